@@ -0,0 +1,129 @@
+/**
+ * @file    LuBanCat_Clock.h
+ * @brief   鲁班猫上位机（Linux）侧时钟同步
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+#ifndef __HOST_LUBANCAT_CLOCK_H
+#define __HOST_LUBANCAT_CLOCK_H
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "LuBanCat_Host.h"
+#include "Clock_Sync.h"
+#include "Communication_Sync.h"
+
+/* 类定义 --------------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   时钟同步类（请求方）
+ *          在 Class_LuBanCat_Host 上注册保留包 COM_PACKET_SYNC，Sync 每 COM_SYNC_PERIOD 发送一次请求并立即 Flush
+ *          （请求帧的帧时间戳即 T1），请求中带上一次交换的 T1、T4 供下位机补全同一组交换；
+ *          收到应答时 T4 取 read 返回时刻减去应答帧及同次 read 中其后字节的线上时间（折算回帧起始时刻，需 Set_Baud_Rate 与链路一致），
+ *          以 Class_Clock_Sync 估计下位机时钟，To_Host 把下位机帧时间戳（Get_Rx_Timestamp）映射为本端时刻；
+ *          Sync 宜在一轮发送开始、写入其余帧之前调用，使请求不排在其他帧之后（排队时延虽可被最小时延滤波剔除，但会减少有效交换）；
+ *          剩余误差主要来自USB转串口等上下行不对称的时延，最小时延滤波只能剔除排队造成的部分
+ */
+class Class_LuBanCat_Clock
+{
+public:
+    /* 函数 */
+    bool Attach(Class_LuBanCat_Host * __Host, uint32_t __Baud_Rate);
+    void Set_Baud_Rate(uint32_t __Baud_Rate);
+    void Reset();
+    bool Sync();
+
+    inline bool Get_Valid();
+    inline uint32_t To_Host(uint32_t __MCU_Time);
+    inline uint32_t To_MCU(uint32_t __Host_Time);
+    inline Class_Clock_Sync * Get_Clock();
+    inline uint32_t Get_Request_Number();
+    inline uint32_t Get_Reply_Number();
+protected:
+    /* 函数 */
+    static void Receive(const void * __Data, uint8_t __Length, void * __Context);
+
+    /* 常量 */
+    Class_LuBanCat_Host * Host = nullptr;       /*!< 所属上位机协议对象 */
+    double Byte_Time = 0.0;                     /*!< 每字节线上时间 (us) */
+
+    /* 读写变量 */
+    uint32_t Request_Number = 0U;               /*!< 已发送请求数 */
+    uint32_t Reply_Number = 0U;                 /*!< 有效应答数 */
+
+    /* 内部变量 */
+    Class_Clock_Sync Clock;                     /*!< 下位机时钟同步 */
+    bool Started = false;                       /*!< 已发送过请求 */
+    bool Pending = false;                       /*!< 请求待应答 */
+    uint8_t Sequence = 0U;                      /*!< 当前交换序号 */
+    uint32_t Origin = 0U;                       /*!< 当前交换的 T1 (us) */
+    uint8_t Previous = COM_SYNC_NONE;           /*!< 已完成、尚未告知下位机的交换序号 */
+    uint32_t Previous_Origin = 0U;              /*!< 该交换的 T1 (us) */
+    uint32_t Previous_Receive = 0U;             /*!< 该交换的 T4 (us) */
+};
+
+/* 接口函数定义 --------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   获取是否已同步
+ *
+ * @return  bool    是否已同步（未同步时映射函数原样返回）
+ */
+bool Class_LuBanCat_Clock::Get_Valid()
+{
+    return (this->Clock.Get_Valid());
+}
+
+/**
+ * @brief   下位机时刻映射为本端时刻
+ *
+ * @param   __MCU_Time  下位机时刻 (us，如帧时间戳)
+ * @return  uint32_t    本端时刻 (us, Class_LuBanCat_Host::Get_Time)
+ */
+uint32_t Class_LuBanCat_Clock::To_Host(uint32_t __MCU_Time)
+{
+    return (this->Clock.To_Local(__MCU_Time));
+}
+
+/**
+ * @brief   本端时刻映射为下位机时刻
+ *
+ * @param   __Host_Time 本端时刻 (us, Class_LuBanCat_Host::Get_Time)
+ * @return  uint32_t    下位机时刻 (us)
+ */
+uint32_t Class_LuBanCat_Clock::To_MCU(uint32_t __Host_Time)
+{
+    return (this->Clock.To_Remote(__Host_Time));
+}
+
+/**
+ * @brief   获取下位机时钟同步对象（漂移、往返时延等诊断信息）
+ *
+ * @return  Class_Clock_Sync *  时钟同步对象
+ */
+Class_Clock_Sync * Class_LuBanCat_Clock::Get_Clock()
+{
+    return (&this->Clock);
+}
+
+/**
+ * @brief   获取已发送请求数
+ *
+ * @return  uint32_t    请求数
+ */
+uint32_t Class_LuBanCat_Clock::Get_Request_Number()
+{
+    return (this->Request_Number);
+}
+
+/**
+ * @brief   获取有效应答数
+ *
+ * @return  uint32_t    应答数
+ */
+uint32_t Class_LuBanCat_Clock::Get_Reply_Number()
+{
+    return (this->Reply_Number);
+}
+
+#endif /* HOST_LuBanCat_Clock.h */
@@ -0,0 +1,270 @@
+/**
+ * @file    LuBanCat_Host.h
+ * @brief   鲁班猫上位机（Linux）侧串口协议库
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.2
+ */
+
+#ifndef __HOST_LUBANCAT_HOST_H
+#define __HOST_LUBANCAT_HOST_H
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "Frame_Parser.h"
+#include "Communication_Link.h"
+#include "Communication_LuBanCat.h"
+
+/* 宏定义 --------------------------------------------------------------------------------------------------------------*/
+#define LUBANCAT_HOST_RING_SIZE     8192U   /* 接收环形缓冲区长度（2的幂） */
+#define LUBANCAT_HOST_READ_MAX      (LUBANCAT_HOST_RING_SIZE - 2U * FRAME_MAX_LENGTH)   /* 单次 read 最大字节数 */
+#define LUBANCAT_HOST_TX_SIZE       4096U   /* 发送批缓冲区长度 */
+
+/* 结构体定义 ----------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   接收处理项结构体
+ */
+struct Struct_LuBanCat_Handler
+{
+    void (* Handler)(const void * Data, uint8_t Length,     /*!< 处理函数（nullptr 为未注册） */
+                     void * Context);
+    void * Context;                                         /*!< 处理函数上下文 */
+};
+
+/* 类定义 --------------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   鲁班猫上位机协议类
+ *          包结构体、包类型与帧格式直接取自固件头文件（Communication_LuBanCat.h、Communication_Link.h、Frame_Parser.h），
+ *          编解码复用固件的 Class_Frame_Parser、COBS、CRC 实现，两端不会各自演化；
+ *          Rx：串口以非阻塞方式登记到内部 epoll，可读时直接 read 进环形缓冲区，每次 read 后立即取尽其中的完整帧并按包类型
+ *          分发，处理函数拿到的数据指针指向环形缓冲区本身（零拷贝，仅在返回前有效；跨越环尾或COBS模式时指向解析器内部缓冲区）；
+ *          Tx：Send 只在批缓冲区尾部原地组帧，Flush（或 Poll 开始时）一次 write 发出整批，内核缓冲区满时登记 EPOLLOUT
+ *          并在可写后接续发送；COBS模式与下位机一致，每批前置一个结束符；
+ *          Get_Epoll_FD 可登记到应用自身的事件循环中，可读时调用 Poll(0)；
+ *          时间戳：Send 以 Get_Time（CLOCK_MONOTONIC 微秒，32位回绕）填充帧时间戳，处理函数中可由 Get_Rx_Timestamp
+ *          取得下位机组帧时刻、Get_Rx_Time 取得本端 read 返回时刻，经 Class_LuBanCat_Clock 映射到同一时基
+ */
+class Class_LuBanCat_Host
+{
+public:
+    /* 函数 */
+    ~Class_LuBanCat_Host();
+    bool Init(int __FD, uint32_t __Pack_Head = LUBANCAT_PACK_HEAD, Enum_Frame_Mode __Frame_Mode = Frame_Mode_Head);
+    bool Register(uint8_t __Type, uint8_t __Length,
+                  void (* __Handler)(const void * Data, uint8_t Length, void * Context),
+                  void * __Context = nullptr, bool __Variable = false);
+    template<typename Type, void (* Handler)(const Type * Data, void * Context)>
+    bool Register(uint8_t __Type, void * __Context = nullptr);
+    bool Send(uint8_t __Type, const void * __Data, uint8_t __Length);
+    template<typename Type>
+    bool Send(uint8_t __Type, const Type & __Data);
+    bool Flush();
+    int Poll(int __Timeout);
+    void Reset();
+
+    static uint32_t Get_Time();
+    inline int Get_Epoll_FD();
+    inline Enum_Frame_Mode Get_Frame_Mode();
+    inline uint32_t Get_Frame_Number();
+    inline uint32_t Get_Error_Number();
+    inline uint32_t Get_Skip_Number();
+    inline uint32_t Get_Tx_Frame_Number();
+    inline uint32_t Get_Tx_Full_Number();
+    inline uint32_t Get_Tx_Pending();
+    inline uint32_t Get_Tx_Time();
+    inline uint32_t Get_Rx_Time();
+    inline uint32_t Get_Rx_Timestamp();
+    inline uint32_t Get_Rx_Trailing();
+protected:
+    /* 函数 */
+    int Receive();
+    void Set_Writable(bool __Writable);
+
+    /* 常量 */
+    int FD = -1;                                /*!< 串口文件描述符（不持有） */
+    int Epoll_FD = -1;                          /*!< epoll 文件描述符 */
+    uint32_t Pack_Head;                         /*!< 包头 (4byte) */
+    Enum_Frame_Mode Frame_Mode;                 /*!< 分帧方式 */
+    Struct_LuBanCat_Handler Handler_List[256];  /*!< 包类型 -> 接收处理项 */
+
+    /* 读写变量 */
+    uint8_t Ring[LUBANCAT_HOST_RING_SIZE];      /*!< 接收环形缓冲区 */
+    uint8_t Buffer_Tx[LUBANCAT_HOST_TX_SIZE];   /*!< 发送批缓冲区 */
+    uint32_t Tx_Frame_Number = 0U;              /*!< 已组帧数 */
+    uint32_t Tx_Full_Number = 0U;               /*!< 批缓冲区满丢帧次数 */
+
+    /* 内部变量 */
+    Class_Frame_Parser Parser;                  /*!< Rx流式帧解析器 */
+    uint16_t Ring_Write = 0U;                   /*!< 环形缓冲区写指针 */
+    uint32_t Tx_Read = 0U;                      /*!< 批缓冲区已写出位置 */
+    uint32_t Tx_Write = 0U;                     /*!< 批缓冲区组帧位置 */
+    bool Writable = false;                      /*!< 已登记 EPOLLOUT */
+    uint32_t Tx_Time = 0U;                      /*!< 最近一次组帧的帧时间戳 (us) */
+    uint32_t Rx_Time = 0U;                      /*!< 最近一次 read 返回时刻 (us) */
+    uint32_t Rx_Timestamp = 0U;                 /*!< 当前分发帧的帧时间戳 (us, 下位机时钟) */
+};
+
+/* 接口函数定义 --------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   注册接收包类型（数据长度取结构体大小）
+ *
+ * @tparam  Type        数据结构体（需 __packed）
+ * @tparam  Handler     接收处理函数
+ * @param   __Type      包类型
+ * @param   __Context   处理函数上下文
+ * @return  bool        是否成功
+ */
+template<typename Type, void (* Handler)(const Type * Data, void * Context)>
+bool Class_LuBanCat_Host::Register(uint8_t __Type, void * __Context)
+{
+    static_assert(sizeof(Type) + FRAME_OVERHEAD <= FRAME_MAX_LENGTH, "LuBanCat packet exceeds FRAME_MAX_LENGTH");
+
+    struct Adapter
+    {
+        static void Call(const void * __Data, uint8_t __Length, void * __Data_Context)
+        {
+            (void) __Length;
+            Handler((const Type *) __Data, __Data_Context);
+        }
+    };
+
+    return (this->Register(__Type, (uint8_t) sizeof(Type), &Adapter::Call, __Context));
+}
+
+/**
+ * @brief   组帧并加入发送批（数据长度取结构体大小）
+ *
+ * @tparam  Type        数据结构体（需 __packed）
+ * @param   __Type      包类型
+ * @param   __Data      数据
+ * @return  bool        是否成功
+ */
+template<typename Type>
+bool Class_LuBanCat_Host::Send(uint8_t __Type, const Type & __Data)
+{
+    static_assert(sizeof(Type) + FRAME_OVERHEAD <= FRAME_MAX_LENGTH, "LuBanCat packet exceeds FRAME_MAX_LENGTH");
+
+    return (this->Send(__Type, &__Data, (uint8_t) sizeof(Type)));
+}
+
+/**
+ * @brief   获取 epoll 文件描述符
+ *
+ * @return  int     文件描述符
+ */
+int Class_LuBanCat_Host::Get_Epoll_FD()
+{
+    return (this->Epoll_FD);
+}
+
+/**
+ * @brief   获取分帧方式
+ *
+ * @return  Enum_Frame_Mode     分帧方式
+ */
+Enum_Frame_Mode Class_LuBanCat_Host::Get_Frame_Mode()
+{
+    return (this->Frame_Mode);
+}
+
+/**
+ * @brief   获取解析成功帧数
+ *
+ * @return  uint32_t    帧数
+ */
+uint32_t Class_LuBanCat_Host::Get_Frame_Number()
+{
+    return (this->Parser.Get_Frame_Number());
+}
+
+/**
+ * @brief   获取长度、CRC校验错误次数
+ *
+ * @return  uint32_t    错误次数
+ */
+uint32_t Class_LuBanCat_Host::Get_Error_Number()
+{
+    return (this->Parser.Get_Error_Number());
+}
+
+/**
+ * @brief   获取重同步丢弃字节数
+ *
+ * @return  uint32_t    字节数
+ */
+uint32_t Class_LuBanCat_Host::Get_Skip_Number()
+{
+    return (this->Parser.Get_Skip_Number());
+}
+
+/**
+ * @brief   获取已组帧数
+ *
+ * @return  uint32_t    帧数
+ */
+uint32_t Class_LuBanCat_Host::Get_Tx_Frame_Number()
+{
+    return (this->Tx_Frame_Number);
+}
+
+/**
+ * @brief   获取批缓冲区满丢帧次数
+ *
+ * @return  uint32_t    次数
+ */
+uint32_t Class_LuBanCat_Host::Get_Tx_Full_Number()
+{
+    return (this->Tx_Full_Number);
+}
+
+/**
+ * @brief   获取批缓冲区中尚未写出的字节数
+ *
+ * @return  uint32_t    字节数
+ */
+uint32_t Class_LuBanCat_Host::Get_Tx_Pending()
+{
+    return (this->Tx_Write - this->Tx_Read);
+}
+
+/**
+ * @brief   获取最近一次组帧的帧时间戳
+ *
+ * @return  uint32_t    组帧时刻 (us)
+ */
+uint32_t Class_LuBanCat_Host::Get_Tx_Time()
+{
+    return (this->Tx_Time);
+}
+
+/**
+ * @brief   获取当前分发帧的接收时刻（在处理函数中调用）
+ *
+ * @return  uint32_t    所在 read 返回时刻 (us)
+ */
+uint32_t Class_LuBanCat_Host::Get_Rx_Time()
+{
+    return (this->Rx_Time);
+}
+
+/**
+ * @brief   获取当前分发帧的帧时间戳（在处理函数中调用）
+ *
+ * @return  uint32_t    下位机组帧时刻 (us, 下位机时钟)
+ */
+uint32_t Class_LuBanCat_Host::Get_Rx_Timestamp()
+{
+    return (this->Rx_Timestamp);
+}
+
+/**
+ * @brief   获取当前分发帧之后同一次 read 读入的字节数（在处理函数中调用，用于把 Get_Rx_Time 折算回帧结束时刻）
+ *
+ * @return  uint32_t    字节数
+ */
+uint32_t Class_LuBanCat_Host::Get_Rx_Trailing()
+{
+    return (this->Parser.Get_Pending_Length(this->Ring_Write));
+}
+
+#endif /* HOST_LuBanCat_Host.h */
@@ -0,0 +1,115 @@
+/**
+ * @file    LuBanCat_Telemetry.h
+ * @brief   鲁班猫上位机（Linux）侧压缩遥测接收
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+#ifndef __HOST_LUBANCAT_TELEMETRY_H
+#define __HOST_LUBANCAT_TELEMETRY_H
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "LuBanCat_Host.h"
+#include "Telemetry_Codec.h"
+
+/* 类定义 --------------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   压缩遥测接收类
+ *          在 Class_LuBanCat_Host 上注册变长包 LuBanCat_Packet_Telemetry，解码后调用用户处理函数；
+ *          收到关键帧时回复 LuBanCat_Packet_Telemetry_Ack（随下一次 Poll 或 Flush 发出），下位机据此切换差分基准；
+ *          引用的关键帧未收到（上位机启动、丢帧）的差分帧被丢弃，至多一个关键帧周期后恢复
+ */
+class Class_LuBanCat_Telemetry
+{
+public:
+    /* 函数 */
+    Class_LuBanCat_Telemetry();
+    bool Attach(Class_LuBanCat_Host * __Host,
+                void (* __Handler)(const Struct_Telemetry_LuBanCat * Data, void * Context),
+                void * __Context = nullptr);
+    void Reset();
+
+    inline uint32_t Get_Frame_Number();
+    inline uint32_t Get_Keyframe_Number();
+    inline uint32_t Get_Invalid_Number();
+    inline uint32_t Get_Byte_Number();
+    inline float Get_Compression_Ratio();
+protected:
+    /* 函数 */
+    static void Receive(const void * __Data, uint8_t __Length, void * __Context);
+
+    /* 常量 */
+    Class_LuBanCat_Host * Host = nullptr;       /*!< 所属上位机协议对象 */
+    void (* Handler)                            /*!< 用户处理函数 */
+         (const Struct_Telemetry_LuBanCat * Data, void * Context) = nullptr;
+    void * Context = nullptr;                   /*!< 用户处理函数上下文 */
+
+    /* 读写变量 */
+    uint32_t Frame_Number = 0U;                 /*!< 解码成功帧数 */
+    uint32_t Keyframe_Number = 0U;              /*!< 其中关键帧数 */
+    uint32_t Invalid_Number = 0U;               /*!< 格式错误或缺少关键帧而丢弃的帧数 */
+    uint32_t Byte_Number = 0U;                  /*!< 解码成功帧的数据字节数 */
+
+    /* 内部变量 */
+    Class_Telemetry_Decoder Decoder;            /*!< 解码器 */
+};
+
+/* 接口函数定义 --------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   获取解码成功帧数
+ *
+ * @return  uint32_t    帧数
+ */
+uint32_t Class_LuBanCat_Telemetry::Get_Frame_Number()
+{
+    return (this->Frame_Number);
+}
+
+/**
+ * @brief   获取关键帧数
+ *
+ * @return  uint32_t    帧数
+ */
+uint32_t Class_LuBanCat_Telemetry::Get_Keyframe_Number()
+{
+    return (this->Keyframe_Number);
+}
+
+/**
+ * @brief   获取丢弃帧数
+ *
+ * @return  uint32_t    帧数
+ */
+uint32_t Class_LuBanCat_Telemetry::Get_Invalid_Number()
+{
+    return (this->Invalid_Number);
+}
+
+/**
+ * @brief   获取解码成功帧的数据字节数
+ *
+ * @return  uint32_t    字节数
+ */
+uint32_t Class_LuBanCat_Telemetry::Get_Byte_Number()
+{
+    return (this->Byte_Number);
+}
+
+/**
+ * @brief   获取压缩比（按 float 原样发送的数据长度 / 实际数据长度）
+ *
+ * @return  float       压缩比（尚未收到时为0）
+ */
+float Class_LuBanCat_Telemetry::Get_Compression_Ratio()
+{
+    if (this->Byte_Number == 0U)
+    {
+        return (0.0f);
+    }
+
+    return ((float) ((double) this->Frame_Number * sizeof(Struct_Telemetry_LuBanCat) / this->Byte_Number));
+}
+
+#endif /* HOST_LuBanCat_Telemetry.h */
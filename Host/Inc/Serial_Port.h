@@ -0,0 +1,60 @@
+/**
+ * @file    Serial_Port.h
+ * @brief   Linux串口封装（非阻塞，termios2 任意波特率）
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+#ifndef __HOST_SERIAL_PORT_H
+#define __HOST_SERIAL_PORT_H
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* 类定义 --------------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   串口类
+ *          以 O_NONBLOCK 打开，原始模式 8N1，无流控；termios2 + BOTHER 可设置任意波特率（如 2625000），
+ *          不受 Bxxxx 常量限制；伪终端（pty）同样适用，此时波特率仅作记录
+ */
+class Class_Serial_Port
+{
+public:
+    /* 函数 */
+    ~Class_Serial_Port();
+    bool Open(const char * __Device, uint32_t __Baud_Rate);
+    void Close();
+    bool Set_Baud_Rate(uint32_t __Baud_Rate);
+
+    inline int Get_FD();
+    inline uint32_t Get_Baud_Rate();
+protected:
+    /* 读写变量 */
+    int FD = -1;                        /*!< 文件描述符 */
+    uint32_t Baud_Rate = 0U;            /*!< 当前波特率 (bit/s) */
+};
+
+/* 接口函数定义 --------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   获取文件描述符
+ *
+ * @return  int     文件描述符（未打开时为 -1）
+ */
+int Class_Serial_Port::Get_FD()
+{
+    return (this->FD);
+}
+
+/**
+ * @brief   获取当前波特率
+ *
+ * @return  uint32_t    波特率 (bit/s)
+ */
+uint32_t Class_Serial_Port::Get_Baud_Rate()
+{
+    return (this->Baud_Rate);
+}
+
+#endif /* HOST_Serial_Port.h */
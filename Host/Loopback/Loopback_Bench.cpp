@@ -0,0 +1,420 @@
+/**
+ * @file    Loopback_Bench.cpp
+ * @brief   伪终端回环测试：固件通讯模块（Class_CustomCOM，x86编译）<-> 上位机协议库
+ *          用法：Loopback_Bench [--cobs] [--baud <N>] [--unpaced] [--batch <N>] [--seconds <N>] [--blast] [--drift <ppm>]
+ *          下位机线程以 1kHz 系统心跳运行固件的 DataProcess / TxProcess / AliveCheck / LinkCheck / Schedule，
+ *          串口由伪终端主端仿真（默认按波特率折算收发耗时，--unpaced 时立即完成）；下位机时钟在仿真时钟上加偏移
+ *          （跨越32位回绕）并按 --drift 设定频差（默认 50ppm）；
+ *          上位机线程在从端使用 Class_LuBanCat_Host：每轮以一次 Flush 发送 --batch 条底盘运动指令（速度X为序号），
+ *          下位机在下一个心跳以里程计包回显最新指令，测量往返时间；同时统计固件遥测调度的上行帧率，
+ *          压缩遥测经 Class_LuBanCat_Telemetry 解码（关键帧确认回路经由真实链路），统计压缩比；
+ *          Class_LuBanCat_Clock 每 COM_SYNC_PERIOD 发起一次时钟同步，同步后统计两端的对齐误差：上位机侧为遥测帧时间戳
+ *          映射到上位机时钟后与真实时刻之差，下位机侧为每个心跳 Get_Host_Time 与真实上位机时刻之差
+ *          （--unpaced 时线上时间为0，按波特率折算的接收时刻早于发送时刻，交换全部被丢弃，不做统计）；
+ *          --blast 时下位机每次循环都将发送队列填满（底盘电机转速包），测试上行满载帧率与队列满计数；
+ *          此时回显、调度遥测与时钟同步应答均因队列无空槽被拒绝，往返全部超时、时钟不同步属预期行为；
+ *          往返丢失（--blast 除外）或任一方向有校验失败的帧时返回 1
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.3
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "Communication.h"
+#include "Chassis.h"
+#include "LuBanCat_Host.h"
+#include "LuBanCat_Clock.h"
+#include "LuBanCat_Telemetry.h"
+#include "Serial_Port.h"
+#include "User_Time.h"
+
+#include <fcntl.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <sys/prctl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+/* 宏定义 --------------------------------------------------------------------------------------------------------------*/
+#define LOOPBACK_TICK           1000000U        /* 系统心跳周期 (ns) */
+#define LOOPBACK_ECHO_TIMEOUT   100U            /* 单轮回显超时 (ms) */
+#define LOOPBACK_CLOCK_OFFSET   0xFFF00000U     /* 起始时下位机时钟读数 (us，约1s后回绕) */
+#define LOOPBACK_CLOCK_WARMUP   (2U * CLOCK_SYNC_FILTER + 1U)   /* 开始统计对齐误差前的有效交换次数（至少三个拟合点） */
+
+/* 结构体定义 ----------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   上位机接收统计结构体
+ */
+struct Struct_Bench_Rx
+{
+    uint32_t Motor_Number = 0U;         /*!< 底盘电机转速包数 */
+    uint32_t Odometry_Number = 0U;      /*!< 里程计包数 */
+    uint32_t Diagnostic_Number = 0U;    /*!< 诊断信息包数 */
+    float Echo = 0.0f;                  /*!< 最近一次里程计回显的序号 */
+    Struct_TxData_Diagnostic_LuBanCat Diagnostic = {};  /*!< 最近一次诊断信息 */
+};
+
+/**
+ * @brief   上位机侧时钟对齐统计结构体
+ */
+struct Struct_Bench_Clock
+{
+    Class_LuBanCat_Host * Host;         /*!< 上位机协议对象 */
+    Class_LuBanCat_Clock * Clock;       /*!< 时钟同步对象 */
+    std::vector<uint64_t> Error;        /*!< 遥测帧时间戳映射误差绝对值 (ns) */
+};
+
+/* 全局变量创建 --------------------------------------------------------------------------------------------------------*/
+Class_Chassis_Macnum Committee_Chariot;
+
+static std::atomic<bool> Running(true);
+static bool Blast = false;
+static std::vector<uint64_t> MCU_Clock_Error;   /* 下位机侧对齐误差绝对值 (ns，仅下位机线程写入) */
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/************************************************************************************************************************
+ * @brief   下位机系统心跳（对应固件 TIM6 中断中的通讯部分）
+ *
+ * @param   __Command_Number    上一心跳时的底盘指令数（有新指令时回显里程计）
+ ***********************************************************************************************************************/
+static void MCU_Tick(uint32_t & __Command_Number)
+{
+    COM_LuBanCat.AliveCheck(100);
+    COM_LuBanCat.LinkCheck();
+
+    if (Committee_Chariot.Command_Number != __Command_Number)
+    {
+        __Command_Number = Committee_Chariot.Command_Number;
+        COM_LuBanCat.DataSend(LuBanCat_Packet_Odometry);
+    }
+
+    COM_LuBanCat.Schedule();
+
+    /* 下位机侧对齐误差：同一仿真时刻的下位机时钟读数经 Get_Host_Time 映射，与上位机时钟读数比较 */
+    if (COM_LuBanCat.Get_Clock()->Get_Exchange_Number() >= LOOPBACK_CLOCK_WARMUP)
+    {
+        uint64_t now = UART_Sim_Now();
+        int32_t error = (int32_t) (COM_LuBanCat.Get_Host_Time(Time_Sim_At(now)) - (uint32_t) (now / 1000U));
+
+        MCU_Clock_Error.push_back((uint64_t) std::abs((int64_t) error) * 1000U);
+    }
+}
+
+/************************************************************************************************************************
+ * @brief   下位机线程：等待串口事件或下一个系统心跳，按固件中断的调用方式分发
+ *
+ * @param   __FD    伪终端主端
+ ***********************************************************************************************************************/
+static void MCU_Thread(int __FD)
+{
+    UART_HandleTypeDef * huart = UART3_Manage_Object.huart;
+    uint64_t next_tick = UART_Sim_Now();
+    uint32_t command_number = 0U;
+
+    /* 定时唤醒精度（默认 50us 的定时器松弛会在帧间引入空闲） */
+    prctl(PR_SET_TIMERSLACK, 1UL);
+
+    while (Running.load(std::memory_order_relaxed))
+    {
+        uint64_t now = UART_Sim_Now();
+        uint64_t wake = next_tick;
+        struct pollfd fd = {__FD, (short) ((huart->Rx_Pending == 0U) ? POLLIN : 0), 0};
+
+        if (huart->Rx_Pending != 0U && huart->Rx_Done < wake)
+        {
+            /* 已读入的字节到达接收时刻时唤醒 */
+            wake = huart->Rx_Done;
+        }
+
+        if (huart->gState == HAL_UART_STATE_BUSY_TX)
+        {
+            /* 发送到时后仍未写出（对端未读取）时等待可写 */
+            if (huart->Tx_Done <= now)
+            {
+                fd.events |= POLLOUT;
+            }
+            else if (huart->Tx_Done < wake)
+            {
+                wake = huart->Tx_Done;
+            }
+        }
+        if (wake > now)
+        {
+            struct timespec timeout = {(time_t) ((wake - now) / 1000000000U), (long) ((wake - now) % 1000000000U)};
+
+            ppoll(&fd, 1, &timeout, nullptr);
+        }
+
+        /* 接收事件（HAL_UARTEx_RxEventCallback） */
+        now = UART_Sim_Now();
+        while (UART_Sim_Rx(&UART3_Manage_Object, now))
+        {
+            COM_LuBanCat.DataProcess();
+        }
+
+        /* 发送完成（HAL_UART_TxCpltCallback） */
+        now = UART_Sim_Now();
+        if (UART_Sim_Tx(&UART3_Manage_Object, now))
+        {
+            COM_LuBanCat.TxProcess();
+        }
+        if (Blast)
+        {
+            while (COM_LuBanCat.DataSend(LuBanCat_Packet_Motor))
+            {
+            }
+        }
+
+        /* 系统心跳（落后超过10个心跳时不再追赶） */
+        if (now >= next_tick)
+        {
+            MCU_Tick(command_number);
+            next_tick = (now - next_tick > 10U * LOOPBACK_TICK) ? (now + LOOPBACK_TICK) : (next_tick + LOOPBACK_TICK);
+        }
+    }
+}
+
+/************************************************************************************************************************
+ * @brief   上位机接收处理：底盘电机转速
+ ***********************************************************************************************************************/
+static void Host_Motor(const Struct_TxData_LuBanCat * Data, void * Context)
+{
+    (void) Data;
+    ((Struct_Bench_Rx *) Context)->Motor_Number += 1U;
+}
+
+/************************************************************************************************************************
+ * @brief   上位机接收处理：里程计（电机0输出轴角度为回显的指令序号）
+ ***********************************************************************************************************************/
+static void Host_Odometry(const Struct_TxData_Odometry_LuBanCat * Data, void * Context)
+{
+    Struct_Bench_Rx * rx = (Struct_Bench_Rx *) Context;
+
+    rx->Odometry_Number += 1U;
+    rx->Echo = Data->Wheel_Angle[0];
+}
+
+/************************************************************************************************************************
+ * @brief   上位机接收处理：诊断信息
+ ***********************************************************************************************************************/
+static void Host_Diagnostic(const Struct_TxData_Diagnostic_LuBanCat * Data, void * Context)
+{
+    Struct_Bench_Rx * rx = (Struct_Bench_Rx *) Context;
+
+    rx->Diagnostic_Number += 1U;
+    rx->Diagnostic = *Data;
+}
+
+/************************************************************************************************************************
+ * @brief   上位机接收处理：压缩遥测（帧时间戳映射到上位机时钟，与仿真给出的真实时刻比较）
+ ***********************************************************************************************************************/
+static void Host_Telemetry(const Struct_Telemetry_LuBanCat * Data, void * Context)
+{
+    Struct_Bench_Clock * clock = (Struct_Bench_Clock *) Context;
+
+    (void) Data;
+    if (clock->Clock->Get_Clock()->Get_Exchange_Number() < LOOPBACK_CLOCK_WARMUP)
+    {
+        return;
+    }
+
+    uint32_t timestamp = clock->Host->Get_Rx_Timestamp();
+    uint32_t truth = (uint32_t) (Time_Sim_Host(timestamp, UART_Sim_Now()) / 1000U);
+    int32_t error = (int32_t) (clock->Clock->To_Host(timestamp) - truth);
+
+    clock->Error.push_back((uint64_t) std::abs((int64_t) error) * 1000U);
+}
+
+/************************************************************************************************************************
+ * @brief   取百分位数
+ *
+ * @param   __Sample    已排序样本
+ * @param   __Percent   百分位
+ * @return  double      样本值 (us)
+ ***********************************************************************************************************************/
+static double Percentile(const std::vector<uint64_t> & __Sample, uint32_t __Percent)
+{
+    if (__Sample.empty())
+    {
+        return (0.0);
+    }
+
+    return ((double) __Sample[(__Sample.size() - 1U) * __Percent / 100U] / 1000.0);
+}
+
+/************************************************************************************************************************
+ * @brief   主函数
+ ***********************************************************************************************************************/
+int main(int argc, char ** argv)
+{
+    Enum_Frame_Mode mode = Frame_Mode_Head;
+    uint32_t baud_rate = COM_LINK_BAUD_RATE_BASE;
+    bool pace = true;
+    uint32_t batch = 1U;
+    uint32_t seconds = 5U;
+    double drift = 50.0;
+
+    setvbuf(stdout, nullptr, _IOLBF, 0);
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--cobs") == 0)
+        {
+            mode = Frame_Mode_COBS;
+        }
+        else if (strcmp(argv[i], "--unpaced") == 0)
+        {
+            pace = false;
+        }
+        else if (strcmp(argv[i], "--blast") == 0)
+        {
+            Blast = true;
+        }
+        else if (strcmp(argv[i], "--baud") == 0 && i + 1 < argc)
+        {
+            baud_rate = (uint32_t) strtoul(argv[++i], nullptr, 0);
+        }
+        else if (strcmp(argv[i], "--batch") == 0 && i + 1 < argc)
+        {
+            batch = std::max(1UL, strtoul(argv[++i], nullptr, 0));
+        }
+        else if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc)
+        {
+            seconds = (uint32_t) strtoul(argv[++i], nullptr, 0);
+        }
+        else if (strcmp(argv[i], "--drift") == 0 && i + 1 < argc)
+        {
+            drift = strtod(argv[++i], nullptr);
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [--cobs] [--baud <N>] [--unpaced] [--batch <N>] [--seconds <N>] [--blast] "
+                    "[--drift <ppm>]\n", argv[0]);
+            return (2);
+        }
+    }
+
+    /* 伪终端：主端为下位机串口，从端为上位机串口 */
+    int master = posix_openpt(O_RDWR | O_NOCTTY);
+
+    if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0)
+    {
+        perror("posix_openpt");
+        return (1);
+    }
+    fcntl(master, F_SETFL, fcntl(master, F_GETFL) | O_NONBLOCK);
+
+    Class_Serial_Port serial;
+    Class_LuBanCat_Host host;
+    Class_LuBanCat_Telemetry telemetry;
+    Class_LuBanCat_Clock clock;
+    Struct_Bench_Rx rx;
+    Struct_Bench_Clock clock_error = {&host, &clock, {}};
+
+    if (!serial.Open(ptsname(master), baud_rate) || !host.Init(serial.Get_FD(), LUBANCAT_PACK_HEAD, mode))
+    {
+        perror(ptsname(master));
+        return (1);
+    }
+    host.Register<Struct_TxData_LuBanCat, Host_Motor>(LuBanCat_Packet_Motor, &rx);
+    host.Register<Struct_TxData_Odometry_LuBanCat, Host_Odometry>(LuBanCat_Packet_Odometry, &rx);
+    host.Register<Struct_TxData_Diagnostic_LuBanCat, Host_Diagnostic>(LuBanCat_Packet_Diagnostic, &rx);
+    telemetry.Attach(&host, Host_Telemetry, &clock_error);
+    clock.Attach(&host, baud_rate);
+
+    /* 下位机 */
+    UART_Sim_Attach(&UART3_Manage_Object, master, baud_rate, pace);
+    Time_Sim_Set(LOOPBACK_CLOCK_OFFSET, drift);
+    COM_LuBanCat.Init(LUBANCAT_PACK_HEAD, mode);
+    std::thread mcu(MCU_Thread, master);
+
+    /* 上位机：指令 -> 回显往返 */
+    std::vector<uint64_t> rtt;
+    uint32_t sequence = 0U;
+    uint32_t lost = 0U;
+    uint64_t start = UART_Sim_Now();
+    uint64_t end = start + (uint64_t) seconds * 1000000000U;
+
+    for (uint64_t now = start; now < end; now = UART_Sim_Now())
+    {
+        /* 时钟同步请求先于本轮命令写出（排在命令之后会计入排队时延） */
+        clock.Sync();
+        for (uint32_t i = 0; i < batch; i++)
+        {
+            Struct_RxData_LuBanCat command = {Chassis_Run, (float) ++sequence, 0.0f, 0.0f};
+
+            host.Send(LuBanCat_Packet_Chassis, command);
+        }
+
+        uint64_t sent = UART_Sim_Now();
+        uint64_t deadline = sent + LOOPBACK_ECHO_TIMEOUT * 1000000U;
+
+        host.Flush();
+        while (rx.Echo != (float) sequence && now < deadline)
+        {
+            if (host.Poll((int) ((deadline - now) / 1000000U) + 1) < 0)
+            {
+                perror("poll");
+                deadline = now;
+            }
+            now = UART_Sim_Now();
+        }
+
+        if (rx.Echo == (float) sequence)
+        {
+            rtt.push_back(now - sent);
+        }
+        else
+        {
+            lost += 1U;
+        }
+    }
+
+    double elapsed = (double) (UART_Sim_Now() - start) / 1e9;
+
+    Running = false;
+    mcu.join();
+
+    /* 统计 */
+    std::sort(rtt.begin(), rtt.end());
+    std::sort(clock_error.Error.begin(), clock_error.Error.end());
+    std::sort(MCU_Clock_Error.begin(), MCU_Clock_Error.end());
+    printf("%s framing, %u baud%s, batch %u%s, %.1f s\n", (mode == Frame_Mode_COBS) ? "cobs" : "head", baud_rate,
+           pace ? "" : " (unpaced)", batch, Blast ? ", blast" : "", elapsed);
+    printf("round trip: %zu ok, %u lost, p50 %.0f us, p99 %.0f us, max %.0f us\n", rtt.size(), lost,
+           Percentile(rtt, 50U), Percentile(rtt, 99U), Percentile(rtt, 100U));
+    printf("downlink:   %.0f frames/s sent, %.0f frames/s handled by firmware, %u firmware rx errors\n",
+           host.Get_Tx_Frame_Number() / elapsed, Committee_Chariot.Command_Number / elapsed,
+           COM_LuBanCat.Get_Error_Number());
+    printf("uplink:     %.0f frames/s (motor %u, odometry %u, diagnostic %u, telemetry %u), %u errors, "
+           "%u bytes skipped\n", host.Get_Frame_Number() / elapsed, rx.Motor_Number, rx.Odometry_Number,
+           rx.Diagnostic_Number, telemetry.Get_Frame_Number(), host.Get_Error_Number(), host.Get_Skip_Number());
+    printf("telemetry:  %u keyframes, %u dropped, mean %.1f B, compression %.2fx vs %zu B of float\n",
+           telemetry.Get_Keyframe_Number(), telemetry.Get_Invalid_Number(),
+           (double) telemetry.Get_Byte_Number() / (telemetry.Get_Frame_Number() ? telemetry.Get_Frame_Number() : 1U),
+           telemetry.Get_Compression_Ratio(), sizeof(Struct_Telemetry_LuBanCat));
+    printf("clock:      %u requests, %u replies, drift %+.2f ppm (set %+.2f), min rtt %u us, %u steps\n",
+           clock.Get_Request_Number(), clock.Get_Reply_Number(), clock.Get_Clock()->Get_Drift() * 1e6, drift,
+           clock.Get_Clock()->Get_Delay(), clock.Get_Clock()->Get_Step_Number());
+    printf("alignment:  host %zu frames p50 %.0f us, p99 %.0f us, max %.0f us; "
+           "firmware %zu ticks p50 %.0f us, p99 %.0f us, max %.0f us\n",
+           clock_error.Error.size(), Percentile(clock_error.Error, 50U), Percentile(clock_error.Error, 99U),
+           Percentile(clock_error.Error, 100U), MCU_Clock_Error.size(), Percentile(MCU_Clock_Error, 50U),
+           Percentile(MCU_Clock_Error, 99U), Percentile(MCU_Clock_Error, 100U));
+    printf("firmware:   link utilization %.1f%%, tx full %u, overrun %u\n",
+           COM_LuBanCat.Get_Link_Utilization() * 100.0f, COM_LuBanCat.Get_Tx_Full_Number(),
+           COM_LuBanCat.Get_Overrun_Number());
+
+    /* 丢帧（--blast 时为预期行为）或任一方向校验失败时返回失败（ctest 判定） */
+    bool ok = (lost == 0U || Blast) && host.Get_Error_Number() == 0U && COM_LuBanCat.Get_Error_Number() == 0U;
+
+    printf("result:     %s\n", ok ? "ok" : "FAIL");
+
+    close(master);
+    return (ok ? 0 : 1);
+}
@@ -0,0 +1,120 @@
+/**
+ * @file    Chassis.h
+ * @brief   底盘仿真（回环测试用，替换固件 User/2-FML/Inc/Chassis.h）
+ *          仅保留通讯模块用到的接口；收到的运动指令直接作为电机输出轴角度回报，上行里程计即为下行指令的回显
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.1
+ */
+
+#ifndef __FML_CHASSIS_H
+#define __FML_CHASSIS_H
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "Relay_Tune.h"
+
+/* 枚举类型定义 --------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   底盘状态枚举类型（与固件一致）
+ */
+enum Enum_ChassisState : uint8_t
+{
+    Chassis_Disable = 0U,   /*!< 底盘失能 */
+    Chassis_Suspend = 1U,   /*!< 底盘悬空 */
+    Chassis_Brake   = 2U,   /*!< 底盘刹车 */
+    Chassis_Run     = 3U,   /*!< 底盘运行 */
+};
+
+/* 类定义 --------------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   直流电机仿真类
+ */
+class Class_Motor_BDC
+{
+public:
+    /* 变量 */
+    float Angle = 0.0f;                     /*!< 输出轴角度 (rad) */
+    float Omega = 0.0f;                     /*!< 转速 (rad/s) */
+
+    /* 函数 */
+    inline float Get_ActualOmega();
+    inline float Get_TargetOmega();
+    inline float Get_ActualAngle();
+    inline float Get_Duty();
+    inline Enum_Relay_Tune_State Get_AutotuneState();
+};
+
+/**
+ * @brief   麦轮底盘仿真类
+ */
+class Class_Chassis_Macnum
+{
+public:
+    /* 变量 */
+    Class_Motor_BDC Motor_Wheel[4];         /*!< 四轮驱动电机对象 */
+    Enum_ChassisState State = Chassis_Disable;  /*!< 底盘状态 */
+    uint32_t Command_Number = 0U;           /*!< 收到的运动、停止指令数 */
+
+    /* 函数 */
+    inline void Set_Motion(float __Velocity_X, float __Velocity_Y, float __Omega);
+    inline void Set_Stop(Enum_ChassisState __Stop_State);
+    inline Enum_ChassisState Get_State();
+};
+
+/* 变量声明 ------------------------------------------------------------------------------------------------------------*/
+extern Class_Chassis_Macnum Committee_Chariot;
+
+/* 接口函数定义 --------------------------------------------------------------------------------------------------------*/
+float Class_Motor_BDC::Get_ActualOmega()
+{
+    return (this->Omega);
+}
+
+float Class_Motor_BDC::Get_TargetOmega()
+{
+    return (this->Omega);
+}
+
+float Class_Motor_BDC::Get_ActualAngle()
+{
+    return (this->Angle);
+}
+
+float Class_Motor_BDC::Get_Duty()
+{
+    return (0.0f);
+}
+
+Enum_Relay_Tune_State Class_Motor_BDC::Get_AutotuneState()
+{
+    return (Relay_Tune_Idle);
+}
+
+/**
+ * @brief   运动指令：三个分量依次作为前三个电机的输出轴角度
+ */
+void Class_Chassis_Macnum::Set_Motion(float __Velocity_X, float __Velocity_Y, float __Omega)
+{
+    this->State = Chassis_Run;
+    this->Motor_Wheel[0].Angle = __Velocity_X;
+    this->Motor_Wheel[1].Angle = __Velocity_Y;
+    this->Motor_Wheel[2].Angle = __Omega;
+    this->Command_Number += 1U;
+}
+
+/**
+ * @brief   停止指令
+ */
+void Class_Chassis_Macnum::Set_Stop(Enum_ChassisState __Stop_State)
+{
+    this->State = __Stop_State;
+    this->Command_Number += 1U;
+}
+
+Enum_ChassisState Class_Chassis_Macnum::Get_State()
+{
+    return (this->State);
+}
+
+#endif /* FML_Chassis.h */
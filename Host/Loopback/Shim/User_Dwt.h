@@ -0,0 +1,41 @@
+/**
+ * @file    User_Dwt.h
+ * @brief   DWT周期计数器仿真（回环测试用，替换固件 User/4-HAL/Inc/User_Dwt.h）
+ *          x86 下以 TSC 代替，计数值为主机周期数，仅供相对比较
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+#ifndef __HAL_USER_DWT_H
+#define __HAL_USER_DWT_H
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include <stdint.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/* 接口函数定义 --------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   获取周期计数值（32位回绕）
+ */
+inline uint32_t DWT_Get_Cycle(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return ((uint32_t) __rdtsc());
+#else
+    return (0U);
+#endif
+}
+
+/**
+ * @brief   计算两次周期计数值间隔
+ */
+inline uint32_t DWT_Get_Elapsed(uint32_t Start)
+{
+    return (DWT_Get_Cycle() - Start);
+}
+
+#endif  /* HAL_User_Dwt.h */
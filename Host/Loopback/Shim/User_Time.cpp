@@ -0,0 +1,80 @@
+/**
+ * @file    User_Time.cpp
+ * @brief   微秒时基仿真（回环测试用，替换固件 User/4-HAL/Src/User_Time.cpp）
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "User_Time.h"
+#include "User_Uart.h"
+
+/* 全局变量创建 --------------------------------------------------------------------------------------------------------*/
+static uint64_t Time_Epoch = 0U;        /* 仿真起点 (ns, 仿真时钟) */
+static uint32_t Time_Offset = 0U;       /* 仿真起点处的下位机时刻 (us) */
+static double Time_Rate = 1.0;          /* 下位机时钟频率 / 仿真时钟频率 */
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/***********************************************************************************************************************
+ * @brief   微秒时基初始化（仿真：无操作）
+ **********************************************************************************************************************/
+void Time_Init(void)
+{
+}
+
+/***********************************************************************************************************************
+ * @brief   微秒时基更新（仿真：无操作）
+ **********************************************************************************************************************/
+void Time_Update(void)
+{
+}
+
+/***********************************************************************************************************************
+ * @brief   获取当前时刻
+ *
+ * @return  uint32_t    下位机时刻 (us)
+ **********************************************************************************************************************/
+uint32_t Time_Get_us(void)
+{
+    return (Time_Sim_At(UART_Sim_Now()));
+}
+
+/***********************************************************************************************************************
+ * @brief   设置下位机时钟
+ *
+ * @param   Offset      当前时刻对应的下位机时刻 (us)
+ * @param   Drift       下位机时钟频差 (ppm)
+ **********************************************************************************************************************/
+void Time_Sim_Set(uint32_t Offset, double Drift)
+{
+    Time_Epoch = UART_Sim_Now();
+    Time_Offset = Offset;
+    Time_Rate = 1.0 + Drift * 1e-6;
+}
+
+/***********************************************************************************************************************
+ * @brief   仿真时刻对应的下位机时刻
+ *
+ * @param   Now         仿真时刻 (ns, UART_Sim_Now)
+ * @return  uint32_t    下位机时刻 (us)
+ **********************************************************************************************************************/
+uint32_t Time_Sim_At(uint64_t Now)
+{
+    return (Time_Offset + (uint32_t) (int64_t) ((double) (int64_t) (Now - Time_Epoch) * Time_Rate / 1000.0));
+}
+
+/***********************************************************************************************************************
+ * @brief   下位机时刻对应的仿真时刻（Time_Sim_At 的反函数，以 Now 附近展开32位回绕）
+ *
+ * @param   Time        下位机时刻 (us)
+ * @param   Now         参考仿真时刻 (ns，与 Time 相距需小于35min)
+ * @return  uint64_t    仿真时刻 (ns)
+ **********************************************************************************************************************/
+uint64_t Time_Sim_Host(uint32_t Time, uint64_t Now)
+{
+    int32_t delta = (int32_t) (Time - Time_Sim_At(Now));
+
+    return (Now + (uint64_t) (int64_t) ((double) delta * 1000.0 / Time_Rate));
+}
@@ -0,0 +1,27 @@
+/**
+ * @file    User_Time.h
+ * @brief   微秒时基仿真（回环测试用，替换固件 User/4-HAL/Inc/User_Time.h）
+ *          下位机时钟由仿真时钟（CLOCK_MONOTONIC，即上位机时钟）加偏移、乘以频差得到，供回环测试校验时钟同步误差
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+#ifndef __HAL_USER_TIME_H
+#define __HAL_USER_TIME_H
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* 函数声明 ------------------------------------------------------------------------------------------------------------*/
+void Time_Init(void);
+void Time_Update(void);
+uint32_t Time_Get_us(void);
+
+/* 仿真接口 */
+void Time_Sim_Set(uint32_t Offset, double Drift);
+uint32_t Time_Sim_At(uint64_t Now);
+uint64_t Time_Sim_Host(uint32_t Time, uint64_t Now);
+
+#endif  /* HAL_User_Time.h */
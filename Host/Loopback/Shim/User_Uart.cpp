@@ -0,0 +1,240 @@
+/**
+ * @file    User_Uart.cpp
+ * @brief   Uart外设仿真（回环测试用，替换固件 User/4-HAL/Src/User_Uart.cpp）
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.1
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "User_Uart.h"
+
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+
+/* 全局变量创建 --------------------------------------------------------------------------------------------------------*/
+static UART_HandleTypeDef huart3 = {{115200U}, HAL_UART_STATE_READY, -1, false, nullptr, 0U, 0U, 0U, 0U, 0U};
+
+Struct_UART_Manage_Object UART3_Manage_Object = {&huart3, {0U}, {0U}, 0U};
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/***********************************************************************************************************************
+ * @brief   UART发送数据（DMA仿真）
+ * @note    数据在发送完成时刻才写入伪终端（对端读到整帧的时刻与实际线路一致），期间 Data 需保持有效
+ *
+ * @param   UART_Manage_Obj     UART处理结构体指针
+ * @param   Data                待发送数据
+ * @param   Length              数据长度
+ * @return  HAL_StatusTypeDef   执行结果（发送中返回 HAL_BUSY）
+ **********************************************************************************************************************/
+HAL_StatusTypeDef UART_Send(Struct_UART_Manage_Object * UART_Mangae_Obj, uint8_t * Data, uint16_t Length)
+{
+    UART_HandleTypeDef * huart = UART_Mangae_Obj->huart;
+
+    if (huart->gState != HAL_UART_STATE_READY)
+    {
+        return (HAL_BUSY);
+    }
+
+    huart->Tx_Data = Data;
+    huart->Tx_Length = Length;
+    huart->Tx_Done = UART_Sim_Now();
+    if (huart->Pace)
+    {
+        /* 8N1：每字节10位 */
+        huart->Tx_Done += (uint64_t) Length * 10U * 1000000000U / huart->Init.BaudRate;
+    }
+    huart->gState = HAL_UART_STATE_BUSY_TX;
+
+    return (HAL_OK);
+}
+
+/***********************************************************************************************************************
+ * @brief   开启环形DMA接收（仿真：写指针归零）
+ *
+ * @param   UART_Manage_Obj     UART处理结构体指针
+ * @return  HAL_StatusTypeDef   执行结果
+ **********************************************************************************************************************/
+HAL_StatusTypeDef UART_ReceiveToRing_DMA(Struct_UART_Manage_Object * UART_Mangae_Obj)
+{
+    static_assert((UART_RX_BUFFER_SIZE & (UART_RX_BUFFER_SIZE - 1)) == 0, "UART_RX_BUFFER_SIZE must be a power of 2");
+
+    UART_Mangae_Obj->Rx_Data_Size = UART_RX_BUFFER_SIZE;
+    UART_Mangae_Obj->huart->Rx_Write = 0U;
+    UART_Mangae_Obj->huart->Rx_Pending = 0U;
+
+    return (HAL_OK);
+}
+
+/***********************************************************************************************************************
+ * @brief   获取环形DMA接收写指针
+ *
+ * @param   UART_Manage_Obj     UART处理结构体指针
+ * @return  uint16_t            下一个待写入字节的下标
+ **********************************************************************************************************************/
+uint16_t UART_Get_Rx_Write_Index(Struct_UART_Manage_Object * UART_Mangae_Obj)
+{
+    return (UART_Mangae_Obj->huart->Rx_Write);
+}
+
+/***********************************************************************************************************************
+ * @brief   获取波特率的实际可达值（与固件相同的BRR折算，时钟为 UART_CLOCK）
+ *
+ * @param   UART_Manage_Obj     UART处理结构体指针
+ * @param   Baud_Rate           期望波特率 (bit/s)
+ * @return  uint32_t            实际波特率 (bit/s)，超出范围时返回0
+ **********************************************************************************************************************/
+uint32_t UART_Get_Baud_Rate_Actual(Struct_UART_Manage_Object * UART_Mangae_Obj, uint32_t Baud_Rate)
+{
+    uint32_t brr = (Baud_Rate == 0U) ? 0U : ((UART_CLOCK + Baud_Rate / 2U) / Baud_Rate);
+
+    (void) UART_Mangae_Obj;
+    if (brr < 16U || brr > 0xFFFFU)
+    {
+        return (0U);
+    }
+
+    return (UART_CLOCK / brr);
+}
+
+/***********************************************************************************************************************
+ * @brief   运行时切换波特率（仿真：中止发送，重新开启接收）
+ *
+ * @param   UART_Manage_Obj     UART处理结构体指针
+ * @param   Baud_Rate           波特率 (bit/s)
+ * @return  HAL_StatusTypeDef   执行结果（超出范围时返回 HAL_ERROR 且不切换）
+ **********************************************************************************************************************/
+HAL_StatusTypeDef UART_Set_Baud_Rate(Struct_UART_Manage_Object * UART_Mangae_Obj, uint32_t Baud_Rate)
+{
+    UART_HandleTypeDef * huart = UART_Mangae_Obj->huart;
+
+    if (UART_Get_Baud_Rate_Actual(UART_Mangae_Obj, Baud_Rate) == 0U)
+    {
+        return (HAL_ERROR);
+    }
+
+    huart->gState = HAL_UART_STATE_READY;
+    huart->Tx_Length = 0U;
+    huart->Init.BaudRate = Baud_Rate;
+
+    return (UART_ReceiveToRing_DMA(UART_Mangae_Obj));
+}
+
+/***********************************************************************************************************************
+ * @brief   仿真时钟
+ *
+ * @return  uint64_t    单调时间 (ns)
+ **********************************************************************************************************************/
+uint64_t UART_Sim_Now()
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t) now.tv_sec * 1000000000U + (uint64_t) now.tv_nsec);
+}
+
+/***********************************************************************************************************************
+ * @brief   绑定伪终端主端
+ *
+ * @param   UART_Manage_Obj     UART处理结构体指针
+ * @param   FD                  伪终端主端（非阻塞）
+ * @param   Baud_Rate           初始波特率 (bit/s，即固件的基础波特率)
+ * @param   Pace                是否按波特率折算发送耗时（否则发送立即完成）
+ **********************************************************************************************************************/
+void UART_Sim_Attach(Struct_UART_Manage_Object * UART_Mangae_Obj, int FD, uint32_t Baud_Rate, bool Pace)
+{
+    UART_HandleTypeDef * huart = UART_Mangae_Obj->huart;
+
+    huart->Init.BaudRate = Baud_Rate;
+    huart->gState = HAL_UART_STATE_READY;
+    huart->FD = FD;
+    huart->Pace = Pace;
+    huart->Tx_Length = 0U;
+    huart->Rx_Write = 0U;
+    huart->Rx_Pending = 0U;
+}
+
+/***********************************************************************************************************************
+ * @brief   接收仿真：读取伪终端写入环形接收缓冲区
+ * @note    每次至多半个缓冲区且不跨越环尾，对应DMA半满、全满、IDLE事件；按波特率折算线上耗时时，
+ *          读入的字节在 (字节数 + 1) 个字节时间后才推进写指针（最后一个字节结束后线路空闲一个字节触发IDLE），
+ *          与实际线路上固件看到整帧的时刻一致；返回 true 时需调用一次接收事件回调
+ *
+ * @param   UART_Manage_Obj     UART处理结构体指针
+ * @param   Now                 当前时刻 (ns)
+ * @return  bool                是否产生接收事件
+ **********************************************************************************************************************/
+bool UART_Sim_Rx(Struct_UART_Manage_Object * UART_Mangae_Obj, uint64_t Now)
+{
+    UART_HandleTypeDef * huart = UART_Mangae_Obj->huart;
+
+    if (huart->Rx_Pending == 0U)
+    {
+        uint16_t room = UART_RX_BUFFER_SIZE - huart->Rx_Write;
+        uint16_t chunk = (room < UART_RX_BUFFER_SIZE / 2U) ? room : (UART_RX_BUFFER_SIZE / 2U);
+        ssize_t n = read(huart->FD, &UART_Mangae_Obj->Rx_Buffer[huart->Rx_Write], chunk);
+
+        if (n <= 0)
+        {
+            return (false);
+        }
+
+        huart->Rx_Pending = (uint16_t) n;
+        huart->Rx_Done = Now;
+        if (huart->Pace)
+        {
+            huart->Rx_Done += ((uint64_t) n + 1U) * 10U * 1000000000U / huart->Init.BaudRate;
+        }
+    }
+
+    if (Now < huart->Rx_Done)
+    {
+        return (false);
+    }
+
+    huart->Rx_Write = (huart->Rx_Write + huart->Rx_Pending) & (UART_RX_BUFFER_SIZE - 1U);
+    huart->Rx_Pending = 0U;
+
+    return (true);
+}
+
+/***********************************************************************************************************************
+ * @brief   发送仿真：到达发送完成时刻后写入伪终端
+ * @note    对端读取不及时（伪终端缓冲区满）时保持发送中，相当于线路被阻塞；返回 true 时需调用一次发送完成回调
+ *
+ * @param   UART_Manage_Obj     UART处理结构体指针
+ * @param   Now                 当前时刻 (ns)
+ * @return  bool                是否发送完成
+ **********************************************************************************************************************/
+bool UART_Sim_Tx(Struct_UART_Manage_Object * UART_Mangae_Obj, uint64_t Now)
+{
+    UART_HandleTypeDef * huart = UART_Mangae_Obj->huart;
+
+    if (huart->gState != HAL_UART_STATE_BUSY_TX || Now < huart->Tx_Done)
+    {
+        return (false);
+    }
+
+    while (huart->Tx_Length > 0U)
+    {
+        ssize_t n = write(huart->FD, huart->Tx_Data, huart->Tx_Length);
+
+        if (n <= 0)
+        {
+            if (n < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            return (false);
+        }
+        huart->Tx_Data += n;
+        huart->Tx_Length -= (uint16_t) n;
+    }
+
+    huart->gState = HAL_UART_STATE_READY;
+
+    return (true);
+}
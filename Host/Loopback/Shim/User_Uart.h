@@ -0,0 +1,94 @@
+/**
+ * @file    User_Uart.h
+ * @brief   Uart外设仿真（回环测试用，替换固件 User/4-HAL/Inc/User_Uart.h）
+ *          串口以伪终端主端代替：UART_Send 按波特率折算发送耗时，到时写入主端并产生发送完成事件；
+ *          主端可读时按DMA方式写入环形接收缓冲区，按波特率折算的接收耗时（含IDLE检测的一个字节）到时后才推进写指针
+ *          并产生接收事件；事件由回环测试主循环按固件中断的调用方式分发
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.1
+ */
+
+#ifndef __HAL_USER_UART_H
+#define __HAL_USER_UART_H
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "User_Math.h"
+
+/* 宏定义 -------------------------------------------------------------------------------------------------------------*/
+#define UART_TX_BUFFER_SIZE            256         // 串口TX缓冲区字节长度
+#define UART_RX_BUFFER_SIZE            256         // 串口RX缓冲区字节长度（环形接收时需为2的幂）
+
+#define UART_CLOCK                     42000000U   // 仿真UART时钟频率 (Hz, APB1)
+#define HAL_UART_STATE_READY           0x20U
+#define HAL_UART_STATE_BUSY_TX         0x21U
+
+/* 单线程仿真，无需关中断（需在 User_Math.h 引用的 CMSIS 头文件之后定义） */
+#define __get_PRIMASK()                0U
+#define __disable_irq()                ((void) 0)
+#define __set_PRIMASK(x)               ((void) (x))
+
+/* 枚举类型定义 --------------------------------------------------------------------------------------------------------*/
+typedef enum
+{
+    HAL_OK      = 0x00U,
+    HAL_ERROR   = 0x01U,
+    HAL_BUSY    = 0x02U,
+    HAL_TIMEOUT = 0x03U,
+} HAL_StatusTypeDef;
+
+/* 结构体定义 ----------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief UART初始化参数（仅保留波特率）
+ */
+struct UART_InitTypeDef
+{
+    uint32_t BaudRate;
+};
+
+/**
+ * @brief UART句柄（仿真状态）
+ */
+struct UART_HandleTypeDef
+{
+    UART_InitTypeDef Init;
+    uint32_t gState;
+    int FD;                         /*!< 伪终端主端 */
+    bool Pace;                      /*!< 是否按波特率折算发送耗时 */
+    const uint8_t * Tx_Data;        /*!< 发送中的数据（DMA源地址） */
+    uint16_t Tx_Length;             /*!< 发送中的剩余字节数 */
+    uint64_t Tx_Done;               /*!< 发送完成时刻 (ns) */
+    uint16_t Rx_Write;              /*!< 环形接收写指针 */
+    uint16_t Rx_Pending;            /*!< 已读入环形缓冲区、尚未到达接收时刻的字节数 */
+    uint64_t Rx_Done;               /*!< 接收事件时刻 (ns) */
+};
+
+/**
+ * @brief UART处理结构体
+ */
+struct Struct_UART_Manage_Object
+{
+    UART_HandleTypeDef * huart;
+    uint8_t Tx_Buffer[UART_TX_BUFFER_SIZE];
+    uint8_t Rx_Buffer[UART_RX_BUFFER_SIZE];
+    uint16_t Rx_Data_Size;
+};
+
+/* 变量声明 ------------------------------------------------------------------------------------------------------------*/
+extern Struct_UART_Manage_Object UART3_Manage_Object;
+
+/* 函数声明 ------------------------------------------------------------------------------------------------------------*/
+HAL_StatusTypeDef UART_Send(Struct_UART_Manage_Object * UART_Mangae_Obj, uint8_t * Data, uint16_t Length);
+HAL_StatusTypeDef UART_ReceiveToRing_DMA(Struct_UART_Manage_Object * UART_Mangae_Obj);
+uint16_t UART_Get_Rx_Write_Index(Struct_UART_Manage_Object * UART_Mangae_Obj);
+uint32_t UART_Get_Baud_Rate_Actual(Struct_UART_Manage_Object * UART_Mangae_Obj, uint32_t Baud_Rate);
+HAL_StatusTypeDef UART_Set_Baud_Rate(Struct_UART_Manage_Object * UART_Mangae_Obj, uint32_t Baud_Rate);
+
+/* 仿真接口 */
+uint64_t UART_Sim_Now();
+void UART_Sim_Attach(Struct_UART_Manage_Object * UART_Mangae_Obj, int FD, uint32_t Baud_Rate, bool Pace);
+bool UART_Sim_Rx(Struct_UART_Manage_Object * UART_Mangae_Obj, uint64_t Now);
+bool UART_Sim_Tx(Struct_UART_Manage_Object * UART_Mangae_Obj, uint64_t Now);
+
+#endif  /* HAL_User_Uart.h */
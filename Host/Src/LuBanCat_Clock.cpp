@@ -0,0 +1,121 @@
+/**
+ * @file    LuBanCat_Clock.cpp
+ * @brief   鲁班猫上位机（Linux）侧时钟同步
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "LuBanCat_Clock.h"
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/************************************************************************************************************************
+ * @brief   注册到上位机协议对象
+ *
+ * @param   __Host      上位机协议对象（需已 Init）
+ * @param   __Baud_Rate 当前波特率 (bit/s)
+ * @return  bool        是否成功
+ ***********************************************************************************************************************/
+bool Class_LuBanCat_Clock::Attach(Class_LuBanCat_Host * __Host, uint32_t __Baud_Rate)
+{
+    this->Host = __Host;
+    this->Set_Baud_Rate(__Baud_Rate);
+    this->Reset();
+
+    return (__Host->Register(COM_PACKET_SYNC, COM_SYNC_LENGTH, &Class_LuBanCat_Clock::Receive, this));
+}
+
+/************************************************************************************************************************
+ * @brief   设置波特率（切换波特率后调用，用于把接收时刻折算回帧起始时刻）
+ *
+ * @param   __Baud_Rate     波特率 (bit/s, 8N1)
+ ***********************************************************************************************************************/
+void Class_LuBanCat_Clock::Set_Baud_Rate(uint32_t __Baud_Rate)
+{
+    this->Byte_Time = (__Baud_Rate > 0U) ? (10.0e6 / __Baud_Rate) : 0.0;
+}
+
+/************************************************************************************************************************
+ * @brief   复位（下位机复位、重新打开串口后调用，重新同步）
+ ***********************************************************************************************************************/
+void Class_LuBanCat_Clock::Reset()
+{
+    this->Clock.Reset();
+    this->Started = false;
+    this->Pending = false;
+    this->Previous = COM_SYNC_NONE;
+}
+
+/************************************************************************************************************************
+ * @brief   周期性调用：距上一次请求满 COM_SYNC_PERIOD 时发送请求并立即写出
+ * @note    上一次请求未收到应答时按丢失处理（序号递增，下位机不会以其更新）
+ *
+ * @return  bool    本次是否发送了请求
+ ***********************************************************************************************************************/
+bool Class_LuBanCat_Clock::Sync()
+{
+    uint32_t now = Class_LuBanCat_Host::Get_Time();
+
+    if (this->Started && now - this->Origin < COM_SYNC_PERIOD * 1000U)
+    {
+        return (false);
+    }
+
+    Struct_COM_Sync request;
+
+    this->Sequence = (this->Sequence + 1U < COM_SYNC_NONE) ? (this->Sequence + 1U) : 0U;
+    request.Sequence = this->Sequence;
+    request.Previous = this->Previous;
+    request.Origin = this->Previous_Origin;
+    request.Receive = this->Previous_Receive;
+    if (!this->Host->Send(COM_PACKET_SYNC, request))
+    {
+        return (false);
+    }
+
+    this->Origin = this->Host->Get_Tx_Time();
+    this->Started = true;
+    this->Pending = true;
+    this->Previous = COM_SYNC_NONE;
+    this->Request_Number += 1U;
+    this->Host->Flush();
+
+    return (true);
+}
+
+/************************************************************************************************************************
+ * @brief   接收处理：应答与当前请求一致时补全四个时间戳，更新时钟同步并记录供下一次请求携带
+ *
+ * @param   __Data      数据
+ * @param   __Length    数据长度
+ * @param   __Context   时钟同步对象
+ ***********************************************************************************************************************/
+void Class_LuBanCat_Clock::Receive(const void * __Data, uint8_t __Length, void * __Context)
+{
+    Class_LuBanCat_Clock * clock = (Class_LuBanCat_Clock *) __Context;
+    Struct_COM_Sync reply;
+
+    (void) __Length;
+    memcpy(&reply, __Data, sizeof(reply));
+    if (!clock->Pending || reply.Sequence != clock->Sequence || reply.Origin != clock->Origin)
+    {
+        return;
+    }
+
+    /* T4：read 返回时刻减去应答帧及同次 read 中其后字节的线上时间，折算回应答帧起始时刻 */
+    uint32_t wire = (clock->Host->Get_Frame_Mode() == Frame_Mode_COBS) ?
+                    (COBS_MAX_ENCODED(COM_SYNC_LENGTH + FRAME_OVERHEAD - 4U) + 1U) : (COM_SYNC_LENGTH + FRAME_OVERHEAD);
+    uint32_t destination = clock->Host->Get_Rx_Time() -
+                           (uint32_t) ((wire + clock->Host->Get_Rx_Trailing()) * clock->Byte_Time + 0.5);
+
+    clock->Pending = false;
+    if (clock->Clock.Update(clock->Origin, reply.Receive, clock->Host->Get_Rx_Timestamp(), destination, true))
+    {
+        clock->Previous = clock->Sequence;
+        clock->Previous_Origin = clock->Origin;
+        clock->Previous_Receive = destination;
+        clock->Reply_Number += 1U;
+    }
+}
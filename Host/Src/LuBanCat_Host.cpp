@@ -0,0 +1,326 @@
+/**
+ * @file    LuBanCat_Host.cpp
+ * @brief   鲁班猫上位机（Linux）侧串口协议库
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.2
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "LuBanCat_Host.h"
+
+#include <errno.h>
+#include <sys/epoll.h>
+#include <time.h>
+#include <unistd.h>
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/************************************************************************************************************************
+ * @brief   上位机协议类析构函数
+ ***********************************************************************************************************************/
+Class_LuBanCat_Host::~Class_LuBanCat_Host()
+{
+    if (this->Epoll_FD >= 0)
+    {
+        close(this->Epoll_FD);
+    }
+}
+
+/************************************************************************************************************************
+ * @brief   上位机协议类初始化函数（所有包类型均未注册）
+ *
+ * @param   __FD            串口文件描述符（需为非阻塞，见 Class_Serial_Port）
+ * @param   __Pack_Head     包头 (4byte，COBS模式不使用，需与下位机一致)
+ * @param   __Frame_Mode    分帧方式（需与下位机一致）
+ * @return  bool            是否成功（失败时 errno 有效）
+ ***********************************************************************************************************************/
+bool Class_LuBanCat_Host::Init(int __FD, uint32_t __Pack_Head, Enum_Frame_Mode __Frame_Mode)
+{
+    /* 参数赋值 */
+    this->FD = __FD;
+    this->Pack_Head = __Pack_Head;
+    this->Frame_Mode = __Frame_Mode;
+    memset(this->Handler_List, 0, sizeof(this->Handler_List));
+    this->Tx_Read = 0U;
+    this->Tx_Write = 0U;
+    this->Writable = false;
+
+    /* Rx流式解析器初始化 */
+    this->Ring_Write = 0U;
+    this->Parser.Init(this->Ring, LUBANCAT_HOST_RING_SIZE, this->Pack_Head, this->Frame_Mode);
+
+    /* 登记可读事件（水平触发） */
+    if (this->Epoll_FD < 0)
+    {
+        this->Epoll_FD = epoll_create1(EPOLL_CLOEXEC);
+        if (this->Epoll_FD < 0)
+        {
+            return (false);
+        }
+    }
+
+    struct epoll_event event = {};
+
+    event.events = EPOLLIN;
+    event.data.fd = this->FD;
+    epoll_ctl(this->Epoll_FD, EPOLL_CTL_DEL, this->FD, nullptr);
+
+    return (epoll_ctl(this->Epoll_FD, EPOLL_CTL_ADD, this->FD, &event) == 0);
+}
+
+/************************************************************************************************************************
+ * @brief   注册接收包类型
+ *
+ * @param   __Type      包类型
+ * @param   __Length    数据长度（帧长度不超过 FRAME_MAX_LENGTH；变长包为最大长度）
+ * @param   __Handler   接收处理函数（数据指针仅在调用期间有效，Length 为本帧数据长度）
+ * @param   __Context   处理函数上下文
+ * @param   __Variable  是否为变长包（接受不超过 __Length 的数据长度）
+ * @return  bool        是否成功
+ ***********************************************************************************************************************/
+bool Class_LuBanCat_Host::Register(uint8_t __Type, uint8_t __Length,
+                                   void (* __Handler)(const void * Data, uint8_t Length, void * Context),
+                                   void * __Context, bool __Variable)
+{
+    if (__Handler == nullptr || __Length + FRAME_OVERHEAD > FRAME_MAX_LENGTH)
+    {
+        return (false);
+    }
+
+    this->Handler_List[__Type].Handler = __Handler;
+    this->Handler_List[__Type].Context = __Context;
+    this->Parser.Register(__Type, __Length, __Variable);
+
+    return (true);
+}
+
+/************************************************************************************************************************
+ * @brief   组帧并加入发送批
+ * @note    在批缓冲区尾部原地组帧（COBS模式先写入原始帧再原地编码），帧时间戳取组帧时刻，不发起系统调用；
+ *          缓冲区不足时先 Flush，仍不足（内核缓冲区已满）时丢弃本帧
+ *
+ * @param   __Type      包类型
+ * @param   __Data      数据
+ * @param   __Length    数据长度
+ * @return  bool        是否成功
+ ***********************************************************************************************************************/
+bool Class_LuBanCat_Host::Send(uint8_t __Type, const void * __Data, uint8_t __Length)
+{
+    const uint32_t wire_max = FRAME_COBS_MAX_ENCODED + 2U;
+
+    if (__Length + FRAME_OVERHEAD > FRAME_MAX_LENGTH)
+    {
+        return (false);
+    }
+    if (LUBANCAT_HOST_TX_SIZE - this->Tx_Write < wire_max)
+    {
+        this->Flush();
+        if (LUBANCAT_HOST_TX_SIZE - this->Tx_Write < wire_max)
+        {
+            this->Tx_Full_Number += 1U;
+            return (false);
+        }
+    }
+
+    uint8_t * frame = &this->Buffer_Tx[this->Tx_Write];
+    uint32_t time = Get_Time();
+
+    this->Tx_Time = time;
+
+    if (this->Frame_Mode == Frame_Mode_COBS)
+    {
+        /* 每批前置结束符，原始帧写在编码位置之后1字节处 */
+        if (this->Tx_Write == this->Tx_Read)
+        {
+            *frame++ = COBS_DELIMITER;
+        }
+        frame[1] = __Type;
+        frame[2] = __Length;
+        memcpy(&frame[3], __Data, __Length);
+        memcpy(&frame[3U + __Length], &time, FRAME_TIME_LENGTH);
+        frame[FRAME_OVERHEAD - 4U + __Length] = Class_CRC8_MAXIM::Calculate(&frame[1], __Length + FRAME_OVERHEAD - 5U);
+
+        uint32_t length = COBS_Encode(&frame[1], __Length + FRAME_OVERHEAD - 4U, frame);
+
+        frame[length++] = COBS_DELIMITER;
+        this->Tx_Write = (uint32_t) (&frame[length] - this->Buffer_Tx);
+    }
+    else
+    {
+        memcpy(frame, &this->Pack_Head, 4);
+        frame[4] = __Type;
+        frame[5] = __Length;
+        memcpy(&frame[FRAME_HEADER_LENGTH], __Data, __Length);
+        memcpy(&frame[FRAME_HEADER_LENGTH + __Length], &time, FRAME_TIME_LENGTH);
+        frame[FRAME_OVERHEAD - 1U + __Length] = Class_CRC8_MAXIM::Calculate(frame, FRAME_OVERHEAD - 1U + __Length);
+        this->Tx_Write += __Length + FRAME_OVERHEAD;
+    }
+
+    this->Tx_Frame_Number += 1U;
+    return (true);
+}
+
+/************************************************************************************************************************
+ * @brief   写出发送批
+ * @note    内核缓冲区满（部分写入、EAGAIN）时登记 EPOLLOUT，由 Poll 在可写后接续
+ *
+ * @return  bool    是否已全部写出
+ ***********************************************************************************************************************/
+bool Class_LuBanCat_Host::Flush()
+{
+    while (this->Tx_Read < this->Tx_Write)
+    {
+        ssize_t n = write(this->FD, &this->Buffer_Tx[this->Tx_Read], this->Tx_Write - this->Tx_Read);
+
+        if (n > 0)
+        {
+            this->Tx_Read += (uint32_t) n;
+        }
+        else if (n < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    if (this->Tx_Read == this->Tx_Write)
+    {
+        this->Tx_Read = 0U;
+        this->Tx_Write = 0U;
+        this->Set_Writable(false);
+        return (true);
+    }
+
+    /* 未写出部分移至缓冲区起点，腾出组帧空间 */
+    memmove(this->Buffer_Tx, &this->Buffer_Tx[this->Tx_Read], this->Tx_Write - this->Tx_Read);
+    this->Tx_Write -= this->Tx_Read;
+    this->Tx_Read = 0U;
+    this->Set_Writable(true);
+    return (false);
+}
+
+/************************************************************************************************************************
+ * @brief   事件处理：写出发送批，等待并处理接收数据
+ *
+ * @param   __Timeout   最长等待时间 (ms, -1 为一直等待，0 为不等待)
+ * @return  int         本次分发的帧数，串口出错或被关闭时返回 -1
+ ***********************************************************************************************************************/
+int Class_LuBanCat_Host::Poll(int __Timeout)
+{
+    struct epoll_event event;
+
+    if (!this->Writable && this->Tx_Write != this->Tx_Read)
+    {
+        this->Flush();
+    }
+
+    int n = epoll_wait(this->Epoll_FD, &event, 1, __Timeout);
+
+    if (n <= 0)
+    {
+        return ((n == 0 || errno == EINTR) ? 0 : -1);
+    }
+    if (event.events & EPOLLOUT)
+    {
+        this->Flush();
+    }
+    if (event.events & (EPOLLIN | EPOLLERR | EPOLLHUP))
+    {
+        return (this->Receive());
+    }
+
+    return (0);
+}
+
+/************************************************************************************************************************
+ * @brief   复位接收（切换波特率后调用，丢弃环形缓冲区中尚未成帧的字节）
+ ***********************************************************************************************************************/
+void Class_LuBanCat_Host::Reset()
+{
+    this->Parser.Reset(this->Ring_Write);
+}
+
+/************************************************************************************************************************
+ * @brief   获取本端时钟
+ *
+ * @return  uint32_t    CLOCK_MONOTONIC 微秒数（32位回绕）
+ ***********************************************************************************************************************/
+uint32_t Class_LuBanCat_Host::Get_Time()
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint32_t) ((uint64_t) now.tv_sec * 1000000U + (uint64_t) now.tv_nsec / 1000U));
+}
+
+/************************************************************************************************************************
+ * @brief   读取并分发
+ * @note    每次 read 不超过 LUBANCAT_HOST_READ_MAX 且不跨越环尾，读后立即取尽完整帧，
+ *          环内滞留的只有不足一帧的尾部，因此写指针不会追上读指针
+ *
+ * @return  int     分发的帧数，串口出错或被关闭时返回 -1
+ ***********************************************************************************************************************/
+int Class_LuBanCat_Host::Receive()
+{
+    int number = 0;
+
+    for (;;)
+    {
+        uint32_t room = LUBANCAT_HOST_RING_SIZE - this->Ring_Write;
+        uint32_t chunk = (room < LUBANCAT_HOST_READ_MAX) ? room : LUBANCAT_HOST_READ_MAX;
+        ssize_t n = read(this->FD, &this->Ring[this->Ring_Write], chunk);
+
+        if (n <= 0)
+        {
+            if (n < 0 && (errno == EAGAIN || errno == EINTR))
+            {
+                return (number);
+            }
+            return ((number > 0) ? number : -1);
+        }
+
+        this->Ring_Write = (this->Ring_Write + (uint32_t) n) & (LUBANCAT_HOST_RING_SIZE - 1U);
+        this->Rx_Time = Get_Time();
+
+        const uint8_t * frame;
+
+        while ((frame = this->Parser.Next(this->Ring_Write)) != nullptr)
+        {
+            const Struct_LuBanCat_Handler & handler = this->Handler_List[frame[0]];
+
+            this->Rx_Timestamp = Frame_Get_Time(frame);
+            handler.Handler(&frame[2], frame[1], handler.Context);
+            number += 1;
+        }
+
+        if ((uint32_t) n < chunk)
+        {
+            return (number);
+        }
+    }
+}
+
+/************************************************************************************************************************
+ * @brief   登记或撤销 EPOLLOUT
+ *
+ * @param   __Writable  是否等待可写
+ ***********************************************************************************************************************/
+void Class_LuBanCat_Host::Set_Writable(bool __Writable)
+{
+    if (this->Writable == __Writable)
+    {
+        return;
+    }
+
+    struct epoll_event event = {};
+
+    event.events = __Writable ? (EPOLLIN | EPOLLOUT) : EPOLLIN;
+    event.data.fd = this->FD;
+    epoll_ctl(this->Epoll_FD, EPOLL_CTL_MOD, this->FD, &event);
+    this->Writable = __Writable;
+}
@@ -0,0 +1,92 @@
+/**
+ * @file    LuBanCat_Telemetry.cpp
+ * @brief   鲁班猫上位机（Linux）侧压缩遥测接收
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "LuBanCat_Telemetry.h"
+
+/* 全局变量创建 --------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   压缩遥测字段描述（与下位机共用 LUBANCAT_TELEMETRY_FIELDS）
+ */
+static const Struct_Codec_Field Telemetry_Field[LUBANCAT_TELEMETRY_FIELD_NUMBER] = LUBANCAT_TELEMETRY_FIELDS;
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/************************************************************************************************************************
+ * @brief   压缩遥测接收类构造函数
+ ***********************************************************************************************************************/
+Class_LuBanCat_Telemetry::Class_LuBanCat_Telemetry()
+    : Decoder(Telemetry_Field, LUBANCAT_TELEMETRY_FIELD_NUMBER)
+{
+}
+
+/************************************************************************************************************************
+ * @brief   注册到上位机协议对象
+ *
+ * @param   __Host      上位机协议对象（需已 Init）
+ * @param   __Handler   用户处理函数（每个解码成功的帧调用一次，可为 nullptr）
+ * @param   __Context   用户处理函数上下文
+ * @return  bool        是否成功
+ ***********************************************************************************************************************/
+bool Class_LuBanCat_Telemetry::Attach(Class_LuBanCat_Host * __Host,
+                                      void (* __Handler)(const Struct_Telemetry_LuBanCat * Data, void * Context),
+                                      void * __Context)
+{
+    this->Host = __Host;
+    this->Handler = __Handler;
+    this->Context = __Context;
+    this->Reset();
+
+    return (__Host->Register(LuBanCat_Packet_Telemetry, LUBANCAT_TELEMETRY_LENGTH, &Class_LuBanCat_Telemetry::Receive,
+                             this, true));
+}
+
+/************************************************************************************************************************
+ * @brief   复位（丢弃已收到的关键帧，如切换波特率、重新打开串口后）
+ ***********************************************************************************************************************/
+void Class_LuBanCat_Telemetry::Reset()
+{
+    this->Decoder.Reset();
+}
+
+/************************************************************************************************************************
+ * @brief   接收处理：解码，关键帧回复确认
+ *
+ * @param   __Data      数据
+ * @param   __Length    数据长度
+ * @param   __Context   压缩遥测接收对象
+ ***********************************************************************************************************************/
+void Class_LuBanCat_Telemetry::Receive(const void * __Data, uint8_t __Length, void * __Context)
+{
+    Class_LuBanCat_Telemetry * telemetry = (Class_LuBanCat_Telemetry *) __Context;
+    Struct_Telemetry_LuBanCat value;
+    uint8_t sequence;
+    Enum_Codec_Result result = telemetry->Decoder.Decode((const uint8_t *) __Data, __Length, (float *) &value,
+                                                         &sequence);
+
+    if (result == Codec_Invalid)
+    {
+        telemetry->Invalid_Number += 1U;
+        return;
+    }
+
+    if (result == Codec_Keyframe)
+    {
+        Struct_RxData_Telemetry_Ack_LuBanCat ack = {sequence};
+
+        telemetry->Host->Send(LuBanCat_Packet_Telemetry_Ack, ack);
+        telemetry->Keyframe_Number += 1U;
+    }
+    telemetry->Frame_Number += 1U;
+    telemetry->Byte_Number += __Length;
+
+    if (telemetry->Handler != nullptr)
+    {
+        telemetry->Handler(&value, telemetry->Context);
+    }
+}
@@ -0,0 +1,99 @@
+/**
+ * @file    Serial_Port.cpp
+ * @brief   Linux串口封装（非阻塞，termios2 任意波特率）
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "Serial_Port.h"
+
+#include <asm/termbits.h>
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/************************************************************************************************************************
+ * @brief   串口类析构函数
+ ***********************************************************************************************************************/
+Class_Serial_Port::~Class_Serial_Port()
+{
+    this->Close();
+}
+
+/************************************************************************************************************************
+ * @brief   打开串口
+ *
+ * @param   __Device        设备路径（如 /dev/ttyS3、/dev/pts/N）
+ * @param   __Baud_Rate     波特率 (bit/s)
+ * @return  bool            是否成功（失败时 errno 有效）
+ ***********************************************************************************************************************/
+bool Class_Serial_Port::Open(const char * __Device, uint32_t __Baud_Rate)
+{
+    this->Close();
+
+    this->FD = open(__Device, O_RDWR | O_NOCTTY | O_NONBLOCK | O_CLOEXEC);
+    if (this->FD < 0)
+    {
+        return (false);
+    }
+    if (!this->Set_Baud_Rate(__Baud_Rate))
+    {
+        this->Close();
+        return (false);
+    }
+
+    return (true);
+}
+
+/************************************************************************************************************************
+ * @brief   关闭串口
+ ***********************************************************************************************************************/
+void Class_Serial_Port::Close()
+{
+    if (this->FD >= 0)
+    {
+        close(this->FD);
+        this->FD = -1;
+    }
+}
+
+/************************************************************************************************************************
+ * @brief   设置为原始模式 8N1 并切换波特率
+ * @note    切换前等待已写入数据发送完成，切换后清空输入缓冲区（旧波特率下的残留字节）
+ *
+ * @param   __Baud_Rate     波特率 (bit/s)
+ * @return  bool            是否成功
+ ***********************************************************************************************************************/
+bool Class_Serial_Port::Set_Baud_Rate(uint32_t __Baud_Rate)
+{
+    struct termios2 tio;
+
+    if (ioctl(this->FD, TCGETS2, &tio) != 0)
+    {
+        return (false);
+    }
+
+    tio.c_iflag &= ~(IGNBRK | BRKINT | PARMRK | ISTRIP | INLCR | IGNCR | ICRNL | IXON | IXOFF | IXANY);
+    tio.c_oflag &= ~OPOST;
+    tio.c_lflag &= ~(ECHO | ECHONL | ICANON | ISIG | IEXTEN);
+    tio.c_cflag &= ~(CSIZE | PARENB | CSTOPB | CRTSCTS | CBAUD | (CBAUD << IBSHIFT));
+    tio.c_cflag |= CS8 | CLOCAL | CREAD | BOTHER | (BOTHER << IBSHIFT);
+    tio.c_ispeed = __Baud_Rate;
+    tio.c_ospeed = __Baud_Rate;
+    tio.c_cc[VMIN] = 0;
+    tio.c_cc[VTIME] = 0;
+
+    ioctl(this->FD, TCSBRK, 1);
+    if (ioctl(this->FD, TCSETS2, &tio) != 0)
+    {
+        return (false);
+    }
+    ioctl(this->FD, TCFLSH, TCIFLUSH);
+    this->Baud_Rate = __Baud_Rate;
+
+    return (true);
+}
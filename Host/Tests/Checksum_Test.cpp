@@ -0,0 +1,155 @@
+/**
+ * @file    Checksum_Test.cpp
+ * @brief   累加和、Fletcher-16、Adler-32 正确性测试（与固件共用 User_Math.cpp）
+ *          随机长度 (0 ~ 20000 B)、随机起始偏移（覆盖非对齐首尾与 5552 字节分块边界）下与逐字节朴素实现比较，
+ *          另校验公开的标准测试值
+ * @note    主机未定义 ARM_MATH_DSP，覆盖的是可移植路径；DSP 指令路径与其逐字等价（User_Math.cpp 中两分支相邻）
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "User_Math.h"
+
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+/* 宏定义 --------------------------------------------------------------------------------------------------------------*/
+#define TEST_CASE_NUMBER        3000U       /* 随机长度、偏移组数 */
+#define TEST_LENGTH_MAX         20000U      /* 最大字节数（超过 3 个 Adler-32 分块） */
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/************************************************************************************************************************
+ * @brief   逐字节 Fletcher-16 参照（每字节取模）
+ ***********************************************************************************************************************/
+static uint16_t Naive_Fletcher_16(const uint8_t * __Address, uint32_t __Length)
+{
+    uint32_t sum_1 = 0U, sum_2 = 0U;
+
+    for (uint32_t i = 0; i < __Length; i++)
+    {
+        sum_1 = (sum_1 + __Address[i]) % 255U;
+        sum_2 = (sum_2 + sum_1) % 255U;
+    }
+
+    return ((uint16_t) (sum_2 << 8 | sum_1));
+}
+
+/************************************************************************************************************************
+ * @brief   逐字节 Adler-32 参照（RFC 1950 原始定义）
+ ***********************************************************************************************************************/
+static uint32_t Naive_Adler_32(const uint8_t * __Address, uint32_t __Length)
+{
+    uint32_t a = 1U, b = 0U;
+
+    for (uint32_t i = 0; i < __Length; i++)
+    {
+        a = (a + __Address[i]) % 65521U;
+        b = (b + a) % 65521U;
+    }
+
+    return (b << 16 | a);
+}
+
+/************************************************************************************************************************
+ * @brief   标准测试值
+ ***********************************************************************************************************************/
+static bool Test_Vector()
+{
+    uint8_t wikipedia[] = "Wikipedia";
+    uint8_t abcde[] = "abcde";
+    uint8_t abcdef[] = "abcdef";
+    uint8_t abcdefgh[] = "abcdefgh";
+    bool ok = Math_Adler_32(wikipedia, 9U) == 0x11E60398U && Math_Fletcher_16(abcde, 5U) == 0xC8F0U &&
+              Math_Fletcher_16(abcdef, 6U) == 0x2057U && Math_Fletcher_16(abcdefgh, 8U) == 0x0627U &&
+              Math_Adler_32(abcde, 0U) == 1U && Math_Fletcher_16(abcde, 0U) == 0U;
+
+    printf("%-24s Adler-32(\"Wikipedia\") %08X  Fletcher-16(\"abcde\") %04X  %s\n", "known values",
+           Math_Adler_32(wikipedia, 9U), Math_Fletcher_16(abcde, 5U), ok ? "ok" : "FAIL");
+
+    return (ok);
+}
+
+/************************************************************************************************************************
+ * @brief   随机长度、偏移与朴素实现比较
+ ***********************************************************************************************************************/
+static bool Test_Random()
+{
+    std::mt19937 random(12U);
+    std::uniform_int_distribution<uint32_t> byte(0U, 255U);
+    std::uniform_int_distribution<uint32_t> length(0U, TEST_LENGTH_MAX);
+    std::uniform_int_distribution<uint32_t> offset(0U, 3U);
+    std::vector<uint8_t> buffer(TEST_LENGTH_MAX + 8U);
+    uint32_t mismatch[5] = {0U, 0U, 0U, 0U, 0U};
+
+    for (uint32_t n = 0; n < TEST_CASE_NUMBER; n++)
+    {
+        uint32_t size = length(random);
+        uint8_t * data = buffer.data() + offset(random);
+
+        /* 前 100 组取全 0xFF（累加和增长最快，检验分块取模不溢出） */
+        for (uint32_t i = 0; i < size; i++)
+        {
+            data[i] = (n < 100U) ? 0xFFU : (uint8_t) byte(random);
+        }
+
+        uint8_t sum_8 = 0U;
+        uint16_t sum_16 = 0U;
+        uint32_t sum_32 = 0U;
+        for (uint32_t i = 0; i < size; i++)
+        {
+            sum_8 += data[i];
+        }
+        for (uint32_t i = 0; i < size / 2U; i++)
+        {
+            uint16_t value;
+
+            std::memcpy(&value, data + 2U * i, sizeof(value));
+            sum_16 += value;
+        }
+        for (uint32_t i = 0; i < size / 4U; i++)
+        {
+            uint32_t value;
+
+            std::memcpy(&value, data + 4U * i, sizeof(value));
+            sum_32 += value;
+        }
+
+        /* Math_Sum_16 / _32 按元素寻址，使用对齐的起始地址 */
+        mismatch[0] += (Math_Sum_8(data, size) != sum_8) ? 1U : 0U;
+        std::memmove(buffer.data(), data, size);
+        mismatch[1] += (Math_Sum_16((uint16_t *) buffer.data(), size / 2U) != sum_16) ? 1U : 0U;
+        mismatch[2] += (Math_Sum_32((uint32_t *) buffer.data(), size / 4U) != sum_32) ? 1U : 0U;
+        std::memmove(data, buffer.data(), size);
+        mismatch[3] += (Math_Fletcher_16(data, size) != Naive_Fletcher_16(data, size)) ? 1U : 0U;
+        mismatch[4] += (Math_Adler_32(data, size) != Naive_Adler_32(data, size)) ? 1U : 0U;
+    }
+
+    const char * name[5] = {"Math_Sum_8", "Math_Sum_16", "Math_Sum_32", "Math_Fletcher_16", "Math_Adler_32"};
+    bool ok = true;
+    for (uint32_t i = 0; i < 5U; i++)
+    {
+        printf("%-24s %u / %u mismatch vs naive  %s\n", name[i], mismatch[i], TEST_CASE_NUMBER,
+               (mismatch[i] == 0U) ? "ok" : "FAIL");
+        ok &= (mismatch[i] == 0U);
+    }
+
+    return (ok);
+}
+
+/************************************************************************************************************************
+ * @brief   主函数
+ ***********************************************************************************************************************/
+int main()
+{
+    bool ok = true;
+
+    ok &= Test_Vector();
+    ok &= Test_Random();
+
+    return (ok ? 0 : 1);
+}
@@ -0,0 +1,142 @@
+/**
+ * @file    Clock_Sync_Test.cpp
+ * @brief   双端时钟同步仿真测试（与固件共用 Clock_Sync.cpp，固定随机种子，结果可复现）
+ *          仿真真实时间下两个自由计数的32位微秒时钟（已知初始偏移、漂移，跨越32位回绕），上下行时延为不同的基础值
+ *          加各自独立的指数抖动，并混入偶发的排队尖峰；双方以相同的四个时间戳各自 Update，
+ *          要求请求方、应答方 To_Remote 相对真值的偏差不超过 上下行基础时延差的一半 + 抖动余量，
+ *          估计的漂移与真值之差不超过 抖动均值 / 拟合跨度 量级的 ppm（容差均随场景的抖动均值给出）
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "Clock_Sync.h"
+
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+/* 宏定义 --------------------------------------------------------------------------------------------------------------*/
+#define TEST_EXCHANGE_NUMBER    600U        /* 每组交换次数 */
+#define TEST_EXCHANGE_PERIOD    100000.0    /* 交换周期 (us) */
+#define TEST_SETTLE_NUMBER      (CLOCK_SYNC_FILTER * CLOCK_SYNC_HISTORY)    /* 拟合点填满前不检查 */
+#define TEST_SPIKE_RATE         0.05        /* 排队尖峰概率 */
+#define TEST_SPIKE_DELAY        8000.0      /* 排队尖峰时延 (us) */
+#define TEST_OFFSET_MARGIN      1.0         /* 偏移容差：基础时延差之半以外的余量（单向抖动均值的倍数） */
+#define TEST_DRIFT_TOLERANCE    0.15        /* 漂移容差：每 us 抖动均值对应的 ppm（拟合跨度约 5.6s） */
+
+/* 结构体定义 ----------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   仿真场景
+ */
+struct Struct_Scenario
+{
+    const char * Name;
+    double Local_Start;     /*!< 请求方时钟初值 (us) */
+    double Remote_Start;    /*!< 应答方时钟初值 (us) */
+    double Drift;           /*!< 应答方时钟相对请求方的频差 (ppm) */
+    double Up_Delay;        /*!< 上行（请求方 -> 应答方）基础时延 (us) */
+    double Down_Delay;      /*!< 下行（应答方 -> 请求方）基础时延 (us) */
+    double Jitter;          /*!< 单向时延指数抖动均值 (us) */
+};
+
+/* 全局变量创建 --------------------------------------------------------------------------------------------------------*/
+static const Struct_Scenario Scenario[] = {
+    {"symmetric", 1000.0, 3.0e9, 0.0, 300.0, 300.0, 40.0},
+    {"drift+", 4294000000.0, 12345.0, 80.0, 400.0, 150.0, 60.0},
+    {"drift-", 2.0e9, 4294900000.0, -120.0, 150.0, 500.0, 80.0},
+    {"crystal", 4294967000.0, 4294967000.0, 30.0, 1200.0, 250.0, 100.0},
+};
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/************************************************************************************************************************
+ * @brief   真实时间 (us) 处的时钟读数（按32位回绕）
+ ***********************************************************************************************************************/
+static uint32_t Clock(double __Start, double __Drift, double __Time)
+{
+    return ((uint32_t) (uint64_t) std::floor(__Start + __Time * (1.0 + __Drift * 1.0e-6)));
+}
+
+/************************************************************************************************************************
+ * @brief   运行一个场景
+ ***********************************************************************************************************************/
+static bool Test_Scenario(const Struct_Scenario & __Scenario, uint32_t __Seed)
+{
+    Class_Clock_Sync client, server;
+    std::mt19937 random(__Seed);
+    std::exponential_distribution<double> jitter(1.0 / __Scenario.Jitter);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    const double bound = std::fabs(__Scenario.Up_Delay - __Scenario.Down_Delay) / 2.0 +
+                         TEST_OFFSET_MARGIN * __Scenario.Jitter;
+    const double tolerance = TEST_DRIFT_TOLERANCE * __Scenario.Jitter;
+    double error_client = 0.0, error_server = 0.0, error_drift = 0.0;
+    uint32_t rejected = 0U;
+
+    client.Reset();
+    server.Reset();
+
+    for (uint32_t n = 0; n < TEST_EXCHANGE_NUMBER; n++)
+    {
+        double t1 = n * TEST_EXCHANGE_PERIOD + uniform(random) * 1000.0;
+        double up = __Scenario.Up_Delay + jitter(random) + ((uniform(random) < TEST_SPIKE_RATE) ? TEST_SPIKE_DELAY : 0.0);
+        double t2 = t1 + up;
+        double t3 = t2 + 20.0 + uniform(random) * 200.0;
+        double down = __Scenario.Down_Delay + jitter(random) +
+                      ((uniform(random) < TEST_SPIKE_RATE) ? TEST_SPIKE_DELAY : 0.0);
+        double t4 = t3 + down;
+
+        uint32_t T1 = Clock(__Scenario.Local_Start, 0.0, t1);
+        uint32_t T2 = Clock(__Scenario.Remote_Start, __Scenario.Drift, t2);
+        uint32_t T3 = Clock(__Scenario.Remote_Start, __Scenario.Drift, t3);
+        uint32_t T4 = Clock(__Scenario.Local_Start, 0.0, t4);
+
+        rejected += client.Update(T1, T2, T3, T4, true) ? 0U : 1U;
+        rejected += server.Update(T1, T2, T3, T4, false) ? 0U : 1U;
+
+        if (n < TEST_SETTLE_NUMBER)
+        {
+            continue;
+        }
+
+        /* 在本次交换之后、下次交换之前的时刻检查映射（含外推） */
+        for (uint32_t k = 0; k < 4U; k++)
+        {
+            double t = t4 + k * TEST_EXCHANGE_PERIOD / 4.0;
+            uint32_t local = Clock(__Scenario.Local_Start, 0.0, t);
+            uint32_t remote = Clock(__Scenario.Remote_Start, __Scenario.Drift, t);
+
+            error_client = std::fmax(error_client, std::fabs((double) (int32_t) (client.To_Remote(local) - remote)));
+            error_server = std::fmax(error_server, std::fabs((double) (int32_t) (server.To_Remote(remote) - local)));
+        }
+        error_drift = std::fmax(error_drift, std::fabs((double) client.Get_Drift() * 1.0e6 - __Scenario.Drift));
+        error_drift = std::fmax(error_drift, std::fabs(-(double) server.Get_Drift() * 1.0e6 - __Scenario.Drift));
+    }
+
+    bool ok = (client.Get_Valid() && server.Get_Valid() && rejected == 0U && error_client <= bound &&
+               error_server <= bound && error_drift <= tolerance && client.Get_Step_Number() == 0U &&
+               server.Get_Step_Number() == 0U);
+
+    printf("%-10s drift %+6.1f ppm  delay %4.0f/%4.0f us  max offset error client %5.1f  server %5.1f us "
+           "(bound %5.1f)  max drift error %.2f ppm (tolerance %.1f)  %s\n", __Scenario.Name, __Scenario.Drift,
+           __Scenario.Up_Delay, __Scenario.Down_Delay, error_client, error_server, bound, error_drift, tolerance,
+           ok ? "ok" : "FAIL");
+
+    return (ok);
+}
+
+/************************************************************************************************************************
+ * @brief   主函数
+ ***********************************************************************************************************************/
+int main()
+{
+    bool ok = true;
+
+    for (uint32_t i = 0; i < sizeof(Scenario) / sizeof(Scenario[0]); i++)
+    {
+        ok &= Test_Scenario(Scenario[i], 25U + i);
+    }
+
+    return (ok ? 0 : 1);
+}
@@ -0,0 +1,196 @@
+/**
+ * @file    Crc_Test.cpp
+ * @brief   CRC校验算法正确性测试（与固件共用 Crc.h、Crc.cpp）
+ *          改写前的 CRC-8/MAXIM 查表（原样保留）作为参照逐项比较生成表、逐帧比较 Calculate_CRC8；
+ *          五种常用类型校验 "123456789" 标准校验值并与逐位定义式比较；分段 Update 与整帧计算比较
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "Crc.h"
+
+#include <cstdio>
+#include <random>
+#include <vector>
+
+/* 宏定义 --------------------------------------------------------------------------------------------------------------*/
+#define TEST_FRAME_NUMBER       2000U       /* 随机帧数 */
+#define TEST_LENGTH_MAX         1024U       /* 随机帧最大字节数 */
+
+/* 变量定义 ------------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   改写前 Crc.cpp 中的 CRC-8/MAXIM 校验表（参照）
+ */
+static const uint8_t Legacy_CRC8_Table[256] =
+{
+    0x00, 0x5e, 0xbc, 0xe2, 0x61, 0x3f, 0xdd, 0x83, 0xc2, 0x9c, 0x7e, 0x20, 0xa3, 0xfd, 0x1f, 0x41,
+    0x9d, 0xc3, 0x21, 0x7f, 0xfc, 0xa2, 0x40, 0x1e, 0x5f, 0x01, 0xe3, 0xbd, 0x3e, 0x60, 0x82, 0xdc,
+    0x23, 0x7d, 0x9f, 0xc1, 0x42, 0x1c, 0xfe, 0xa0, 0xe1, 0xbf, 0x5d, 0x03, 0x80, 0xde, 0x3c, 0x62,
+    0xbe, 0xe0, 0x02, 0x5c, 0xdf, 0x81, 0x63, 0x3d, 0x7c, 0x22, 0xc0, 0x9e, 0x1d, 0x43, 0xa1, 0xff,
+    0x46, 0x18, 0xfa, 0xa4, 0x27, 0x79, 0x9b, 0xc5, 0x84, 0xda, 0x38, 0x66, 0xe5, 0xbb, 0x59, 0x07,
+    0xdb, 0x85, 0x67, 0x39, 0xba, 0xe4, 0x06, 0x58, 0x19, 0x47, 0xa5, 0xfb, 0x78, 0x26, 0xc4, 0x9a,
+    0x65, 0x3b, 0xd9, 0x87, 0x04, 0x5a, 0xb8, 0xe6, 0xa7, 0xf9, 0x1b, 0x45, 0xc6, 0x98, 0x7a, 0x24,
+    0xf8, 0xa6, 0x44, 0x1a, 0x99, 0xc7, 0x25, 0x7b, 0x3a, 0x64, 0x86, 0xd8, 0x5b, 0x05, 0xe7, 0xb9,
+    0x8c, 0xd2, 0x30, 0x6e, 0xed, 0xb3, 0x51, 0x0f, 0x4e, 0x10, 0xf2, 0xac, 0x2f, 0x71, 0x93, 0xcd,
+    0x11, 0x4f, 0xad, 0xf3, 0x70, 0x2e, 0xcc, 0x92, 0xd3, 0x8d, 0x6f, 0x31, 0xb2, 0xec, 0x0e, 0x50,
+    0xaf, 0xf1, 0x13, 0x4d, 0xce, 0x90, 0x72, 0x2c, 0x6d, 0x33, 0xd1, 0x8f, 0x0c, 0x52, 0xb0, 0xee,
+    0x32, 0x6c, 0x8e, 0xd0, 0x53, 0x0d, 0xef, 0xb1, 0xf0, 0xae, 0x4c, 0x12, 0x91, 0xcf, 0x2d, 0x73,
+    0xca, 0x94, 0x76, 0x28, 0xab, 0xf5, 0x17, 0x49, 0x08, 0x56, 0xb4, 0xea, 0x69, 0x37, 0xd5, 0x8b,
+    0x57, 0x09, 0xeb, 0xb5, 0x36, 0x68, 0x8a, 0xd4, 0x95, 0xcb, 0x29, 0x77, 0xf4, 0xaa, 0x48, 0x16,
+    0xe9, 0xb7, 0x55, 0x0b, 0x88, 0xd6, 0x34, 0x6a, 0x2b, 0x75, 0x97, 0xc9, 0x4a, 0x14, 0xf6, 0xa8,
+    0x74, 0x2a, 0xc8, 0x96, 0x15, 0x4b, 0xa9, 0xf7, 0xb6, 0xe8, 0x0a, 0x54, 0xd7, 0x89, 0x6b, 0x35,
+};
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/************************************************************************************************************************
+ * @brief   改写前的 Calculate_CRC8（逐字节查表）
+ ***********************************************************************************************************************/
+static uint8_t Legacy_CRC8(const uint8_t * __Buffer, uint32_t __Length)
+{
+    uint8_t crc = 0x00U;
+
+    while (__Length--)
+    {
+        crc = Legacy_CRC8_Table[crc ^ *__Buffer++];
+    }
+    return (crc);
+}
+
+/************************************************************************************************************************
+ * @brief   逐位定义式（Rocksoft 参数模型）
+ ***********************************************************************************************************************/
+template<typename CRC>
+struct Struct_CRC_Model;
+
+template<typename Type, Type Polynomial, Type Init, bool Reflect, Type Xor_Out>
+struct Struct_CRC_Model<Class_CRC<Type, Polynomial, Init, Reflect, Xor_Out>>
+{
+    static Type Calculate(const uint8_t * __Buffer, uint32_t __Length)
+    {
+        const uint32_t width = 8U * sizeof(Type);
+        const uint32_t top = 1U << (width - 1U);
+        uint32_t crc = Init;
+
+        for (uint32_t i = 0; i < __Length; i++)
+        {
+            uint32_t byte = Reflect ? CRC_Reflect(__Buffer[i], 8U) : __Buffer[i];
+
+            crc ^= byte << (width - 8U);
+            for (uint32_t bit = 0; bit < 8U; bit++)
+            {
+                crc = ((crc & top) ? ((crc << 1) ^ Polynomial) : (crc << 1)) & CRC_Mask(width);
+            }
+        }
+        if (Reflect)
+        {
+            crc = CRC_Reflect(crc, width);
+        }
+
+        return ((Type) (crc ^ Xor_Out));
+    }
+};
+
+/************************************************************************************************************************
+ * @brief   单个类型：标准校验值、随机帧与逐位定义式比较、随机分段与整帧比较
+ *
+ * @param   __Check     "123456789" 的标准校验值
+ ***********************************************************************************************************************/
+template<typename CRC, typename Type>
+static bool Test(const char * __Name, Type __Check)
+{
+    const uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    std::mt19937 random(21U);
+    std::uniform_int_distribution<uint32_t> length(0U, TEST_LENGTH_MAX);
+    std::uniform_int_distribution<uint32_t> offset(0U, 3U);
+    std::vector<uint8_t> buffer(TEST_LENGTH_MAX + 4U);
+    uint32_t mismatch_model = 0U, mismatch_chunk = 0U;
+    CRC crc;
+
+    Type value = CRC::Calculate(check, sizeof(check));
+
+    for (uint32_t n = 0; n < TEST_FRAME_NUMBER; n++)
+    {
+        uint32_t size = length(random);
+        uint8_t * data = buffer.data() + offset(random);
+
+        for (uint32_t i = 0; i < size; i++)
+        {
+            data[i] = (uint8_t) random();
+        }
+
+        Type one_shot = CRC::Calculate(data, size);
+        mismatch_model += (one_shot != Struct_CRC_Model<CRC>::Calculate(data, size)) ? 1U : 0U;
+
+        /* 随机分段（含0长度段、1~3字节段，模拟DMA半满/空闲中断分块） */
+        crc.Begin();
+        for (uint32_t done = 0; done < size;)
+        {
+            uint32_t chunk = std::uniform_int_distribution<uint32_t>(0U, (n % 4U == 0U) ? 3U : 64U)(random);
+
+            chunk = (chunk < size - done) ? chunk : (size - done);
+            crc.Update(data + done, chunk);
+            done += chunk;
+        }
+        mismatch_chunk += (crc.Finish() != one_shot) ? 1U : 0U;
+    }
+
+    bool ok = (value == __Check && mismatch_model == 0U && mismatch_chunk == 0U);
+    printf("%-20s check %08X (expect %08X)  vs bitwise model %u / %u  chunked vs one-shot %u / %u  %s\n", __Name,
+           (uint32_t) value, (uint32_t) __Check, mismatch_model, TEST_FRAME_NUMBER, mismatch_chunk, TEST_FRAME_NUMBER,
+           ok ? "ok" : "FAIL");
+
+    return (ok);
+}
+
+/************************************************************************************************************************
+ * @brief   CRC-8/MAXIM 与改写前实现比较：生成表逐项、Calculate_CRC8 逐帧
+ ***********************************************************************************************************************/
+static bool Test_Legacy()
+{
+    const uint8_t (&table)[4][256] = Struct_CRC_Table<uint8_t, 0x31U, true>::Table;
+    std::mt19937 random(22U);
+    std::uniform_int_distribution<uint32_t> length(0U, TEST_LENGTH_MAX);
+    std::vector<uint8_t> buffer(TEST_LENGTH_MAX);
+    uint32_t mismatch_table = 0U, mismatch_frame = 0U;
+
+    for (uint32_t i = 0; i < 256U; i++)
+    {
+        mismatch_table += (table[0][i] != Legacy_CRC8_Table[i]) ? 1U : 0U;
+    }
+    for (uint32_t n = 0; n < TEST_FRAME_NUMBER; n++)
+    {
+        uint32_t size = length(random);
+
+        for (uint32_t i = 0; i < size; i++)
+        {
+            buffer[i] = (uint8_t) random();
+        }
+        mismatch_frame += (Calculate_CRC8(buffer.data(), size) != Legacy_CRC8(buffer.data(), size)) ? 1U : 0U;
+    }
+
+    bool ok = (mismatch_table == 0U && mismatch_frame == 0U);
+    printf("%-20s table %u / 256 entries differ  Calculate_CRC8 %u / %u frames differ  %s\n", "CRC8 legacy table",
+           mismatch_table, mismatch_frame, TEST_FRAME_NUMBER, ok ? "ok" : "FAIL");
+
+    return (ok);
+}
+
+/************************************************************************************************************************
+ * @brief   主函数
+ ***********************************************************************************************************************/
+int main()
+{
+    bool ok = true;
+
+    ok &= Test_Legacy();
+    ok &= Test<Class_CRC8_MAXIM>("CRC-8/MAXIM", (uint8_t) 0xA1U);
+    ok &= Test<Class_CRC16_MCRF4XX>("CRC-16/MCRF4XX", (uint16_t) 0x6F91U);
+    ok &= Test<Class_CRC16_CCITT_FALSE>("CRC-16/CCITT-FALSE", (uint16_t) 0x29B1U);
+    ok &= Test<Class_CRC32>("CRC-32", (uint32_t) 0xCBF43926U);
+    ok &= Test<Class_CRC32_MPEG2>("CRC-32/MPEG-2", (uint32_t) 0x0376E6E7U);
+
+    return (ok ? 0 : 1);
+}
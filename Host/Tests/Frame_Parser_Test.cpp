@@ -0,0 +1,230 @@
+/**
+ * @file    Frame_Parser_Test.cpp
+ * @brief   流式帧解析回放测试（与固件共用 Frame_Parser.cpp、Cobs.cpp、Crc.cpp）
+ *          包头模式、COBS模式各回放 20000 帧：帧间无间隔首尾相接，按随机长度 (1 ~ 96 B) 分段写入 256 字节环形缓冲区
+ *          （与 UART_RX_BUFFER_SIZE 相同，分段即 DMA 半满/满/IDLE 事件），并随机插入垃圾字节、翻转单个比特；
+ *          要求所有完好帧按序取出且内容一致（零丢帧），损坏帧一律不取出（零误收）
+ * @note    COBS模式下垃圾字节后的首帧带前置结束符（对应 Communication.cpp 中线路空闲后首帧的前置结束符）；
+ *          比特翻转不落在结束符上：结束符被翻转时损坏帧与其后一帧合并，两帧同时丢弃，属于COBS定界的固有代价
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "Frame_Parser.h"
+
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+/* 宏定义 --------------------------------------------------------------------------------------------------------------*/
+#define TEST_FRAME_NUMBER       20000U          /* 每种分帧方式回放帧数 */
+#define TEST_RING_SIZE          256U            /* 环形缓冲区长度（与 UART_RX_BUFFER_SIZE 相同） */
+#define TEST_CHUNK_MAX          96U             /* 单次写入最大字节数 */
+#define TEST_GARBAGE_MAX        24U             /* 单次插入最大垃圾字节数 */
+#define TEST_GARBAGE_RATE       10U             /* 插入垃圾字节的帧占比 (%) */
+#define TEST_FLIP_RATE          5U              /* 翻转单个比特的帧占比 (%) */
+#define TEST_PACK_HEAD          0x20250301U     /* 包头（与 LUBANCAT_PACK_HEAD 相同） */
+
+/* 结构体定义 ----------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   测试包类型
+ */
+struct Struct_Test_Packet
+{
+    uint8_t Type;       /* 包类型 */
+    uint8_t Length;     /* 数据长度（变长包为最大数据长度） */
+    bool Variable;      /* 是否为变长包 */
+};
+
+/**
+ * @brief   发送的一帧
+ */
+struct Struct_Test_Frame
+{
+    uint8_t Type;                   /* 包类型 */
+    uint8_t Length;                 /* 数据长度 */
+    uint8_t Data[FRAME_MAX_LENGTH]; /* 数据 */
+    uint32_t Time;                  /* 时间戳（帧序号） */
+};
+
+/* 变量定义 ------------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   注册的包类型（含空数据包与最大长度变长包）
+ */
+static const Struct_Test_Packet Test_Packet[] =
+{
+    {0x01U, 12U, false},
+    {0x02U, 0U, false},
+    {0x03U, 40U, false},
+    {0x04U, FRAME_MAX_LENGTH - FRAME_OVERHEAD, true},
+};
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/************************************************************************************************************************
+ * @brief   组帧（与 Class_LuBanCat_Host::Send 相同的帧格式）
+ *
+ * @param   __Leading   COBS模式是否前置结束符
+ * @return  std::vector<uint8_t>    线上字节
+ ***********************************************************************************************************************/
+static std::vector<uint8_t> Build(Enum_Frame_Mode __Mode, const Struct_Test_Frame & __Frame, bool __Leading)
+{
+    uint8_t frame[FRAME_MAX_LENGTH];
+    uint32_t length = __Frame.Length + FRAME_OVERHEAD;
+    const uint32_t head = TEST_PACK_HEAD;
+
+    memcpy(frame, &head, 4);
+    frame[4] = __Frame.Type;
+    frame[5] = __Frame.Length;
+    memcpy(&frame[FRAME_HEADER_LENGTH], __Frame.Data, __Frame.Length);
+    memcpy(&frame[FRAME_HEADER_LENGTH + __Frame.Length], &__Frame.Time, FRAME_TIME_LENGTH);
+
+    if (__Mode == Frame_Mode_Head)
+    {
+        frame[length - 1U] = Class_CRC8_MAXIM::Calculate(frame, length - 1U);
+        return (std::vector<uint8_t>(frame, frame + length));
+    }
+
+    uint8_t encoded[FRAME_COBS_MAX_ENCODED + 2U];
+    uint32_t offset = __Leading ? 1U : 0U;
+
+    frame[length - 1U] = Class_CRC8_MAXIM::Calculate(&frame[4], length - 5U);
+    encoded[0] = COBS_DELIMITER;
+    uint32_t encoded_length = COBS_Encode(&frame[4], length - 4U, &encoded[offset]) + offset;
+    encoded[encoded_length++] = COBS_DELIMITER;
+    return (std::vector<uint8_t>(encoded, encoded + encoded_length));
+}
+
+/************************************************************************************************************************
+ * @brief   单种分帧方式回放
+ ***********************************************************************************************************************/
+static bool Test_Replay(Enum_Frame_Mode __Mode, const char * __Name)
+{
+    std::mt19937 random(17U + __Mode);
+    std::uniform_int_distribution<uint32_t> percent(0U, 99U);
+    std::uniform_int_distribution<uint32_t> byte(0U, 255U);
+    std::uniform_int_distribution<uint32_t> chunk(1U, TEST_CHUNK_MAX);
+    std::uniform_int_distribution<uint32_t> garbage(1U, TEST_GARBAGE_MAX);
+    const uint32_t packet_number = sizeof(Test_Packet) / sizeof(Test_Packet[0]);
+    std::vector<uint8_t> stream;
+    std::vector<Struct_Test_Frame> intact;
+
+    /* 生成字节流 */
+    for (uint32_t n = 0; n < TEST_FRAME_NUMBER; n++)
+    {
+        const Struct_Test_Packet & packet = Test_Packet[random() % packet_number];
+        Struct_Test_Frame frame;
+        bool leading = false;
+
+        frame.Type = packet.Type;
+        frame.Length = packet.Variable ? (uint8_t) (random() % (packet.Length + 1U)) : packet.Length;
+        for (uint32_t i = 0; i < frame.Length; i++)
+        {
+            /* 约 1/4 为 0x00，覆盖COBS短段 */
+            frame.Data[i] = (random() % 4U == 0U) ? 0x00U : (uint8_t) byte(random);
+        }
+        frame.Time = n;
+
+        if (percent(random) < TEST_GARBAGE_RATE)
+        {
+            for (uint32_t i = garbage(random); i > 0U; i--)
+            {
+                stream.push_back((uint8_t) byte(random));
+            }
+            leading = true;
+        }
+
+        std::vector<uint8_t> wire = Build(__Mode, frame, leading);
+
+        if (percent(random) < TEST_FLIP_RATE)
+        {
+            /* 避开前置、末尾结束符 */
+            uint32_t first = (__Mode == Frame_Mode_COBS) ? (leading ? 1U : 0U) : 0U;
+            uint32_t last = (__Mode == Frame_Mode_COBS) ? (uint32_t) wire.size() - 1U : (uint32_t) wire.size();
+            uint32_t bit = random() % ((last - first) * 8U);
+
+            wire[first + bit / 8U] ^= (uint8_t) (1U << (bit % 8U));
+        }
+        else
+        {
+            intact.push_back(frame);
+        }
+        stream.insert(stream.end(), wire.begin(), wire.end());
+    }
+
+    /* 分段写入环形缓冲区并逐帧取出 */
+    static uint8_t ring[TEST_RING_SIZE];
+    Class_Frame_Parser parser;
+    uint32_t position = 0U, write = 0U, received = 0U, mismatch = 0U, overrun = 0U;
+
+    parser.Init(ring, TEST_RING_SIZE, TEST_PACK_HEAD, __Mode);
+    for (const Struct_Test_Packet & packet : Test_Packet)
+    {
+        parser.Register(packet.Type, packet.Length, packet.Variable);
+    }
+
+    while (position < stream.size())
+    {
+        uint32_t size = chunk(random);
+
+        size = (size < stream.size() - position) ? size : (uint32_t) (stream.size() - position);
+        overrun += (parser.Get_Pending_Length((uint16_t) write) + size >= TEST_RING_SIZE) ? 1U : 0U;
+        for (uint32_t i = 0; i < size; i++)
+        {
+            ring[write] = stream[position++];
+            write = (write + 1U) & (TEST_RING_SIZE - 1U);
+        }
+
+        const uint8_t * packet;
+        while ((packet = parser.Next((uint16_t) write)) != nullptr)
+        {
+            /* 与下一个完好帧逐字节比较（取出损坏帧或漏帧时不一致） */
+            if (received >= intact.size() || packet[0] != intact[received].Type ||
+                packet[1] != intact[received].Length ||
+                memcmp(&packet[2], intact[received].Data, intact[received].Length) != 0 ||
+                Frame_Get_Time(packet) != intact[received].Time)
+            {
+                mismatch += 1U;
+                break;
+            }
+            received += 1U;
+        }
+        if (mismatch != 0U)
+        {
+            break;
+        }
+    }
+
+    bool ok = (received == intact.size() && mismatch == 0U && overrun == 0U);
+
+    printf("%-6s %u frames  %u intact  %u received  %u error  %u skipped byte  %u lost  %s\n", __Name,
+           TEST_FRAME_NUMBER, (uint32_t) intact.size(), received, parser.Get_Error_Number(), parser.Get_Skip_Number(),
+           (uint32_t) intact.size() - received, ok ? "ok" : "FAIL");
+    if (mismatch != 0U)
+    {
+        printf("%-6s ERROR frame %u (time %u) differs from the next intact frame\n", __Name, received,
+               (received < intact.size()) ? intact[received].Time : 0U);
+    }
+    if (overrun != 0U)
+    {
+        printf("%-6s ERROR %u chunks would overrun the ring\n", __Name, overrun);
+    }
+
+    return (ok);
+}
+
+/************************************************************************************************************************
+ * @brief   主函数
+ ***********************************************************************************************************************/
+int main()
+{
+    bool ok = true;
+
+    ok &= Test_Replay(Frame_Mode_Head, "head");
+    ok &= Test_Replay(Frame_Mode_COBS, "COBS");
+
+    return (ok ? 0 : 1);
+}
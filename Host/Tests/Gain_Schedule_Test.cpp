@@ -0,0 +1,190 @@
+/**
+ * @file    Gain_Schedule_Test.cpp
+ * @brief   增益调度缓存区间与 arm_linear_interp_f32 一致性测试（与固件共用 Gain_Schedule.h）
+ *          参考值为 arm_linear_interp_f32（低于首个断点取首项，超出末个断点取末项）；调度变量取小步随机游走
+ *          （以缓存区间为主，跨越区间与表外）、表内外随机跳变、各断点及其两侧相邻 float 交替，
+ *          K_P/K_I/K_D 与参考值之差不超过 4 个 float 精度（按表中最大值）；断点两侧结果连续；
+ *          Get_Changed 须与本次结果是否不同于上次一致（Init 后首次为 true，表外与平坦区间内为 false）
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "Gain_Schedule.h"
+
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+/* 宏定义 --------------------------------------------------------------------------------------------------------------*/
+#define TEST_N                  5U          /* 断点数 */
+#define TEST_X_START            2.0f        /* 首个断点 (rad/s) */
+#define TEST_X_SPACING          5.0f        /* 断点间距 (rad/s) */
+#define TEST_WALK_NUMBER        200000U     /* 随机游走步数 */
+#define TEST_WALK_STEP          0.05f       /* 随机游走最大步长 */
+#define TEST_JUMP_NUMBER        100000U     /* 随机跳变次数 */
+#define TEST_X_MIN              -5.0f       /* 调度变量测试范围（覆盖表外两侧） */
+#define TEST_X_MAX              30.0f
+#define TEST_TOLERANCE          (4.0f * FLT_EPSILON * 5.0f)     /* 4 个 float 精度（按表中最大值 5.0） */
+
+/* 类定义 --------------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   增益调度测试类（读取缓存区间序号）
+ */
+class Class_Gain_Schedule_Probe : public Class_Gain_Schedule<TEST_N>
+{
+public:
+    inline uint32_t Get_Segment()
+    {
+        return (this->Segment);
+    }
+};
+
+/* 全局变量创建 --------------------------------------------------------------------------------------------------------*/
+/* K_P 末区间平坦、K_D 首区间平坦，覆盖区间内结果不变的情况 */
+static float K_P_Table[TEST_N] = {0.10f, 0.14f, 0.20f, 0.22f, 0.22f};
+static float K_I_Table[TEST_N] = {5.0f, 4.0f, 3.0f, 3.0f, 2.5f};
+static float K_D_Table[TEST_N] = {0.0f, 0.0f, 0.01f, 0.02f, 0.03f};
+static arm_linear_interp_instance_f32 Interp_K_P = {TEST_N, TEST_X_START, TEST_X_SPACING, K_P_Table};
+static arm_linear_interp_instance_f32 Interp_K_I = {TEST_N, TEST_X_START, TEST_X_SPACING, K_I_Table};
+static arm_linear_interp_instance_f32 Interp_K_D = {TEST_N, TEST_X_START, TEST_X_SPACING, K_D_Table};
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/************************************************************************************************************************
+ * @brief   参考值（arm_linear_interp_f32，首个间距以下取首项）
+ ***********************************************************************************************************************/
+static float Reference(arm_linear_interp_instance_f32 * __Interp, float __X)
+{
+    return ((__X < TEST_X_START) ? __Interp->pYData[0] : arm_linear_interp_f32(__Interp, __X));
+}
+
+/************************************************************************************************************************
+ * @brief   增益调度测试器（逐次计算并与参考值、上次结果比较）
+ ***********************************************************************************************************************/
+struct Struct_Checker
+{
+    Class_Gain_Schedule_Probe Schedule;
+    float Pre_K[3] = {0.0f, 0.0f, 0.0f};
+    uint32_t Pre_Segment = 0U;
+    float Error = 0.0f;
+    uint32_t Mismatch = 0U;         /* 超出容差次数 */
+    uint32_t Changed_Error = 0U;    /* Get_Changed 与结果是否变化不一致次数 */
+    uint32_t Unchanged = 0U;        /* 结果未变化次数 */
+    uint32_t Cached = 0U;           /* 区间未变化（缓存区间）次数 */
+    uint32_t Number = 0U;
+
+    void Check(float __X)
+    {
+        this->Schedule.Calculate(__X);
+
+        float k[3] = {this->Schedule.Get_K_P(), this->Schedule.Get_K_I(), this->Schedule.Get_K_D()};
+        float e = std::fmax(std::fabs(k[0] - Reference(&Interp_K_P, __X)),
+                            std::fmax(std::fabs(k[1] - Reference(&Interp_K_I, __X)),
+                                      std::fabs(k[2] - Reference(&Interp_K_D, __X))));
+        bool changed = (k[0] != this->Pre_K[0] || k[1] != this->Pre_K[1] || k[2] != this->Pre_K[2]);
+
+        this->Error = std::fmax(this->Error, e);
+        this->Mismatch += (e <= TEST_TOLERANCE) ? 0U : 1U;
+        this->Changed_Error += (this->Schedule.Get_Changed() == changed) ? 0U : 1U;
+        this->Unchanged += changed ? 0U : 1U;
+        this->Cached += (this->Schedule.Get_Segment() == this->Pre_Segment) ? 1U : 0U;
+        this->Number += 1U;
+        for (uint32_t i = 0; i < 3U; i++)
+        {
+            this->Pre_K[i] = k[i];
+        }
+        this->Pre_Segment = this->Schedule.Get_Segment();
+    }
+
+    bool Print(const char * __Name)
+    {
+        bool ok = (this->Mismatch == 0U && this->Changed_Error == 0U);
+
+        printf("%-10s %6u calls  %6u cached  %6u unchanged  max error %.1e  %u beyond tolerance  "
+               "%u Get_Changed errors  %s\n", __Name, this->Number, this->Cached, this->Unchanged, this->Error,
+               this->Mismatch, this->Changed_Error, ok ? "ok" : "FAIL");
+
+        return (ok);
+    }
+};
+
+/************************************************************************************************************************
+ * @brief   主函数
+ ***********************************************************************************************************************/
+int main()
+{
+    static Struct_Checker checker;
+    std::mt19937 random(7U);
+    std::uniform_real_distribution<float> step(-TEST_WALK_STEP, TEST_WALK_STEP);
+    std::uniform_real_distribution<float> jump(TEST_X_MIN, TEST_X_MAX);
+    const float x_end = TEST_X_START + (TEST_N - 1U) * TEST_X_SPACING;
+    bool ok = true;
+
+    checker.Schedule.Init(TEST_X_START, TEST_X_SPACING, K_P_Table, K_I_Table, K_D_Table);
+
+    /* Init 后首次计算有变化（即使结果与 Init 内的计算相同），其后同一调度变量无变化 */
+    checker.Schedule.Calculate(TEST_X_START);
+    bool first = checker.Schedule.Get_Changed();
+    checker.Schedule.Calculate(TEST_X_START);
+    bool second = checker.Schedule.Get_Changed();
+    checker.Pre_K[0] = checker.Schedule.Get_K_P();
+    checker.Pre_K[1] = checker.Schedule.Get_K_I();
+    checker.Pre_K[2] = checker.Schedule.Get_K_D();
+    checker.Pre_Segment = checker.Schedule.Get_Segment();
+    ok &= (first && !second);
+    printf("%-10s first Calculate after Init changed %d, repeated %d  %s\n", "init", first, second,
+           (first && !second) ? "ok" : "FAIL");
+
+    /* 小步随机游走：以缓存区间为主，在测试范围两端之间往返，跨越各区间与表外两侧 */
+    float x = TEST_X_MIN, drift = 0.4f * TEST_WALK_STEP;
+    for (uint32_t n = 0; n < TEST_WALK_NUMBER; n++)
+    {
+        x += step(random) + drift;
+        drift = (x > TEST_X_MAX) ? -Math_Abs(drift) : ((x < TEST_X_MIN) ? Math_Abs(drift) : drift);
+        checker.Check(x);
+    }
+    ok &= checker.Print("walk");
+    ok &= (checker.Cached > checker.Number * 9U / 10U && checker.Unchanged > 0U);
+
+    /* 随机跳变：每次重新定位 */
+    checker = Struct_Checker();
+    checker.Schedule.Init(TEST_X_START, TEST_X_SPACING, K_P_Table, K_I_Table, K_D_Table);
+    for (uint32_t n = 0; n < TEST_JUMP_NUMBER; n++)
+    {
+        checker.Check(jump(random));
+    }
+    ok &= checker.Print("jump");
+
+    /* 断点及其两侧相邻 float 交替（含首、末断点），两侧结果连续 */
+    float discontinuity = 0.0f;
+    checker = Struct_Checker();
+    checker.Schedule.Init(TEST_X_START, TEST_X_SPACING, K_P_Table, K_I_Table, K_D_Table);
+    for (uint32_t i = 0; i < TEST_N; i++)
+    {
+        float point = TEST_X_START + i * TEST_X_SPACING;
+        float side[3] = {std::nextafter(point, -FLT_MAX), point, std::nextafter(point, FLT_MAX)};
+        float k[3];
+
+        for (uint32_t j = 0; j < 3U; j++)
+        {
+            checker.Check(side[j]);
+            k[j] = checker.Schedule.Get_K_I();
+        }
+        checker.Check(side[0]);
+        checker.Check(side[2]);
+        checker.Check(side[1]);
+        discontinuity = std::fmax(discontinuity, std::fmax(std::fabs(k[1] - k[0]), std::fabs(k[2] - k[1])));
+    }
+    checker.Check(x_end + 1.0f);
+    checker.Check(FLT_MAX);
+    checker.Check(-FLT_MAX);
+    ok &= checker.Print("breakpoint");
+    ok &= (discontinuity <= TEST_TOLERANCE);
+    printf("%-10s max K_I step across a breakpoint %.1e  %s\n", "continuity", discontinuity,
+           (discontinuity <= TEST_TOLERANCE) ? "ok" : "FAIL");
+
+    return (ok ? 0 : 1);
+}
@@ -0,0 +1,173 @@
+/**
+ * @file    Gear_SCurve_Test.cpp
+ * @brief   S曲线变速调节时间、超调与前馈测试（与固件共用 Gear.cpp、Pid.h）
+ *          静止阶跃（加速度未达限幅的三角形、达到限幅的梯形、反向、底盘50ms周期、超出 V_Max）：
+ *          各周期加速度不超过 A_Max、加速度变化量不超过 J_Max * D_T，输出不越过设定值，
+ *          调节时间（输出等于设定值且加速度为0）不超过加加速度受限的理论最短时间 + 2个周期；
+ *          加速中途改设定值为当前输出附近：超调不超过以 J_Max 将当前加速度减至0所需的速度变化
+ *          a^2 / (2 * J_Max) + 1个周期的变化量；
+ *          PID 以 Set_Target_Rate 输入规划加速度时，前馈与目标值单周期差分前馈之差不超过 K_F * J_Max * D_T^2 / 2
+ *          （梯形积分与矩形前馈之差，另计输出值的 float 舍入），即两种前馈下 K_F 含义相同
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "Gear.h"
+#include "Pid.h"
+
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
+
+/* 宏定义 --------------------------------------------------------------------------------------------------------------*/
+#define TEST_TIME               3.0f    /* 每组仿真时间 (s) */
+#define TEST_SETTLE_MARGIN      2U      /* 调节时间余量（周期数） */
+#define TEST_K_F                0.8f    /* 前馈参数 */
+#define TEST_EPSILON            1.0e-4f /* 浮点相对容差 */
+
+/* 结构体定义 ----------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   测试场景（由 Start 静止阶跃至 Target，Retarget_Time 非0时在该时刻改设定值为 当前输出 + Retarget_Delta）
+ */
+struct Struct_Test_Case
+{
+    const char * Name;
+    float V_Max;
+    float A_Max;
+    float J_Max;
+    float D_T;
+    float Start;
+    float Target;
+    float Retarget_Time;
+    float Retarget_Delta;
+};
+
+/* 全局变量创建 --------------------------------------------------------------------------------------------------------*/
+static const Struct_Test_Case Test_Case[] = {
+    {"triangle", 0.0f, 50.0f, 500.0f, 0.001f, 0.0f, 2.0f, 0.0f, 0.0f},
+    {"trapezoid", 0.0f, 50.0f, 500.0f, 0.001f, 0.0f, 20.0f, 0.0f, 0.0f},
+    {"reverse", 0.0f, 50.0f, 500.0f, 0.001f, 20.0f, -15.0f, 0.0f, 0.0f},
+    {"chassis", 0.0f, 27.0f, 200.0f, 0.05f, 0.0f, 10.0f, 0.0f, 0.0f},
+    {"v_max", 26.0f, 50.0f, 500.0f, 0.001f, 0.0f, 40.0f, 0.0f, 0.0f},
+    {"retarget", 0.0f, 50.0f, 500.0f, 0.001f, 0.0f, 20.0f, 0.2f, 1.0f},
+    {"brake", 0.0f, 50.0f, 500.0f, 0.001f, 0.0f, 20.0f, 0.3f, -2.0f},
+};
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/************************************************************************************************************************
+ * @brief   静止起止、加加速度受限的理论最短调节时间
+ ***********************************************************************************************************************/
+static float Settle_Time(float __Delta, float __A_Max, float __J_Max)
+{
+    __Delta = std::fabs(__Delta);
+
+    return ((__Delta * __J_Max >= __A_Max * __A_Max) ? (__Delta / __A_Max + __A_Max / __J_Max)
+                                                      : (2.0f * std::sqrt(__Delta / __J_Max)));
+}
+
+/************************************************************************************************************************
+ * @brief   运行一个场景
+ ***********************************************************************************************************************/
+static bool Test(const Struct_Test_Case & __Case)
+{
+    Class_Gear_SCurve gear;
+    Class_PID_2DOF pid_rate, pid_diff;
+    const uint32_t step_number = (uint32_t) (TEST_TIME / __Case.D_T + 0.5f);
+    const float j_d_t = __Case.J_Max * __Case.D_T;
+    float target = (__Case.V_Max > 0.0f) ? std::fmax(std::fmin(__Case.Target, __Case.V_Max), -__Case.V_Max)
+                                         : __Case.Target;
+    float direction = (target > __Case.Start) ? 1.0f : -1.0f;
+    float overshoot_max = 0.0f, overshoot = 0.0f, feedforward_error = 0.0f;
+    float pre_acceleration = 0.0f, settle = TEST_TIME;
+    uint32_t violation = 0U;
+    bool settled = false;
+
+    gear.Init(__Case.V_Max, __Case.A_Max, __Case.J_Max, __Case.D_T);
+    gear.Reset(__Case.Start);
+    gear.Set_Value(__Case.Target);
+    pid_rate.Init(0.0f, 0.0f, 0.0f, TEST_K_F, 0.0f, 0.0f, __Case.D_T);
+    pid_diff.Init(0.0f, 0.0f, 0.0f, TEST_K_F, 0.0f, 0.0f, __Case.D_T);
+    pid_rate.Set_Target(__Case.Start);
+    pid_diff.Set_Target(__Case.Start);
+    pid_rate.Calculate();
+    pid_diff.Calculate();
+
+    for (uint32_t n = 0; n < step_number; n++)
+    {
+        /* 加速中途改设定值：超调上限为当前加速度以 J_Max 减至0所需的速度变化 */
+        if (__Case.Retarget_Time > 0.0f && n == (uint32_t) (__Case.Retarget_Time / __Case.D_T + 0.5f))
+        {
+            float acceleration = gear.Get_Acceleration();
+
+            target = gear.Get_Out() + __Case.Retarget_Delta;
+            direction = (__Case.Retarget_Delta > 0.0f) ? 1.0f : -1.0f;
+            overshoot_max = acceleration * acceleration / (2.0f * __Case.J_Max) + j_d_t * __Case.D_T;
+            gear.Set_Value(target);
+        }
+
+        gear.Calculate();
+
+        float out = gear.Get_Out();
+        float acceleration = gear.Get_Acceleration();
+
+        /* 加速度、加加速度限幅 */
+        violation += (std::fabs(acceleration) <= __Case.A_Max * (1.0f + TEST_EPSILON)) ? 0U : 1U;
+        violation += (std::fabs(acceleration - pre_acceleration) <= j_d_t * (1.0f + TEST_EPSILON)) ? 0U : 1U;
+        pre_acceleration = acceleration;
+
+        /* 超调、调节时间 */
+        overshoot = std::fmax(overshoot, (out - target) * direction);
+        if (out == target && acceleration == 0.0f)
+        {
+            if (!settled)
+            {
+                settle = (n + 1U) * __Case.D_T;
+            }
+            settled = true;
+        }
+        else
+        {
+            settled = false;
+        }
+
+        /* 规划加速度前馈与单周期差分前馈比较 */
+        pid_rate.Set_Target(out);
+        pid_rate.Set_Target_Rate(acceleration);
+        pid_rate.Calculate();
+        pid_diff.Set_Target(out);
+        pid_diff.Calculate();
+        feedforward_error = std::fmax(feedforward_error, std::fabs(pid_rate.Get_Out() - pid_diff.Get_Out()));
+    }
+
+    float settle_max = (__Case.Retarget_Time > 0.0f) ? TEST_TIME :
+                       Settle_Time(target - __Case.Start, __Case.A_Max, __Case.J_Max) + TEST_SETTLE_MARGIN * __Case.D_T;
+    float overshoot_bound = overshoot_max + TEST_EPSILON * std::fabs(target);
+    float feedforward_bound = TEST_K_F * (j_d_t * __Case.D_T * 0.5f +
+                                          4.0f * FLT_EPSILON * std::fmax(std::fabs(__Case.Start), std::fabs(target)));
+    bool ok = (violation == 0U && settled && settle <= settle_max && overshoot <= overshoot_bound &&
+               feedforward_error <= feedforward_bound);
+
+    printf("%-10s settle %.3f s (max %.3f)  overshoot %.2e (max %.2e)  feedforward error %.2e (max %.2e)  "
+           "limit violations %u  %s\n", __Case.Name, settle, settle_max, overshoot, overshoot_bound, feedforward_error,
+           feedforward_bound, violation, ok ? "ok" : "FAIL");
+
+    return (ok);
+}
+
+/************************************************************************************************************************
+ * @brief   主函数
+ ***********************************************************************************************************************/
+int main()
+{
+    bool ok = true;
+
+    for (uint32_t i = 0; i < sizeof(Test_Case) / sizeof(Test_Case[0]); i++)
+    {
+        ok &= Test(Test_Case[i]);
+    }
+
+    return (ok ? 0 : 1);
+}
@@ -0,0 +1,206 @@
+/**
+ * @file    Math_Fast_Test.cpp
+ * @brief   快速数学函数精度测试（与固件共用 Math_Fast.h、User_Math.cpp）
+ *          以双精度 libm 为参照扫描输入区间，最大误差不超过 Math_Fast.cpp 注释中给出的值；
+ *          取整、取余与单精度 libm 逐位比较
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "Math_Fast.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+
+/* 宏定义 --------------------------------------------------------------------------------------------------------------*/
+#define TEST_SAMPLE_NUMBER      2000000U    /* 每项随机采样点数 */
+#define TEST_TOLERANCE_SIN      4.2e-7      /* sin/cos 最大绝对误差，|x| <= PI（与 Math_Fast_Sin_Cos 注释一致） */
+#define TEST_TOLERANCE_SIN_100  7.0e-6      /* sin/cos 最大绝对误差，|x| <= 100 */
+#define TEST_TOLERANCE_ATAN2    3.1e-7      /* atan2 最大绝对误差 (rad)（与 Math_Fast_Atan2 注释一致） */
+#define TEST_TOLERANCE_SINC     3.0e-7      /* Math_Sinc 最大绝对误差 */
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/************************************************************************************************************************
+ * @brief   输出一行结果
+ ***********************************************************************************************************************/
+static bool Report(const char * __Name, double __Error, double __Tolerance)
+{
+    bool ok = (__Error <= __Tolerance);
+
+    printf("%-28s max error %.3e  (tolerance %.2e)  %s\n", __Name, __Error, __Tolerance, ok ? "ok" : "FAIL");
+    return (ok);
+}
+
+/************************************************************************************************************************
+ * @brief   sin/cos：随机采样 + 区间端点、表节点附近
+ ***********************************************************************************************************************/
+static double Error_Sin_Cos(float __Range)
+{
+    std::mt19937 random(1U);
+    std::uniform_real_distribution<float> value(-__Range, __Range);
+    double error = 0.0;
+
+    auto check = [&](float __X) {
+        float s, c;
+
+        Math_Fast_Sin_Cos(__X, &s, &c);
+        error = std::fmax(error, std::fabs(s - std::sin((double) __X)));
+        error = std::fmax(error, std::fabs(c - std::cos((double) __X)));
+        error = std::fmax(error, std::fabs(Math_Fast_Sin(__X) - s));
+        error = std::fmax(error, std::fabs(Math_Fast_Cos(__X) - c));
+    };
+
+    for (uint32_t n = 0; n < TEST_SAMPLE_NUMBER; n++)
+    {
+        check(value(random));
+    }
+    for (int32_t i = -(int32_t) MATH_FAST_TABLE_SIZE; i <= (int32_t) MATH_FAST_TABLE_SIZE; i++)
+    {
+        float node = (float) (i * PI / MATH_FAST_TABLE_SIZE);
+
+        check(node);
+        check(std::nextafter(node, -INFINITY));
+        check(std::nextafter(node, INFINITY));
+    }
+    check(-__Range);
+    check(__Range);
+
+    return (error);
+}
+
+/************************************************************************************************************************
+ * @brief   atan2：单位圆全角度、跨数量级半径随机采样 + 坐标轴与符号零
+ ***********************************************************************************************************************/
+static double Error_Atan2(bool * __Sign_Ok)
+{
+    std::mt19937 random(2U);
+    std::uniform_real_distribution<float> angle(-PI, PI);
+    std::uniform_real_distribution<float> exponent(-20.0f, 20.0f);
+    double error = 0.0;
+
+    auto check = [&](float __Y, float __X) {
+        error = std::fmax(error, std::fabs(Math_Fast_Atan2(__Y, __X) - std::atan2((double) __Y, (double) __X)));
+    };
+
+    for (uint32_t n = 0; n < TEST_SAMPLE_NUMBER; n++)
+    {
+        float theta = angle(random);
+        float radius = std::exp2(exponent(random));
+
+        check(radius * std::sin(theta), radius * std::cos(theta));
+    }
+    const float axis[][2] = {{0.0f, 1.0f}, {1.0f, 0.0f}, {0.0f, -1.0f}, {-1.0f, 0.0f}, {1.0f, 1.0f},
+                             {-1.0f, -1.0f}, {1.0f, -1.0f}, {-1.0f, 1.0f}, {-0.0f, 1.0f}, {-0.0f, -1.0f},
+                             {1e-30f, 1e30f}, {1e30f, 1e-30f}};
+    for (const float (&item)[2] : axis)
+    {
+        check(item[0], item[1]);
+    }
+
+    /* 符号零：atan2(+0, -x) = +PI，atan2(-0, -x) = -PI；原点返回0 */
+    *__Sign_Ok = Math_Fast_Atan2(0.0f, -1.0f) > 0.0f && Math_Fast_Atan2(-0.0f, -1.0f) < 0.0f &&
+                 Math_Fast_Atan2(0.0f, 0.0f) == 0.0f;
+
+    return (error);
+}
+
+/************************************************************************************************************************
+ * @brief   Math_Sinc：0 附近按相对误差、其余按绝对误差
+ ***********************************************************************************************************************/
+static double Error_Sinc()
+{
+    std::mt19937 random(3U);
+    std::uniform_real_distribution<float> value(-4.0f * PI, 4.0f * PI);
+    double error = 0.0;
+
+    auto check = [&](float __X) {
+        double reference = (__X == 0.0f) ? 1.0 : std::sin((double) __X) / __X;
+
+        error = std::fmax(error, std::fabs(Math_Sinc(__X) - reference));
+    };
+
+    for (uint32_t n = 0; n < TEST_SAMPLE_NUMBER; n++)
+    {
+        check(value(random));
+    }
+    for (float x = 1e-30f; x < 1.0f; x *= 1.5f)
+    {
+        check(x);
+        check(-x);
+    }
+    check(0.0f);
+
+    return (error);
+}
+
+/************************************************************************************************************************
+ * @brief   取整、取余、归一化、开方：与单精度 libm 比较
+ *
+ * @param   __Mismatch  各函数不一致的采样数：floor, sqrt, fmod, Wrap_PI（超出 [-PI, PI)）
+ * @return  double      Wrap_PI 结果与输入之差偏离 2 * PI 整数倍的最大值
+ ***********************************************************************************************************************/
+static double Mismatch_Elementary(uint32_t __Mismatch[4])
+{
+    std::mt19937 random(4U);
+    std::uniform_real_distribution<float> value(-1.0e4f, 1.0e4f);
+    std::uniform_real_distribution<float> positive(0.0f, 1.0e6f);
+    double wrap_error = 0.0;
+
+    for (uint32_t n = 0; n < TEST_SAMPLE_NUMBER; n++)
+    {
+        float x = value(random);
+        float p = positive(random);
+
+        __Mismatch[0] += (Math_Fast_Floor(x) != std::floor(x)) ? 1U : 0U;
+        __Mismatch[1] += (Math_Fast_Sqrt(p) != std::sqrt(p)) ? 1U : 0U;
+
+        /* 舵机角度取余（周期 360 度），含符号零逐位比较 */
+        float fmod_fast = Math_Fast_Fmod(x, 360.0f);
+        float fmod_libm = std::fmod(x, 360.0f);
+        __Mismatch[2] += (std::memcmp(&fmod_fast, &fmod_libm, sizeof(float)) != 0) ? 1U : 0U;
+
+        /* 归一化结果在 [-PI, PI) 内，且与输入相差 2 * PI 的整数倍 */
+        float wrap = Math_Fast_Wrap_PI(x);
+        double turn = ((double) x - wrap) / (2.0 * PI);
+        __Mismatch[3] += (wrap < -PI || wrap >= PI) ? 1U : 0U;
+        wrap_error = std::fmax(wrap_error, std::fabs(turn - std::round(turn)) * 2.0 * PI);
+    }
+    __Mismatch[1] += (Math_Fast_Sqrt(-1.0f) != 0.0f) ? 1U : 0U;
+    __Mismatch[0] += (Math_Fast_Floor(-0.5f) != -1.0f || Math_Fast_Floor(2.0f) != 2.0f) ? 1U : 0U;
+
+    return (wrap_error);
+}
+
+/************************************************************************************************************************
+ * @brief   主函数
+ ***********************************************************************************************************************/
+int main()
+{
+    bool ok = true;
+    bool sign_ok;
+    uint32_t mismatch[4] = {0U, 0U, 0U, 0U};
+
+    ok &= Report("sin/cos |x| <= PI", Error_Sin_Cos(PI), TEST_TOLERANCE_SIN);
+    ok &= Report("sin/cos |x| <= 100", Error_Sin_Cos(100.0f), TEST_TOLERANCE_SIN_100);
+    ok &= Report("atan2", Error_Atan2(&sign_ok), TEST_TOLERANCE_ATAN2);
+    ok &= Report("Math_Sinc |x| <= 4 PI", Error_Sinc(), TEST_TOLERANCE_SINC);
+
+    /* |x| <= 1e4 时单精度间隔约 1e-3，归一化误差为 x 的舍入误差 */
+    ok &= Report("Wrap_PI |x| <= 1e4", Mismatch_Elementary(mismatch), 1.0e-3);
+
+    const char * name[4] = {"floor vs floorf", "sqrt vs sqrtf", "fmod vs fmodf (bitwise)", "Wrap_PI in [-PI, PI)"};
+    for (uint32_t i = 0; i < 4U; i++)
+    {
+        printf("%-28s %u mismatch  %s\n", name[i], mismatch[i], (mismatch[i] == 0U) ? "ok" : "FAIL");
+        ok &= (mismatch[i] == 0U);
+    }
+    printf("%-28s %s\n", "atan2 signed zero", sign_ok ? "ok" : "FAIL");
+    ok &= sign_ok;
+
+    return (ok ? 0 : 1);
+}
@@ -0,0 +1,230 @@
+/**
+ * @file    Motor_DJI_Test.cpp
+ * @brief   大疆电机反馈帧解包一致性测试（Motor_DJI.cpp 原样编译，CAN 由 Shim 仿真）
+ *          随机帧与各字段边界值（0、0x7FFF、0x8000、0xFFFF）下，Class_DJI_Motor_CAN_Layout 解包须与原手写移位
+ *          （Math_Endian_Reverse_16 逐字段反转）逐位相同，Encode 须还原原帧；DataGet 连续正反转多圈，
+ *          角度、角速度、电流与原逐项换算公式相对误差不超过 1e-6，温度（摄氏度）与反馈一致；
+ *          Control 写入发送缓冲区的字节与原手写移位相同
+ * @note    原实现以16位读取温度（字节6为高字节、保留字节7为低字节），新布局只取字节6，比较原16位值的高字节
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.1
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "Motor_DJI.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+
+/* 宏定义 --------------------------------------------------------------------------------------------------------------*/
+#define TEST_FRAME_NUMBER       200000U     /* 随机帧数 */
+#define TEST_STEP_NUMBER        100000U     /* DataGet 连续接收次数 */
+#define TEST_GEARBOX_RATE       (3591.0f / 187.0f)  /* C620 默认减速比（M3508） */
+#define TEST_CURRENT_CONVERSION (20.0f / 16384.0f)  /* 转矩电流换算值（与 Class_DJI_Motor_C620 相同） */
+
+/* 结构体定义 ----------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   原手写移位解包结果
+ */
+struct Struct_Reference_Data
+{
+    uint16_t Encoder;
+    int16_t Omega;
+    int16_t Torque;
+    int16_t Temperature;
+};
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/************************************************************************************************************************
+ * @brief   原解包（与原 DataGet 中 Math_Endian_Reverse_16 逐字段反转相同）
+ ***********************************************************************************************************************/
+static Struct_Reference_Data Reference_Decode(const uint8_t * __Frame)
+{
+    Struct_Reference_Data data;
+
+    data.Encoder = (uint16_t) ((__Frame[0] << 8) | __Frame[1]);
+    data.Omega = (int16_t) ((__Frame[2] << 8) | __Frame[3]);
+    data.Torque = (int16_t) ((__Frame[4] << 8) | __Frame[5]);
+    data.Temperature = (int16_t) ((__Frame[6] << 8) | __Frame[7]);
+
+    return (data);
+}
+
+/************************************************************************************************************************
+ * @brief   相对误差
+ ***********************************************************************************************************************/
+static float Relative_Error(float __Value, float __Reference)
+{
+    return ((__Reference == 0.0f) ? std::fabs(__Value) : std::fabs(__Value - __Reference) / std::fabs(__Reference));
+}
+
+/************************************************************************************************************************
+ * @brief   帧布局解包、打包与原手写移位比较
+ ***********************************************************************************************************************/
+static bool Test_Layout()
+{
+    std::mt19937 random(13U);
+    const uint16_t edge[] = {0x0000U, 0x0001U, 0x7FFFU, 0x8000U, 0x8001U, 0xFFFFU};
+    const uint32_t edge_number = sizeof(edge) / sizeof(edge[0]);
+    uint32_t mismatch = 0U, frame_number = 0U;
+
+    for (uint32_t n = 0; n < TEST_FRAME_NUMBER + edge_number * edge_number; n++)
+    {
+        uint8_t frame[8], encoded[8];
+        Struct_DJI_Motor_CAN_Data data;
+
+        for (uint32_t i = 0; i < 8U; i++)
+        {
+            frame[i] = (uint8_t) random();
+        }
+        if (n >= TEST_FRAME_NUMBER)
+        {
+            /* 各字段取边界值组合（编码器与转速、转矩与温度） */
+            uint16_t a = edge[(n - TEST_FRAME_NUMBER) / edge_number];
+            uint16_t b = edge[(n - TEST_FRAME_NUMBER) % edge_number];
+
+            frame[0] = frame[4] = (uint8_t) (a >> 8);
+            frame[1] = frame[5] = (uint8_t) a;
+            frame[2] = frame[6] = (uint8_t) (b >> 8);
+            frame[3] = frame[7] = (uint8_t) b;
+        }
+
+        Struct_Reference_Data reference = Reference_Decode(frame);
+        Class_DJI_Motor_CAN_Layout::Decode(frame, &data);
+        memcpy(encoded, frame, 8U);
+        memset(encoded, 0x5A, 7U);
+        Class_DJI_Motor_CAN_Layout::Encode(&data, encoded);
+
+        if (data.Encoder != reference.Encoder || data.Omega != reference.Omega || data.Torque != reference.Torque ||
+            data.Temperature != (int8_t) (reference.Temperature >> 8) || memcmp(encoded, frame, 8U) != 0)
+        {
+            mismatch += 1U;
+        }
+        frame_number += 1U;
+    }
+
+    bool ok = (mismatch == 0U);
+
+    printf("%-8s %u frames (%u edge)  %u differ from hand-written shifts  %s\n", "layout", frame_number,
+           edge_number * edge_number, mismatch, ok ? "ok" : "FAIL");
+
+    return (ok);
+}
+
+/************************************************************************************************************************
+ * @brief   DataGet 连续接收（正反转多圈）与原换算公式比较
+ ***********************************************************************************************************************/
+static bool Test_DataGet()
+{
+    static Class_DJI_Motor_C620 motor;      /* 与固件全局对象相同，零初始化 */
+    std::mt19937 random(31U);
+    std::uniform_int_distribution<int32_t> step(-3000, 3000);
+    std::uniform_int_distribution<int32_t> raw(-32768, 32767);
+    std::uniform_int_distribution<int32_t> celsius(-20, 127);
+    int32_t total = 0, total_reference = 0, round = 0, round_max = 0;
+    uint16_t pre_encoder = 0U;
+    float error_angle = 0.0f, error_omega = 0.0f, error_torque = 0.0f;
+    uint32_t encoder_mismatch = 0U, temperature_mismatch = 0U;
+
+    motor.Init(&CAN1_Manage_Object, DJI_Motor_ID_0x201, DJI_Motor_Control_Method_OMEGA, TEST_GEARBOX_RATE);
+
+    for (uint32_t n = 0; n < TEST_STEP_NUMBER; n++)
+    {
+        uint8_t * frame = CAN1_Manage_Object.Rx_Buffer.Data;
+
+        /* 每次转过不超过半圈，前半段正转、后半段反转 */
+        total += (n < TEST_STEP_NUMBER / 2U) ? Math_Abs(step(random)) : -Math_Abs(step(random));
+        uint16_t encoder = (uint16_t) (((total % 8192) + 8192) % 8192);
+        int16_t omega = (int16_t) raw(random);
+        int16_t torque = (int16_t) raw(random);
+        int8_t temperature = (int8_t) celsius(random);
+
+        frame[0] = (uint8_t) (encoder >> 8);
+        frame[1] = (uint8_t) encoder;
+        frame[2] = (uint8_t) ((uint16_t) omega >> 8);
+        frame[3] = (uint8_t) omega;
+        frame[4] = (uint8_t) ((uint16_t) torque >> 8);
+        frame[5] = (uint8_t) torque;
+        frame[6] = (uint8_t) temperature;
+        frame[7] = 0U;
+        motor.DataGet();
+
+        /* 原 DataGet 圈数累计与换算 */
+        int16_t delta = (int16_t) (encoder - pre_encoder);
+        round += (delta < -4096) ? 1 : ((delta > 4096) ? -1 : 0);
+        total_reference = round * 8192 + encoder;
+        pre_encoder = encoder;
+        round_max = (round > round_max) ? round : round_max;
+
+        float angle = (float) total_reference / (float) 8192 * 2.0f * PI / TEST_GEARBOX_RATE;
+        float omega_reference = (float) omega * RPM_TO_RADPS / TEST_GEARBOX_RATE;
+        float torque_reference = (float) torque * TEST_CURRENT_CONVERSION;
+
+        encoder_mismatch += (total_reference != total) ? 1U : 0U;
+        temperature_mismatch += (motor.Get_Now_Temperature() != ((temperature < 0) ? 0 : temperature)) ? 1U : 0U;
+        error_angle = std::fmax(error_angle, Relative_Error(motor.Get_Now_Angle(), angle));
+        error_omega = std::fmax(error_omega, Relative_Error(motor.Get_Now_Omega(), omega_reference));
+        error_torque = std::fmax(error_torque, Relative_Error(motor.Get_Now_Torque(), torque_reference));
+    }
+
+    bool ok = (encoder_mismatch == 0U && temperature_mismatch == 0U && error_angle <= 1.0e-6f && error_omega <= 1.0e-6f &&
+               error_torque <= 1.0e-6f);
+
+    printf("%-8s %u frames  up to %d turns  round count errors %u  temperature (C) errors %u  max rel error angle %.1e  "
+           "omega %.1e  current %.1e  %s\n", "DataGet", TEST_STEP_NUMBER, round_max, encoder_mismatch,
+           temperature_mismatch, error_angle, error_omega, error_torque, ok ? "ok" : "FAIL");
+
+    return (ok);
+}
+
+/************************************************************************************************************************
+ * @brief   Control 发送缓冲区填充与原手写移位比较
+ ***********************************************************************************************************************/
+static bool Test_Control()
+{
+    static Class_DJI_Motor_C620 motor;      /* 与固件全局对象相同，零初始化 */
+    std::mt19937 random(7U);
+    std::uniform_real_distribution<float> torque(-0.0488f, 0.0488f);
+    uint32_t mismatch = 0U;
+
+    motor.Init(&CAN1_Manage_Object, DJI_Motor_ID_0x202, DJI_Motor_Control_Method_TORQUE);
+
+    for (uint32_t n = 0; n < TEST_FRAME_NUMBER; n++)
+    {
+        motor.Set_Target_Torque(torque(random));
+        motor.Control();
+
+        /* 原实现：int16_t 输出高字节在前 */
+        int16_t out = motor.Get_Out() / TEST_CURRENT_CONVERSION;
+        uint8_t reference[2] = {(uint8_t) ((int16_t) out >> 8), (uint8_t) (int16_t) out};
+
+        mismatch += (memcmp(&DJI_0x200_CAN1_Tx_Data[2], reference, 2U) != 0) ? 1U : 0U;
+    }
+
+    DJI_CAN_SendData();
+    bool ok = (mismatch == 0U && CAN_Sim_Get_Tx_ID() == 0x200U &&
+               memcmp(CAN_Sim_Get_Tx_Data(), DJI_0x200_CAN1_Tx_Data, 8U) == 0);
+
+    printf("%-8s %u commands  %u differ from hand-written shifts  %s\n", "Control", TEST_FRAME_NUMBER, mismatch,
+           ok ? "ok" : "FAIL");
+
+    return (ok);
+}
+
+/************************************************************************************************************************
+ * @brief   主函数
+ ***********************************************************************************************************************/
+int main()
+{
+    bool ok = true;
+
+    ok &= Test_Layout();
+    ok &= Test_DataGet();
+    ok &= Test_Control();
+
+    return (ok ? 0 : 1);
+}
@@ -0,0 +1,168 @@
+/**
+ * @file    Pid_2DOF_Test.cpp
+ * @brief   二自由度PID与原PID一致性测试（与固件共用 Pid.h）
+ *          Class_PID_2DOF 取默认参数（N = 0、b = c = 1、K_T = 0）时须与 Class_PID 逐周期输出相同：
+ *          以底盘轮速环参数（Chassis::Init，I_Out_Max = 10、Out_Max = 20、50ms 周期）开环、闭环各运行，
+ *          目标值大幅阶跃使积分长时间处于限幅，统计积分饱和周期占比；另校验 K_T > 0 时反算抗饱和缩短退饱和时间、
+ *          修改 K_I 时积分项输出不跳变
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "Pid.h"
+
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+/* 宏定义 --------------------------------------------------------------------------------------------------------------*/
+#define TEST_STEP_NUMBER        100000U     /* 每组控制周期数 */
+#define TEST_D_T                0.05f       /* 控制周期 (s) */
+#define TEST_I_OUT_MAX          10.0f       /* 积分限幅 */
+#define TEST_OUT_MAX            20.0f       /* 输出限幅 */
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/************************************************************************************************************************
+ * @brief   默认参数下与 Class_PID 逐周期比较
+ *
+ * @param   __K_D           D参数
+ * @param   __Closed_Loop   是否闭环（一阶轮速模型，输出即开环角速度指令）
+ ***********************************************************************************************************************/
+static bool Test_Default(const char * __Name, float __K_D, bool __Closed_Loop)
+{
+    Class_PID pid;
+    Class_PID_2DOF pid_2dof;
+    std::mt19937 random(6U);
+    std::uniform_real_distribution<float> target(-26.0f, 26.0f);
+    std::normal_distribution<float> noise(0.0f, 0.2f);
+    float set = 0.0f, actual = 0.0f;
+    float difference = 0.0f;
+    uint32_t saturated = 0U;
+
+    pid.Init(0.1f, 5.0f, __K_D, 0.0f, TEST_I_OUT_MAX, TEST_OUT_MAX, TEST_D_T);
+    pid_2dof.Init(0.1f, 5.0f, __K_D, 0.0f, TEST_I_OUT_MAX, TEST_OUT_MAX, TEST_D_T);
+
+    for (uint32_t n = 0; n < TEST_STEP_NUMBER; n++)
+    {
+        if (n % 80U == 0U)
+        {
+            set = target(random);
+        }
+        if (!__Closed_Loop)
+        {
+            /* 开环：实际值慢速跟随，误差长时间存在，积分持续饱和 */
+            actual += 0.02f * (set - actual);
+        }
+
+        float measure = actual + noise(random);
+
+        pid.Set_Target(set);
+        pid.Set_Actual(measure);
+        pid.Calculate();
+        pid_2dof.Set_Target(set);
+        pid_2dof.Set_Actual(measure);
+        pid_2dof.Calculate();
+
+        difference = std::fmax(difference, std::fabs(pid.Get_Out() - pid_2dof.Get_Out()));
+        difference = std::fmax(difference, std::fabs(pid.Get_Integral_Error() - pid_2dof.Get_Integral_Error()));
+        saturated += (std::fabs(5.0f * pid.Get_Integral_Error()) >= TEST_I_OUT_MAX) ? 1U : 0U;
+
+        if (__Closed_Loop)
+        {
+            /* 闭环：一阶轮速模型（时间常数 2 个控制周期，增益 0.8，输出饱和时跟不上阶跃） */
+            actual += (0.8f * pid.Get_Out() - actual) * 0.5f;
+        }
+    }
+
+    /* 须逐位相同，且积分饱和确实发生 */
+    bool ok = (difference == 0.0f && saturated > TEST_STEP_NUMBER / 20U);
+
+    printf("%-12s %-6s  max diff vs Class_PID %.2e  integral saturated %5.1f%%  %s\n", __Name,
+           __Closed_Loop ? "closed" : "open", difference, 100.0f * saturated / TEST_STEP_NUMBER, ok ? "ok" : "FAIL");
+
+    return (ok);
+}
+
+/************************************************************************************************************************
+ * @brief   反算抗饱和：输出长时间饱和后目标值反向，K_T > 0 时退饱和更快
+ ***********************************************************************************************************************/
+static bool Test_Back_Calculation()
+{
+    uint32_t recover[2];
+
+    for (uint32_t i = 0; i < 2U; i++)
+    {
+        Class_PID_2DOF pid;
+        float actual = 0.0f;
+
+        /* 积分限幅取输出限幅的 2 倍，仅靠积分限幅时积分项可长时间压住输出 */
+        pid.Init(0.1f, 5.0f, 0.0f, 0.0f, 2.0f * TEST_OUT_MAX, TEST_OUT_MAX, TEST_D_T);
+        pid.Set_K_T((i == 0U) ? 0.0f : 4.0f);
+        recover[i] = 0U;
+
+        for (uint32_t n = 0; n < 400U; n++)
+        {
+            /* 目标值超出可达范围 60 个周期后回到可达值 */
+            pid.Set_Target((n < 60U) ? 30.0f : 5.0f);
+            pid.Set_Actual(actual);
+            pid.Calculate();
+            actual += (0.8f * pid.Get_Out() - actual) * 0.5f;
+            if (n >= 60U && recover[i] == 0U && actual < 6.0f)
+            {
+                recover[i] = n - 60U;
+            }
+        }
+    }
+
+    bool ok = (recover[1] != 0U && recover[1] < recover[0]);
+
+    printf("%-12s %-6s  recover from saturation K_T = 0: %u ticks  K_T = 4: %u ticks  %s\n", "back calc", "closed",
+           recover[0], recover[1], ok ? "ok" : "FAIL");
+
+    return (ok);
+}
+
+/************************************************************************************************************************
+ * @brief   修改 K_I（增益调度）前后积分项输出 K_I * 积分值 不变
+ ***********************************************************************************************************************/
+static bool Test_K_I_Bumpless()
+{
+    Class_PID_2DOF pid;
+
+    pid.Init(0.1f, 5.0f, 0.0f, 0.0f, TEST_I_OUT_MAX, TEST_OUT_MAX, TEST_D_T);
+    pid.Set_Target(1.0f);
+    for (uint32_t n = 0; n < 20U; n++)
+    {
+        pid.Calculate();
+    }
+
+    float i_out = 5.0f * pid.Get_Integral_Error();
+    pid.Set_K_I(8.0f);
+    float jump = std::fabs(8.0f * pid.Get_Integral_Error() - i_out);
+    bool ok = (i_out > 0.0f && jump <= 1.0e-6f * i_out);
+
+    printf("%-12s %-6s  integral output %.4f  jump after K_I 5 -> 8 %.1e  %s\n", "K_I change", "-", i_out, jump,
+           ok ? "ok" : "FAIL");
+
+    return (ok);
+}
+
+/************************************************************************************************************************
+ * @brief   主函数
+ ***********************************************************************************************************************/
+int main()
+{
+    bool ok = true;
+
+    ok &= Test_Default("chassis PI", 0.0f, false);
+    ok &= Test_Default("chassis PI", 0.0f, true);
+    ok &= Test_Default("chassis PID", 0.002f, false);
+    ok &= Test_Default("chassis PID", 0.002f, true);
+    ok &= Test_Back_Calculation();
+    ok &= Test_K_I_Bumpless();
+
+    return (ok ? 0 : 1);
+}
@@ -0,0 +1,129 @@
+/**
+ * @file    Pid_Bank_Test.cpp
+ * @brief   PID控制器组与单路PID一致性测试（与固件共用 Pid.h、Pid_Bank.h）
+ *          Class_PID_Bank<4> 与 4 个 Class_PID 以底盘轮速环参数（Chassis::Init）逐周期比较，要求输出、积分逐位相同：
+ *          目标值大幅阶跃使积分长时间限幅；各路随机离开、再次加入控制器组（按 Chassis::Wheel_Control_Bank 每周期 Reset，
+ *          再次加入时与新建的 Class_PID 比较）；各路随机修改 K_I（含 0 与非 0 之间切换）
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "Pid.h"
+#include "Pid_Bank.h"
+
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+/* 宏定义 --------------------------------------------------------------------------------------------------------------*/
+#define TEST_STEP_NUMBER        200000U     /* 控制周期数 */
+#define TEST_WHEEL_NUMBER       4U          /* 控制器路数（底盘四轮） */
+#define TEST_K_P                0.1f        /* 底盘轮速环参数（Chassis::Init） */
+#define TEST_K_I                5.0f
+#define TEST_K_D                0.002f
+#define TEST_I_OUT_MAX          10.0f
+#define TEST_OUT_MAX            20.0f
+#define TEST_D_T                0.05f
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/************************************************************************************************************************
+ * @brief   主函数
+ ***********************************************************************************************************************/
+int main()
+{
+    Class_PID_Bank<TEST_WHEEL_NUMBER> bank;
+    Class_PID pid[TEST_WHEEL_NUMBER];
+    float k_i[TEST_WHEEL_NUMBER];
+    float set[TEST_WHEEL_NUMBER] = {0.0f};
+    float actual[TEST_WHEEL_NUMBER] = {0.0f};
+    bool run[TEST_WHEEL_NUMBER];
+    std::mt19937 random(1U);
+    std::uniform_real_distribution<float> target(-26.0f, 26.0f);
+    std::uniform_int_distribution<uint32_t> percent(0U, 999U);
+    std::normal_distribution<float> noise(0.0f, 0.2f);
+    const float k_i_choice[4] = {0.0f, 2.0f, 5.0f, 8.0f};
+    float difference = 0.0f;
+    uint32_t saturated = 0U, reenter = 0U, k_i_change = 0U, compare = 0U;
+
+    bank.Init(TEST_K_P, TEST_K_I, TEST_K_D, 0.0f, TEST_I_OUT_MAX, TEST_OUT_MAX, TEST_D_T);
+    for (uint32_t i = 0; i < TEST_WHEEL_NUMBER; i++)
+    {
+        pid[i].Init(TEST_K_P, TEST_K_I, TEST_K_D, 0.0f, TEST_I_OUT_MAX, TEST_OUT_MAX, TEST_D_T);
+        k_i[i] = TEST_K_I;
+        run[i] = true;
+    }
+
+    for (uint32_t n = 0; n < TEST_STEP_NUMBER; n++)
+    {
+        for (uint32_t i = 0; i < TEST_WHEEL_NUMBER; i++)
+        {
+            /* 约 0.5% 概率离开或再次加入控制器组（电机停止、切换模式） */
+            if (percent(random) < 5U)
+            {
+                run[i] = !run[i];
+                if (run[i])
+                {
+                    pid[i] = Class_PID();
+                    pid[i].Init(TEST_K_P, k_i[i], TEST_K_D, 0.0f, TEST_I_OUT_MAX, TEST_OUT_MAX, TEST_D_T);
+                    actual[i] = 0.0f;
+                    reenter += 1U;
+                }
+            }
+            /* 约 0.2% 概率修改 K_I（积分值保持不变） */
+            if (percent(random) < 2U)
+            {
+                k_i[i] = k_i_choice[random() % 4U];
+                bank.Set_K_I(i, k_i[i]);
+                pid[i].Set_K_I(k_i[i]);
+                k_i_change += 1U;
+            }
+            if (n % 60U == 0U)
+            {
+                set[i] = target(random);
+            }
+
+            if (run[i])
+            {
+                float measure = actual[i] + noise(random);
+
+                bank.Set_Target(i, set[i]);
+                bank.Set_Actual(i, measure);
+                pid[i].Set_Target(set[i]);
+                pid[i].Set_Actual(measure);
+                pid[i].Calculate();
+            }
+            else
+            {
+                bank.Reset(i);
+            }
+        }
+
+        bank.Calculate();
+
+        for (uint32_t i = 0; i < TEST_WHEEL_NUMBER; i++)
+        {
+            if (!run[i])
+            {
+                continue;
+            }
+            difference = std::fmax(difference, std::fabs(bank.Get_Out(i) - pid[i].Get_Out()));
+            difference = std::fmax(difference, std::fabs(bank.Get_Integral_Error(i) - pid[i].Get_Integral_Error()));
+            saturated += (std::fabs(k_i[i] * pid[i].Get_Integral_Error()) >= TEST_I_OUT_MAX) ? 1U : 0U;
+            compare += 1U;
+
+            /* 一阶轮速模型（时间常数 2 个控制周期，输出饱和时跟不上阶跃） */
+            actual[i] += (0.8f * pid[i].Get_Out() - actual[i]) * 0.5f;
+        }
+    }
+
+    bool ok = (difference == 0.0f && saturated > compare / 20U && reenter > 100U && k_i_change > 100U);
+
+    printf("Class_PID_Bank<4> vs 4x Class_PID  %u ticks compared  max diff %.2e  integral saturated %4.1f%%  "
+           "%u re-entries  %u K_I changes  %s\n", compare, difference, 100.0f * saturated / compare, reenter,
+           k_i_change, ok ? "ok" : "FAIL");
+
+    return (ok ? 0 : 1);
+}
@@ -0,0 +1,174 @@
+/**
+ * @file    Pid_Q31_Test.cpp
+ * @brief   Q31定点PID与浮点PID一致性测试（与固件共用 Pid.h、Pid_Q31.h）
+ *          以 Motor::Init_Q31 的定标（编码器计数 -> PWM比较值）构造控制器，分别开环（同一误差序列）、
+ *          闭环（各自驱动相同的一阶电机模型）运行，输出偏差不超过 Class_PID_Q31 注释中给出的容差
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.1
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "Pid.h"
+#include "Pid_Q31.h"
+
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+/* 宏定义 --------------------------------------------------------------------------------------------------------------*/
+#define TEST_STEP_NUMBER        200000U     /* 每组控制周期数（50ms 周期下约 2.8h） */
+#define TEST_TOLERANCE          2.0e-5f     /* 输出偏差容差（相对输出限幅，与 Class_PID_Q31 注释一致） */
+#define TEST_DRIFT              (4.0f / 2147483648.0f)  /* 开环积分截断误差每周期累积上限（相对输出限幅，1 LSB） */
+
+/* 结构体定义 ----------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   测试参数（实际单位：误差为控制周期内编码器计数，输出为PWM比较值）
+ */
+struct Struct_Test_Case
+{
+    const char * Name;
+    float K_P;
+    float K_I;
+    float K_D;
+    float I_Out_Max;
+    float Out_Max;
+    float Error_Max;
+    float D_T;
+    bool Compare_PID;   /* 积分不饱和，另与 Class_PID 比较 */
+};
+
+/**
+ * @brief   浮点参照PID（与定点版本相同算式：积分项 K_I * D_T * 误差 累加后限幅，输出限幅不影响积分）
+ */
+struct Struct_Reference_PID
+{
+    float K_P;
+    float K_I_D_T;
+    float K_D_Div_D_T;
+    float I_Out_Max;
+    float Out_Max;
+    float I_Out;
+    float Pre_Error;
+};
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/************************************************************************************************************************
+ * @brief   浮点参照PID计算
+ *
+ * @return  float   输出值
+ ***********************************************************************************************************************/
+static float Reference_Calculate(Struct_Reference_PID * __PID, float __Error)
+{
+    float pd_out = __PID->K_P * __Error + __PID->K_D_Div_D_T * (__Error - __PID->Pre_Error);
+
+    __PID->I_Out = std::fmin(std::fmax(__PID->I_Out + __PID->K_I_D_T * __Error, -__PID->I_Out_Max), __PID->I_Out_Max);
+    __PID->Pre_Error = __Error;
+
+    return (std::fmin(std::fmax(pd_out + __PID->I_Out, -__PID->Out_Max), __PID->Out_Max));
+}
+
+/************************************************************************************************************************
+ * @brief   单组测试
+ * @note    浮点参照为 Struct_Reference_PID（积分累加后限幅，与定点算式相同）；
+ *          Class_PID、Class_PID_2DOF 先限幅后累加，积分限幅时有一拍差异，仅在积分不饱和的用例 (Compare_PID) 中比较
+ ***********************************************************************************************************************/
+static bool Test(const Struct_Test_Case & __Case, bool __Closed_Loop)
+{
+    Class_PID_Q31 pid_q31;
+    Struct_Reference_PID reference;
+    Class_PID pid;
+    std::mt19937 random(7U);
+    std::uniform_real_distribution<float> target(-0.45f * __Case.Error_Max, 0.45f * __Case.Error_Max);
+    std::normal_distribution<float> noise(0.0f, 1.0f);
+    float set = 0.0f;
+    float actual_q31 = 0.0f, actual_float = 0.0f;
+    float error_reference = 0.0f, error_pid = 0.0f;
+    uint32_t saturated = 0U;
+
+    float threshold = pid_q31.Init(__Case.K_P, __Case.K_I, __Case.K_D, __Case.I_Out_Max, __Case.Out_Max,
+                                   __Case.Error_Max, __Case.D_T);
+    /* 定点版本积分限幅为0时限幅至输出限幅，浮点参照取相同值 */
+    float i_out_max = (__Case.I_Out_Max != 0.0f) ? __Case.I_Out_Max : __Case.Out_Max;
+    reference = {__Case.K_P, __Case.K_I * __Case.D_T, __Case.K_D / __Case.D_T, i_out_max, __Case.Out_Max, 0.0f, 0.0f};
+    pid.Init(__Case.K_P, __Case.K_I, __Case.K_D, 0.0f, i_out_max, __Case.Out_Max, __Case.D_T);
+
+    for (uint32_t n = 0; n < TEST_STEP_NUMBER; n++)
+    {
+        if (n % 100U == 0U)
+        {
+            set = target(random);
+        }
+
+        if (!__Closed_Loop)
+        {
+            /* 开环：实际值为带噪声的一阶跟随，两者输入相同 */
+            actual_q31 += 0.1f * (set - actual_q31);
+            actual_float = actual_q31 + noise(random);
+        }
+
+        /* 开环时输入为整数编码器计数（与 Control_Q31 相同走 Raw_To_Q31）；闭环时不量化，避免计数跳变放大两环差异 */
+        float actual_in_q31 = __Closed_Loop ? actual_q31 : std::round(actual_float);
+        float actual_in_float = __Closed_Loop ? actual_float : std::round(actual_float);
+
+        /* 增益过大时定点版本误差在饱和阈值处饱和（P项此时已饱和），浮点参照输入相同的饱和误差 */
+        actual_in_float = set - std::fmin(std::fmax(set - actual_in_float, -threshold), threshold);
+
+        pid_q31.Set_Target(pid_q31.Scale_Error.To_Q31(set));
+        pid_q31.Set_Actual(__Closed_Loop ? pid_q31.Scale_Error.To_Q31(actual_in_q31) :
+                                           pid_q31.Scale_Error.Raw_To_Q31((int32_t) actual_in_q31));
+        pid_q31.Calculate();
+        float out_reference = Reference_Calculate(&reference, set - actual_in_float);
+        pid.Set_Target(set);
+        pid.Set_Actual(actual_in_float);
+        pid.Calculate();
+
+        float out_q31 = pid_q31.Scale_Out.To_Float(pid_q31.Get_Out());
+
+        error_reference = std::fmax(error_reference, std::fabs(out_q31 - out_reference) / __Case.Out_Max);
+        error_pid = std::fmax(error_pid, std::fabs(out_q31 - pid.Get_Out()) / __Case.Out_Max);
+        saturated += (std::fabs(out_reference) >= __Case.Out_Max) ? 1U : 0U;
+
+        if (__Closed_Loop)
+        {
+            /* 闭环：一阶电机模型（满占空比对应满量程转速的 0.9 倍，时间常数 3 个控制周期） */
+            actual_q31 += (0.9f * __Case.Error_Max * 0.5f * out_q31 / __Case.Out_Max - actual_q31) / 3.0f;
+            actual_float += (0.9f * __Case.Error_Max * 0.5f * out_reference / __Case.Out_Max - actual_float) / 3.0f;
+        }
+    }
+
+    /* 开环时积分无反馈，截断误差随周期数累积 */
+    float tolerance = TEST_TOLERANCE + (__Closed_Loop ? 0.0f : TEST_DRIFT * TEST_STEP_NUMBER);
+    bool ok = (error_reference <= tolerance) && (!__Case.Compare_PID || error_pid <= tolerance);
+
+    printf("%-14s %-6s  error threshold %7.1f / %7.1f  max diff vs float %.2e  vs PID %.2e%s  saturated %5.1f%%  %s\n",
+           __Case.Name, __Closed_Loop ? "closed" : "open", threshold, __Case.Error_Max, error_reference, error_pid,
+           __Case.Compare_PID ? "" : " (n/a)", 100.0f * saturated / TEST_STEP_NUMBER, ok ? "ok" : "FAIL");
+
+    return (ok);
+}
+
+/************************************************************************************************************************
+ * @brief   主函数
+ ***********************************************************************************************************************/
+int main()
+{
+    /* 底盘电机：13线编码器四倍频、减速比27、50ms 周期（1 计数约 0.0895 rad/s），PWM 周期 1000，Omega_MAX 26 rad/s */
+    const float gain = 0.0895f / 0.026f;
+    const Struct_Test_Case test_case[] = {
+        {"chassis PI",   0.1f * gain, 5.0f * gain, 0.0f,          10.0f / 0.026f, 1000.0f, 580.0f, 0.05f, false},
+        {"chassis PID",  0.1f * gain, 5.0f * gain, 0.002f * gain, 10.0f / 0.026f, 1000.0f, 580.0f, 0.05f, false},
+        {"high gain PI", 4.0f * gain, 40.0f * gain, 0.0f,         0.0f,           1000.0f, 580.0f, 0.05f, false},
+        {"low gain PI",  0.1f * gain, 0.5f * gain, 0.0f,          0.0f,           1000.0f, 580.0f, 0.05f, true},
+    };
+    bool ok = true;
+
+    for (const Struct_Test_Case & item : test_case)
+    {
+        ok &= Test(item, false);
+        ok &= Test(item, true);
+    }
+
+    return (ok ? 0 : 1);
+}
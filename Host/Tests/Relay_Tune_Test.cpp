@@ -0,0 +1,198 @@
+/**
+ * @file    Relay_Tune_Test.cpp
+ * @brief   继电自整定模型验证（与固件共用 Relay_Tune.h、Pid.h）
+ *          一阶惯性加纯滞后 (FOPDT) 电机模型 G(s) = K * e^(-L s) / (T s + 1)，按 Motor::Control 的时序仿真：
+ *          控制周期内输出保持，测速为控制周期内平均转速；继电实验测得的 K_U、T_U 与模型解析值比较，
+ *          再以整定参数闭环（Class_PID_2DOF，与 PID_Omega 相同）做阶跃响应，校验稳定、超调与稳态误差
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "Pid.h"
+#include "Relay_Tune.h"
+
+#include <cmath>
+#include <cstdio>
+#include <deque>
+#include <random>
+
+/* 宏定义 --------------------------------------------------------------------------------------------------------------*/
+#define TEST_D_T                0.05f   /* 控制周期 (s)（底盘电机 50ms） */
+#define TEST_SUBSTEP            50U     /* 每控制周期模型积分步数 */
+#define TEST_TOLERANCE_K_U      0.30f   /* K_U 相对误差容差（描述函数近似、滞环相位滞后） */
+#define TEST_TOLERANCE_T_U      0.30f   /* T_U 相对误差容差（临界周期仅 4~16 个控制周期，切换时刻按 D_T 量化） */
+#define TEST_OVERSHOOT          0.25f   /* 闭环阶跃超调上限（Tyreus-Luyben PI） */
+#define TEST_STEADY_ERROR       0.02f   /* 闭环稳态误差上限（相对阶跃幅值） */
+
+/* 类定义 --------------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   FOPDT 电机模型（输入为开环输出角速度 rad/s，输出为实际角速度）
+ */
+class Class_FOPDT
+{
+public:
+    Class_FOPDT(float __K, float __T, float __L) : K(__K), T(__T),
+        Delay((size_t) std::lround(__L / (TEST_D_T / TEST_SUBSTEP)), 0.0f) {}
+
+    /**
+     * @brief   输入保持一个控制周期，返回周期内平均转速（编码器计数 / 周期）
+     */
+    float Step(float __In, float __Noise)
+    {
+        const float h = TEST_D_T / TEST_SUBSTEP;
+        float sum = 0.0f;
+
+        for (uint32_t i = 0; i < TEST_SUBSTEP; i++)
+        {
+            float in = __In;
+
+            if (!this->Delay.empty())
+            {
+                this->Delay.push_back(__In);
+                in = this->Delay.front();
+                this->Delay.pop_front();
+            }
+            this->Omega += (this->K * in - this->Omega) * h / this->T;
+            sum += this->Omega;
+        }
+
+        return (sum / TEST_SUBSTEP + __Noise);
+    }
+
+protected:
+    float K;
+    float T;
+    float Omega = 0.0f;
+    std::deque<float> Delay;
+};
+
+/* 结构体定义 ----------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   测试模型参数
+ */
+struct Struct_Test_Case
+{
+    const char * Name;
+    float K;        /* 稳态增益 */
+    float T;        /* 时间常数 (s) */
+    float L;        /* 纯滞后 (s) */
+};
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/************************************************************************************************************************
+ * @brief   解析临界增益、临界周期（等效滞后计入零阶保持 D_T / 2 与周期平均测速 D_T / 2）
+ *          相位穿越：atan(w T) + w L_eff = PI，K_U = sqrt(1 + (w T)^2) / K
+ ***********************************************************************************************************************/
+static void Ultimate(const Struct_Test_Case & __Case, float * __K_U, float * __T_U)
+{
+    double l_eff = __Case.L + TEST_D_T;
+    double low = 0.0, high = PI / l_eff;
+
+    for (uint32_t i = 0; i < 100U; i++)
+    {
+        double w = 0.5 * (low + high);
+
+        ((std::atan(w * __Case.T) + w * l_eff < PI) ? low : high) = w;
+    }
+    *__K_U = (float) (std::sqrt(1.0 + low * low * __Case.T * __Case.T) / __Case.K);
+    *__T_U = (float) (2.0 * PI / low);
+}
+
+/************************************************************************************************************************
+ * @brief   单组测试：偏置 10 rad/s、继电幅值 3 rad/s、滞环 0.3 rad/s（与 AutotuneStart 的用法一致），测速噪声 0.1 rad/s
+ ***********************************************************************************************************************/
+static bool Test(const Struct_Test_Case & __Case)
+{
+    const float set = 10.0f, amplitude = 3.0f, hysteresis = 0.3f;
+    Class_FOPDT plant(__Case.K, __Case.T, __Case.L);
+    Class_Relay_Tune relay;
+    Class_PID_2DOF pid;
+    std::mt19937 random(11U);
+    std::normal_distribution<float> noise(0.0f, 0.1f);
+    float k_u, t_u, k_p, k_i, k_d;
+    float actual = 0.0f;
+    uint32_t tick = 0U;
+
+    Ultimate(__Case, &k_u, &t_u);
+
+    /* 工作点 */
+    for (uint32_t n = 0; n < 200U; n++)
+    {
+        actual = plant.Step(set / __Case.K, noise(random));
+    }
+
+    /* 继电实验（超时 30 s，与 AutotuneStart 相同） */
+    relay.Init(amplitude, hysteresis, TEST_D_T, 4U, (uint32_t) (30.0f / TEST_D_T));
+    relay.Start(set, set / __Case.K);
+    while (relay.Get_State() == Relay_Tune_Running)
+    {
+        relay.Set_Actual(actual);
+        relay.Calculate();
+        actual = plant.Step(relay.Get_Out(), noise(random));
+        tick += 1U;
+    }
+
+    if (!relay.Get_Gains(Relay_Tune_Rule_TL_PI, &k_p, &k_i, &k_d))
+    {
+        printf("%-12s FAIL relay experiment did not finish (%u ticks)\n", __Case.Name, tick);
+        return (false);
+    }
+
+    float error_k_u = std::fabs(relay.Get_K_U() - k_u) / k_u;
+    float error_t_u = std::fabs(relay.Get_T_U() - t_u) / t_u;
+
+    /* 整定参数闭环阶跃 10 -> 15 rad/s（输出限幅 26 rad/s，与底盘电机一致） */
+    const float step = 5.0f;
+    float peak = 0.0f, steady = 0.0f;
+
+    pid.Init(k_p, k_i, k_d, 0.0f, 26.0f, 26.0f, TEST_D_T);
+    pid.Set_Integral_Error(set / __Case.K / k_i);
+    for (uint32_t n = 0; n < 400U; n++)
+    {
+        pid.Set_Target(set + step);
+        pid.Set_Actual(actual);
+        pid.Calculate();
+        actual = plant.Step(pid.Get_Out(), noise(random));
+        peak = std::fmax(peak, actual - set);
+        if (n >= 300U)
+        {
+            steady += (actual - set - step) / 100.0f;
+        }
+    }
+
+    float overshoot = peak / step - 1.0f;
+    bool ok = error_k_u <= TEST_TOLERANCE_K_U && error_t_u <= TEST_TOLERANCE_T_U &&
+              overshoot <= TEST_OVERSHOOT && std::fabs(steady) <= TEST_STEADY_ERROR * step;
+
+    printf("%-12s K_U %6.3f (model %6.3f, %4.1f%%)  T_U %5.3f s (model %5.3f s, %4.1f%%)  %3u ticks  "
+           "TL PI K_P %5.3f K_I %6.3f  step overshoot %5.1f%%  steady %+6.3f  %s\n",
+           __Case.Name, relay.Get_K_U(), k_u, 100.0f * error_k_u, relay.Get_T_U(), t_u, 100.0f * error_t_u, tick,
+           k_p, k_i, 100.0f * overshoot, steady, ok ? "ok" : "FAIL");
+
+    return (ok);
+}
+
+/************************************************************************************************************************
+ * @brief   主函数
+ ***********************************************************************************************************************/
+int main()
+{
+    /* 底盘电机开环输出按 Omega_MAX 映射为PWM，稳态增益约为1；时间常数、滞后覆盖空载到满载 */
+    const Struct_Test_Case test_case[] = {
+        {"light load",  1.0f, 0.10f, 0.02f},
+        {"nominal",     1.0f, 0.20f, 0.05f},
+        {"heavy load",  0.9f, 0.50f, 0.10f},
+        {"long delay",  1.0f, 0.30f, 0.20f},
+    };
+    bool ok = true;
+
+    for (const Struct_Test_Case & item : test_case)
+    {
+        ok &= Test(item);
+    }
+
+    return (ok ? 0 : 1);
+}
@@ -0,0 +1,59 @@
+/**
+ * @file    User_Can.cpp
+ * @brief   CAN外设仿真（电机驱动测试用，替换固件 User/4-HAL/Src/User_Can.cpp）
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "User_Can.h"
+
+#include <string.h>
+
+/* 全局变量创建 --------------------------------------------------------------------------------------------------------*/
+static uint8_t CAN1_Instance, CAN2_Instance;
+
+CAN_HandleTypeDef hcan1 = {&CAN1_Instance};
+CAN_HandleTypeDef hcan2 = {&CAN2_Instance};
+Struct_CAN_Manage_Object CAN1_Manage_Object = {&hcan1, {{0U}, {0U}}};
+
+static uint16_t CAN_Tx_ID = 0U;         /* 最近一次发送的ID */
+static uint8_t CAN_Tx_Data[8];          /* 最近一次发送的数据 */
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/***********************************************************************************************************************
+ * @brief   发送数据帧（仿真：记录帧内容）
+ *
+ * @param   CAN_Manage_Obj  CAN处理结构体指针
+ * @param   ID              CAN-ID
+ * @param   Data            数据
+ * @param   Length          数据长度（不超过8）
+ * @return  uint8_t         发送结果（仿真恒为0，与 HAL_OK 相同）
+ **********************************************************************************************************************/
+uint8_t CAN_Send_Data(Struct_CAN_Manage_Object * CAN_Manage_Obj, uint16_t ID, uint8_t * Data, uint16_t Length)
+{
+    (void) CAN_Manage_Obj;
+
+    CAN_Tx_ID = ID;
+    memcpy(CAN_Tx_Data, Data, (Length < 8U) ? Length : 8U);
+
+    return (0U);
+}
+
+/***********************************************************************************************************************
+ * @brief   获取最近一次发送的ID
+ **********************************************************************************************************************/
+uint16_t CAN_Sim_Get_Tx_ID()
+{
+    return (CAN_Tx_ID);
+}
+
+/***********************************************************************************************************************
+ * @brief   获取最近一次发送的数据
+ **********************************************************************************************************************/
+const uint8_t * CAN_Sim_Get_Tx_Data()
+{
+    return (CAN_Tx_Data);
+}
@@ -0,0 +1,67 @@
+/**
+ * @file    User_Can.h
+ * @brief   CAN外设仿真（电机驱动测试用，替换固件 User/4-HAL/Inc/User_Can.h）
+ *          仅保留电机驱动用到的句柄、接收缓冲区与发送接口，CAN_Send_Data 记录最近一次发送的帧
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+#ifndef __HAL_USER_CAN_H
+#define __HAL_USER_CAN_H
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* 结构体定义 ----------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief CAN句柄（Instance 仅用于区分 CAN1/CAN2）
+ */
+struct CAN_HandleTypeDef
+{
+    void * Instance;
+};
+
+/**
+ * @brief CAN-RX包头（仅保留标准ID）
+ */
+struct CAN_RxHeaderTypeDef
+{
+    uint32_t StdId;
+};
+
+/**
+ * @brief CAN-RX数据结构体
+ */
+struct Struct_CAN_Rx_Buffer
+{
+    CAN_RxHeaderTypeDef Header;         /*!< CAN-RX包头 */
+    uint8_t Data[8];                    /*!< CAN-RX包数据 */
+};
+
+/**
+ * @brief CAN处理结构体
+ */
+struct Struct_CAN_Manage_Object
+{
+    /* 常量部分 */
+    CAN_HandleTypeDef * hcan;           /*!< CAN外设句柄 */
+
+    /* 变量部分 */
+    Struct_CAN_Rx_Buffer Rx_Buffer;     /*!< CAN-RX缓冲区*/
+};
+
+/* 变量声明 ------------------------------------------------------------------------------------------------------------*/
+extern CAN_HandleTypeDef hcan1;
+extern CAN_HandleTypeDef hcan2;
+extern Struct_CAN_Manage_Object CAN1_Manage_Object;
+
+/* 函数声明 ------------------------------------------------------------------------------------------------------------*/
+uint8_t CAN_Send_Data(Struct_CAN_Manage_Object * CAN_Manage_Obj, uint16_t ID, uint8_t * Data, uint16_t Length);
+
+/* 仿真接口 */
+uint16_t CAN_Sim_Get_Tx_ID();
+const uint8_t * CAN_Sim_Get_Tx_Data();
+
+#endif /* HAL_User_Can */
@@ -0,0 +1,133 @@
+/**
+ * @file    Telemetry_Codec_Test.cpp
+ * @brief   压缩遥测量化误差测试（与固件共用 Telemetry_Codec.cpp 与字段描述 LUBANCAT_TELEMETRY_FIELDS）
+ *          各字段取量程端点、端点附近、舍入边界、0、量程外、NaN/±inf 与量程内随机值，经关键帧、独立帧与差分帧编码、
+ *          解码，要求解码值与限幅后数值之差不超过 半个分辨率 + 解码值 float 表示的半个 ulp（量程外限幅至端点，
+ *          NaN 取下限）；差分帧覆盖全部字段量程（差分值为量程全幅）
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "Telemetry_Codec.h"
+#include "Communication_LuBanCat.h"
+
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <vector>
+
+/* 宏定义 --------------------------------------------------------------------------------------------------------------*/
+#define TEST_RANDOM_NUMBER      20000U  /* 每字段量程内随机值个数 */
+#define TEST_KEY_PERIOD         4U      /* 关键帧周期（帧数，短周期使关键帧、差分帧交替） */
+
+/* 全局变量创建 --------------------------------------------------------------------------------------------------------*/
+static const Struct_Codec_Field Field[LUBANCAT_TELEMETRY_FIELD_NUMBER] = LUBANCAT_TELEMETRY_FIELDS;
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/************************************************************************************************************************
+ * @brief   字段测试值（量程端点、端点附近、舍入边界、0、量程外、NaN/±inf、量程内随机值）
+ ***********************************************************************************************************************/
+static std::vector<float> Sample(const Struct_Codec_Field & __Field, std::mt19937 & __Random)
+{
+    const float min = __Field.Min, max = __Field.Max, resolution = __Field.Resolution;
+    std::uniform_real_distribution<float> inside(min, max);
+    std::vector<float> sample = {
+        min, max, std::nextafter(min, max), std::nextafter(max, min),
+        min + 0.5f * resolution, max - 0.5f * resolution, min + 0.49f * resolution, max - 0.51f * resolution,
+        0.0f, -0.0f, 0.5f * resolution, -0.5f * resolution,
+        min - resolution, max + resolution, 2.0f * min - 1.0f, 2.0f * max + 1.0f,
+        std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::infinity(),
+        -std::numeric_limits<float>::infinity(),
+    };
+
+    for (uint32_t n = 0; n < TEST_RANDOM_NUMBER; n++)
+    {
+        sample.push_back(inside(__Random));
+    }
+
+    return (sample);
+}
+
+/************************************************************************************************************************
+ * @brief   主函数
+ ***********************************************************************************************************************/
+int main()
+{
+    const uint8_t number = LUBANCAT_TELEMETRY_FIELD_NUMBER;
+    Class_Telemetry_Encoder encoder(Field, number, TEST_KEY_PERIOD);
+    Class_Telemetry_Decoder decoder(Field, number);
+    std::mt19937 random(24U);
+    std::vector<float> sample[LUBANCAT_TELEMETRY_FIELD_NUMBER];
+    double error[LUBANCAT_TELEMETRY_FIELD_NUMBER] = {0.0};
+    uint32_t frame_number = 0U, result_number[4] = {0U}, fail = 0U;
+    size_t length = 0U;
+
+    for (uint8_t i = 0; i < number; i++)
+    {
+        sample[i] = Sample(Field[i], random);
+        length = (sample[i].size() > length) ? sample[i].size() : length;
+    }
+
+    /* 每帧各字段取各自的第 n 个测试值，各轮按字段错开，使每个测试值经不同帧类型编码；
+     * 首轮不确认关键帧（关键帧之间为独立帧），其后即时确认（关键帧之间为差分帧） */
+    for (uint32_t pass = 0; pass < TEST_KEY_PERIOD; pass++)
+    {
+        for (size_t n = 0; n < length; n++)
+        {
+            float value[LUBANCAT_TELEMETRY_FIELD_NUMBER], decoded[LUBANCAT_TELEMETRY_FIELD_NUMBER];
+            uint8_t data[64], sequence;
+
+            for (uint8_t i = 0; i < number; i++)
+            {
+                value[i] = sample[i][(n + pass * i) % sample[i].size()];
+            }
+
+            uint8_t size = encoder.Encode(value, data, sizeof(data));
+            Enum_Codec_Result result = decoder.Decode(data, size, decoded, &sequence);
+
+            result_number[result] += 1U;
+            frame_number += 1U;
+            if (result == Codec_Invalid)
+            {
+                fail += 1U;
+                continue;
+            }
+            if (result == Codec_Keyframe && pass != 0U)
+            {
+                encoder.Acknowledge(sequence);
+            }
+
+            for (uint8_t i = 0; i < number; i++)
+            {
+                /* 限幅后的期望值（NaN 取下限） */
+                float expect = std::isnan(value[i]) ? Field[i].Min : std::fmin(std::fmax(value[i], Field[i].Min),
+                                                                                Field[i].Max);
+                double bound = 0.5 * (double) Field[i].Resolution +
+                               0.5 * (double) (std::nextafter(std::fabs(decoded[i]), INFINITY) - std::fabs(decoded[i]));
+                double e = std::fabs((double) decoded[i] - (double) expect);
+
+                error[i] = (e / bound > error[i]) ? e / bound : error[i];
+                fail += (e <= bound) ? 0U : 1U;
+            }
+        }
+    }
+
+    printf("%u frames (%u key, %u absolute, %u delta, %u invalid)\n", frame_number, result_number[Codec_Keyframe],
+           result_number[Codec_Absolute], result_number[Codec_Delta], result_number[Codec_Invalid]);
+    for (uint8_t i = 0; i < number; i++)
+    {
+        printf("field %2u  range %+9g .. %-9g  resolution %-6g  max error %.2f of bound\n", i, Field[i].Min,
+               Field[i].Max, Field[i].Resolution, error[i]);
+    }
+
+    bool ok = (fail == 0U && result_number[Codec_Keyframe] > 0U && result_number[Codec_Absolute] > 0U &&
+               result_number[Codec_Delta] > 0U);
+
+    printf("%u errors beyond bound  %s\n", fail, ok ? "ok" : "FAIL");
+
+    return (ok ? 0 : 1);
+}
@@ -0,0 +1,252 @@
+/**
+ * @file    Twist_Ramp_Test.cpp
+ * @brief   底盘变速路径仿真（与固件共用 Gear.h）
+ *          按 Class_Chassis_Macnum::Control 的时序与参数仿真麦轮底盘：逆运动学、轮速限幅因子、变速，轮速理想跟踪，
+ *          由正运动学积分底盘位姿；比较原方案（各轮 Class_Gear_Slope，5 rad/s 每控制周期）与底盘速度空间变速
+ *          (Class_Gear_Twist，10 m/s^2、27 rad/s^2) 的路径偏离与速度矢量方向误差
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "Gear.h"
+
+#include <cmath>
+#include <cstdio>
+
+/* 宏定义 --------------------------------------------------------------------------------------------------------------*/
+#define TEST_D_T                0.05f   /* 底盘控制周期 (s) */
+#define TEST_SUBSTEP            100U    /* 每控制周期位姿积分步数 */
+#define TEST_CYCLE_NUMBER       40U     /* 每组仿真控制周期数（2 s，两种方案均已到达目标） */
+#define TEST_WHEEL_RADIUS       0.1f    /* 与 Class_Chassis_Macnum 相同 */
+#define TEST_WHEEL_SPACING      0.43f
+#define TEST_WHEEL_BASE         0.3f
+#define TEST_WHEEL_OMEGA_MAX    26.0f
+#define TEST_DEVIATION          1.0e-4f /* 底盘速度空间变速路径偏离容差 (m)（浮点舍入） */
+#define TEST_DIRECTION          1.0e-3f /* 底盘速度空间变速速度矢量方向误差容差 (rad) */
+
+/* 结构体定义 ----------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   测试场景（平面速度由 Start 阶跃至 Target）
+ */
+struct Struct_Test_Case
+{
+    const char * Name;
+    float Start[3];     /* vx (m/s), vy (m/s), omega (rad/s) */
+    float Target[3];
+};
+
+/**
+ * @brief   单方案仿真结果
+ */
+struct Struct_Test_Result
+{
+    float Deviation;    /* 直线场景：位置偏离运动方向直线的最大距离 (m) */
+    float Direction;    /* 速度矢量变化量与设定变化量的最大夹角 (rad)（角速度按轮缘线速度折算） */
+    float Heading;      /* 直线场景：航向角最大偏差 (rad) */
+    float Settle;       /* 到达目标用时 (s) */
+};
+
+/* 变量定义 ------------------------------------------------------------------------------------------------------------*/
+static const float K_Linear = 1.0f / TEST_WHEEL_RADIUS;
+static const float K_Angular = (TEST_WHEEL_SPACING + TEST_WHEEL_BASE) / 2.0f / TEST_WHEEL_RADIUS;
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/************************************************************************************************************************
+ * @brief   直线场景：无旋转，起点、目标速度共线（含静止），理想路径为直线
+ ***********************************************************************************************************************/
+static bool Straight(const Struct_Test_Case & __Case)
+{
+    return (__Case.Start[2] == 0.0f && __Case.Target[2] == 0.0f &&
+            __Case.Start[0] * __Case.Target[1] - __Case.Start[1] * __Case.Target[0] == 0.0f);
+}
+
+/************************************************************************************************************************
+ * @brief   逆运动学与轮速限幅因子（与 Class_Chassis_Macnum::Control 相同）
+ ***********************************************************************************************************************/
+static void Inverse(const float __Twist[3], float __Wheel[4])
+{
+    float max = 0.0f;
+
+    __Wheel[0] =  K_Linear * __Twist[0] - K_Linear * __Twist[1] - K_Angular * __Twist[2];
+    __Wheel[1] = -K_Linear * __Twist[0] - K_Linear * __Twist[1] - K_Angular * __Twist[2];
+    __Wheel[2] =  K_Linear * __Twist[0] + K_Linear * __Twist[1] - K_Angular * __Twist[2];
+    __Wheel[3] = -K_Linear * __Twist[0] + K_Linear * __Twist[1] - K_Angular * __Twist[2];
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        max = std::fmax(max, std::fabs(__Wheel[i]));
+    }
+    for (uint8_t i = 0; i < 4 && max > TEST_WHEEL_OMEGA_MAX; i++)
+    {
+        __Wheel[i] *= TEST_WHEEL_OMEGA_MAX / max;
+    }
+}
+
+/************************************************************************************************************************
+ * @brief   正运动学（逆运动学矩阵的左伪逆）
+ ***********************************************************************************************************************/
+static void Forward(const float __Wheel[4], float __Twist[3])
+{
+    __Twist[0] = ( __Wheel[0] - __Wheel[1] + __Wheel[2] - __Wheel[3]) / (4.0f * K_Linear);
+    __Twist[1] = (-__Wheel[0] - __Wheel[1] + __Wheel[2] + __Wheel[3]) / (4.0f * K_Linear);
+    __Twist[2] = -(__Wheel[0] + __Wheel[1] + __Wheel[2] + __Wheel[3]) / (4.0f * K_Angular);
+}
+
+/************************************************************************************************************************
+ * @brief   单方案仿真
+ *
+ * @param   __Twist_Ramp    true: 底盘速度空间变速；false: 各轮斜坡变速
+ ***********************************************************************************************************************/
+static Struct_Test_Result Simulate(const Struct_Test_Case & __Case, bool __Twist_Ramp)
+{
+    Class_Gear_Slope slope[4];
+    Class_Gear_Twist twist_ramp;
+    Struct_Test_Result result = {0.0f, 0.0f, 0.0f, 0.0f};
+    float wheel[4], twist[3], target[3];
+    float delta[3], set_delta = 0.0f;
+    double x = 0.0, y = 0.0, theta = 0.0;
+    bool straight = Straight(__Case);
+    bool settled = false;
+
+    /* 起点：以 Start 匀速运动（变速器输出已到达 Start） */
+    Inverse(__Case.Start, wheel);
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        slope[i].Set_Value(wheel[i]);
+        slope[i].Calculate();
+        slope[i].Init(__Twist_Ramp ? 0.0f : 5.0f);
+    }
+    twist_ramp.Set_Value(__Case.Start[0], __Case.Start[1], __Case.Start[2]);
+    twist_ramp.Calculate();
+    twist_ramp.Init(__Twist_Ramp ? 10.0f * TEST_D_T : 0.0f, __Twist_Ramp ? 27.0f * TEST_D_T : 0.0f);
+
+    /* 稳态：目标经轮速限幅后的底盘速度 */
+    Inverse(__Case.Target, wheel);
+    Forward(wheel, target);
+
+    /* 路径参考直线：运动方向（起点静止时取目标速度方向） */
+    const float * line = (__Case.Start[0] != 0.0f || __Case.Start[1] != 0.0f) ? __Case.Start : __Case.Target;
+    double line_norm = std::hypot(line[0], line[1]);
+    for (uint8_t k = 0; k < 3; k++)
+    {
+        delta[k] = __Case.Target[k] - __Case.Start[k];
+    }
+    set_delta = std::sqrt(delta[0] * delta[0] + delta[1] * delta[1] + delta[2] * delta[2] * (K_Angular / K_Linear) *
+                          (K_Angular / K_Linear));
+
+    for (uint32_t n = 0; n < TEST_CYCLE_NUMBER; n++)
+    {
+        /* 底盘控制周期 */
+        twist_ramp.Set_Value(__Case.Target[0], __Case.Target[1], __Case.Target[2]);
+        twist_ramp.Calculate();
+        float ramp[3] = {twist_ramp.Get_Velocity_X(), twist_ramp.Get_Velocity_Y(), twist_ramp.Get_Omega()};
+        Inverse(ramp, wheel);
+        for (uint8_t i = 0; i < 4; i++)
+        {
+            slope[i].Set_Value(wheel[i]);
+            slope[i].Calculate();
+            wheel[i] = slope[i].Get_Out();
+        }
+
+        /* 轮速理想跟踪，周期内底盘速度保持 */
+        Forward(wheel, twist);
+
+        /* 速度矢量方向误差（相对起点的变化量） */
+        float d[3] = {twist[0] - __Case.Start[0], twist[1] - __Case.Start[1],
+                      (twist[2] - __Case.Start[2]) * K_Angular / K_Linear};
+        float d_norm = std::sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+        if (d_norm > 1.0e-3f * set_delta)
+        {
+            float dot = (d[0] * delta[0] + d[1] * delta[1] + d[2] * delta[2] * K_Angular / K_Linear) /
+                        (d_norm * set_delta);
+            result.Direction = std::fmax(result.Direction, std::acos(std::fmin(dot, 1.0f)));
+        }
+
+        if (!settled && std::fabs(twist[0] - target[0]) < 1.0e-4f && std::fabs(twist[1] - target[1]) < 1.0e-4f &&
+            std::fabs(twist[2] - target[2]) < 1.0e-4f)
+        {
+            settled = true;
+            result.Settle = (n + 1U) * TEST_D_T;
+        }
+
+        /* 位姿积分 */
+        for (uint32_t s = 0; s < TEST_SUBSTEP; s++)
+        {
+            const double h = TEST_D_T / TEST_SUBSTEP;
+
+            x += (twist[0] * std::cos(theta) - twist[1] * std::sin(theta)) * h;
+            y += (twist[0] * std::sin(theta) + twist[1] * std::cos(theta)) * h;
+            theta += twist[2] * h;
+            if (straight)
+            {
+                float deviation = (float) (std::fabs(x * line[1] - y * line[0]) / line_norm);
+
+                result.Deviation = std::fmax(result.Deviation, deviation);
+                result.Heading = std::fmax(result.Heading, (float) std::fabs(theta));
+            }
+        }
+    }
+    if (!settled)
+    {
+        result.Settle = INFINITY;
+    }
+
+    return (result);
+}
+
+/************************************************************************************************************************
+ * @brief   单组测试
+ ***********************************************************************************************************************/
+static bool Test(const Struct_Test_Case & __Case)
+{
+    Struct_Test_Result slope = Simulate(__Case, false);
+    Struct_Test_Result twist = Simulate(__Case, true);
+    bool straight = Straight(__Case);
+    bool ok = twist.Direction <= TEST_DIRECTION && (!straight || twist.Deviation <= TEST_DEVIATION) &&
+              std::isfinite(twist.Settle);
+
+    if (straight)
+    {
+        printf("%-22s wheel slope: deviation %6.1f mm  heading %5.2f deg  direction %5.2f deg  settle %4.2f s  | "
+               "twist ramp: deviation %6.3f mm  heading %5.2f deg  direction %5.2f deg  settle %4.2f s  %s\n",
+               __Case.Name, 1000.0f * slope.Deviation, slope.Heading * 180.0f / PI, slope.Direction * 180.0f / PI,
+               slope.Settle, 1000.0f * twist.Deviation, twist.Heading * 180.0f / PI, twist.Direction * 180.0f / PI,
+               twist.Settle, ok ? "ok" : "FAIL");
+    }
+    else
+    {
+        printf("%-22s wheel slope: direction %5.2f deg  settle %4.2f s  | "
+               "twist ramp: direction %5.2f deg  settle %4.2f s  %s\n",
+               __Case.Name, slope.Direction * 180.0f / PI, slope.Settle, twist.Direction * 180.0f / PI, twist.Settle,
+               ok ? "ok" : "FAIL");
+    }
+
+    return (ok);
+}
+
+/************************************************************************************************************************
+ * @brief   主函数
+ ***********************************************************************************************************************/
+int main()
+{
+    const Struct_Test_Case test_case[] = {
+        {"rest -> (1.5,0.5,0)",    {0.0f, 0.0f, 0.0f}, {1.5f, 0.5f, 0.0f}},
+        {"rest -> (0.5,1.5,0)",    {0.0f, 0.0f, 0.0f}, {0.5f, 1.5f, 0.0f}},
+        {"rest -> (1.0,1.0,0)",    {0.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 0.0f}},
+        {"rest -> (2.0,0.8,0)",    {0.0f, 0.0f, 0.0f}, {2.0f, 0.8f, 0.0f}},
+        {"(1.5,0.5,0) -> rest",    {1.5f, 0.5f, 0.0f}, {0.0f, 0.0f, 0.0f}},
+        {"(1.5,0,0) -> (0,1.5,0)", {1.5f, 0.0f, 0.0f}, {0.0f, 1.5f, 0.0f}},
+        {"rest -> (1.0,0.5,2.0)",  {0.0f, 0.0f, 0.0f}, {1.0f, 0.5f, 2.0f}},
+        {"(1.0,0,0) -> (1.0,0,3)", {1.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 3.0f}},
+    };
+    bool ok = true;
+
+    for (const Struct_Test_Case & item : test_case)
+    {
+        ok &= Test(item);
+    }
+
+    return (ok ? 0 : 1);
+}
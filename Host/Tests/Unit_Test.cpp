@@ -0,0 +1,225 @@
+/**
+ * @file    Unit_Test.cpp
+ * @brief   强类型物理量与单位换算测试（与固件共用 Unit.h）
+ *          编译期：常用换算系数、复合与逆换算的数值（static_assert）；物理量与 float 不能隐式互转、不同单位不能
+ *          相加、换算不能作用于错误单位（SFINAE 检测，违反时本文件编译失败）；物理量与 float 等大小
+ *          运行期：编码器、减速箱、采样周期换算在整个量程内往返（换算后逆换算）相对误差不超过 2 ulp，
+ *          复合换算与逐级换算相对误差不超过 2 ulp；
+ *          浮点数-整型仿射映射（Math_Float_To_Int/Math_Int_To_Float，经 Class_Math_Affine 实现）以电机协议
+ *          常用定点格式与原逐项公式比较：整型相差不超过 1 LSB，浮点数相差不超过量程的 1e-6，
+ *          往返误差不超过 1.01 LSB（向零取整 + 浮点舍入）
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.1
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "Unit.h"
+
+#include <cmath>
+#include <cstdio>
+#include <type_traits>
+#include <utility>
+
+/* 宏定义 --------------------------------------------------------------------------------------------------------------*/
+#define TEST_ULP                (2.0f * FLT_EPSILON)    /* 往返、复合换算允许的相对误差 */
+
+/* 结构体定义 ----------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   检测 A + B 是否可编译
+ */
+template<typename A, typename B, typename = void>
+struct Struct_Can_Add : std::false_type {};
+
+template<typename A, typename B>
+struct Struct_Can_Add<A, B, decltype((void) (std::declval<A>() + std::declval<B>()))> : std::true_type {};
+
+/**
+ * @brief   检测换算 Scale 能否作用于物理量 Quantity
+ */
+template<typename Scale, typename Quantity, typename = void>
+struct Struct_Can_Apply : std::false_type {};
+
+template<typename Scale, typename Quantity>
+struct Struct_Can_Apply<Scale, Quantity, decltype((void) (std::declval<Scale>()(std::declval<Quantity>())))>
+    : std::true_type {};
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/************************************************************************************************************************
+ * @brief   编译期相对误差比较
+ ***********************************************************************************************************************/
+constexpr bool Near(float __Value, float __Reference, float __Tolerance)
+{
+    return ((__Value - __Reference <= __Tolerance * (__Reference < 0.0f ? -__Reference : __Reference)) &&
+            (__Reference - __Value <= __Tolerance * (__Reference < 0.0f ? -__Reference : __Reference)));
+}
+
+/* 编译期检查 ----------------------------------------------------------------------------------------------------------*/
+/* 类型约束 */
+static_assert(sizeof(Class_Rad) == sizeof(float), "Class_Quantity must be a bare float");
+static_assert(std::is_trivially_copyable<Class_Rad>::value, "Class_Quantity must be trivially copyable");
+static_assert(!std::is_convertible<float, Class_Rad>::value, "float must not convert to Class_Rad implicitly");
+static_assert(!std::is_convertible<Class_Rad, float>::value, "Class_Rad must not convert to float implicitly");
+static_assert(Struct_Can_Add<Class_Rad, Class_Rad>::value, "same-unit addition must compile");
+static_assert(!Struct_Can_Add<Class_Rad, Class_Radps>::value, "Rad + Radps must not compile");
+static_assert(!Struct_Can_Add<Class_Rad, float>::value, "Rad + float must not compile");
+static_assert(Struct_Can_Apply<Class_Unit_Scale<Struct_Unit_RPM, Struct_Unit_Radps>, Class_RPM>::value,
+              "RPM scale must apply to RPM");
+static_assert(!Struct_Can_Apply<Class_Unit_Scale<Struct_Unit_RPM, Struct_Unit_Radps>, Class_Tick>::value,
+              "RPM scale must not apply to Tick");
+static_assert(std::is_same<decltype(Unit_Gearbox_Scale(1.0f).Inverse()),
+                           Class_Unit_Scale<Struct_Unit_Radps, Struct_Unit_RPM>>::value, "Inverse swaps units");
+static_assert(std::is_same<decltype(Unit_Increment_Rate(1.0f) * Unit_Encoder_Scale(1.0f, 1.0f)),
+                           Class_Unit_Scale<Struct_Unit_Tick, Struct_Unit_Radps>>::value, "composition chains units");
+
+/* 换算数值（底盘轮：13 线正交编码器 52 刻度/圈、减速比 27、控制周期 50ms；C620：8192 刻度/圈、减速比 3591/187） */
+static_assert(Near(Unit_RPM_To_Radps(Class_RPM(60.0f)).Get(), 2.0f * PI, TEST_ULP), "60 rpm = 2 pi rad/s");
+static_assert(Near(Unit_Encoder_Scale(52.0f, 27.0f)(Class_Tick(52.0f * 27.0f)).Get(), 2.0f * PI, TEST_ULP),
+              "one output turn = 2 pi rad");
+static_assert(Near(Unit_Encoder_Scale(8192.0f, 3591.0f / 187.0f).Inverse()(Class_Rad(2.0f * PI)).Get(),
+                   8192.0f * 3591.0f / 187.0f, TEST_ULP), "2 pi rad = one output turn of ticks");
+static_assert(Near(Unit_Gearbox_Scale(3591.0f / 187.0f)(Class_RPM(3591.0f / 187.0f * 60.0f)).Get(), 2.0f * PI,
+                   TEST_ULP), "gearbox scale");
+static_assert(Near((Unit_Increment_Rate(0.05f) * Unit_Encoder_Scale(52.0f, 27.0f))(Class_Tick(52.0f * 27.0f)).Get(),
+                   2.0f * PI / 0.05f, TEST_ULP), "ticks per period -> rad/s");
+static_assert(Near((Class_Rad(1.0f) + Class_Rad(2.0f) - Class_Rad(0.5f)) / Class_Rad(0.5f), 5.0f, 0.0f),
+              "same-unit arithmetic");
+static_assert(Class_Rad(1.0f) < Class_Rad(2.0f) && -Class_Rad(1.0f) < Class_Rad(0.0f), "same-unit comparison");
+
+/************************************************************************************************************************
+ * @brief   换算往返：源值 -> 目标值 -> 源值
+ *
+ * @param   __Range     源值量程（对称）
+ ***********************************************************************************************************************/
+template<typename From, typename To>
+static bool Test_Round_Trip(const char * __Name, Class_Unit_Scale<From, To> __Scale, float __Range)
+{
+    Class_Unit_Scale<To, From> inverse = __Scale.Inverse();
+    float error = 0.0f;
+
+    for (int32_t n = -100000; n <= 100000; n++)
+    {
+        Class_Quantity<From> x((float) n / 100000.0f * __Range);
+
+        if (x.Get() == 0.0f)
+        {
+            continue;
+        }
+        error = std::fmax(error, std::fabs((inverse(__Scale(x)) - x) / x));
+    }
+
+    bool ok = (error <= TEST_ULP);
+
+    printf("%-24s round trip over +/-%-9g max rel error %.1e  %s\n", __Name, __Range, error, ok ? "ok" : "FAIL");
+
+    return (ok);
+}
+
+/************************************************************************************************************************
+ * @brief   复合换算与逐级换算比较（编码器刻度增量 -> 角度 -> 角速度）
+ ***********************************************************************************************************************/
+static bool Test_Composition()
+{
+    Class_Unit_Scale<Struct_Unit_Tick, Struct_Unit_Rad> tick_to_angle = Unit_Encoder_Scale(52.0f, 27.0f);
+    Class_Unit_Scale<Struct_Unit_Rad, Struct_Unit_Radps> angle_to_omega = Unit_Increment_Rate(0.05f);
+    Class_Unit_Scale<Struct_Unit_Tick, Struct_Unit_Radps> tick_to_omega = angle_to_omega * tick_to_angle;
+    float error = 0.0f;
+
+    for (int32_t tick = -300; tick <= 300; tick++)
+    {
+        Class_Tick x((float) tick);
+        float step = angle_to_omega(tick_to_angle(x)).Get();
+
+        if (tick == 0)
+        {
+            continue;
+        }
+        error = std::fmax(error, std::fabs((tick_to_omega(x).Get() - step) / step));
+    }
+
+    bool ok = (error <= TEST_ULP);
+
+    printf("%-24s composed vs chained over +/-300 ticks  max rel error %.1e  %s\n", "Tick -> Rad -> Rad/s", error,
+           ok ? "ok" : "FAIL");
+
+    return (ok);
+}
+
+/************************************************************************************************************************
+ * @brief   原浮点数映射到整型（逐项公式）
+ ***********************************************************************************************************************/
+static int32_t Reference_Float_To_Int(float __X, float __Float_Min, float __Float_Max, int32_t __Int_Min,
+                                      int32_t __Int_Max)
+{
+    float tmp = (__X - __Float_Min) / (__Float_Max - __Float_Min);
+    return ((int32_t) (tmp * (float) (__Int_Max - __Int_Min) + __Int_Min));
+}
+
+/************************************************************************************************************************
+ * @brief   原整型映射到浮点数（逐项公式）
+ ***********************************************************************************************************************/
+static float Reference_Int_To_Float(int32_t __X, int32_t __Int_Min, int32_t __Int_Max, float __Float_Min,
+                                    float __Float_Max)
+{
+    float tmp = (float) (__X - __Int_Min) / (float) (__Int_Max - __Int_Min);
+    return (tmp * (__Float_Max - __Float_Min) + __Float_Min);
+}
+
+/************************************************************************************************************************
+ * @brief   浮点数-整型仿射映射与原逐项公式比较
+ *
+ * @param   __Float_Max     浮点数量程（对称）
+ * @param   __Bits          整型位数（无符号 0 ~ 2^__Bits - 1）
+ ***********************************************************************************************************************/
+static bool Test_Affine(const char * __Name, float __Float_Max, uint32_t __Bits)
+{
+    int32_t int_max = (int32_t) ((1U << __Bits) - 1U);
+    float lsb = 2.0f * __Float_Max / (float) int_max;
+    int32_t error_int = 0;
+    float error_float = 0.0f, error_round_trip = 0.0f;
+
+    for (int32_t n = -200000; n <= 200000; n++)
+    {
+        float x = (float) n / 200000.0f * __Float_Max;
+        int32_t encoded = Math_Float_To_Int(x, -__Float_Max, __Float_Max, 0, int_max);
+        int32_t reference = Reference_Float_To_Int(x, -__Float_Max, __Float_Max, 0, int_max);
+
+        error_int = Math_Abs(encoded - reference) > error_int ? Math_Abs(encoded - reference) : error_int;
+        error_round_trip = std::fmax(error_round_trip,
+                                     std::fabs(Math_Int_To_Float(encoded, 0, int_max, -__Float_Max, __Float_Max) - x));
+    }
+    for (int32_t i = 0; i <= int_max; i++)
+    {
+        error_float = std::fmax(error_float, std::fabs(Math_Int_To_Float(i, 0, int_max, -__Float_Max, __Float_Max) -
+                                                       Reference_Int_To_Float(i, 0, int_max, -__Float_Max, __Float_Max)));
+    }
+
+    bool ok = (error_int <= 1 && error_float <= 2.0e-6f * __Float_Max && error_round_trip <= 1.01f * lsb);
+
+    printf("%-24s +/-%-4g -> %2u bit  int diff %d LSB  float diff %.1e  round trip %.2f LSB  %s\n", __Name,
+           __Float_Max, __Bits, error_int, error_float, error_round_trip / lsb, ok ? "ok" : "FAIL");
+
+    return (ok);
+}
+
+/************************************************************************************************************************
+ * @brief   主函数
+ ***********************************************************************************************************************/
+int main()
+{
+    bool ok = true;
+
+    ok &= Test_Round_Trip("Tick -> Rad (wheel)", Unit_Encoder_Scale(52.0f, 27.0f), 1.0e6f);
+    ok &= Test_Round_Trip("Tick -> Rad (C620)", Unit_Encoder_Scale(8192.0f, 3591.0f / 187.0f), 1.0e7f);
+    ok &= Test_Round_Trip("RPM -> Rad/s (C620)", Unit_Gearbox_Scale(3591.0f / 187.0f), 16384.0f);
+    ok &= Test_Round_Trip("Rad -> Rad/s (50ms)", Unit_Increment_Rate(0.05f), 100.0f);
+    ok &= Test_Round_Trip("Raw -> A (C620)", Class_Unit_Scale<Struct_Unit_Raw, Struct_Unit_Ampere>(20.0f / 16384.0f),
+                          16384.0f);
+    ok &= Test_Composition();
+    ok &= Test_Affine("position (rad)", 12.5f, 16U);
+    ok &= Test_Affine("velocity (rad/s)", 30.0f, 12U);
+    ok &= Test_Affine("torque (N*m)", 10.0f, 12U);
+
+    return (ok ? 0 : 1);
+}
@@ -0,0 +1,137 @@
+/**
+ * @file    Checksum_Bench.cpp
+ * @brief   累加和、Fletcher-16、Adler-32 吞吐量测试（与固件共用 User_Math.cpp）
+ *          帧长 8 B ~ 4 KB，字宽内核 vs 逐字节实现（Math_Sum_8 为改写前的逐元素循环，Fletcher/Adler 为每字节取模的
+ *          定义式），同时校验两者结果一致
+ * @note    主机未定义 ARM_MATH_DSP，测得的是可移植路径；目标板耗时以 DWT 周期计数为准
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "User_Math.h"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+/* 宏定义 --------------------------------------------------------------------------------------------------------------*/
+#define BENCH_BYTE_NUMBER       (64U * 1024U * 1024U)   /* 每组处理总字节数 */
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/************************************************************************************************************************
+ * @brief   改写前的 Math_Sum_8（逐元素循环，禁止内联以对应原独立函数）
+ ***********************************************************************************************************************/
+__attribute__((noinline)) static uint8_t Legacy_Sum_8(uint8_t * __Address, uint32_t __Length)
+{
+    uint8_t sum = 0;
+    for (int i = 0; i < (int) __Length; i++)
+    {
+        sum += __Address[i];
+    }
+    return (sum);
+}
+
+/************************************************************************************************************************
+ * @brief   逐字节 Fletcher-16（每字节取模）
+ ***********************************************************************************************************************/
+__attribute__((noinline)) static uint16_t Naive_Fletcher_16(uint8_t * __Address, uint32_t __Length)
+{
+    uint32_t sum_1 = 0U, sum_2 = 0U;
+
+    for (uint32_t i = 0; i < __Length; i++)
+    {
+        sum_1 = (sum_1 + __Address[i]) % 255U;
+        sum_2 = (sum_2 + sum_1) % 255U;
+    }
+
+    return ((uint16_t) (sum_2 << 8 | sum_1));
+}
+
+/************************************************************************************************************************
+ * @brief   逐字节 Adler-32（每字节取模）
+ ***********************************************************************************************************************/
+__attribute__((noinline)) static uint32_t Naive_Adler_32(uint8_t * __Address, uint32_t __Length)
+{
+    uint32_t a = 1U, b = 0U;
+
+    for (uint32_t i = 0; i < __Length; i++)
+    {
+        a = (a + __Address[i]) % 65521U;
+        b = (b + a) % 65521U;
+    }
+
+    return (b << 16 | a);
+}
+
+/************************************************************************************************************************
+ * @brief   计时：对 __Buffer 中连续的 __Size 字节帧逐帧计算，共 BENCH_BYTE_NUMBER 字节
+ *
+ * @return  double  每帧耗时 (ns)，__Result 返回各帧结果异或（用于一致性校验）
+ ***********************************************************************************************************************/
+template<typename Function>
+static double Run(Function __Function, std::vector<uint8_t> & __Buffer, uint32_t __Size, uint32_t * __Result)
+{
+    uint32_t frame = (uint32_t) (__Buffer.size() / __Size);
+    uint32_t repeat = BENCH_BYTE_NUMBER / (frame * __Size);
+    uint32_t result = 0U;
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t r = 0; r < repeat; r++)
+    {
+        for (uint32_t n = 0; n < frame; n++)
+        {
+            result ^= __Function(__Buffer.data() + n * __Size, __Size) + n;
+        }
+    }
+    auto t1 = std::chrono::steady_clock::now();
+
+    *__Result = result;
+    return (std::chrono::duration<double, std::nano>(t1 - t0).count() / ((double) repeat * frame));
+}
+
+/************************************************************************************************************************
+ * @brief   主函数
+ ***********************************************************************************************************************/
+int main()
+{
+    const uint32_t size[] = {8U, 16U, 32U, 64U, 128U, 256U, 512U, 1024U, 2048U, 4096U};
+    std::vector<uint8_t> buffer(64U * 1024U);
+    std::mt19937 random(5U);
+    bool ok = true;
+
+    for (uint8_t & item : buffer)
+    {
+        item = (uint8_t) random();
+    }
+
+    printf("%6s  %-30s  %-30s  %-30s\n", "size", "Math_Sum_8 / legacy (ns)", "Fletcher-16 / naive (ns)",
+           "Adler-32 / naive (ns)");
+    for (uint32_t item : size)
+    {
+        uint32_t result[6];
+        double ns[6];
+
+        ns[0] = Run(Math_Sum_8, buffer, item, &result[0]);
+        ns[1] = Run(Legacy_Sum_8, buffer, item, &result[1]);
+        ns[2] = Run(Math_Fletcher_16, buffer, item, &result[2]);
+        ns[3] = Run(Naive_Fletcher_16, buffer, item, &result[3]);
+        ns[4] = Run(Math_Adler_32, buffer, item, &result[4]);
+        ns[5] = Run(Naive_Adler_32, buffer, item, &result[5]);
+
+        printf("%5u B  %8.1f / %8.1f (%5.2fx)    %8.1f / %8.1f (%5.2fx)    %8.1f / %8.1f (%5.2fx)   %5.0f MB/s adler\n",
+               item, ns[0], ns[1], ns[1] / ns[0], ns[2], ns[3], ns[3] / ns[2], ns[4], ns[5], ns[5] / ns[4],
+               item / ns[4] * 1000.0);
+
+        if (result[0] != result[1] || result[2] != result[3] || result[4] != result[5])
+        {
+            printf("%5u B  ERROR checksum differs from byte-wise reference\n", item);
+            ok = false;
+        }
+    }
+
+    return (ok ? 0 : 1);
+}
@@ -0,0 +1,206 @@
+/**
+ * @file    Cobs_Bench.cpp
+ * @brief   COBS编解码吞吐量测试（与固件共用 Cobs.cpp）
+ *          COBS_Encode 与按段编码（改写前 COBS_Encode 的唯一路径）、逐字节编码对照；帧长 16 B ~ 64 KB，
+ *          另在 124 B（最大帧编码前长度）上扫描 0x00 出现概率，对应 COBS_BYTEWISE_LENGTH 的取舍
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.1
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "Cobs.h"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+/* 宏定义 --------------------------------------------------------------------------------------------------------------*/
+#define COBS_SHORT_RUN  16U     /* 短段长度（与 Cobs.cpp 相同） */
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/************************************************************************************************************************
+ * @brief   逐字节COBS编码（对照组）
+ ***********************************************************************************************************************/
+static uint32_t COBS_Encode_Bytewise(const uint8_t * __Source, uint32_t __Length, uint8_t * __Destination)
+{
+    uint8_t * code = __Destination;
+    uint8_t * out = __Destination + 1;
+    uint8_t count = 1U;
+
+    for (uint32_t i = 0; i < __Length; i++)
+    {
+        if (__Source[i] == 0U)
+        {
+            *code = count;
+            code = out++;
+            count = 1U;
+        }
+        else
+        {
+            *out++ = __Source[i];
+            if (++count == 0xFFU)
+            {
+                *code = count;
+                code = out++;
+                count = 1U;
+            }
+        }
+    }
+    *code = count;
+
+    return ((uint32_t) (out - __Destination));
+}
+
+/************************************************************************************************************************
+ * @brief   按段COBS编码（改写前 COBS_Encode 的唯一路径，现仅用于超过 COBS_BYTEWISE_LENGTH 的数据）
+ ***********************************************************************************************************************/
+static uint32_t COBS_Encode_Segment(const uint8_t * __Source, uint32_t __Length, uint8_t * __Destination)
+{
+    uint8_t * out = __Destination;
+
+    for (;;)
+    {
+        uint32_t limit = (__Length < 254U) ? __Length : 254U;
+        uint8_t * code = out++;
+        uint32_t run = 0U;
+
+        while (run < limit && run < COBS_SHORT_RUN && __Source[run] != 0U)
+        {
+            *out++ = __Source[run];
+            run++;
+        }
+        if (run == COBS_SHORT_RUN && run < limit)
+        {
+            const uint8_t * zero = (const uint8_t *) memchr(&__Source[run], 0, limit - run);
+            uint32_t rest = ((zero != nullptr) ? (uint32_t) (zero - __Source) : limit) - run;
+
+            memmove(out, &__Source[run], rest);
+            out += rest;
+            run += rest;
+        }
+
+        *code = (uint8_t) (run + 1U);
+        __Source += run;
+        __Length -= run;
+
+        if (run < limit)
+        {
+            __Source += 1;
+            __Length -= 1U;
+        }
+        else if (run < 254U || __Length == 0U)
+        {
+            break;
+        }
+    }
+
+    return ((uint32_t) (out - __Destination));
+}
+
+/************************************************************************************************************************
+ * @brief   编码耗时
+ *
+ * @return  double  吞吐量 (MB/s)
+ ***********************************************************************************************************************/
+static double Run(uint32_t (*__Function)(const uint8_t *, uint32_t, uint8_t *), const std::vector<uint8_t> & __Source,
+                  uint32_t __Frame_Length, uint32_t __Frame_Number, std::vector<uint8_t> & __Encoded, uint32_t * __Sink)
+{
+    const uint32_t pool = (uint32_t) (__Source.size() / __Frame_Length);
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < __Frame_Number; i++)
+    {
+        *__Sink += __Function(&__Source[(i % pool) * __Frame_Length], __Frame_Length, __Encoded.data());
+    }
+    auto t1 = std::chrono::steady_clock::now();
+
+    return ((double) __Frame_Number * __Frame_Length / std::chrono::duration<double>(t1 - t0).count() / 1e6);
+}
+
+/************************************************************************************************************************
+ * @brief   单组测试：随机帧（0x00 出现概率 __Zero / 256，其余字节非零均匀分布）编码、解码并校验往返一致
+ ***********************************************************************************************************************/
+static bool Bench(const char * __Name, uint32_t __Frame_Length, uint32_t __Zero)
+{
+    const uint32_t frame_number = (64U << 20) / __Frame_Length;
+    const uint32_t pool = 256U;
+    std::mt19937 random(__Frame_Length);
+    std::vector<uint8_t> source(pool * __Frame_Length);
+    std::vector<uint8_t> encoded(COBS_MAX_ENCODED(__Frame_Length));
+    std::vector<uint8_t> reference(COBS_MAX_ENCODED(__Frame_Length));
+    std::vector<uint8_t> segment(COBS_MAX_ENCODED(__Frame_Length));
+    std::vector<uint8_t> decoded(__Frame_Length);
+    uint64_t encoded_bytes = 0U;
+
+    for (auto & byte : source)
+    {
+        byte = (random() % 256U < __Zero) ? 0U : (uint8_t) (random() % 255U + 1U);
+    }
+
+    /* 正确性 */
+    for (uint32_t i = 0; i < pool; i++)
+    {
+        const uint8_t * frame = &source[i * __Frame_Length];
+        uint32_t length = COBS_Encode(frame, __Frame_Length, encoded.data());
+        uint32_t reference_length = COBS_Encode_Bytewise(frame, __Frame_Length, reference.data());
+        uint32_t segment_length = COBS_Encode_Segment(frame, __Frame_Length, segment.data());
+
+        /* 以 254 字节整段结尾时逐字节编码多一个 0x01 段，两种形式均须能解码；COBS_Encode 与按段编码须逐字节一致 */
+        if (memchr(encoded.data(), 0, length) != nullptr || segment_length != length ||
+            memcmp(segment.data(), encoded.data(), length) != 0 ||
+            COBS_Decode(encoded.data(), length, decoded.data()) != __Frame_Length ||
+            memcmp(frame, decoded.data(), __Frame_Length) != 0 ||
+            COBS_Decode(reference.data(), reference_length, decoded.data()) != __Frame_Length ||
+            memcmp(frame, decoded.data(), __Frame_Length) != 0)
+        {
+            printf("%-10s %5u B  MISMATCH\n", __Name, __Frame_Length);
+            return (false);
+        }
+        encoded_bytes += length;
+    }
+
+    /* 吞吐量 */
+    uint32_t sink = 0U;
+    double encode = Run(COBS_Encode, source, __Frame_Length, frame_number, encoded, &sink);
+    double segment_encode = Run(COBS_Encode_Segment, source, __Frame_Length, frame_number, encoded, &sink);
+    double bytewise_encode = Run(COBS_Encode_Bytewise, source, __Frame_Length, frame_number, encoded, &sink);
+    uint32_t length = COBS_Encode(&source[0], __Frame_Length, encoded.data());
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < frame_number; i++)
+    {
+        sink += COBS_Decode(encoded.data(), length, decoded.data());
+    }
+    auto t1 = std::chrono::steady_clock::now();
+
+    double decode = (double) frame_number * __Frame_Length / std::chrono::duration<double>(t1 - t0).count() / 1e6;
+    printf("%-10s %5u B  overhead %5.2f%%  encode %7.0f MB/s (segment %6.0f, bytewise %6.0f)  decode %7.0f MB/s  [%u]\n",
+           __Name, __Frame_Length, 100.0 * ((double) encoded_bytes / pool - __Frame_Length) / __Frame_Length, encode,
+           segment_encode, bytewise_encode, decode, sink & 1U);
+
+    return (true);
+}
+
+/************************************************************************************************************************
+ * @brief   主函数
+ ***********************************************************************************************************************/
+int main()
+{
+    bool ok = true;
+
+    for (uint32_t length : {16U, 64U, 124U, 1024U, 65536U})
+    {
+        ok &= Bench("random", length, 1U);
+    }
+    ok &= Bench("no-zero", 124U, 0U);
+    ok &= Bench("6%-zero", 124U, 16U);
+    ok &= Bench("20%-zero", 124U, 51U);
+    ok &= Bench("50%-zero", 124U, 128U);
+    ok &= Bench("all-zero", 124U, 256U);
+    ok &= Bench("no-zero", 65536U, 0U);
+
+    return (ok ? 0 : 1);
+}
@@ -0,0 +1,207 @@
+/**
+ * @file    Codec_Bench.cpp
+ * @brief   压缩遥测编解码测试（与固件共用 Telemetry_Codec.cpp 与字段描述）
+ *          合成 100Hz 底盘遥测轨迹，经带延迟、丢帧的确认回路编码、解码，校验量化误差并统计压缩比与编码耗时
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "Telemetry_Codec.h"
+#include "Communication_LuBanCat.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <deque>
+#include <random>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/* 宏定义 --------------------------------------------------------------------------------------------------------------*/
+#define BENCH_FRAME_NUMBER      60000U  /* 每组帧数（100Hz 下 10min） */
+#define BENCH_LEGACY_LENGTH     48U     /* 原定长遥测（底盘电机转速 16byte + 里程计 32byte）数据长度 */
+
+/* 全局变量创建 --------------------------------------------------------------------------------------------------------*/
+static const Struct_Codec_Field Field[LUBANCAT_TELEMETRY_FIELD_NUMBER] = LUBANCAT_TELEMETRY_FIELDS;
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/************************************************************************************************************************
+ * @brief   周期计数（x86 为 TSC，其余平台返回0）
+ ***********************************************************************************************************************/
+static inline uint64_t Cycle()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return (__rdtsc());
+#else
+    return (0U);
+#endif
+}
+
+/************************************************************************************************************************
+ * @brief   合成轨迹：四轮转速跟随分段目标（一阶惯性 + 测速噪声），占空比随转速，角度积分；__Idle 时底盘静止
+ ***********************************************************************************************************************/
+static void Trajectory(std::vector<Struct_Telemetry_LuBanCat> & __Frame, bool __Idle, uint32_t __Seed)
+{
+    std::mt19937 random(__Seed);
+    std::normal_distribution<float> noise(0.0f, 0.05f);
+    std::uniform_real_distribution<float> target(-20.0f, 20.0f);
+    Struct_Telemetry_LuBanCat value = {};
+
+    value.Flags = 3.0f;     /* 底盘运行 (Chassis_Run) */
+    for (uint32_t n = 0; n < __Frame.size(); n++)
+    {
+        for (uint8_t i = 0; i < 4; i++)
+        {
+            if (!__Idle && n % 300U == i * 50U)
+            {
+                value.Wheel_Target[i] = target(random);
+            }
+            value.Wheel_Omega[i] += 0.1f * (value.Wheel_Target[i] - value.Wheel_Omega[i]);
+            value.Wheel_Omega[i] += __Idle ? 0.0f : noise(random);
+            value.Wheel_Duty[i] = value.Wheel_Omega[i] / 26.0f;
+            value.Wheel_Angle[i] += value.Wheel_Omega[i] * 0.01f;
+        }
+        __Frame[n] = value;
+    }
+}
+
+/************************************************************************************************************************
+ * @brief   单组测试
+ *
+ * @param   __Name          名称
+ * @param   __Idle          底盘静止
+ * @param   __Loss          上行帧、确认帧丢失概率
+ * @param   __Ack_Delay     确认回路延迟（帧数）
+ * @return  bool            量化误差是否均不超过半个分辨率
+ ***********************************************************************************************************************/
+static bool Bench(const char * __Name, bool __Idle, double __Loss, uint32_t __Ack_Delay)
+{
+    std::vector<Struct_Telemetry_LuBanCat> frame(BENCH_FRAME_NUMBER);
+    std::mt19937 random(7U);
+    std::bernoulli_distribution lost(__Loss);
+    std::deque<std::pair<uint32_t, uint8_t>> ack;
+    Class_Telemetry_Encoder encoder(Field, LUBANCAT_TELEMETRY_FIELD_NUMBER, LUBANCAT_TELEMETRY_KEY_PERIOD);
+    Class_Telemetry_Decoder decoder(Field, LUBANCAT_TELEMETRY_FIELD_NUMBER);
+    uint8_t data[LUBANCAT_TELEMETRY_LENGTH];
+    uint64_t byte_number = 0U;
+    uint32_t decoded_number = 0U;
+    uint32_t keyframe_number = 0U;
+    uint32_t absolute_number = 0U;
+    uint32_t invalid_number = 0U;
+    uint8_t length_max = 0U;
+    double error_max = 0.0;
+
+    Trajectory(frame, __Idle, 1U);
+
+    for (uint32_t n = 0; n < BENCH_FRAME_NUMBER; n++)
+    {
+        while (!ack.empty() && ack.front().first <= n)
+        {
+            encoder.Acknowledge(ack.front().second);
+            ack.pop_front();
+        }
+
+        uint8_t length = encoder.Encode((const float *) &frame[n], data, sizeof(data));
+
+        byte_number += length;
+        length_max = (length > length_max) ? length : length_max;
+        if (lost(random))
+        {
+            continue;
+        }
+
+        Struct_Telemetry_LuBanCat value;
+        uint8_t sequence;
+        Enum_Codec_Result result = decoder.Decode(data, length, (float *) &value, &sequence);
+
+        if (result == Codec_Invalid)
+        {
+            invalid_number += 1U;
+            continue;
+        }
+        if (result == Codec_Keyframe)
+        {
+            keyframe_number += 1U;
+            if (!lost(random))
+            {
+                ack.push_back(std::make_pair(n + __Ack_Delay, sequence));
+            }
+        }
+        absolute_number += (result == Codec_Absolute) ? 1U : 0U;
+        decoded_number += 1U;
+
+        /* 量化误差（相对限幅后的原值，计入 float 表示误差） */
+        const float * source = (const float *) &frame[n];
+        const float * result_value = (const float *) &value;
+
+        for (uint8_t i = 0; i < LUBANCAT_TELEMETRY_FIELD_NUMBER; i++)
+        {
+            double x = std::fmin(std::fmax(source[i], Field[i].Min), Field[i].Max);
+            double error = std::fabs(result_value[i] - x) - 0.5 * Field[i].Resolution -
+                           2.0 * std::fabs(x) * 1.2e-7;
+
+            error_max = (error > error_max) ? error : error_max;
+        }
+    }
+
+    /* 编码耗时（关键帧立即确认） */
+    Class_Telemetry_Encoder timing(Field, LUBANCAT_TELEMETRY_FIELD_NUMBER, LUBANCAT_TELEMETRY_KEY_PERIOD);
+    uint32_t sink = 0U;
+
+    auto t0 = std::chrono::steady_clock::now();
+    uint64_t c0 = Cycle();
+    for (uint32_t n = 0; n < BENCH_FRAME_NUMBER; n++)
+    {
+        sink += timing.Encode((const float *) &frame[n], data, sizeof(data));
+        if (data[0] & CODEC_KEYFRAME)
+        {
+            timing.Acknowledge(data[0]);
+        }
+    }
+    uint64_t c1 = Cycle();
+    auto t1 = std::chrono::steady_clock::now();
+
+    double mean = (double) byte_number / BENCH_FRAME_NUMBER;
+
+    printf("%-12s loss %4.1f%%  mean %5.2f B (max %2u)  ratio %5.2fx vs float %u B, %5.2fx vs legacy %u B  "
+           "keyframe %5.2f%%  absolute %4u  dropped %4u  encode %5.1f ns %5.0f cyc  [%u]\n",
+           __Name, 100.0 * __Loss, mean, length_max, sizeof(Struct_Telemetry_LuBanCat) / mean,
+           (unsigned) sizeof(Struct_Telemetry_LuBanCat), BENCH_LEGACY_LENGTH / mean, BENCH_LEGACY_LENGTH,
+           100.0 * keyframe_number / (decoded_number ? decoded_number : 1U), absolute_number, invalid_number,
+           std::chrono::duration<double, std::nano>(t1 - t0).count() / BENCH_FRAME_NUMBER,
+           (double) (c1 - c0) / BENCH_FRAME_NUMBER, sink & 1U);
+
+    if (error_max > 0.0 || length_max > LUBANCAT_TELEMETRY_LENGTH)
+    {
+        printf("%-12s ERROR exceeds resolution / 2 by %g or frame exceeds %u B\n", __Name, error_max,
+               LUBANCAT_TELEMETRY_LENGTH);
+        return (false);
+    }
+
+    return (true);
+}
+
+/************************************************************************************************************************
+ * @brief   主函数
+ ***********************************************************************************************************************/
+int main()
+{
+    Class_Telemetry_Encoder encoder(Field, LUBANCAT_TELEMETRY_FIELD_NUMBER, LUBANCAT_TELEMETRY_KEY_PERIOD);
+    bool ok = (encoder.Get_Length_MAX() == LUBANCAT_TELEMETRY_LENGTH);
+
+    printf("field %u  length max %u B (LUBANCAT_TELEMETRY_LENGTH %u)  key period %u\n",
+           LUBANCAT_TELEMETRY_FIELD_NUMBER, encoder.Get_Length_MAX(), LUBANCAT_TELEMETRY_LENGTH,
+           LUBANCAT_TELEMETRY_KEY_PERIOD);
+
+    ok &= Bench("idle", true, 0.0, 2U);
+    ok &= Bench("driving", false, 0.0, 2U);
+    ok &= Bench("driving", false, 0.01, 2U);
+    ok &= Bench("driving", false, 0.10, 5U);
+
+    return (ok ? 0 : 1);
+}
@@ -0,0 +1,155 @@
+/**
+ * @file    Crc_Bench.cpp
+ * @brief   CRC校验算法吞吐量测试（与固件共用 Crc.h、Crc.cpp）
+ *          帧长 8 B ~ 4 KB，逐字节查表（改写前 Calculate_CRC8 的算法）vs slicing-by-4，另测 64 字节分段增量计算，
+ *          同时校验结果一致（逐项正确性见 Tests/Crc_Test.cpp）
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "Crc.h"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+/* 宏定义 --------------------------------------------------------------------------------------------------------------*/
+#define BENCH_BYTE_NUMBER       (64U * 1024U * 1024U)   /* 每组处理总字节数 */
+#define BENCH_CHUNK             64U                     /* 增量计算分段字节数 */
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/************************************************************************************************************************
+ * @brief   逐字节查表（与改写前 Calculate_CRC8 相同的循环，使用同一张0号表；禁止内联以对应原独立函数）
+ ***********************************************************************************************************************/
+template<typename CRC>
+struct Struct_CRC_Byte;
+
+template<typename Type, Type Polynomial, Type Init, bool Reflect, Type Xor_Out>
+struct Struct_CRC_Byte<Class_CRC<Type, Polynomial, Init, Reflect, Xor_Out>>
+{
+    __attribute__((noinline)) static uint32_t Calculate(const uint8_t * __Buffer, uint32_t __Length)
+    {
+        const uint32_t width = 8U * sizeof(Type);
+        const Type (&table)[4][256] = Struct_CRC_Table<Type, Polynomial, Reflect>::Table;
+        uint32_t crc = Init;
+
+        while (__Length--)
+        {
+            if (Reflect)
+            {
+                crc = (crc >> 8) ^ table[0][(crc ^ *__Buffer++) & 0xFFU];
+            }
+            else
+            {
+                crc = ((crc << 8) & CRC_Mask(width)) ^ table[0][((crc >> (width - 8U)) ^ *__Buffer++) & 0xFFU];
+            }
+        }
+        return ((Type) (crc ^ Xor_Out));
+    }
+};
+
+/************************************************************************************************************************
+ * @brief   slicing-by-4 整帧计算
+ ***********************************************************************************************************************/
+template<typename CRC>
+static uint32_t One_Shot(const uint8_t * __Buffer, uint32_t __Length)
+{
+    return (CRC::Calculate(__Buffer, __Length));
+}
+
+/************************************************************************************************************************
+ * @brief   slicing-by-4 按 BENCH_CHUNK 字节分段增量计算
+ ***********************************************************************************************************************/
+template<typename CRC>
+static uint32_t Chunked(const uint8_t * __Buffer, uint32_t __Length)
+{
+    CRC crc;
+
+    crc.Begin();
+    for (uint32_t done = 0; done < __Length; done += BENCH_CHUNK)
+    {
+        crc.Update(__Buffer + done, (__Length - done < BENCH_CHUNK) ? (__Length - done) : BENCH_CHUNK);
+    }
+    return (crc.Finish());
+}
+
+/************************************************************************************************************************
+ * @brief   计时：对 __Buffer 中连续的 __Size 字节帧逐帧计算，共 BENCH_BYTE_NUMBER 字节
+ *
+ * @return  double  每帧耗时 (ns)，__Result 返回各帧结果异或（用于一致性校验）
+ ***********************************************************************************************************************/
+static double Run(uint32_t (*__Function)(const uint8_t *, uint32_t), const std::vector<uint8_t> & __Buffer,
+                  uint32_t __Size, uint32_t * __Result)
+{
+    uint32_t frame = (uint32_t) (__Buffer.size() / __Size);
+    uint32_t repeat = BENCH_BYTE_NUMBER / (frame * __Size);
+    uint32_t result = 0U;
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t r = 0; r < repeat; r++)
+    {
+        for (uint32_t n = 0; n < frame; n++)
+        {
+            result ^= __Function(__Buffer.data() + n * __Size, __Size) + n;
+        }
+    }
+    auto t1 = std::chrono::steady_clock::now();
+
+    *__Result = result;
+    return (std::chrono::duration<double, std::nano>(t1 - t0).count() / ((double) repeat * frame));
+}
+
+/************************************************************************************************************************
+ * @brief   单个类型全部帧长
+ ***********************************************************************************************************************/
+template<typename CRC>
+static bool Bench(const char * __Name, const std::vector<uint8_t> & __Buffer)
+{
+    const uint32_t size[] = {8U, 16U, 32U, 64U, 128U, 256U, 512U, 1024U, 2048U, 4096U};
+    bool ok = true;
+
+    printf("%s  byte-wise / slicing-by-4 / %u B chunks (ns per frame)\n", __Name, BENCH_CHUNK);
+    for (uint32_t item : size)
+    {
+        uint32_t result[3];
+        double ns_byte = Run(Struct_CRC_Byte<CRC>::Calculate, __Buffer, item, &result[0]);
+        double ns_slice = Run(One_Shot<CRC>, __Buffer, item, &result[1]);
+        double ns_chunk = Run(Chunked<CRC>, __Buffer, item, &result[2]);
+
+        printf("%5u B  %9.1f / %9.1f / %9.1f  (%5.2fx)  %6.0f MB/s\n", item, ns_byte, ns_slice, ns_chunk,
+               ns_byte / ns_slice, item / ns_slice * 1000.0);
+        if (result[0] != result[1] || result[1] != result[2])
+        {
+            printf("%5u B  ERROR slicing-by-4 or chunked result differs from byte-wise table\n", item);
+            ok = false;
+        }
+    }
+
+    return (ok);
+}
+
+/************************************************************************************************************************
+ * @brief   主函数
+ ***********************************************************************************************************************/
+int main()
+{
+    std::vector<uint8_t> buffer(64U * 1024U);
+    std::mt19937 random(6U);
+    bool ok = true;
+
+    for (uint8_t & item : buffer)
+    {
+        item = (uint8_t) random();
+    }
+
+    ok &= Bench<Class_CRC8_MAXIM>("CRC-8/MAXIM", buffer);
+    ok &= Bench<Class_CRC16_MCRF4XX>("CRC-16/MCRF4XX", buffer);
+    ok &= Bench<Class_CRC16_CCITT_FALSE>("CRC-16/CCITT-FALSE", buffer);
+    ok &= Bench<Class_CRC32>("CRC-32", buffer);
+
+    return (ok ? 0 : 1);
+}
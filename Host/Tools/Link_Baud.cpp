@@ -0,0 +1,304 @@
+/**
+ * @file    Link_Baud.cpp
+ * @brief   串口波特率协商工具（Linux，termios2 任意波特率）
+ *          用法：Link_Baud <串口设备> <目标波特率> [--cobs] [--hold]
+ *          以基础波特率发起协商，双方切换后往返探测 COM_LINK_PROBE_NUMBER 帧，全部通过后提交；
+ *          --hold 时保持链路（每 200ms 发送一次探测帧作为保活并测量往返时间），同时进行时钟同步，每秒打印接收统计与
+ *          下位机时钟的漂移、最小往返时延，
+ *          超过 COM_LINK_SILENCE_TIMEOUT 无有效帧时与下位机同样回退至基础波特率
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.3
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "LuBanCat_Host.h"
+#include "LuBanCat_Clock.h"
+#include "LuBanCat_Telemetry.h"
+#include "Serial_Port.h"
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+/* 宏定义 --------------------------------------------------------------------------------------------------------------*/
+#define LINK_REPLY_TIMEOUT      50U             /* 单次应答超时 (ms) */
+#define LINK_RETRY              3U              /* 协商、提交重试次数 */
+#define LINK_HOLD_PERIOD        200U            /* --hold 保活探测周期 (ms) */
+
+/* 全局变量创建 --------------------------------------------------------------------------------------------------------*/
+static const uint8_t Link_Pattern[8] = COM_LINK_PATTERN;
+
+static Class_Serial_Port Serial;
+static Class_LuBanCat_Host Host;
+static Class_LuBanCat_Telemetry Telemetry;
+static Class_LuBanCat_Clock Clock;
+static Struct_COM_Link Link_Reply;
+static bool Link_Reply_Flag = false;
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/************************************************************************************************************************
+ * @brief   当前时间 (ms)
+ ***********************************************************************************************************************/
+static uint64_t Now()
+{
+    return ((uint64_t) std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/************************************************************************************************************************
+ * @brief   切换本端波特率（等待已写出数据发送完成，丢弃尚未成帧的接收数据）
+ *
+ * @param   __Baud_Rate     波特率 (bit/s)
+ ***********************************************************************************************************************/
+static void Link_Set_Baud_Rate(uint32_t __Baud_Rate)
+{
+    Host.Flush();
+    if (!Serial.Set_Baud_Rate(__Baud_Rate))
+    {
+        perror("TCSETS2");
+    }
+    Host.Reset();
+    Clock.Set_Baud_Rate(__Baud_Rate);
+}
+
+/************************************************************************************************************************
+ * @brief   接收处理：链路协商包
+ ***********************************************************************************************************************/
+static void Link_Receive(const Struct_COM_Link * Data, void * Context)
+{
+    (void) Context;
+    Link_Reply = *Data;
+    Link_Reply_Flag = true;
+}
+
+/************************************************************************************************************************
+ * @brief   接收处理：下位机上行包（仅用于 --hold 统计帧数）
+ ***********************************************************************************************************************/
+template<typename Type>
+static void Link_Uplink(const Type * Data, void * Context)
+{
+    (void) Data;
+    (void) Context;
+}
+
+/************************************************************************************************************************
+ * @brief   发送链路协商包并等待对应应答
+ *
+ * @param   __Command       命令
+ * @param   __Sequence      序号
+ * @param   __Baud_Rate     波特率 (bit/s)
+ * @param   __Reply         应答（成功时写入）
+ * @return  bool            是否在 LINK_REPLY_TIMEOUT 内收到同序号应答
+ ***********************************************************************************************************************/
+static bool Link_Request(uint8_t __Command, uint8_t __Sequence, uint32_t __Baud_Rate, Struct_COM_Link * __Reply)
+{
+    Struct_COM_Link link;
+    uint64_t deadline = Now() + LINK_REPLY_TIMEOUT;
+
+    link.Command = __Command;
+    link.Sequence = __Sequence;
+    link.Baud_Rate = __Baud_Rate;
+    if (__Command == COM_Link_Probe)
+    {
+        memcpy(link.Pattern, Link_Pattern, sizeof(Link_Pattern));
+    }
+    else
+    {
+        memset(link.Pattern, 0, sizeof(link.Pattern));
+    }
+    Host.Send(COM_PACKET_LINK, link);
+    Link_Reply_Flag = false;
+
+    for (uint64_t now = Now(); now < deadline; now = Now())
+    {
+        Host.Poll((int) (deadline - now));
+        if (Link_Reply_Flag && Link_Reply.Sequence == __Sequence)
+        {
+            *__Reply = Link_Reply;
+            return (true);
+        }
+    }
+
+    return (false);
+}
+
+/************************************************************************************************************************
+ * @brief   协商切换至目标波特率
+ *
+ * @param   __Baud_Rate     目标波特率 (bit/s)
+ * @return  bool            是否成功（失败时已回退至基础波特率）
+ ***********************************************************************************************************************/
+static bool Link_Negotiate(uint32_t __Baud_Rate)
+{
+    Struct_COM_Link reply;
+    uint8_t sequence = (uint8_t) Now();
+    bool accepted = false;
+
+    /* 协商 */
+    for (uint32_t i = 0; i < LINK_RETRY && !accepted; i++)
+    {
+        if (Link_Request(COM_Link_Propose, ++sequence, __Baud_Rate, &reply))
+        {
+            if (reply.Command == COM_Link_Reject)
+            {
+                printf("rejected, device stays at %u baud\n", reply.Baud_Rate);
+                return (false);
+            }
+            accepted = (reply.Command == COM_Link_Accept);
+        }
+    }
+    if (!accepted)
+    {
+        printf("no reply to propose at %u baud\n", COM_LINK_BAUD_RATE_BASE);
+        return (false);
+    }
+
+    /* 切换（下位机在应答发送完成后的下一个系统心跳切换） */
+    Link_Set_Baud_Rate(__Baud_Rate);
+    usleep(5000);
+
+    /* 往返探测 */
+    uint32_t pass = 0U;
+    uint64_t rtt = 0U;
+
+    for (uint32_t i = 0; i < 2U * COM_LINK_PROBE_NUMBER && pass < COM_LINK_PROBE_NUMBER; i++)
+    {
+        uint64_t start = Now();
+
+        if (Link_Request(COM_Link_Probe, ++sequence, __Baud_Rate, &reply) && reply.Command == COM_Link_Probe &&
+            memcmp(reply.Pattern, Link_Pattern, sizeof(Link_Pattern)) == 0)
+        {
+            pass += 1U;
+            rtt += Now() - start;
+        }
+    }
+
+    /* 提交 */
+    bool committed = false;
+
+    if (pass >= COM_LINK_PROBE_NUMBER)
+    {
+        for (uint32_t i = 0; i < LINK_RETRY && !committed; i++)
+        {
+            committed = Link_Request(COM_Link_Commit, ++sequence, __Baud_Rate, &reply) &&
+                        reply.Command == COM_Link_Commit;
+        }
+    }
+
+    printf("probe %u/%u (avg rtt %.1f ms), %s at %u baud\n", pass, COM_LINK_PROBE_NUMBER,
+           pass ? (double) rtt / pass : 0.0, committed ? "committed" : "failed", __Baud_Rate);
+    if (!committed)
+    {
+        /* 下位机试用超时后回退至原波特率 */
+        Link_Set_Baud_Rate(COM_LINK_BAUD_RATE_BASE);
+    }
+
+    return (committed);
+}
+
+/************************************************************************************************************************
+ * @brief   保持链路并统计（Ctrl-C 退出）
+ *
+ * @param   __Baud_Rate     当前波特率 (bit/s)
+ ***********************************************************************************************************************/
+static void Link_Hold(uint32_t __Baud_Rate)
+{
+    uint64_t last_frame = Now();
+    uint64_t next_probe = Now();
+    uint64_t next_print = Now() + 1000U;
+    uint32_t frame_base = Host.Get_Frame_Number();
+    uint32_t error_base = Host.Get_Error_Number();
+    uint8_t sequence = 0U;
+
+    for (;;)
+    {
+        uint64_t now = Now();
+
+        Clock.Sync();
+        if (now >= next_probe)
+        {
+            Struct_COM_Link link = {COM_Link_Probe, ++sequence, __Baud_Rate, COM_LINK_PATTERN};
+
+            Host.Send(COM_PACKET_LINK, link);
+            next_probe = now + LINK_HOLD_PERIOD;
+        }
+
+        if (Host.Poll(10) > 0)
+        {
+            last_frame = Now();
+        }
+
+        now = Now();
+        if (now >= next_print)
+        {
+            printf("%u baud: %u frames/s, %u errors, %u bytes skipped, clock %s drift %+.2f ppm delay %u us\n",
+                   __Baud_Rate, Host.Get_Frame_Number() - frame_base, Host.Get_Error_Number() - error_base,
+                   Host.Get_Skip_Number(), Clock.Get_Valid() ? "synced" : "unsynced",
+                   Clock.Get_Clock()->Get_Drift() * 1e6, Clock.Get_Clock()->Get_Delay());
+            frame_base = Host.Get_Frame_Number();
+            error_base = Host.Get_Error_Number();
+            next_print = now + 1000U;
+        }
+        if (__Baud_Rate != COM_LINK_BAUD_RATE_BASE && now - last_frame >= COM_LINK_SILENCE_TIMEOUT)
+        {
+            printf("link silent for %u ms, falling back to %u baud\n", COM_LINK_SILENCE_TIMEOUT, COM_LINK_BAUD_RATE_BASE);
+            __Baud_Rate = COM_LINK_BAUD_RATE_BASE;
+            Link_Set_Baud_Rate(__Baud_Rate);
+            last_frame = now;
+        }
+    }
+}
+
+/************************************************************************************************************************
+ * @brief   主函数
+ ***********************************************************************************************************************/
+int main(int argc, char ** argv)
+{
+    Enum_Frame_Mode mode = Frame_Mode_Head;
+    bool hold = false;
+
+    setvbuf(stdout, nullptr, _IOLBF, 0);
+    if (argc < 3)
+    {
+        fprintf(stderr, "usage: %s <device> <baud> [--cobs] [--hold]\n", argv[0]);
+        return (2);
+    }
+    for (int i = 3; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--cobs") == 0)
+        {
+            mode = Frame_Mode_COBS;
+        }
+        else if (strcmp(argv[i], "--hold") == 0)
+        {
+            hold = true;
+        }
+    }
+
+    if (!Serial.Open(argv[1], COM_LINK_BAUD_RATE_BASE) || !Host.Init(Serial.Get_FD(), LUBANCAT_PACK_HEAD, mode))
+    {
+        perror(argv[1]);
+        return (1);
+    }
+    Host.Register<Struct_COM_Link, Link_Receive>(COM_PACKET_LINK);
+    Host.Register<Struct_TxData_LuBanCat, Link_Uplink>(LuBanCat_Packet_Motor);
+    Host.Register<Struct_TxData_Odometry_LuBanCat, Link_Uplink>(LuBanCat_Packet_Odometry);
+    Host.Register<Struct_TxData_Diagnostic_LuBanCat, Link_Uplink>(LuBanCat_Packet_Diagnostic);
+    Telemetry.Attach(&Host, nullptr);
+    Clock.Attach(&Host, COM_LINK_BAUD_RATE_BASE);
+
+    uint32_t baud_rate = (uint32_t) strtoul(argv[2], nullptr, 0);
+    bool ok = (baud_rate == COM_LINK_BAUD_RATE_BASE) || Link_Negotiate(baud_rate);
+
+    if (hold)
+    {
+        Link_Hold(ok ? baud_rate : COM_LINK_BAUD_RATE_BASE);
+    }
+
+    return (ok ? 0 : 1);
+}
@@ -0,0 +1,120 @@
+/**
+ * @file    Math_Fast_Bench.cpp
+ * @brief   快速数学函数计算耗时测试（与固件共用 Math_Fast.h、Math_Fast.cpp）
+ *          同一组输入分别送入 Math_Fast_* 与单精度 libm，统计每次调用耗时（精度见 Tests/Math_Fast_Test.cpp）
+ * @note    主机 glibc 的 sinf/cosf/atan2f 为向量化 FMA 实现，与 Cortex-M4 上的软件 libm 不可比，
+ *          目标板耗时以 DWT 周期计数为准
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "Math_Fast.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/* 宏定义 --------------------------------------------------------------------------------------------------------------*/
+#define BENCH_INPUT_NUMBER      4096U       /* 输入个数（常驻 L1） */
+#define BENCH_REPEAT            512U        /* 重复次数 */
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/************************************************************************************************************************
+ * @brief   时间戳计数器
+ ***********************************************************************************************************************/
+static inline uint64_t Cycle()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return (__rdtsc());
+#else
+    return (0U);
+#endif
+}
+
+/************************************************************************************************************************
+ * @brief   计时执行 __Function(n)，n 遍历全部输入 BENCH_REPEAT 次
+ *
+ * @return  double  每次调用耗时 (ns)，__Cycle 返回每次时钟周期数
+ ***********************************************************************************************************************/
+template<typename Function>
+static double Run(Function __Function, double * __Cycle)
+{
+    auto t0 = std::chrono::steady_clock::now();
+    uint64_t c0 = Cycle();
+    for (uint32_t r = 0; r < BENCH_REPEAT; r++)
+    {
+        for (uint32_t n = 0; n < BENCH_INPUT_NUMBER; n++)
+        {
+            __Function(n);
+        }
+    }
+    uint64_t c1 = Cycle();
+    auto t1 = std::chrono::steady_clock::now();
+
+    *__Cycle = (double) (c1 - c0) / (BENCH_REPEAT * BENCH_INPUT_NUMBER);
+    return (std::chrono::duration<double, std::nano>(t1 - t0).count() / (BENCH_REPEAT * BENCH_INPUT_NUMBER));
+}
+
+/************************************************************************************************************************
+ * @brief   对比两种实现并输出一行结果
+ ***********************************************************************************************************************/
+template<typename Function_Libm, typename Function_Fast>
+static void Bench(const char * __Name, const char * __Libm, Function_Libm __Function_Libm, const char * __Fast,
+                  Function_Fast __Function_Fast)
+{
+    double cycle_libm, cycle_fast;
+    double ns_libm = Run(__Function_Libm, &cycle_libm);
+    double ns_fast = Run(__Function_Fast, &cycle_fast);
+
+    printf("%-8s %-14s %6.2f ns %6.1f cyc  %-18s %6.2f ns %6.1f cyc  (%.2fx)\n", __Name, __Libm, ns_libm, cycle_libm,
+           __Fast, ns_fast, cycle_fast, ns_libm / ns_fast);
+}
+
+/************************************************************************************************************************
+ * @brief   主函数
+ ***********************************************************************************************************************/
+int main()
+{
+    std::mt19937 random(2024U);
+    std::uniform_real_distribution<float> angle(-PI, PI);
+    std::uniform_real_distribution<float> coordinate(-10.0f, 10.0f);
+    std::uniform_real_distribution<float> servo(-720.0f, 720.0f);
+    std::vector<float> x(BENCH_INPUT_NUMBER), y(BENCH_INPUT_NUMBER), z(BENCH_INPUT_NUMBER);
+    std::vector<float> out_a(BENCH_INPUT_NUMBER), out_b(BENCH_INPUT_NUMBER);
+    volatile float sink = 0.0f;
+
+    for (uint32_t n = 0; n < BENCH_INPUT_NUMBER; n++)
+    {
+        x[n] = angle(random);
+        y[n] = coordinate(random);
+        z[n] = servo(random);
+    }
+
+    Bench("sin", "sinf", [&](uint32_t n) { out_a[n] = sinf(x[n]); },
+          "Math_Fast_Sin", [&](uint32_t n) { out_a[n] = Math_Fast_Sin(x[n]); });
+    Bench("sincos", "sinf + cosf", [&](uint32_t n) { out_a[n] = sinf(x[n]); out_b[n] = cosf(x[n]); },
+          "Math_Fast_Sin_Cos", [&](uint32_t n) { Math_Fast_Sin_Cos(x[n], &out_a[n], &out_b[n]); });
+    Bench("atan2", "atan2f", [&](uint32_t n) { out_a[n] = atan2f(y[n], x[n]); },
+          "Math_Fast_Atan2", [&](uint32_t n) { out_a[n] = Math_Fast_Atan2(y[n], x[n]); });
+    Bench("sqrt", "sqrtf", [&](uint32_t n) { out_a[n] = sqrtf(std::fabs(y[n])); },
+          "Math_Fast_Sqrt", [&](uint32_t n) { out_a[n] = Math_Fast_Sqrt(std::fabs(y[n])); });
+    Bench("fmod", "fmodf", [&](uint32_t n) { out_a[n] = fmodf(z[n], 360.0f); },
+          "Math_Fast_Fmod", [&](uint32_t n) { out_a[n] = Math_Fast_Fmod(z[n], 360.0f); });
+    Bench("wrap", "remainderf", [&](uint32_t n) { out_a[n] = remainderf(10.0f * y[n], 2.0f * PI); },
+          "Math_Fast_Wrap_PI", [&](uint32_t n) { out_a[n] = Math_Fast_Wrap_PI(10.0f * y[n]); });
+
+    for (uint32_t n = 0; n < BENCH_INPUT_NUMBER; n++)
+    {
+        sink = sink + out_a[n] + out_b[n];
+    }
+
+    return (0);
+}
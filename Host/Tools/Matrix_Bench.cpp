@@ -0,0 +1,295 @@
+/**
+ * @file    Matrix_Bench.cpp
+ * @brief   定长矩阵模板计算耗时测试（与固件共用 Matrix.h、User_Math.cpp）
+ *          同一组随机矩阵分别送入 Math_Matrix_Multiply_3_3 / _3_1（独立编译单元，与固件相同不可跨调用内联）
+ *          与 Class_Matrix 运算符，统计每次乘法耗时；结果与双精度朴素乘积比较，另校验超过展开上限时的
+ *          arm_mat_mult_f32 分支与 3x3、4x4 求逆（constexpr 求逆另以 static_assert 编译期校验）
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.1
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "Matrix.h"
+#include "User_Math.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/* 宏定义 --------------------------------------------------------------------------------------------------------------*/
+#define BENCH_MATRIX_NUMBER     4096U       /* 随机矩阵组数（常驻 L1/L2） */
+#define BENCH_REPEAT            256U        /* 每组重复次数 */
+#define BENCH_TOLERANCE         1.0e-6f     /* 与双精度朴素乘积的最大偏差（元素取值 [-1, 1]） */
+#define BENCH_TOLERANCE_INVERSE 1.0e-4f     /* A * A^-1 与单位阵的最大偏差（条件数受限的随机矩阵） */
+
+/* 编译期校验 ----------------------------------------------------------------------------------------------------------*/
+/* constexpr 求逆（C++11 单 return 形式），元素与逆矩阵均可精确表示 */
+constexpr Class_Matrix<3, 3> Inverse_3 = Math_Matrix_Inverse(Class_Matrix<3, 3>{{1.0f, 2.0f, 0.0f,
+                                                                                   0.0f, 1.0f, 0.0f,
+                                                                                   0.0f, 0.0f, 2.0f}});
+constexpr Class_Matrix<4, 4> Inverse_4 = Math_Matrix_Inverse(Class_Matrix<4, 4>{{1.0f, 1.0f, 0.0f, 0.0f,
+                                                                                   0.0f, 1.0f, 0.0f, 0.0f,
+                                                                                   0.0f, 0.0f, 2.0f, 0.0f,
+                                                                                   0.0f, 0.0f, 0.0f, 4.0f}});
+static_assert(Inverse_3(0, 0) == 1.0f && Inverse_3(0, 1) == -2.0f && Inverse_3(1, 1) == 1.0f &&
+              Inverse_3(2, 2) == 0.5f && Inverse_3(1, 0) == 0.0f, "3x3 constexpr inverse");
+static_assert(Inverse_4(0, 0) == 1.0f && Inverse_4(0, 1) == -1.0f && Inverse_4(1, 1) == 1.0f &&
+              Inverse_4(2, 2) == 0.5f && Inverse_4(3, 3) == 0.25f && Inverse_4(3, 0) == 0.0f, "4x4 constexpr inverse");
+static_assert(Math_Matrix_Determinant(Class_Matrix<4, 4>{{1.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+                                                          0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 0.0f, 4.0f}}) == 8.0f,
+              "4x4 constexpr determinant");
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/************************************************************************************************************************
+ * @brief   时间戳计数器
+ ***********************************************************************************************************************/
+static inline uint64_t Cycle()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return (__rdtsc());
+#else
+    return (0U);
+#endif
+}
+
+/************************************************************************************************************************
+ * @brief   随机矩阵
+ ***********************************************************************************************************************/
+template<uint32_t R, uint32_t C>
+static void Random(std::vector<Class_Matrix<R, C>> & __Matrix, uint32_t __Seed)
+{
+    std::mt19937 random(__Seed);
+    std::uniform_real_distribution<float> value(-1.0f, 1.0f);
+
+    for (Class_Matrix<R, C> & item : __Matrix)
+    {
+        for (uint32_t i = 0; i < R * C; i++)
+        {
+            item[i] = value(random);
+        }
+    }
+}
+
+/************************************************************************************************************************
+ * @brief   双精度朴素乘积最大偏差
+ ***********************************************************************************************************************/
+template<uint32_t R, uint32_t K, uint32_t C>
+static float Difference(const Class_Matrix<R, K> & __A, const Class_Matrix<K, C> & __B, const Class_Matrix<R, C> & __Out)
+{
+    float difference = 0.0f;
+
+    for (uint32_t i = 0; i < R; i++)
+    {
+        for (uint32_t j = 0; j < C; j++)
+        {
+            double sum = 0.0;
+
+            for (uint32_t k = 0; k < K; k++)
+            {
+                sum += (double) __A.Data[i][k] * __B.Data[k][j];
+            }
+            difference = std::fmax(difference, (float) std::fabs(sum - __Out.Data[i][j]));
+        }
+    }
+
+    return (difference);
+}
+
+/************************************************************************************************************************
+ * @brief   计时执行 __Function(n)，n 遍历全部矩阵组 BENCH_REPEAT 次
+ *
+ * @return  double  每次乘法耗时 (ns)，__Cycle 返回每次时钟周期数
+ ***********************************************************************************************************************/
+template<typename Function>
+static double Run(Function __Function, double * __Cycle)
+{
+    auto t0 = std::chrono::steady_clock::now();
+    uint64_t c0 = Cycle();
+    for (uint32_t r = 0; r < BENCH_REPEAT; r++)
+    {
+        for (uint32_t n = 0; n < BENCH_MATRIX_NUMBER; n++)
+        {
+            __Function(n);
+        }
+    }
+    uint64_t c1 = Cycle();
+    auto t1 = std::chrono::steady_clock::now();
+
+    *__Cycle = (double) (c1 - c0) / (BENCH_REPEAT * BENCH_MATRIX_NUMBER);
+    return (std::chrono::duration<double, std::nano>(t1 - t0).count() / (BENCH_REPEAT * BENCH_MATRIX_NUMBER));
+}
+
+/************************************************************************************************************************
+ * @brief   输出一行结果
+ ***********************************************************************************************************************/
+static bool Report(const char * __Name, const char * __Reference, double __Ns_Reference, double __Cycle_Reference,
+                   double __Ns, double __Cycle, float __Difference_Reference, float __Difference)
+{
+    bool ok = (__Difference_Reference <= BENCH_TOLERANCE && __Difference <= BENCH_TOLERANCE);
+
+    printf("%-10s %-26s %6.2f ns %6.1f cyc  Class_Matrix %6.2f ns %6.1f cyc  (%.2fx)  diff %.1e / %.1e  %s\n",
+           __Name, __Reference, __Ns_Reference, __Cycle_Reference, __Ns, __Cycle, __Ns_Reference / __Ns,
+           __Difference_Reference, __Difference, ok ? "ok" : "FAIL");
+
+    return (ok);
+}
+
+/************************************************************************************************************************
+ * @brief   3x3 * 3x3
+ ***********************************************************************************************************************/
+static bool Bench_3_3()
+{
+    std::vector<Class_Matrix<3, 3>> a(BENCH_MATRIX_NUMBER), b(BENCH_MATRIX_NUMBER);
+    std::vector<Class_Matrix<3, 3>> out_function(BENCH_MATRIX_NUMBER), out_matrix(BENCH_MATRIX_NUMBER);
+    float difference_function = 0.0f, difference_matrix = 0.0f;
+    double cycle_function, cycle_matrix;
+
+    Random(a, 1U);
+    Random(b, 2U);
+
+    double ns_function = Run([&](uint32_t n) {
+        Math_Matrix_Multiply_3_3(a[n].Data, b[n].Data, out_function[n].Data);
+    }, &cycle_function);
+    double ns_matrix = Run([&](uint32_t n) {
+        out_matrix[n] = a[n] * b[n];
+    }, &cycle_matrix);
+
+    for (uint32_t n = 0; n < BENCH_MATRIX_NUMBER; n++)
+    {
+        difference_function = std::fmax(difference_function, Difference(a[n], b[n], out_function[n]));
+        difference_matrix = std::fmax(difference_matrix, Difference(a[n], b[n], out_matrix[n]));
+    }
+
+    return (Report("3x3 * 3x3", "Math_Matrix_Multiply_3_3", ns_function, cycle_function, ns_matrix, cycle_matrix,
+                   difference_function, difference_matrix));
+}
+
+/************************************************************************************************************************
+ * @brief   3x3 * 3x1
+ ***********************************************************************************************************************/
+static bool Bench_3_1()
+{
+    std::vector<Class_Matrix<3, 3>> a(BENCH_MATRIX_NUMBER);
+    std::vector<Class_Vector<3>> b(BENCH_MATRIX_NUMBER);
+    std::vector<Class_Vector<3>> out_function(BENCH_MATRIX_NUMBER), out_matrix(BENCH_MATRIX_NUMBER);
+    float difference_function = 0.0f, difference_matrix = 0.0f;
+    double cycle_function, cycle_matrix;
+
+    Random(a, 3U);
+    Random(b, 4U);
+
+    double ns_function = Run([&](uint32_t n) {
+        Math_Matrix_Multiply_3_1(a[n].Data, &b[n].Data[0][0], &out_function[n].Data[0][0]);
+    }, &cycle_function);
+    double ns_matrix = Run([&](uint32_t n) {
+        out_matrix[n] = a[n] * b[n];
+    }, &cycle_matrix);
+
+    for (uint32_t n = 0; n < BENCH_MATRIX_NUMBER; n++)
+    {
+        difference_function = std::fmax(difference_function, Difference(a[n], b[n], out_function[n]));
+        difference_matrix = std::fmax(difference_matrix, Difference(a[n], b[n], out_matrix[n]));
+    }
+
+    return (Report("3x3 * 3x1", "Math_Matrix_Multiply_3_1", ns_function, cycle_function, ns_matrix, cycle_matrix,
+                   difference_function, difference_matrix));
+}
+
+/************************************************************************************************************************
+ * @brief   超过展开上限 (8x8 * 8x8) 的 arm_mat_mult_f32 分支
+ ***********************************************************************************************************************/
+static bool Bench_8_8()
+{
+    std::vector<Class_Matrix<8, 8>> a(BENCH_MATRIX_NUMBER), b(BENCH_MATRIX_NUMBER), out(BENCH_MATRIX_NUMBER);
+    float difference = 0.0f;
+    double cycle;
+
+    Random(a, 5U);
+    Random(b, 6U);
+
+    double ns = Run([&](uint32_t n) {
+        out[n] = a[n] * b[n];
+    }, &cycle);
+
+    for (uint32_t n = 0; n < BENCH_MATRIX_NUMBER; n++)
+    {
+        difference = std::fmax(difference, Difference(a[n], b[n], out[n]));
+    }
+
+    bool ok = (difference <= 4.0f * BENCH_TOLERANCE);
+    printf("%-10s %-26s %6.2f ns %6.1f cyc  diff %.1e  %s\n", "8x8 * 8x8", "arm_mat_mult_f32", ns, cycle, difference,
+           ok ? "ok" : "FAIL");
+
+    return (ok);
+}
+
+/************************************************************************************************************************
+ * @brief   求逆校验：A * A^-1 与单位阵的最大偏差（跳过 |det| 过小的病态矩阵）
+ ***********************************************************************************************************************/
+template<uint32_t N>
+static bool Check_Inverse(const char * __Name, uint32_t __Seed)
+{
+    std::vector<Class_Matrix<N, N>> a(BENCH_MATRIX_NUMBER);
+    float difference = 0.0f;
+    uint32_t number = 0U;
+
+    Random(a, __Seed);
+
+    for (const Class_Matrix<N, N> & item : a)
+    {
+        Class_Matrix<N, N> inverse;
+
+        if (!Math_Matrix_Inverse(item, &inverse))
+        {
+            continue;
+        }
+
+        Class_Matrix<N, N> product = item * inverse;
+        float norm = 0.0f;
+        for (uint32_t i = 0; i < N * N; i++)
+        {
+            norm = std::fmax(norm, std::fabs(inverse[i]));
+        }
+        if (norm > 10.0f)
+        {
+            continue;
+        }
+
+        number += 1U;
+        for (uint32_t i = 0; i < N; i++)
+        {
+            for (uint32_t j = 0; j < N; j++)
+            {
+                difference = std::fmax(difference, std::fabs(product.Data[i][j] - ((i == j) ? 1.0f : 0.0f)));
+            }
+        }
+    }
+
+    bool ok = (number > BENCH_MATRIX_NUMBER / 2U && difference <= BENCH_TOLERANCE_INVERSE);
+    printf("%-10s A * A^-1 - I  max %.1e over %u matrices  %s\n", __Name, difference, number, ok ? "ok" : "FAIL");
+
+    return (ok);
+}
+
+/************************************************************************************************************************
+ * @brief   主函数
+ ***********************************************************************************************************************/
+int main()
+{
+    bool ok = true;
+
+    ok &= Bench_3_3();
+    ok &= Bench_3_1();
+    ok &= Bench_8_8();
+    ok &= Check_Inverse<3>("3x3 inv", 7U);
+    ok &= Check_Inverse<4>("4x4 inv", 8U);
+
+    return (ok ? 0 : 1);
+}
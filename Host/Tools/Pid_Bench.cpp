@@ -0,0 +1,407 @@
+/**
+ * @file    Pid_Bench.cpp
+ * @brief   PID控制器计算耗时测试（与固件共用 Pid.h、Pid_Bank.h）
+ *          同一组四轮目标、实际值轨迹分别送入各PID实现，校验输出一致并统计每控制周期（四路）耗时：
+ *          策略特化前的运行时分支实现 vs Class_PID / Class_PID_T<>，四个独立PID vs Class_PID_Bank<4>
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.2
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "Pid.h"
+#include "Pid_Bank.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/* 宏定义 --------------------------------------------------------------------------------------------------------------*/
+#define BENCH_STEP_NUMBER       1000000U    /* 每组控制周期数 */
+#define BENCH_WHEEL_NUMBER      4U          /* 控制器路数（底盘四轮） */
+#define BENCH_TOLERANCE         5.0e-4f     /* 输出一致性容差（相对输出限幅，对照组每次计算做除法的舍入差） */
+
+/* 结构体定义 ----------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   单控制周期四轮输入
+ */
+struct Struct_Bench_Step
+{
+    float Target[BENCH_WHEEL_NUMBER];
+    float Actual[BENCH_WHEEL_NUMBER];
+};
+
+/* 类定义 --------------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   策略特化前的PID实现（对照组，Calculate 与原 Pid.cpp 相同：运行时判断各功能，每次计算做除法）
+ */
+class Class_PID_Legacy
+{
+public:
+    void Init(float __K_P, float __K_I, float __K_D, float __K_F = 0.0f, float __I_Out_Max = 0.0f,
+              float __Out_Max = 0.0f, float __D_T = 0.001f, float __Dead_Zone = 0.0f,
+              float __I_Variable_Speed_A = 0.0f, float __I_Variable_Speed_B = 0.0f, float __I_Separate_Threshold = 0.0f,
+              Enum_PID_D_First __D_First = PID_D_First_DISABLE)
+    {
+        K_P = __K_P;
+        K_I = __K_I;
+        K_D = __K_D;
+        K_F = __K_F;
+        I_Out_Max = __I_Out_Max;
+        Out_Max = __Out_Max;
+        D_T = __D_T;
+        Dead_Zone = __Dead_Zone;
+        I_Variable_Speed_A = __I_Variable_Speed_A;
+        I_Variable_Speed_B = __I_Variable_Speed_B;
+        I_Separate_Threshold = __I_Separate_Threshold;
+        D_First = __D_First;
+    }
+    void Calculate();
+
+    float Get_Out() { return (Out); }
+    void Set_Target(float __Target) { Target = __Target; }
+    void Set_Actual(float __Actual) { Actual = __Actual; }
+protected:
+    float Out = 0.0f;
+    float D_T = 0.001f;
+    float K_P = 0.0f;
+    float K_I = 0.0f;
+    float K_D = 0.0f;
+    float K_F = 0.0f;
+    float I_Out_Max = 0.0f;
+    float Out_Max = 0.0f;
+    float I_Variable_Speed_A = 0.0f;
+    float I_Variable_Speed_B = 0.0f;
+    float I_Separate_Threshold = 0.0f;
+    float Target = 0.0f;
+    float Actual = 0.0f;
+    float Dead_Zone = 0.0f;
+    Enum_PID_D_First D_First = PID_D_First_DISABLE;
+    float Integral_Error = 0.0f;
+    float Pre_Target = 0.0f;
+    float Pre_Actual = 0.0f;
+    float Pre_Out = 0.0f;
+    float Pre_Error = 0.0f;
+};
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/************************************************************************************************************************
+ * @brief   周期计数（x86 为 TSC，其余平台返回0）
+ ***********************************************************************************************************************/
+static inline uint64_t Cycle()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return (__rdtsc());
+#else
+    return (0U);
+#endif
+}
+
+/************************************************************************************************************************
+ * @brief   对照组PID计算（逐行保留原实现，禁止内联以对应原 Pid.cpp 中的独立函数）
+ ***********************************************************************************************************************/
+__attribute__((noinline)) void Class_PID_Legacy::Calculate()
+{
+    float p_out = 0.0f;
+    float i_out = 0.0f;
+    float d_out = 0.0f;
+    float f_out = 0.0f;
+    float error;
+    float abs_error;
+    float speed_ratio = 1.0f;
+
+    error = Target - Actual;
+    abs_error = Math_Abs(error);
+
+    if(abs_error < Dead_Zone)
+    {
+        Target = Actual;
+        error = 0.0f;
+        abs_error = 0.0f;
+    }
+
+    p_out = K_P * error;
+
+    if(I_Variable_Speed_A == 0.0f && I_Variable_Speed_B == 0.0f)
+    {
+        speed_ratio = 1.0f;
+    }
+    else
+    {
+        if(abs_error <= I_Variable_Speed_A)
+        {
+            speed_ratio = 1.0f;
+        }
+        else if(I_Variable_Speed_A < abs_error && abs_error < I_Variable_Speed_B)
+        {
+            speed_ratio = (I_Variable_Speed_B - abs_error) / (I_Variable_Speed_B - I_Variable_Speed_A);
+        }
+        if(abs_error >= I_Variable_Speed_B)
+        {
+            speed_ratio = 0.0f;
+        }
+    }
+    if(I_Out_Max != 0.0f)
+    {
+        Math_Constrain(&Integral_Error, -I_Out_Max / K_I, I_Out_Max / K_I);
+    }
+    if(I_Separate_Threshold == 0.0f)
+    {
+        Integral_Error += speed_ratio * D_T * error;
+        i_out = K_I * Integral_Error;
+    }
+    else
+    {
+        if(abs_error < I_Separate_Threshold)
+        {
+            Integral_Error += speed_ratio * D_T * error;
+            i_out = K_I * Integral_Error;
+        }
+        else
+        {
+            Integral_Error = 0.0f;
+            i_out = 0.0f;
+        }
+    }
+
+    if(D_First == PID_D_First_ENABLE)
+    {
+        d_out = K_D * (Out - Pre_Out) / D_T;
+    }
+    else
+    {
+        d_out = K_D * (error - Pre_Error) / D_T;
+    }
+
+    f_out = (Target - Pre_Target) * K_F;
+
+    Out = p_out + i_out + d_out + f_out;
+    if(Out_Max != 0.0f)
+    {
+        Math_Constrain(&Out, -Out_Max, Out_Max);
+    }
+
+    Pre_Actual = Actual;
+    Pre_Target = Target;
+    Pre_Out = Out;
+    Pre_Error = error;
+}
+
+/************************************************************************************************************************
+ * @brief   合成轨迹：目标值分段阶跃，实际值一阶跟随并叠加测速噪声（与底盘 20ms 控制周期、±26 rad/s 轮速一致）
+ ***********************************************************************************************************************/
+static void Trajectory(std::vector<Struct_Bench_Step> & __Step)
+{
+    std::mt19937 random(2024U);
+    std::normal_distribution<float> noise(0.0f, 0.3f);
+    std::uniform_real_distribution<float> target(-26.0f, 26.0f);
+    Struct_Bench_Step value = {};
+
+    for (uint32_t n = 0; n < __Step.size(); n++)
+    {
+        for (uint32_t i = 0; i < BENCH_WHEEL_NUMBER; i++)
+        {
+            if (n % 200U == i * 50U)
+            {
+                value.Target[i] = target(random);
+            }
+            value.Actual[i] += 0.1f * (value.Target[i] - value.Actual[i]);
+            __Step[n].Target[i] = value.Target[i];
+            __Step[n].Actual[i] = value.Actual[i] + noise(random);
+        }
+    }
+}
+
+/************************************************************************************************************************
+ * @brief   四个独立PID逐路计算
+ *
+ * @tparam  PID 独立PID类型
+ * @return  double  每周期（四路）耗时 (ns)，__Cycle 返回每周期时钟周期数
+ ***********************************************************************************************************************/
+template<typename PID>
+static double Run_Separate(PID * __PID, const std::vector<Struct_Bench_Step> & __Step, std::vector<float> & __Out,
+                           double * __Cycle)
+{
+    auto t0 = std::chrono::steady_clock::now();
+    uint64_t c0 = Cycle();
+    for (uint32_t n = 0; n < __Step.size(); n++)
+    {
+        for (uint32_t i = 0; i < BENCH_WHEEL_NUMBER; i++)
+        {
+            __PID[i].Set_Target(__Step[n].Target[i]);
+            __PID[i].Set_Actual(__Step[n].Actual[i]);
+            __PID[i].Calculate();
+            __Out[n * BENCH_WHEEL_NUMBER + i] = __PID[i].Get_Out();
+        }
+    }
+    uint64_t c1 = Cycle();
+    auto t1 = std::chrono::steady_clock::now();
+
+    *__Cycle = (double) (c1 - c0) / __Step.size();
+    return (std::chrono::duration<double, std::nano>(t1 - t0).count() / __Step.size());
+}
+
+/************************************************************************************************************************
+ * @brief   PID控制器组四路一次计算
+ ***********************************************************************************************************************/
+static double Run_Bank(Class_PID_Bank<BENCH_WHEEL_NUMBER> & __Bank, const std::vector<Struct_Bench_Step> & __Step,
+                       std::vector<float> & __Out, double * __Cycle)
+{
+    auto t0 = std::chrono::steady_clock::now();
+    uint64_t c0 = Cycle();
+    for (uint32_t n = 0; n < __Step.size(); n++)
+    {
+        for (uint32_t i = 0; i < BENCH_WHEEL_NUMBER; i++)
+        {
+            __Bank.Set_Target(i, __Step[n].Target[i]);
+            __Bank.Set_Actual(i, __Step[n].Actual[i]);
+        }
+        __Bank.Calculate();
+        for (uint32_t i = 0; i < BENCH_WHEEL_NUMBER; i++)
+        {
+            __Out[n * BENCH_WHEEL_NUMBER + i] = __Bank.Get_Out(i);
+        }
+    }
+    uint64_t c1 = Cycle();
+    auto t1 = std::chrono::steady_clock::now();
+
+    *__Cycle = (double) (c1 - c0) / __Step.size();
+    return (std::chrono::duration<double, std::nano>(t1 - t0).count() / __Step.size());
+}
+
+/************************************************************************************************************************
+ * @brief   输出最大偏差（相对输出限幅）
+ ***********************************************************************************************************************/
+static float Difference(const std::vector<float> & __A, const std::vector<float> & __B, float __Scale)
+{
+    float difference = 0.0f;
+
+    for (uint32_t n = 0; n < __A.size(); n++)
+    {
+        difference = std::fmax(difference, std::fabs(__A[n] - __B[n]) / __Scale);
+    }
+
+    return (difference);
+}
+
+/************************************************************************************************************************
+ * @brief   单组测试：底盘参数（K_P 0.1, K_I 5, 积分限幅 10, 输出限幅 20, 20ms）下三种实现各跑一遍
+ * @note    控制器组、Class_PID_2DOF（N = 0、b = c = 1、K_T = 0）与 Class_PID 积分算式相同（先限幅后累加），始终校验
+ ***********************************************************************************************************************/
+static bool Bench(const char * __Name, const std::vector<Struct_Bench_Step> & __Step, float __K_D, float __I_Out_Max)
+{
+    const float k_p = 0.1f, k_i = 5.0f, out_max = 20.0f, d_t = 0.02f;
+    Class_PID_Bank<BENCH_WHEEL_NUMBER> bank;
+    Class_PID pid[BENCH_WHEEL_NUMBER];
+    Class_PID_2DOF pid_2dof[BENCH_WHEEL_NUMBER];
+    std::vector<float> out_bank(__Step.size() * BENCH_WHEEL_NUMBER);
+    std::vector<float> out_pid(__Step.size() * BENCH_WHEEL_NUMBER);
+    std::vector<float> out_2dof(__Step.size() * BENCH_WHEEL_NUMBER);
+    double cycle_bank, cycle_pid, cycle_2dof;
+
+    bank.Init(k_p, k_i, __K_D, 0.0f, __I_Out_Max, out_max, d_t);
+    for (uint32_t i = 0; i < BENCH_WHEEL_NUMBER; i++)
+    {
+        pid[i].Init(k_p, k_i, __K_D, 0.0f, __I_Out_Max, out_max, d_t);
+        pid_2dof[i].Init(k_p, k_i, __K_D, 0.0f, __I_Out_Max, out_max, d_t);
+    }
+
+    double ns_pid = Run_Separate(pid, __Step, out_pid, &cycle_pid);
+    double ns_2dof = Run_Separate(pid_2dof, __Step, out_2dof, &cycle_2dof);
+    double ns_bank = Run_Bank(bank, __Step, out_bank, &cycle_bank);
+
+    float difference_pid = Difference(out_bank, out_pid, out_max);
+    float difference_2dof = Difference(out_bank, out_2dof, out_max);
+
+    printf("%-10s 4x Class_PID %6.1f ns %6.0f cyc  4x Class_PID_2DOF %6.1f ns %6.0f cyc  "
+           "Class_PID_Bank<4> %6.1f ns %6.0f cyc  (%.2fx / %.2fx)  diff %.1e / %.1e\n",
+           __Name, ns_pid, cycle_pid, ns_2dof, cycle_2dof, ns_bank, cycle_bank, ns_pid / ns_bank, ns_2dof / ns_bank,
+           difference_pid, difference_2dof);
+
+    if (difference_pid > BENCH_TOLERANCE || difference_2dof > BENCH_TOLERANCE)
+    {
+        printf("%-10s ERROR bank output differs from separate PID by more than %g\n", __Name, BENCH_TOLERANCE);
+        return (false);
+    }
+
+    return (true);
+}
+
+/************************************************************************************************************************
+ * @brief   单组测试：策略特化前后（底盘参数，__Full 时另启用死区、变速积分、积分分离、微分先行）
+ * @note    Class_PID 须与对照组一致；Class_PID_T<> 无可选功能，仅在 !__Full 时参与
+ ***********************************************************************************************************************/
+static bool Bench_Policy(const char * __Name, const std::vector<Struct_Bench_Step> & __Step, bool __Full)
+{
+    const float k_p = 0.1f, k_i = 5.0f, k_d = 0.002f, i_out_max = 10.0f, out_max = 20.0f, d_t = 0.02f;
+    const float dead_zone = __Full ? 0.05f : 0.0f;
+    const float speed_a = __Full ? 2.0f : 0.0f, speed_b = __Full ? 8.0f : 0.0f;
+    const float separate = __Full ? 15.0f : 0.0f;
+    const Enum_PID_D_First d_first = __Full ? PID_D_First_ENABLE : PID_D_First_DISABLE;
+    Class_PID_Legacy legacy[BENCH_WHEEL_NUMBER];
+    Class_PID pid[BENCH_WHEEL_NUMBER];
+    Class_PID_T<> pid_plain[BENCH_WHEEL_NUMBER];
+    std::vector<float> out_legacy(__Step.size() * BENCH_WHEEL_NUMBER);
+    std::vector<float> out_pid(__Step.size() * BENCH_WHEEL_NUMBER);
+    std::vector<float> out_plain(__Step.size() * BENCH_WHEEL_NUMBER);
+    double cycle_legacy, cycle_pid, cycle_plain = 0.0, ns_plain = 0.0;
+    float difference_plain = 0.0f;
+
+    for (uint32_t i = 0; i < BENCH_WHEEL_NUMBER; i++)
+    {
+        legacy[i].Init(k_p, k_i, k_d, 0.0f, i_out_max, out_max, d_t, dead_zone, speed_a, speed_b, separate, d_first);
+        pid[i].Init(k_p, k_i, k_d, 0.0f, i_out_max, out_max, d_t, dead_zone, speed_a, speed_b, separate, d_first);
+        pid_plain[i].Init(k_p, k_i, k_d, 0.0f, i_out_max, out_max, d_t);
+    }
+
+    double ns_legacy = Run_Separate(legacy, __Step, out_legacy, &cycle_legacy);
+    double ns_pid = Run_Separate(pid, __Step, out_pid, &cycle_pid);
+    if (!__Full)
+    {
+        ns_plain = Run_Separate(pid_plain, __Step, out_plain, &cycle_plain);
+        difference_plain = Difference(out_legacy, out_plain, out_max);
+    }
+
+    float difference_pid = Difference(out_legacy, out_pid, out_max);
+
+    printf("%-10s 4x legacy %6.1f ns %6.0f cyc  4x Class_PID %6.1f ns %6.0f cyc (%.2fx)", __Name, ns_legacy,
+           cycle_legacy, ns_pid, cycle_pid, ns_legacy / ns_pid);
+    if (!__Full)
+    {
+        printf("  4x Class_PID_T<> %6.1f ns %6.0f cyc (%.2fx)", ns_plain, cycle_plain, ns_legacy / ns_plain);
+    }
+    printf("  diff %.1e / %.1e\n", difference_pid, difference_plain);
+
+    if (difference_pid > BENCH_TOLERANCE || difference_plain > BENCH_TOLERANCE)
+    {
+        printf("%-10s ERROR policy PID output differs from legacy PID by more than %g\n", __Name, BENCH_TOLERANCE);
+        return (false);
+    }
+
+    return (true);
+}
+
+/************************************************************************************************************************
+ * @brief   主函数
+ ***********************************************************************************************************************/
+int main()
+{
+    std::vector<Struct_Bench_Step> step(BENCH_STEP_NUMBER);
+    bool ok = true;
+
+    Trajectory(step);
+
+    ok &= Bench_Policy("policy", step, false);
+    ok &= Bench_Policy("policy all", step, true);
+    ok &= Bench("PI", step, 0.0f, 0.0f);
+    ok &= Bench("PID", step, 0.002f, 0.0f);
+    ok &= Bench("PI limit", step, 0.0f, 10.0f);
+
+    return (ok ? 0 : 1);
+}
@@ -0,0 +1,263 @@
+/**
+ * @file    Quaternion_Bench.cpp
+ * @brief   四元数运算库计算耗时测试（与固件共用 Quaternion.h、Quaternion.cpp 及 CMSIS-DSP 四元数函数）
+ *          同一组随机单位四元数、角速度、向量分别送入库函数与朴素标量实现（逐项展开 + libm），
+ *          统计每次调用耗时，并校验两者最大偏差
+ * @note    主机 glibc 的 sinf/cosf/atan2f 为向量化 FMA 实现，与 Cortex-M4 上的软件 libm 不可比，
+ *          目标板耗时以 DWT 周期计数为准
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "Quaternion.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/* 宏定义 --------------------------------------------------------------------------------------------------------------*/
+#define BENCH_INPUT_NUMBER      4096U       /* 输入组数（常驻 L1/L2） */
+#define BENCH_REPEAT            256U        /* 重复次数 */
+#define BENCH_TOLERANCE         1.0e-6f     /* 与朴素实现的最大偏差（单位四元数、单位向量、rad） */
+
+/* 结构体定义 ----------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   单组输入
+ */
+struct Struct_Bench_Input
+{
+    Class_Quaternion Q;         /* 单位四元数（俯仰角 |sin| < 0.999，避开欧拉角奇异点） */
+    Class_Quaternion P;         /* 单位四元数 */
+    Class_Quaternion Raw;       /* 未归一化四元数（P 的 0.5 ~ 2 倍） */
+    Class_Vector<3> Omega;      /* 角速度 (rad/s)，各轴 ±2000 dps（陀螺仪满量程） */
+    Class_Vector<3> V;          /* 单位向量 */
+};
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/************************************************************************************************************************
+ * @brief   时间戳计数器
+ ***********************************************************************************************************************/
+static inline uint64_t Cycle()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return (__rdtsc());
+#else
+    return (0U);
+#endif
+}
+
+/************************************************************************************************************************
+ * @brief   朴素 Hamilton 乘积
+ ***********************************************************************************************************************/
+static Class_Quaternion Naive_Product(const Class_Quaternion & __A, const Class_Quaternion & __B)
+{
+    return (Class_Quaternion{{__A[0] * __B[0] - __A[1] * __B[1] - __A[2] * __B[2] - __A[3] * __B[3],
+                              __A[0] * __B[1] + __A[1] * __B[0] + __A[2] * __B[3] - __A[3] * __B[2],
+                              __A[0] * __B[2] - __A[1] * __B[3] + __A[2] * __B[0] + __A[3] * __B[1],
+                              __A[0] * __B[3] + __A[1] * __B[2] - __A[2] * __B[1] + __A[3] * __B[0]}});
+}
+
+/************************************************************************************************************************
+ * @brief   朴素欧拉角（ZYX，atan2f / asinf）
+ ***********************************************************************************************************************/
+static void Naive_Euler(const Class_Quaternion & __Q, float * __Roll, float * __Pitch, float * __Yaw)
+{
+    float w = __Q[0], x = __Q[1], y = __Q[2], z = __Q[3];
+
+    *__Roll = atan2f(2.0f * (w * x + y * z), 1.0f - 2.0f * (x * x + y * y));
+    *__Pitch = asinf(std::fmin(std::fmax(2.0f * (w * y - z * x), -1.0f), 1.0f));
+    *__Yaw = atan2f(2.0f * (w * z + x * y), 1.0f - 2.0f * (y * y + z * z));
+}
+
+/************************************************************************************************************************
+ * @brief   朴素指数映射积分（sqrtf / sinf / cosf，无小角度分支）
+ ***********************************************************************************************************************/
+static Class_Quaternion Naive_Integrate(const Class_Quaternion & __Q, const Class_Vector<3> & __Omega, float __D_T)
+{
+    float h[3] = {0.5f * __D_T * __Omega[0], 0.5f * __D_T * __Omega[1], 0.5f * __D_T * __Omega[2]};
+    float angle = sqrtf(h[0] * h[0] + h[1] * h[1] + h[2] * h[2]);
+    float sinc = (angle > 0.0f) ? sinf(angle) / angle : 1.0f;
+
+    return (Naive_Product(__Q, Class_Quaternion{{cosf(angle), sinc * h[0], sinc * h[1], sinc * h[2]}}));
+}
+
+/************************************************************************************************************************
+ * @brief   朴素旋转：q ⊗ (0, v) ⊗ q*
+ ***********************************************************************************************************************/
+static Class_Vector<3> Naive_Rotate(const Class_Quaternion & __Q, const Class_Vector<3> & __V)
+{
+    Class_Quaternion out = Naive_Product(Naive_Product(__Q, Class_Quaternion{{0.0f, __V[0], __V[1], __V[2]}}),
+                                         Math_Quaternion_Conjugate(__Q));
+
+    return (Class_Vector<3>{{out[1], out[2], out[3]}});
+}
+
+/************************************************************************************************************************
+ * @brief   计时执行 __Function(n)，n 遍历全部输入 BENCH_REPEAT 次
+ *
+ * @return  double  每次调用耗时 (ns)，__Cycle 返回每次时钟周期数
+ ***********************************************************************************************************************/
+template<typename Function>
+static double Run(Function __Function, double * __Cycle)
+{
+    auto t0 = std::chrono::steady_clock::now();
+    uint64_t c0 = Cycle();
+    for (uint32_t r = 0; r < BENCH_REPEAT; r++)
+    {
+        for (uint32_t n = 0; n < BENCH_INPUT_NUMBER; n++)
+        {
+            __Function(n);
+        }
+        /* 内存屏障：阻止编译器把重复的相同写入合并为一次（否则内联的朴素实现被提出循环） */
+        __asm__ volatile("" ::: "memory");
+    }
+    uint64_t c1 = Cycle();
+    auto t1 = std::chrono::steady_clock::now();
+
+    *__Cycle = (double) (c1 - c0) / (BENCH_REPEAT * BENCH_INPUT_NUMBER);
+    return (std::chrono::duration<double, std::nano>(t1 - t0).count() / (BENCH_REPEAT * BENCH_INPUT_NUMBER));
+}
+
+/************************************************************************************************************************
+ * @brief   两组浮点数组最大偏差
+ ***********************************************************************************************************************/
+static float Difference(const float * __A, const float * __B, uint32_t __N)
+{
+    float difference = 0.0f;
+
+    for (uint32_t i = 0; i < __N; i++)
+    {
+        difference = std::fmax(difference, std::fabs(__A[i] - __B[i]));
+    }
+
+    return (difference);
+}
+
+/************************************************************************************************************************
+ * @brief   对比两种实现并输出一行结果
+ *
+ * @param   __Output_Library    库函数输出首地址（__Function_Library 写入）
+ * @param   __Output_Naive      朴素实现输出首地址（__Function_Naive 写入）
+ * @param   __Output_Number     输出浮点数个数
+ ***********************************************************************************************************************/
+template<typename Function_Library, typename Function_Naive>
+static bool Bench(const char * __Name, Function_Library __Function_Library, Function_Naive __Function_Naive,
+                  const float * __Output_Library, const float * __Output_Naive, uint32_t __Output_Number)
+{
+    double cycle_library, cycle_naive;
+    double ns_naive = Run(__Function_Naive, &cycle_naive);
+    double ns_library = Run(__Function_Library, &cycle_library);
+    float difference = Difference(__Output_Library, __Output_Naive, __Output_Number);
+    bool ok = (difference <= BENCH_TOLERANCE);
+
+    printf("%-12s naive %6.2f ns %6.1f cyc  library %6.2f ns %6.1f cyc  (%.2fx)  diff %.1e  %s\n", __Name, ns_naive,
+           cycle_naive, ns_library, cycle_library, ns_naive / ns_library, difference, ok ? "ok" : "FAIL");
+
+    return (ok);
+}
+
+/************************************************************************************************************************
+ * @brief   随机单位四元数
+ ***********************************************************************************************************************/
+static Class_Quaternion Random_Unit(std::mt19937 & __Random)
+{
+    std::normal_distribution<float> normal(0.0f, 1.0f);
+    Class_Quaternion q = {{normal(__Random), normal(__Random), normal(__Random), normal(__Random)}};
+
+    return (Math_Quaternion_Normalize(q));
+}
+
+/************************************************************************************************************************
+ * @brief   主函数
+ ***********************************************************************************************************************/
+int main()
+{
+    const float d_t = 0.001f;
+    std::mt19937 random(16U);
+    std::uniform_real_distribution<float> omega(-34.9f, 34.9f);
+    std::uniform_real_distribution<float> scale_distribution(0.5f, 2.0f);
+    std::vector<Struct_Bench_Input> input(BENCH_INPUT_NUMBER);
+    std::vector<Class_Quaternion> out_library(BENCH_INPUT_NUMBER), out_naive(BENCH_INPUT_NUMBER);
+    std::vector<Class_Rotation> rotation_library(BENCH_INPUT_NUMBER), rotation_naive(BENCH_INPUT_NUMBER);
+    std::vector<Class_Vector<3>> euler_library(BENCH_INPUT_NUMBER), euler_naive(BENCH_INPUT_NUMBER);
+    bool ok = true;
+
+    for (Struct_Bench_Input & item : input)
+    {
+        do
+        {
+            item.Q = Random_Unit(random);
+        } while (std::fabs(2.0f * (item.Q[0] * item.Q[2] - item.Q[3] * item.Q[1])) >= 0.999f);
+        item.P = Random_Unit(random);
+        float scale = scale_distribution(random);
+        item.Raw = Class_Quaternion{{item.P[0] * scale, item.P[1] * scale, item.P[2] * scale, item.P[3] * scale}};
+        item.Omega = Class_Vector<3>{{omega(random), omega(random), omega(random)}};
+        Class_Quaternion v = Random_Unit(random);
+        item.V = Class_Vector<3>{{v[1], v[2], v[3]}} * (1.0f / std::sqrt(1.0f - v[0] * v[0]));
+    }
+
+    const float * library = out_library[0].Data;
+    const float * naive = out_naive[0].Data;
+    const uint32_t number = 4U * BENCH_INPUT_NUMBER;
+
+    ok &= Bench("product",
+                [&](uint32_t n) { out_library[n] = input[n].Q * input[n].P; },
+                [&](uint32_t n) { out_naive[n] = Naive_Product(input[n].Q, input[n].P); },
+                library, naive, number);
+
+    ok &= Bench("normalize",
+                [&](uint32_t n) { out_library[n] = Math_Quaternion_Normalize(input[n].Raw); },
+                [&](uint32_t n) {
+                    const Class_Quaternion & q = input[n].Raw;
+                    float inverse = 1.0f / sqrtf(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+                    out_naive[n] = Class_Quaternion{{q[0] * inverse, q[1] * inverse, q[2] * inverse, q[3] * inverse}};
+                },
+                library, naive, number);
+
+    ok &= Bench("to rotation",
+                [&](uint32_t n) { rotation_library[n] = Math_Quaternion_To_Rotation(input[n].Q); },
+                [&](uint32_t n) {
+                    float w = input[n].Q[0], x = input[n].Q[1], y = input[n].Q[2], z = input[n].Q[3];
+                    rotation_naive[n].Matrix = {{{1.0f - 2.0f * (y * y + z * z), 2.0f * (x * y - w * z),
+                                                  2.0f * (x * z + w * y)},
+                                                 {2.0f * (x * y + w * z), 1.0f - 2.0f * (x * x + z * z),
+                                                  2.0f * (y * z - w * x)},
+                                                 {2.0f * (x * z - w * y), 2.0f * (y * z + w * x),
+                                                  1.0f - 2.0f * (x * x + y * y)}}};
+                },
+                &rotation_library[0].Matrix.Data[0][0], &rotation_naive[0].Matrix.Data[0][0], 9U * BENCH_INPUT_NUMBER);
+
+    ok &= Bench("euler",
+                [&](uint32_t n) {
+                    Math_Quaternion_To_Euler(input[n].Q, &euler_library[n][0], &euler_library[n][1],
+                                             &euler_library[n][2]);
+                },
+                [&](uint32_t n) { Naive_Euler(input[n].Q, &euler_naive[n][0], &euler_naive[n][1], &euler_naive[n][2]); },
+                &euler_library[0][0], &euler_naive[0][0], 3U * BENCH_INPUT_NUMBER);
+
+    ok &= Bench("integrate",
+                [&](uint32_t n) { out_library[n] = Math_Quaternion_Integrate(input[n].Q, input[n].Omega, d_t); },
+                [&](uint32_t n) { out_naive[n] = Naive_Integrate(input[n].Q, input[n].Omega, d_t); },
+                library, naive, number);
+
+    /* 角速度放大 8 倍：半角超过 QUATERNION_SMALL_ANGLE，走 Math_Fast_Sin_Cos 分支 */
+    ok &= Bench("integrate x8",
+                [&](uint32_t n) { out_library[n] = Math_Quaternion_Integrate(input[n].Q, input[n].Omega, 8.0f * d_t); },
+                [&](uint32_t n) { out_naive[n] = Naive_Integrate(input[n].Q, input[n].Omega, 8.0f * d_t); },
+                library, naive, number);
+
+    ok &= Bench("rotate",
+                [&](uint32_t n) { euler_library[n] = Math_Quaternion_Rotate(input[n].Q, input[n].V); },
+                [&](uint32_t n) { euler_naive[n] = Naive_Rotate(input[n].Q, input[n].V); },
+                &euler_library[0][0], &euler_naive[0][0], 3U * BENCH_INPUT_NUMBER);
+
+    return (ok ? 0 : 1);
+}
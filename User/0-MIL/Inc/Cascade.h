@@ -0,0 +1,191 @@
+/**
+ * @file    Cascade.h
+ * @brief   多速率串级控制器
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.1
+ */
+
+#ifndef __MIL_CASCADE_H
+#define __MIL_CASCADE_H
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "User_Math.h"
+
+/* 类定义 --------------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   多速率串级控制器类
+ *          外环每 Outer_Divider 次内环计算执行一次，其间保持外环输出（内环目标值）不变；
+ *          内环输出饱和且外环误差方向会加深饱和时，外环本次计算保持积分（条件积分，在外环输出前决定），
+ *          防止外环积分饱和
+ *          外环控制器的控制周期需按 内环周期 * Outer_Divider 初始化
+ *
+ * @tparam  Outer   外环控制器类型（需提供 Set_Target/Set_Actual/Calculate/Get_Out/Set_Integral_Hold/Set_Integral_Error）
+ * @tparam  Inner   内环控制器类型（需额外提供 Get_Out_Max）
+ */
+template<typename Outer, typename Inner>
+class Class_Cascade
+{
+public:
+    /* 函数 */
+    void Init(Outer * __PID_Outer, Inner * __PID_Inner, uint16_t __Outer_Divider = 1U);
+    void Calculate();
+    void Reset();
+
+    inline float Get_Out();
+    inline float Get_Inner_Target();
+    inline void Set_Target(float __Target);
+    inline void Set_Actual_Outer(float __Actual_Outer);
+    inline void Set_Actual_Inner(float __Actual_Inner);
+protected:
+    /* 常量 */
+    Outer * PID_Outer = nullptr;            /*!< 绑定的外环控制器 */
+    Inner * PID_Inner = nullptr;            /*!< 绑定的内环控制器 */
+    uint16_t Outer_Divider = 1U;            /*!< 外环分频系数 */
+
+    /* 写变量 */
+    float Target = 0.0f;                    /*!< 外环目标值 */
+    float Actual_Outer = 0.0f;              /*!< 外环实际值 */
+    float Actual_Inner = 0.0f;              /*!< 内环实际值 */
+
+    /* 读变量 */
+    float Inner_Target = 0.0f;              /*!< 内环目标值（外环输出，两次外环计算之间保持） */
+
+    /* 内部变量 */
+    uint16_t Outer_Counter = 0U;            /*!< 外环分频计数器 */
+    int8_t Inner_Saturation = 0;            /*!< 内环饱和方向 (1 正饱和, -1 负饱和, 0 未饱和) */
+};
+
+/* 接口函数定义 --------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   串级控制器初始化
+ *
+ * @param   __PID_Outer     外环控制器指针
+ * @param   __PID_Inner     内环控制器指针
+ * @param   __Outer_Divider 外环分频系数（外环执行频率 = 内环执行频率 / __Outer_Divider）
+ */
+template<typename Outer, typename Inner>
+void Class_Cascade<Outer, Inner>::Init(Outer * __PID_Outer, Inner * __PID_Inner, uint16_t __Outer_Divider)
+{
+    this->PID_Outer = __PID_Outer;
+    this->PID_Inner = __PID_Inner;
+    this->Outer_Divider = (__Outer_Divider == 0U) ? 1U : __Outer_Divider;
+    this->Reset();
+}
+
+/**
+ * @brief   串级控制器计算（按内环频率调用）
+ */
+template<typename Outer, typename Inner>
+void Class_Cascade<Outer, Inner>::Calculate()
+{
+    /* 外环（分频执行） */
+    if (this->Outer_Counter == 0U)
+    {
+        float error = this->Target - this->Actual_Outer;
+
+        /* 内环饱和反馈：外环误差将加深内环饱和时不积分（计算前决定，外环输出与积分一致） */
+        this->PID_Outer->Set_Integral_Hold((this->Inner_Saturation > 0 && error > 0.0f) ||
+                                           (this->Inner_Saturation < 0 && error < 0.0f));
+
+        this->PID_Outer->Set_Target(this->Target);
+        this->PID_Outer->Set_Actual(this->Actual_Outer);
+        this->PID_Outer->Calculate();
+
+        this->Inner_Target = this->PID_Outer->Get_Out();
+    }
+    this->Outer_Counter = (this->Outer_Counter + 1U < this->Outer_Divider) ? (this->Outer_Counter + 1U) : 0U;
+
+    /* 内环 */
+    this->PID_Inner->Set_Target(this->Inner_Target);
+    this->PID_Inner->Set_Actual(this->Actual_Inner);
+    this->PID_Inner->Calculate();
+
+    /* 内环饱和判断 */
+    float out = this->PID_Inner->Get_Out();
+    float out_max = this->PID_Inner->Get_Out_Max();
+    if (out_max != 0.0f && out >= out_max)
+    {
+        this->Inner_Saturation = 1;
+    }
+    else if (out_max != 0.0f && out <= -out_max)
+    {
+        this->Inner_Saturation = -1;
+    }
+    else
+    {
+        this->Inner_Saturation = 0;
+    }
+}
+
+/**
+ * @brief   串级控制器复位（内外环积分清零，下次计算立即执行外环）
+ */
+template<typename Outer, typename Inner>
+void Class_Cascade<Outer, Inner>::Reset()
+{
+    this->PID_Outer->Set_Integral_Hold(false);
+    this->PID_Outer->Set_Integral_Error(0.0f);
+    this->PID_Inner->Set_Integral_Error(0.0f);
+    this->Inner_Target = 0.0f;
+    this->Outer_Counter = 0U;
+    this->Inner_Saturation = 0;
+}
+
+/**
+ * @brief   获取输出值（内环输出）
+ *
+ * @return  float   输出值
+ */
+template<typename Outer, typename Inner>
+float Class_Cascade<Outer, Inner>::Get_Out()
+{
+    return (this->PID_Inner->Get_Out());
+}
+
+/**
+ * @brief   获取内环目标值（外环输出）
+ *
+ * @return  float   内环目标值
+ */
+template<typename Outer, typename Inner>
+float Class_Cascade<Outer, Inner>::Get_Inner_Target()
+{
+    return (this->Inner_Target);
+}
+
+/**
+ * @brief   设定外环目标值
+ *
+ * @param   __Target    外环目标值
+ */
+template<typename Outer, typename Inner>
+void Class_Cascade<Outer, Inner>::Set_Target(float __Target)
+{
+    this->Target = __Target;
+}
+
+/**
+ * @brief   设定外环实际值
+ *
+ * @param   __Actual_Outer  外环实际值
+ */
+template<typename Outer, typename Inner>
+void Class_Cascade<Outer, Inner>::Set_Actual_Outer(float __Actual_Outer)
+{
+    this->Actual_Outer = __Actual_Outer;
+}
+
+/**
+ * @brief   设定内环实际值
+ *
+ * @param   __Actual_Inner  内环实际值
+ */
+template<typename Outer, typename Inner>
+void Class_Cascade<Outer, Inner>::Set_Actual_Inner(float __Actual_Inner)
+{
+    this->Actual_Inner = __Actual_Inner;
+}
+
+#endif /* MIL_Cascade.h */
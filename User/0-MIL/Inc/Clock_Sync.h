@@ -0,0 +1,152 @@
+/**
+ * @file    Clock_Sync.h
+ * @brief   双端时钟同步（NTP式四时间戳交换，最小时延滤波 + 线性拟合估计偏移与漂移）
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+#ifndef __MIL_CLOCK_SYNC_H
+#define __MIL_CLOCK_SYNC_H
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "stdint.h"
+
+/* 宏定义 --------------------------------------------------------------------------------------------------------------*/
+#define CLOCK_SYNC_FILTER       8U      /* 最小时延滤波窗口（交换次数，每窗口取往返时延最小的一次作为拟合点） */
+#define CLOCK_SYNC_HISTORY      8U      /* 拟合点数（最小二乘拟合偏移与漂移） */
+#define CLOCK_SYNC_DELAY_MAX    50000U  /* 往返时延上限 (us)，超出的交换直接丢弃 */
+#define CLOCK_SYNC_STEP_MAX     5000U   /* 拟合点与预测值的偏差上限 (us)，超出视为对端时钟跳变（复位），清空拟合点重新同步 */
+#define CLOCK_SYNC_GAP_MAX      60000000U   /* 拟合点间隔上限 (us)，交换中断更久时清空拟合点重新同步 */
+
+/* 类定义 --------------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   时钟同步类
+ *          两端各有一个自由计数的32位微秒时钟（回绕，时刻之差均按 int32_t 计算），一次交换由请求方（client）发起：
+ *          T1 请求方发送时刻、T2 应答方接收时刻、T3 应答方发送时刻、T4 请求方接收时刻，
+ *          往返时延 = (T4 - T1) - (T3 - T2)，两端时钟在各自收发中点处对齐（假设上下行时延对称）；
+ *          双方拿到同一组四个时间戳后各自调用 Update（请求方 __Client 为 true），得到互为反函数的映射，
+ *          因此同一个类既用于上位机（映射下位机帧时间戳），也用于下位机（向固件模块提供上位机时基）；
+ *          每 CLOCK_SYNC_FILTER 次交换取往返时延最小的一次（排队、调度延迟只会使时延变大，最小者对称性最好），
+ *          对最近 CLOCK_SYNC_HISTORY 个拟合点做最小二乘，截距为最新拟合点处的偏移，斜率为漂移（晶振频差），
+ *          两次拟合之间按漂移外推；首次交换即给出偏移（漂移为0），首个窗口内该拟合点随时延更小的交换替换，
+ *          避免启动时单次排队的交换在 CLOCK_SYNC_HISTORY 个窗口内持续拉偏拟合；积累两个拟合点后开始估计漂移
+ */
+class Class_Clock_Sync
+{
+public:
+    /* 函数 */
+    void Reset();
+    bool Update(uint32_t __T1, uint32_t __T2, uint32_t __T3, uint32_t __T4, bool __Client);
+
+    inline bool Get_Valid();
+    inline uint32_t To_Remote(uint32_t __Local);
+    inline uint32_t To_Local(uint32_t __Remote);
+    inline float Get_Drift();
+    inline uint32_t Get_Delay();
+    inline uint32_t Get_Exchange_Number();
+    inline uint32_t Get_Step_Number();
+protected:
+    /* 函数 */
+    void Fit();
+
+    /* 读写变量 */
+    bool Valid = false;                         /*!< 已同步 */
+    float Drift = 0.0f;                         /*!< 漂移（对端时钟相对本端的频差，us/us） */
+    uint32_t Delay = 0U;                        /*!< 最新拟合点的往返时延 (us) */
+    uint32_t Exchange_Number = 0U;              /*!< 有效交换次数 */
+    uint32_t Step_Number = 0U;                  /*!< 时钟跳变复位次数 */
+
+    /* 内部变量 */
+    uint32_t Anchor_Local = 0U;                 /*!< 映射基准点：本端时刻 (us) */
+    uint32_t Anchor_Offset = 0U;                /*!< 映射基准点：偏移（对端 - 本端，按32位回绕） */
+    uint32_t History_Local[CLOCK_SYNC_HISTORY]; /*!< 拟合点：本端中点时刻 */
+    uint32_t History_Offset[CLOCK_SYNC_HISTORY];    /*!< 拟合点：偏移 */
+    uint8_t History_Number = 0U;                /*!< 拟合点数 */
+    uint8_t History_Index = 0U;                 /*!< 下一个拟合点写入位置 */
+    uint8_t Filter_Number = 0U;                 /*!< 当前滤波窗口内的交换次数 */
+    bool Provisional = false;                   /*!< 最新拟合点为暂定值（首个滤波窗口结束前随更优的交换替换） */
+    uint32_t Best_Local = 0U;                   /*!< 当前滤波窗口内时延最小的交换：本端中点时刻 */
+    uint32_t Best_Offset = 0U;                  /*!< 当前滤波窗口内时延最小的交换：偏移 */
+    uint32_t Best_Delay = 0U;                   /*!< 当前滤波窗口内时延最小的交换：往返时延 */
+};
+
+/* 接口函数定义 --------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   获取是否已同步
+ *
+ * @return  bool    是否已同步（未同步时映射函数原样返回）
+ */
+bool Class_Clock_Sync::Get_Valid()
+{
+    return (this->Valid);
+}
+
+/**
+ * @brief   本端时刻映射为对端时刻
+ *
+ * @param   __Local     本端时刻 (us)
+ * @return  uint32_t    对端时刻 (us)
+ */
+uint32_t Class_Clock_Sync::To_Remote(uint32_t __Local)
+{
+    float drift = this->Drift * (float) (int32_t) (__Local - this->Anchor_Local);
+
+    return (__Local + this->Anchor_Offset + (uint32_t) (int32_t) ((drift >= 0.0f) ? (drift + 0.5f) : (drift - 0.5f)));
+}
+
+/**
+ * @brief   对端时刻映射为本端时刻（To_Remote 的反函数，漂移项以一次迭代近似）
+ *
+ * @param   __Remote    对端时刻 (us)
+ * @return  uint32_t    本端时刻 (us)
+ */
+uint32_t Class_Clock_Sync::To_Local(uint32_t __Remote)
+{
+    uint32_t local = __Remote - this->Anchor_Offset;
+
+    return (local - (this->To_Remote(local) - __Remote));
+}
+
+/**
+ * @brief   获取漂移
+ *
+ * @return  float   对端时钟相对本端的频差 (us/us，乘以1e6为ppm)
+ */
+float Class_Clock_Sync::Get_Drift()
+{
+    return (this->Drift);
+}
+
+/**
+ * @brief   获取最新拟合点的往返时延
+ *
+ * @return  uint32_t    时延 (us)
+ */
+uint32_t Class_Clock_Sync::Get_Delay()
+{
+    return (this->Delay);
+}
+
+/**
+ * @brief   获取有效交换次数
+ *
+ * @return  uint32_t    次数
+ */
+uint32_t Class_Clock_Sync::Get_Exchange_Number()
+{
+    return (this->Exchange_Number);
+}
+
+/**
+ * @brief   获取时钟跳变复位次数
+ *
+ * @return  uint32_t    次数
+ */
+uint32_t Class_Clock_Sync::Get_Step_Number()
+{
+    return (this->Step_Number);
+}
+
+#endif /* MIL_Clock_Sync.h */
@@ -0,0 +1,26 @@
+/**
+ * @file    Cobs.h
+ * @brief   COBS (Consistent Overhead Byte Stuffing) 编解码
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.1
+ */
+
+#ifndef __MIL_COBS_H
+#define __MIL_COBS_H
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "stdint.h"
+#include "string.h"
+
+/* 宏定义 --------------------------------------------------------------------------------------------------------------*/
+#define COBS_DELIMITER              0x00U                           /* 帧结束符 */
+#define COBS_MAX_ENCODED(Length)    ((Length) + (Length) / 254U + 1U)   /* 编码后最大长度（不含结束符） */
+#define COBS_BYTEWISE_LENGTH        128U                            /* 不超过该长度时逐字节编码（覆盖 FRAME_MAX_LENGTH） */
+
+/* 函数声明 ------------------------------------------------------------------------------------------------------------*/
+uint32_t COBS_Encode(const uint8_t * __Source, uint32_t __Length, uint8_t * __Destination);
+uint32_t COBS_Decode(const uint8_t * __Source, uint32_t __Length, uint8_t * __Destination);
+
+#endif /* MIL_Cobs.h */
@@ -4,7 +4,7 @@
  *
  * @author  Tang-yucheng (QQ: 3143961287)
  * @date    2024-2-16
- * @version v1.0
+ * @version v1.1
  */
 
 #ifndef __MIL_CRC_H
@@ -13,7 +13,247 @@
 /* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
 #include "User_Math.h"
 
+/* 编译期工具 ----------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   下标序列
+ */
+template<uint32_t... I>
+struct CRC_Index
+{
+};
+
+/**
+ * @brief   拼接下标序列（后半段整体偏移前半段长度）
+ */
+template<typename A, typename B>
+struct CRC_Index_Concat;
+
+template<uint32_t... I, uint32_t... J>
+struct CRC_Index_Concat<CRC_Index<I...>, CRC_Index<J...>>
+{
+    typedef CRC_Index<I..., (sizeof...(I) + J)...> Type;
+};
+
+/**
+ * @brief   生成下标序列 0, 1, ..., N - 1（二分递归，实例化深度 log2(N)）
+ */
+template<uint32_t N>
+struct CRC_Make_Index
+{
+    typedef typename CRC_Index_Concat<typename CRC_Make_Index<N / 2U>::Type,
+                                      typename CRC_Make_Index<N - N / 2U>::Type>::Type Type;
+};
+
+template<>
+struct CRC_Make_Index<0U>
+{
+    typedef CRC_Index<> Type;
+};
+
+template<>
+struct CRC_Make_Index<1U>
+{
+    typedef CRC_Index<0U> Type;
+};
+
+/**
+ * @brief   低 __Width 位按位反转
+ */
+constexpr uint32_t CRC_Reflect(uint32_t __X, uint32_t __Width)
+{
+    return ((__Width == 0U) ? 0U : (((__X & 1U) << (__Width - 1U)) | CRC_Reflect(__X >> 1, __Width - 1U)));
+}
+
+/**
+ * @brief   __Width 位掩码
+ */
+constexpr uint32_t CRC_Mask(uint32_t __Width)
+{
+    return ((__Width >= 32U) ? 0xFFFFFFFFU : ((1U << __Width) - 1U));
+}
+
+/**
+ * @brief   反射（低位在前）寄存器移入 __Bits 个零位
+ */
+constexpr uint32_t CRC_Shift_Reflect(uint32_t __Register, uint32_t __Polynomial_Reflect, uint32_t __Bits)
+{
+    return ((__Bits == 0U) ? __Register :
+            CRC_Shift_Reflect((__Register & 1U) ? ((__Register >> 1) ^ __Polynomial_Reflect) : (__Register >> 1),
+                              __Polynomial_Reflect, __Bits - 1U));
+}
+
+/**
+ * @brief   正序（高位在前）寄存器移入 __Bits 个零位
+ */
+constexpr uint32_t CRC_Shift_Normal(uint32_t __Register, uint32_t __Polynomial, uint32_t __Width, uint32_t __Bits)
+{
+    return ((__Bits == 0U) ? __Register :
+            CRC_Shift_Normal(((__Register & (1U << (__Width - 1U))) ? ((__Register << 1) ^ __Polynomial) : (__Register << 1)) &
+                             CRC_Mask(__Width), __Polynomial, __Width, __Bits - 1U));
+}
+
+/**
+ * @brief   查表项：寄存器为0时输入字节 __Index 再输入 __Slice 个零字节后的寄存器值（slicing-by-4 第 __Slice 张表）
+ */
+constexpr uint32_t CRC_Table_Entry(uint32_t __Width, uint32_t __Polynomial, bool __Reflect, uint32_t __Slice, uint32_t __Index)
+{
+    return (__Reflect ? CRC_Shift_Reflect(__Index, CRC_Reflect(__Polynomial, __Width), 8U * (__Slice + 1U)) :
+            CRC_Shift_Normal(__Index << (__Width - 8U), __Polynomial, __Width, 8U * (__Slice + 1U)));
+}
+
+/**
+ * @brief   CRC查表（4 × 256 项，编译期生成并存放于Flash）
+ */
+template<typename Type, Type Polynomial, bool Reflect, typename Index = typename CRC_Make_Index<256U>::Type>
+struct Struct_CRC_Table;
+
+template<typename Type, Type Polynomial, bool Reflect, uint32_t... I>
+struct Struct_CRC_Table<Type, Polynomial, Reflect, CRC_Index<I...>>
+{
+    static constexpr Type Table[4][256] =
+    {
+        {(Type) CRC_Table_Entry(8U * sizeof(Type), Polynomial, Reflect, 0U, I)...},
+        {(Type) CRC_Table_Entry(8U * sizeof(Type), Polynomial, Reflect, 1U, I)...},
+        {(Type) CRC_Table_Entry(8U * sizeof(Type), Polynomial, Reflect, 2U, I)...},
+        {(Type) CRC_Table_Entry(8U * sizeof(Type), Polynomial, Reflect, 3U, I)...},
+    };
+};
+
+template<typename Type, Type Polynomial, bool Reflect, uint32_t... I>
+constexpr Type Struct_CRC_Table<Type, Polynomial, Reflect, CRC_Index<I...>>::Table[4][256];
+
+/* 类定义 --------------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   CRC计算类（参数模型同 Rocksoft：多项式为正序表示，输入输出同为反射或同为正序）
+ *          每次处理 4 字节（slicing-by-4），不足 4 字节按字节查表；
+ *          Begin/Update/Finish 为增量接口，数据可分段（如DMA分块到达时）输入，结果与整帧一次计算相同
+ *
+ * @tparam  Type        寄存器类型（uint8_t/uint16_t/uint32_t，对应 CRC8/CRC16/CRC32）
+ * @tparam  Polynomial  生成多项式（正序）
+ * @tparam  Init        寄存器初值
+ * @tparam  Reflect     是否反射（低位在前）
+ * @tparam  Xor_Out     结果异或值
+ */
+template<typename Type, Type Polynomial, Type Init, bool Reflect, Type Xor_Out>
+class Class_CRC
+{
+public:
+    /* 函数 */
+    inline void Begin();
+    inline void Update(const uint8_t * __Buffer, uint32_t __Length);
+    inline Type Finish();
+
+    static inline Type Calculate(const uint8_t * __Buffer, uint32_t __Length);
+    static Type Continue(Type __Register, const uint8_t * __Buffer, uint32_t __Length);
+protected:
+    /* 内部变量 */
+    Type Register = Init;                   /*!< CRC寄存器 */
+};
+
+/* 常用CRC类型 */
+typedef Class_CRC<uint8_t, 0x31U, 0x00U, true, 0x00U> Class_CRC8_MAXIM;                         /*!< CRC-8/MAXIM */
+typedef Class_CRC<uint16_t, 0x1021U, 0xFFFFU, true, 0x0000U> Class_CRC16_MCRF4XX;               /*!< CRC-16/MCRF4XX（DJI裁判系统） */
+typedef Class_CRC<uint16_t, 0x1021U, 0xFFFFU, false, 0x0000U> Class_CRC16_CCITT_FALSE;          /*!< CRC-16/CCITT-FALSE */
+typedef Class_CRC<uint32_t, 0x04C11DB7U, 0xFFFFFFFFU, true, 0xFFFFFFFFU> Class_CRC32;           /*!< CRC-32（zlib） */
+typedef Class_CRC<uint32_t, 0x04C11DB7U, 0xFFFFFFFFU, false, 0x00000000U> Class_CRC32_MPEG2;    /*!< CRC-32/MPEG-2（STM32硬件CRC） */
+
 /* 函数声明 ------------------------------------------------------------------------------------------------------------*/
 uint8_t Calculate_CRC8(uint8_t * Buffer, uint32_t Buffer_Len);
 
+/* 接口函数定义 --------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   开始一次增量计算（寄存器置初值）
+ */
+template<typename Type, Type Polynomial, Type Init, bool Reflect, Type Xor_Out>
+void Class_CRC<Type, Polynomial, Init, Reflect, Xor_Out>::Begin()
+{
+    this->Register = Init;
+}
+
+/**
+ * @brief   输入一段数据
+ *
+ * @param   __Buffer    数据地址（可非对齐）
+ * @param   __Length    字节数
+ */
+template<typename Type, Type Polynomial, Type Init, bool Reflect, Type Xor_Out>
+void Class_CRC<Type, Polynomial, Init, Reflect, Xor_Out>::Update(const uint8_t * __Buffer, uint32_t __Length)
+{
+    this->Register = Continue(this->Register, __Buffer, __Length);
+}
+
+/**
+ * @brief   获取结果（不改变寄存器，可继续 Update）
+ *
+ * @return  Type    CRC校验值
+ */
+template<typename Type, Type Polynomial, Type Init, bool Reflect, Type Xor_Out>
+Type Class_CRC<Type, Polynomial, Init, Reflect, Xor_Out>::Finish()
+{
+    return ((Type) (this->Register ^ Xor_Out));
+}
+
+/**
+ * @brief   整帧计算
+ *
+ * @param   __Buffer    数据地址（可非对齐）
+ * @param   __Length    字节数
+ * @return  Type        CRC校验值
+ */
+template<typename Type, Type Polynomial, Type Init, bool Reflect, Type Xor_Out>
+Type Class_CRC<Type, Polynomial, Init, Reflect, Xor_Out>::Calculate(const uint8_t * __Buffer, uint32_t __Length)
+{
+    return ((Type) (Continue(Init, __Buffer, __Length) ^ Xor_Out));
+}
+
+/**
+ * @brief   从给定寄存器值继续计算（不含结果异或）
+ *
+ * @param   __Register  寄存器值
+ * @param   __Buffer    数据地址（可非对齐）
+ * @param   __Length    字节数
+ * @return  Type        寄存器值
+ */
+template<typename Type, Type Polynomial, Type Init, bool Reflect, Type Xor_Out>
+Type Class_CRC<Type, Polynomial, Init, Reflect, Xor_Out>::Continue(Type __Register, const uint8_t * __Buffer,
+                                                                   uint32_t __Length)
+{
+    const uint32_t width = 8U * sizeof(Type);
+    const Type (&table)[4][256] = Struct_CRC_Table<Type, Polynomial, Reflect>::Table;
+    uint32_t crc = __Register;
+    uint32_t word;
+
+    if (Reflect)
+    {
+        /* 低位在前：寄存器与小端字对齐 */
+        for (; __Length >= 4U; __Length -= 4U, __Buffer += 4U)
+        {
+            memcpy(&word, __Buffer, 4U);
+            word ^= crc;
+            crc = table[3][word & 0xFFU] ^ table[2][(word >> 8) & 0xFFU] ^ table[1][(word >> 16) & 0xFFU] ^
+                  table[0][word >> 24];
+        }
+        for (; __Length > 0U; __Length--, __Buffer++)
+        {
+            crc = (crc >> 8) ^ table[0][(crc ^ *__Buffer) & 0xFFU];
+        }
+    }
+    else
+    {
+        /* 高位在前：寄存器与大端字高位对齐 */
+        for (; __Length >= 4U; __Length -= 4U, __Buffer += 4U)
+        {
+            word = Math_Load_BE<uint32_t>(__Buffer) ^ (crc << (32U - width));
+            crc = table[3][word >> 24] ^ table[2][(word >> 16) & 0xFFU] ^ table[1][(word >> 8) & 0xFFU] ^
+                  table[0][word & 0xFFU];
+        }
+        for (; __Length > 0U; __Length--, __Buffer++)
+        {
+            crc = ((crc << 8) & CRC_Mask(width)) ^ table[0][((crc >> (width - 8U)) ^ *__Buffer) & 0xFFU];
+        }
+    }
+
+    return ((Type) crc);
+}
+
 #endif  /* MIL_Crc.h */
@@ -0,0 +1,108 @@
+/**
+ * @file    Frame.h
+ * @brief   声明式帧布局编解码
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+#ifndef __MIL_FRAME_H
+#define __MIL_FRAME_H
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "User_Math.h"
+
+/* 结构体定义 ----------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   大端字段描述
+ *
+ * @tparam  Struct  解包目标结构体
+ * @tparam  Type    字段类型
+ * @tparam  Member  对应结构体成员
+ * @tparam  Offset  字段在帧内的字节偏移
+ */
+template<typename Struct, typename Type, Type Struct::*Member, uint32_t Offset>
+struct Struct_Frame_Field_BE
+{
+    static const uint32_t End = Offset + sizeof(Type);     /*!< 字段结束位置 */
+
+    static inline void Decode(const uint8_t * __Frame, Struct * __Data)
+    {
+        __Data->*Member = Math_Load_BE<Type>(&__Frame[Offset]);
+    }
+
+    static inline void Encode(const Struct * __Data, uint8_t * __Frame)
+    {
+        Math_Store_BE<Type>(&__Frame[Offset], __Data->*Member);
+    }
+};
+
+/**
+ * @brief   字段结束位置最大值（编译期检查字段不越过帧长）
+ */
+template<typename... Fields>
+struct Struct_Frame_End;
+
+template<>
+struct Struct_Frame_End<>
+{
+    static const uint32_t Value = 0U;
+};
+
+template<typename Field, typename... Fields>
+struct Struct_Frame_End<Field, Fields...>
+{
+    static const uint32_t Value = (Field::End > Struct_Frame_End<Fields...>::Value) ?
+                                  Field::End : Struct_Frame_End<Fields...>::Value;
+};
+
+/* 类定义 --------------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   帧布局类
+ *          以字段列表声明帧内各字段的类型、偏移与对应结构体成员，Decode/Encode 在编译期展开为逐字段的
+ *          单次加载 + 字节序反转（REV16/REV），一次遍历完成整帧解包/打包，无中间缓冲与函数调用
+ *
+ * @tparam  Struct  解包目标结构体
+ * @tparam  Length  帧长度（字节）
+ * @tparam  Fields  字段描述列表（Struct_Frame_Field_BE）
+ */
+template<typename Struct, uint32_t Length, typename... Fields>
+class Class_Frame_Layout
+{
+public:
+    static_assert(Struct_Frame_End<Fields...>::Value <= Length, "Class_Frame_Layout field exceeds frame length");
+
+    /* 函数 */
+    static inline void Decode(const uint8_t * __Frame, Struct * __Data);
+    static inline void Encode(const Struct * __Data, uint8_t * __Frame);
+};
+
+/* 接口函数定义 --------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   整帧解包
+ *
+ * @param   __Frame     帧数据（至少 Length 字节，可非对齐）
+ * @param   __Data      解包结果
+ */
+template<typename Struct, uint32_t Length, typename... Fields>
+void Class_Frame_Layout<Struct, Length, Fields...>::Decode(const uint8_t * __Frame, Struct * __Data)
+{
+    int expand[] = {0, (Fields::Decode(__Frame, __Data), 0)...};
+    (void) expand;
+}
+
+/**
+ * @brief   整帧打包（仅写入声明的字段，其余字节保持不变）
+ *
+ * @param   __Data      待打包数据
+ * @param   __Frame     帧数据（至少 Length 字节，可非对齐）
+ */
+template<typename Struct, uint32_t Length, typename... Fields>
+void Class_Frame_Layout<Struct, Length, Fields...>::Encode(const Struct * __Data, uint8_t * __Frame)
+{
+    int expand[] = {0, (Fields::Encode(__Data, __Frame), 0)...};
+    (void) expand;
+}
+
+#endif /* MIL_Frame.h */
@@ -0,0 +1,160 @@
+/**
+ * @file    Frame_Parser.h
+ * @brief   环形缓冲区流式帧解析
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.5
+ */
+
+#ifndef __MIL_FRAME_PARSER_H
+#define __MIL_FRAME_PARSER_H
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "Cobs.h"
+#include "Crc.h"
+
+/* 宏定义 --------------------------------------------------------------------------------------------------------------*/
+#define FRAME_MAX_LENGTH        128U    /* 最大帧长度 (byte) */
+#define FRAME_HEADER_LENGTH     6U      /* 帧头长度：包头 (4byte) + 包类型 (1byte) + 数据长度 (1byte) */
+#define FRAME_TIME_LENGTH       4U      /* 帧时间戳长度：发送方组帧时刻 (us, 小端) */
+#define FRAME_OVERHEAD          11U     /* 帧开销：帧头 + 时间戳 (4byte) + CRC8 (1byte) */
+#define FRAME_COBS_MAX_ENCODED  COBS_MAX_ENCODED(FRAME_MAX_LENGTH - 4U)     /* COBS模式编码后最大长度（不含结束符） */
+
+/* 枚举类型定义 --------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   分帧方式枚举类型
+ */
+enum Enum_Frame_Mode : uint8_t
+{
+    Frame_Mode_Head = 0U,   /*!< 包头 + 包类型 + 数据长度 + 数据 + 时间戳 + CRC8 */
+    Frame_Mode_COBS = 1U,   /*!< COBS(包类型 + 数据长度 + 数据 + 时间戳 + CRC8) + 0x00 结束符 */
+};
+
+/* 类定义 --------------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   流式帧解析类
+ *          包头模式帧格式：包头 (4byte) + 包类型 (1byte) + 数据长度 (1byte) + 数据 + 时间戳 (4byte) + CRC8 (1byte, CRC-8/MAXIM,
+ *          覆盖前面全部字节)；时间戳为发送方自由计数的微秒时钟（组帧时刻），置于数据之后，数据仍位于包类型偏移2处；
+ *          环形缓冲区由循环DMA写入，解析器只维护读指针：逐字节搜索包头，按包类型查表校验数据长度（未注册类型、长度不符直接跳过，
+ *          不等待整帧），再在环内原地完成CRC校验（跨越环尾时分两段计算）；任一校验不符时仅前移一个字节重新搜索，
+ *          因此垃圾数据、截断帧之后紧跟的完整帧不会丢失，多帧粘连也可逐帧取出；
+ *          COBS模式帧格式：COBS(包类型 + 数据长度 + 数据 + 时间戳 + CRC8) + 0x00，CRC覆盖包类型至时间戳；数据中不会出现 0x00，
+ *          以 0x00 定界后直接从环中解码，任何损坏只影响所在一帧，下一个 0x00 之后必然重新同步，开销比包头模式少2字节；
+ *          注册为变长的包类型，数据长度不超过注册长度即可
+ */
+class Class_Frame_Parser
+{
+public:
+    static_assert(FRAME_MAX_LENGTH <= COBS_BYTEWISE_LENGTH, "Class_Frame_Parser frame exceeds COBS bytewise length");
+
+    /* 函数 */
+    void Init(const uint8_t * __Ring, uint16_t __Ring_Size, uint32_t __Pack_Head,
+              Enum_Frame_Mode __Mode = Frame_Mode_Head);
+    void Register(uint8_t __Type, uint8_t __Length, bool __Variable = false);
+    void Reset(uint16_t __Read_Index = 0U);
+    const uint8_t * Next(uint16_t __Write_Index);
+
+    inline uint32_t Get_Frame_Number();
+    inline uint32_t Get_Error_Number();
+    inline uint32_t Get_Skip_Number();
+    inline uint16_t Get_Pending_Length(uint16_t __Write_Index);
+protected:
+    /* 函数 */
+    const uint8_t * Next_Head(uint16_t __Write_Index);
+    const uint8_t * Next_COBS(uint16_t __Write_Index);
+    inline bool Length_Check(uint8_t __Type, uint16_t __Frame_Length);
+
+    /* 常量 */
+    Enum_Frame_Mode Mode = Frame_Mode_Head;     /*!< 分帧方式 */
+    const uint8_t * Ring = nullptr;             /*!< 环形缓冲区 */
+    uint16_t Ring_Mask = 0U;                    /*!< 环形缓冲区下标掩码（长度为2的幂） */
+    uint8_t Head[4];                            /*!< 包头（按线上字节顺序） */
+    uint8_t Frame_Length[256];                  /*!< 各包类型帧长度（0为未注册，变长包为最大帧长度） */
+    uint32_t Variable[8];                       /*!< 变长包类型位图 */
+
+    /* 读写变量 */
+    uint8_t Buffer[FRAME_MAX_LENGTH];           /*!< 跨越环尾的帧拷贝、COBS解码结果 */
+    uint32_t Frame_Number = 0U;                 /*!< 解析成功帧数 */
+    uint32_t Error_Number = 0U;                 /*!< 长度、CRC校验错误次数 */
+    uint32_t Skip_Number = 0U;                  /*!< 重同步丢弃字节数 */
+
+    /* 内部变量 */
+    uint16_t Read_Index = 0U;                   /*!< 读指针 */
+    uint16_t Scan_Index = 0U;                   /*!< COBS结束符搜索位置 */
+    bool Discard = false;                       /*!< COBS超长帧丢弃中（丢弃至下一个结束符） */
+};
+
+/* 接口函数定义 --------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   获取帧时间戳
+ *
+ * @param   __Packet    包类型地址（Next 的返回值）
+ * @return  uint32_t    发送方组帧时刻 (us，发送方时钟)
+ */
+inline uint32_t Frame_Get_Time(const uint8_t * __Packet)
+{
+    uint32_t time;
+
+    memcpy(&time, &__Packet[2U + __Packet[1]], FRAME_TIME_LENGTH);
+
+    return (time);
+}
+
+/**
+ * @brief   帧长度校验（定长包需相等，变长包不超过注册长度）
+ *
+ * @param   __Type          包类型
+ * @param   __Frame_Length  帧长度（由数据长度字段折算）
+ * @return  bool            是否有效（未注册的包类型无效）
+ */
+bool Class_Frame_Parser::Length_Check(uint8_t __Type, uint16_t __Frame_Length)
+{
+    uint16_t length = this->Frame_Length[__Type];
+
+    return (__Frame_Length == length ||
+            (__Frame_Length < length && (this->Variable[__Type >> 5] & (1UL << (__Type & 31U))) != 0U));
+}
+
+/**
+ * @brief   获取解析成功帧数
+ *
+ * @return  uint32_t    帧数
+ */
+uint32_t Class_Frame_Parser::Get_Frame_Number()
+{
+    return (this->Frame_Number);
+}
+
+/**
+ * @brief   获取长度、CRC校验错误次数
+ *
+ * @return  uint32_t    错误次数
+ */
+uint32_t Class_Frame_Parser::Get_Error_Number()
+{
+    return (this->Error_Number);
+}
+
+/**
+ * @brief   获取重同步丢弃字节数
+ *
+ * @return  uint32_t    字节数
+ */
+uint32_t Class_Frame_Parser::Get_Skip_Number()
+{
+    return (this->Skip_Number);
+}
+
+/**
+ * @brief   获取尚未解析的字节数（在 Next 返回一帧后调用，即同一批接收中位于该帧之后的字节数）
+ *
+ * @param   __Write_Index   DMA写指针（与 Next 使用的相同）
+ * @return  uint16_t        字节数
+ */
+uint16_t Class_Frame_Parser::Get_Pending_Length(uint16_t __Write_Index)
+{
+    return ((__Write_Index - this->Read_Index) & this->Ring_Mask);
+}
+
+#endif /* MIL_Frame_Parser.h */
@@ -0,0 +1,272 @@
+/**
+ * @file    Gain_Schedule.h
+ * @brief   PID增益调度（断点表线性插值）
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.1
+ */
+
+#ifndef __MIL_GAIN_SCHEDULE_H
+#define __MIL_GAIN_SCHEDULE_H
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "User_Math.h"
+
+/* 类定义 --------------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   PID增益调度类
+ *          K_P/K_I/K_D 由等间距断点表按调度变量（如 |目标值|）线性插值得到，超出范围取端点值
+ *          缓存当前所在区间：调度变量仍在区间内时仅做 3 次乘加（斜率在 Init 中预先计算，无除法）；
+ *          离开区间时由 arm_linear_interp_f32 计算并重新定位区间，每次计算均为 O(1)；
+ *          Get_Changed 给出本次结果是否变化，调用方仅在变化时写入PID（PID的 Set_K_I/Set_K_D 含倒数、滤波系数更新）
+ *
+ * @tparam  N   断点数（不少于2）
+ */
+template<uint32_t N>
+class Class_Gain_Schedule
+{
+public:
+    /* 函数 */
+    void Init(float __X_Start, float __X_Spacing, const float * __K_P_Table, const float * __K_I_Table,
+              const float * __K_D_Table);
+    void Calculate(float __X);
+
+    inline bool Get_Enable();
+    inline bool Get_Changed();
+    inline float Get_K_P();
+    inline float Get_K_I();
+    inline float Get_K_D();
+protected:
+    /* 函数 */
+    inline void Locate(float __X);
+
+    /* 常量 */
+    float X_Start = 0.0f;                   /*!< 首个断点 */
+    float X_Spacing = 1.0f;                 /*!< 断点间距 */
+    float X_Spacing_Inv = 1.0f;             /*!< 1 / 断点间距 */
+    float K_P_Table[N];                     /*!< K_P 断点表 */
+    float K_I_Table[N];                     /*!< K_I 断点表 */
+    float K_D_Table[N];                     /*!< K_D 断点表 */
+    float K_P_Slope[N - 1U];                /*!< K_P 各区间斜率 */
+    float K_I_Slope[N - 1U];                /*!< K_I 各区间斜率 */
+    float K_D_Slope[N - 1U];                /*!< K_D 各区间斜率 */
+    arm_linear_interp_instance_f32 Interp_K_P;  /*!< K_P 插值实例 */
+    arm_linear_interp_instance_f32 Interp_K_I;  /*!< K_I 插值实例 */
+    arm_linear_interp_instance_f32 Interp_K_D;  /*!< K_D 插值实例 */
+
+    /* 读变量 */
+    bool Enable = false;                    /*!< 是否已初始化 */
+    bool Changed = false;                   /*!< 本次计算 K_P/K_I/K_D 是否有变化 */
+    float K_P = 0.0f;                       /*!< 当前 K_P */
+    float K_I = 0.0f;                       /*!< 当前 K_I */
+    float K_D = 0.0f;                       /*!< 当前 K_D */
+
+    /* 内部变量 */
+    uint32_t Segment = 0U;                  /*!< 缓存区间序号（0 低于首个断点, i + 1 为第 i 区间, N 超出末个断点） */
+    float Segment_Lo = 0.0f;                /*!< 缓存区间下界 */
+    float Segment_Hi = -1.0f;               /*!< 缓存区间上界（下界大于上界表示无缓存） */
+    float Segment_X = 0.0f;                 /*!< 缓存区间插值起点 */
+    float Base_K_P = 0.0f;                  /*!< 缓存区间起点 K_P */
+    float Base_K_I = 0.0f;                  /*!< 缓存区间起点 K_I */
+    float Base_K_D = 0.0f;                  /*!< 缓存区间起点 K_D */
+    float Slope_K_P = 0.0f;                 /*!< 缓存区间 K_P 斜率 */
+    float Slope_K_I = 0.0f;                 /*!< 缓存区间 K_I 斜率 */
+    float Slope_K_D = 0.0f;                 /*!< 缓存区间 K_D 斜率 */
+    bool Changed_Pending = false;           /*!< Init 后首次计算视为有变化 */
+};
+
+/* 接口函数定义 --------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   增益调度初始化
+ *
+ * @param   __X_Start       首个断点（调度变量最小值）
+ * @param   __X_Spacing     断点间距（需大于0）
+ * @param   __K_P_Table     K_P 断点表（N项）
+ * @param   __K_I_Table     K_I 断点表（N项）
+ * @param   __K_D_Table     K_D 断点表（N项）
+ */
+template<uint32_t N>
+void Class_Gain_Schedule<N>::Init(float __X_Start, float __X_Spacing, const float * __K_P_Table,
+                                  const float * __K_I_Table, const float * __K_D_Table)
+{
+    static_assert(N >= 2U, "Class_Gain_Schedule needs at least 2 breakpoints");
+
+    this->X_Start = __X_Start;
+    this->X_Spacing = __X_Spacing;
+    this->X_Spacing_Inv = 1.0f / __X_Spacing;
+
+    for (uint32_t i = 0; i < N; i++)
+    {
+        this->K_P_Table[i] = __K_P_Table[i];
+        this->K_I_Table[i] = __K_I_Table[i];
+        this->K_D_Table[i] = __K_D_Table[i];
+    }
+
+    /* 区间斜率预计算 */
+    for (uint32_t i = 0; i < N - 1U; i++)
+    {
+        this->K_P_Slope[i] = (this->K_P_Table[i + 1U] - this->K_P_Table[i]) * this->X_Spacing_Inv;
+        this->K_I_Slope[i] = (this->K_I_Table[i + 1U] - this->K_I_Table[i]) * this->X_Spacing_Inv;
+        this->K_D_Slope[i] = (this->K_D_Table[i + 1U] - this->K_D_Table[i]) * this->X_Spacing_Inv;
+    }
+
+    /* 插值实例 */
+    this->Interp_K_P = {N, __X_Start, __X_Spacing, this->K_P_Table};
+    this->Interp_K_I = {N, __X_Start, __X_Spacing, this->K_I_Table};
+    this->Interp_K_D = {N, __X_Start, __X_Spacing, this->K_D_Table};
+
+    /* 清除区间缓存 */
+    this->Segment_Lo = 0.0f;
+    this->Segment_Hi = -1.0f;
+    this->Enable = true;
+
+    this->Calculate(__X_Start);
+    this->Changed_Pending = true;
+}
+
+/**
+ * @brief   增益调度计算一次
+ *
+ * @param   __X     调度变量
+ */
+template<uint32_t N>
+void Class_Gain_Schedule<N>::Calculate(float __X)
+{
+    float pre_k_p = this->K_P;
+    float pre_k_i = this->K_I;
+    float pre_k_d = this->K_D;
+
+    if (__X < this->Segment_Lo || __X >= this->Segment_Hi)
+    {
+        /* 离开缓存区间，插值并重新定位 */
+        this->K_P = arm_linear_interp_f32(&this->Interp_K_P, __X);
+        this->K_I = arm_linear_interp_f32(&this->Interp_K_I, __X);
+        this->K_D = arm_linear_interp_f32(&this->Interp_K_D, __X);
+        this->Locate(__X);
+    }
+    else
+    {
+        /* 仍在缓存区间内 */
+        float delta_x = __X - this->Segment_X;
+        this->K_P = this->Base_K_P + delta_x * this->Slope_K_P;
+        this->K_I = this->Base_K_I + delta_x * this->Slope_K_I;
+        this->K_D = this->Base_K_D + delta_x * this->Slope_K_D;
+    }
+
+    /* 端点区间内或调度变量不变时结果不变 */
+    this->Changed = this->Changed_Pending || this->K_P != pre_k_p || this->K_I != pre_k_i || this->K_D != pre_k_d;
+    this->Changed_Pending = false;
+}
+
+/**
+ * @brief   定位调度变量所在区间并缓存区间起点与斜率
+ *
+ * @param   __X     调度变量
+ */
+template<uint32_t N>
+void Class_Gain_Schedule<N>::Locate(float __X)
+{
+    float x_end = this->X_Start + (N - 1U) * this->X_Spacing;
+    uint32_t i;
+
+    if (__X < this->X_Start)
+    {
+        /* 低于首个断点：保持首项（arm_linear_interp_f32 在首个间距内向下取整为0，会线性外推，此处统一为首项） */
+        this->Segment = 0U;
+        this->Segment_Lo = -FLT_MAX;
+        this->Segment_Hi = this->X_Start;
+        this->Segment_X = this->X_Start;
+        this->Base_K_P = this->K_P = this->K_P_Table[0];
+        this->Base_K_I = this->K_I = this->K_I_Table[0];
+        this->Base_K_D = this->K_D = this->K_D_Table[0];
+        this->Slope_K_P = this->Slope_K_I = this->Slope_K_D = 0.0f;
+    }
+    else if (__X >= x_end)
+    {
+        /* 超出末个断点：保持末项 */
+        this->Segment = N;
+        this->Segment_Lo = x_end;
+        this->Segment_Hi = FLT_MAX;
+        this->Segment_X = x_end;
+        this->Base_K_P = this->K_P_Table[N - 1U];
+        this->Base_K_I = this->K_I_Table[N - 1U];
+        this->Base_K_D = this->K_D_Table[N - 1U];
+        this->Slope_K_P = this->Slope_K_I = this->Slope_K_D = 0.0f;
+    }
+    else
+    {
+        i = (uint32_t)((__X - this->X_Start) * this->X_Spacing_Inv);
+        if (i > N - 2U)
+        {
+            i = N - 2U;
+        }
+        this->Segment = i + 1U;
+        this->Segment_X = this->X_Start + i * this->X_Spacing;
+        this->Segment_Lo = this->Segment_X;
+        this->Segment_Hi = this->Segment_X + this->X_Spacing;
+        this->Base_K_P = this->K_P_Table[i];
+        this->Base_K_I = this->K_I_Table[i];
+        this->Base_K_D = this->K_D_Table[i];
+        this->Slope_K_P = this->K_P_Slope[i];
+        this->Slope_K_I = this->K_I_Slope[i];
+        this->Slope_K_D = this->K_D_Slope[i];
+    }
+}
+
+/**
+ * @brief   获取是否已初始化（未初始化时不应使用调度结果）
+ *
+ * @return  bool    是否已初始化
+ */
+template<uint32_t N>
+bool Class_Gain_Schedule<N>::Get_Enable()
+{
+    return (this->Enable);
+}
+
+/**
+ * @brief   获取本次计算结果是否变化
+ *
+ * @return  bool    K_P/K_I/K_D 是否与上次计算不同（Init 后首次计算为 true）
+ */
+template<uint32_t N>
+bool Class_Gain_Schedule<N>::Get_Changed()
+{
+    return (this->Changed);
+}
+
+/**
+ * @brief   获取当前 K_P
+ *
+ * @return  float   K_P
+ */
+template<uint32_t N>
+float Class_Gain_Schedule<N>::Get_K_P()
+{
+    return (this->K_P);
+}
+
+/**
+ * @brief   获取当前 K_I
+ *
+ * @return  float   K_I
+ */
+template<uint32_t N>
+float Class_Gain_Schedule<N>::Get_K_I()
+{
+    return (this->K_I);
+}
+
+/**
+ * @brief   获取当前 K_D
+ *
+ * @return  float   K_D
+ */
+template<uint32_t N>
+float Class_Gain_Schedule<N>::Get_K_D()
+{
+    return (this->K_D);
+}
+
+#endif /* MIL_Gain_Schedule.h */
@@ -4,7 +4,7 @@
  *
  * @author  Tang-yucheng (QQ: 3143961287)
  * @date    2024-2-15
- * @version v1.0
+ * @version v1.2
  */
 
 #ifndef __MIL_GEAR_H
@@ -30,11 +30,75 @@ public:
     inline float Get_Out();
 protected:
     /* 常量 */
-    float Step_Length;      /*!< 变速步长 */
+    float Step_Length = 0.0f;   /*!< 变速步长, 0为不限制 */
 
     /* 读写变量 */
-    float Set_Val = 0.0f;   /*!< 设定值 */
-    float Out_Val = 0.0f;   /*!< 当前输出值 */
+    float Set_Val = 0.0f;       /*!< 设定值 */
+    float Out_Val = 0.0f;       /*!< 当前输出值 */
+};
+
+/**
+ * @brief   S曲线变速控制器类（加加速度受限）
+ *          每次计算求解 a' * D_T / 2 + a' * |a'| / (2 * J_Max) = 剩余速度差，得到恰好以最大加加速度减至0加速度时到达设定值的
+ *          下一周期加速度，再按加加速度、加速度限幅，闭式求解 O(1)，无迭代、无除法；输出规划加速度供前馈使用
+ */
+class Class_Gear_SCurve
+{
+public:
+    /* 函数 */
+    void Init(float __V_Max, float __A_Max, float __J_Max, float __D_T);
+    void Calculate();
+    void Reset(float __Value = 0.0f);
+
+    inline bool Get_Enable();
+    inline float Set_Value(float __Set_Value);
+    inline float Get_Out();
+    inline float Get_Acceleration();
+protected:
+    /* 常量 */
+    float V_Max = 0.0f;         /*!< 输出限幅, 0为不限制 */
+    float A_Max = 0.0f;         /*!< 加速度限幅（单位/s） */
+    float J_Max = 0.0f;         /*!< 加加速度限幅（单位/s^2） */
+    float D_T = 0.001f;         /*!< 计算周期 (s) */
+    float J_Max_Inv = 0.0f;     /*!< 1 / J_Max */
+    float J_D_T = 0.0f;         /*!< J_Max * D_T（单周期加速度最大变化量） */
+
+    /* 读写变量 */
+    float Set_Val = 0.0f;       /*!< 设定值 */
+    float Out_Val = 0.0f;       /*!< 当前输出值 */
+    float Acceleration = 0.0f;  /*!< 当前规划加速度（单位/s） */
+};
+
+/**
+ * @brief   平面速度 (vx, vy, omega) 变速控制器类
+ *          三个分量按同一比例逼近设定值：平移速度变化量的模不超过 Step_Linear，角速度变化量不超过 Step_Angular，
+ *          变速过程中速度矢量方向保持不变（麦轮底盘四轮同时到达目标，加速时不走弧线）
+ */
+class Class_Gear_Twist
+{
+public:
+    /* 函数 */
+    void Init(float __Step_Linear = 0.0f, float __Step_Angular = 0.0f);
+    void Calculate();
+    void Reset();
+
+    inline bool Get_Enable();
+    inline void Set_Value(float __Velocity_X, float __Velocity_Y, float __Omega);
+    inline float Get_Velocity_X();
+    inline float Get_Velocity_Y();
+    inline float Get_Omega();
+protected:
+    /* 常量 */
+    float Step_Linear = 0.0f;   /*!< 每周期平移速度最大变化量, 0为不限制 */
+    float Step_Angular = 0.0f;  /*!< 每周期角速度最大变化量, 0为不限制 */
+
+    /* 读写变量 */
+    float Set_Velocity_X = 0.0f;    /*!< X方向速度设定值 */
+    float Set_Velocity_Y = 0.0f;    /*!< Y方向速度设定值 */
+    float Set_Omega = 0.0f;         /*!< 角速度设定值 */
+    float Out_Velocity_X = 0.0f;    /*!< X方向速度当前输出值 */
+    float Out_Velocity_Y = 0.0f;    /*!< Y方向速度当前输出值 */
+    float Out_Omega = 0.0f;         /*!< 角速度当前输出值 */
 };
 
 /* 函数声明 ------------------------------------------------------------------------------------------------------------*/
@@ -61,4 +125,99 @@ float Class_Gear_Slope::Get_Out()
     return this->Out_Val;
 }
 
+/**
+ * @brief   S曲线变速是否已初始化
+ *
+ * @return  bool    是否已初始化
+ */
+bool Class_Gear_SCurve::Get_Enable()
+{
+    return (this->J_Max > 0.0f);
+}
+
+/**
+ * @brief   S曲线变速值设定
+ *
+ * @return  float   设定的值（超出 V_Max 时为限幅后的值）
+ */
+float Class_Gear_SCurve::Set_Value(float __Set_Value)
+{
+    if (this->V_Max > 0.0f)
+    {
+        Math_Constrain(&__Set_Value, -this->V_Max, this->V_Max);
+    }
+    this->Set_Val = __Set_Value;
+    return this->Set_Val;
+}
+
+/**
+ * @brief   S曲线输出值获取
+ *
+ * @return  float   当前输出值
+ */
+float Class_Gear_SCurve::Get_Out()
+{
+    return this->Out_Val;
+}
+
+/**
+ * @brief   S曲线规划加速度获取
+ *
+ * @return  float   当前规划加速度（单位/s）
+ */
+float Class_Gear_SCurve::Get_Acceleration()
+{
+    return this->Acceleration;
+}
+
+/**
+ * @brief   平面速度变速是否限制加速度
+ *
+ * @return  bool    平移、旋转任一步长非0
+ */
+bool Class_Gear_Twist::Get_Enable()
+{
+    return (this->Step_Linear != 0.0f || this->Step_Angular != 0.0f);
+}
+
+/**
+ * @brief   平面速度设定
+ */
+void Class_Gear_Twist::Set_Value(float __Velocity_X, float __Velocity_Y, float __Omega)
+{
+    this->Set_Velocity_X = __Velocity_X;
+    this->Set_Velocity_Y = __Velocity_Y;
+    this->Set_Omega = __Omega;
+}
+
+/**
+ * @brief   X方向速度输出值获取
+ *
+ * @return  float   当前X方向速度
+ */
+float Class_Gear_Twist::Get_Velocity_X()
+{
+    return this->Out_Velocity_X;
+}
+
+/**
+ * @brief   Y方向速度输出值获取
+ *
+ * @return  float   当前Y方向速度
+ */
+float Class_Gear_Twist::Get_Velocity_Y()
+{
+    return this->Out_Velocity_Y;
+}
+
+/**
+ * @brief   角速度输出值获取
+ *
+ * @return  float   当前角速度
+ */
+float Class_Gear_Twist::Get_Omega()
+{
+    return this->Out_Omega;
+}
+
 #endif /* MIL_Gear.h */
@@ -0,0 +1,96 @@
+/**
+ * @file    Math_Fast.h
+ * @brief   快速数学函数（查表三角函数、多项式反正切、硬件开方、无分支角度归一化）
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.1
+ */
+
+#ifndef __MIL_MATH_FAST_H
+#define __MIL_MATH_FAST_H
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "User_Math.h"
+
+/* 宏定义 --------------------------------------------------------------------------------------------------------------*/
+#define MATH_FAST_TABLE_SIZE    512U    /* 正弦表一个周期的点数（表长 MATH_FAST_TABLE_SIZE + 1） */
+
+/* 函数声明 ------------------------------------------------------------------------------------------------------------*/
+void Math_Fast_Sin_Cos(float x, float *Sin, float *Cos);
+float Math_Fast_Sin(float x);
+float Math_Fast_Cos(float x);
+float Math_Fast_Atan2(float y, float x);
+
+/* 接口函数定义 --------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   向下取整（无分支，|x| < 2^31）
+ *
+ * @param   x       输入
+ * @return  float   不大于 x 的最大整数
+ */
+inline float Math_Fast_Floor(float x)
+{
+    float t = (float)(int32_t)x;
+
+    return (t - (float)(t > x));
+}
+
+/**
+ * @brief   平方根（Cortex-M4F 上为 VSQRT 单指令）
+ *
+ * @param   x       输入
+ * @return  float   sqrt(x)，x 为负时返回0
+ */
+inline float Math_Fast_Sqrt(float x)
+{
+    float out;
+
+    arm_sqrt_f32(x, &out);
+    return (out);
+}
+
+/**
+ * @brief   浮点取余（与 fmodf 一致：结果与 x 同号，|x / Period| < 2^31）
+ *
+ * @param   x       被除数
+ * @param   Period  除数（需大于0）
+ * @return  float   x - Period * trunc(x / Period)
+ */
+inline float Math_Fast_Fmod(float x, float Period)
+{
+    /* x 为 Period 整数倍时差值为 +0，按 fmodf 取 x 的符号 */
+    return (copysignf(x - Period * (float)(int32_t)(x / Period), x));
+}
+
+/**
+ * @brief   周期归一化至 [Lower, Lower + Period)（无分支）
+ *
+ * @param   x       输入
+ * @param   Lower   区间下界
+ * @param   Period  周期（需大于0）
+ * @return  float   归一化后的值
+ */
+inline float Math_Fast_Wrap(float x, float Lower, float Period)
+{
+    float out = x - Period * Math_Fast_Floor((x - Lower) / Period);
+
+    /* (x - Lower) / Period 舍入到整数时结果越界一个舍入误差，折回区间内 */
+    return (out + Period * ((float)(out < Lower) - (float)(out >= Lower + Period)));
+}
+
+/**
+ * @brief   角度归一化至 [-PI, PI)（无分支）
+ *
+ * @param   x       角度 (rad)
+ * @return  float   归一化后的角度 (rad)
+ */
+inline float Math_Fast_Wrap_PI(float x)
+{
+    float out = x - 2.0f * PI * Math_Fast_Floor((x + PI) * (0.5f / PI));
+
+    /* (x + PI) / (2 * PI) 舍入到整数时结果越界一个舍入误差，折回区间内 */
+    return (out + 2.0f * PI * ((float)(out < -PI) - (float)(out >= PI)));
+}
+
+#endif /* MIL_Math_Fast.h */
@@ -0,0 +1,513 @@
+/**
+ * @file    Matrix.h
+ * @brief   定长矩阵、向量运算库（编译期展开）
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.1
+ */
+
+#ifndef __MIL_MATRIX_H
+#define __MIL_MATRIX_H
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "User_Math.h"
+
+/* 宏定义 --------------------------------------------------------------------------------------------------------------*/
+#define MATRIX_UNROLL_MAX   64U     /* 矩阵乘法展开上限（乘加次数 R * K * C），超过时调用 arm_mat_mult_f32 */
+
+/* 类定义 --------------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   定长矩阵类（行优先存储，与 arm_matrix_instance_f32 一致）
+ *          聚合类型，可用 {{{...}, {...}}} 或按行优先平铺的 {{...}} 初始化，可作 constexpr 常量；
+ *          逐元素运算与乘法由编译期生成的下标序列展开为单条表达式，无循环
+ *
+ * @tparam  R   行数
+ * @tparam  C   列数
+ */
+template<uint32_t R, uint32_t C>
+class Class_Matrix
+{
+public:
+    /* 变量 */
+    float Data[R][C];                       /*!< 矩阵元素 */
+
+    /* 函数 */
+    inline float & operator()(uint32_t __Row, uint32_t __Col);
+    constexpr float operator()(uint32_t __Row, uint32_t __Col) const;
+    inline float & operator[](uint32_t __Index);
+    constexpr float operator[](uint32_t __Index) const;
+};
+
+/**
+ * @brief   定长列向量
+ *
+ * @tparam  N   维数
+ */
+template<uint32_t N>
+using Class_Vector = Class_Matrix<N, 1U>;
+
+/**
+ * @brief   编译期下标序列（C++11 无 std::index_sequence）
+ */
+template<uint32_t... I>
+struct Matrix_Index
+{
+};
+
+/**
+ * @brief   生成下标序列 0, 1, ..., N - 1
+ */
+template<uint32_t N, uint32_t... I>
+struct Matrix_Make_Index : Matrix_Make_Index<N - 1U, N - 1U, I...>
+{
+};
+
+template<uint32_t... I>
+struct Matrix_Make_Index<0U, I...>
+{
+    typedef Matrix_Index<I...> Type;
+};
+
+/**
+ * @brief   编译期展开 A 第 __Row 行与 B 第 __Col 列前 K 项的点积
+ */
+template<uint32_t K>
+struct Matrix_Unroll_Dot
+{
+    template<uint32_t R, uint32_t N, uint32_t C>
+    static constexpr float Calculate(const Class_Matrix<R, N> & __A, const Class_Matrix<N, C> & __B,
+                                     uint32_t __Row, uint32_t __Col)
+    {
+        return (Matrix_Unroll_Dot<K - 1U>::Calculate(__A, __B, __Row, __Col) + __A.Data[__Row][K - 1U] * __B.Data[K - 1U][__Col]);
+    }
+};
+
+template<>
+struct Matrix_Unroll_Dot<1U>
+{
+    template<uint32_t R, uint32_t N, uint32_t C>
+    static constexpr float Calculate(const Class_Matrix<R, N> & __A, const Class_Matrix<N, C> & __B,
+                                     uint32_t __Row, uint32_t __Col)
+    {
+        return (__A.Data[__Row][0] * __B.Data[0][__Col]);
+    }
+};
+
+/* 函数声明 ------------------------------------------------------------------------------------------------------------*/
+template<uint32_t R, uint32_t C, uint32_t... E>
+constexpr Class_Matrix<R, C> Matrix_Add(const Class_Matrix<R, C> & __A, const Class_Matrix<R, C> & __B, Matrix_Index<E...>);
+template<uint32_t R, uint32_t C, uint32_t... E>
+constexpr Class_Matrix<R, C> Matrix_Subtract(const Class_Matrix<R, C> & __A, const Class_Matrix<R, C> & __B, Matrix_Index<E...>);
+template<uint32_t R, uint32_t C, uint32_t... E>
+constexpr Class_Matrix<R, C> Matrix_Scale(const Class_Matrix<R, C> & __A, float __K, Matrix_Index<E...>);
+template<uint32_t R, uint32_t C, uint32_t... E>
+constexpr Class_Matrix<C, R> Matrix_Transpose(const Class_Matrix<R, C> & __A, Matrix_Index<E...>);
+template<uint32_t R, uint32_t K, uint32_t C, uint32_t... E>
+constexpr Class_Matrix<R, C> Matrix_Multiply(const Class_Matrix<R, K> & __A, const Class_Matrix<K, C> & __B, Matrix_Index<E...>);
+
+/**
+ * @brief   矩阵乘法分派（展开 / arm_mat_mult_f32）
+ */
+template<bool Unroll>
+struct Matrix_Multiply_Dispatch
+{
+    template<uint32_t R, uint32_t K, uint32_t C>
+    static constexpr Class_Matrix<R, C> Calculate(const Class_Matrix<R, K> & __A, const Class_Matrix<K, C> & __B)
+    {
+        return (Matrix_Multiply(__A, __B, typename Matrix_Make_Index<R * C>::Type()));
+    }
+};
+
+template<>
+struct Matrix_Multiply_Dispatch<false>
+{
+    template<uint32_t R, uint32_t K, uint32_t C>
+    static inline Class_Matrix<R, C> Calculate(const Class_Matrix<R, K> & __A, const Class_Matrix<K, C> & __B)
+    {
+        Class_Matrix<R, C> out;
+        arm_matrix_instance_f32 a = {R, K, const_cast<float *>(&__A.Data[0][0])};
+        arm_matrix_instance_f32 b = {K, C, const_cast<float *>(&__B.Data[0][0])};
+        arm_matrix_instance_f32 o = {R, C, &out.Data[0][0]};
+
+        arm_mat_mult_f32(&a, &b, &o);
+        return (out);
+    }
+};
+
+/* 接口函数定义 --------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   元素访问
+ *
+ * @param   __Row   行
+ * @param   __Col   列
+ * @return  float&  元素引用
+ */
+template<uint32_t R, uint32_t C>
+float & Class_Matrix<R, C>::operator()(uint32_t __Row, uint32_t __Col)
+{
+    return (this->Data[__Row][__Col]);
+}
+
+/**
+ * @brief   元素访问（只读）
+ *
+ * @param   __Row   行
+ * @param   __Col   列
+ * @return  float   元素值
+ */
+template<uint32_t R, uint32_t C>
+constexpr float Class_Matrix<R, C>::operator()(uint32_t __Row, uint32_t __Col) const
+{
+    return (this->Data[__Row][__Col]);
+}
+
+/**
+ * @brief   按行优先序号访问元素（向量即第 __Index 维）
+ *
+ * @param   __Index 行优先序号
+ * @return  float&  元素引用
+ */
+template<uint32_t R, uint32_t C>
+float & Class_Matrix<R, C>::operator[](uint32_t __Index)
+{
+    return (this->Data[__Index / C][__Index % C]);
+}
+
+/**
+ * @brief   按行优先序号访问元素（只读）
+ *
+ * @param   __Index 行优先序号
+ * @return  float   元素值
+ */
+template<uint32_t R, uint32_t C>
+constexpr float Class_Matrix<R, C>::operator[](uint32_t __Index) const
+{
+    return (this->Data[__Index / C][__Index % C]);
+}
+
+/**
+ * @brief   矩阵加法（展开实现）
+ */
+template<uint32_t R, uint32_t C, uint32_t... E>
+constexpr Class_Matrix<R, C> Matrix_Add(const Class_Matrix<R, C> & __A, const Class_Matrix<R, C> & __B, Matrix_Index<E...>)
+{
+    return (Class_Matrix<R, C>{{__A[E] + __B[E]...}});
+}
+
+/**
+ * @brief   矩阵减法（展开实现）
+ */
+template<uint32_t R, uint32_t C, uint32_t... E>
+constexpr Class_Matrix<R, C> Matrix_Subtract(const Class_Matrix<R, C> & __A, const Class_Matrix<R, C> & __B, Matrix_Index<E...>)
+{
+    return (Class_Matrix<R, C>{{__A[E] - __B[E]...}});
+}
+
+/**
+ * @brief   矩阵数乘（展开实现）
+ */
+template<uint32_t R, uint32_t C, uint32_t... E>
+constexpr Class_Matrix<R, C> Matrix_Scale(const Class_Matrix<R, C> & __A, float __K, Matrix_Index<E...>)
+{
+    return (Class_Matrix<R, C>{{__A[E] * __K...}});
+}
+
+/**
+ * @brief   矩阵转置（展开实现，E 为结果的行优先序号）
+ */
+template<uint32_t R, uint32_t C, uint32_t... E>
+constexpr Class_Matrix<C, R> Matrix_Transpose(const Class_Matrix<R, C> & __A, Matrix_Index<E...>)
+{
+    return (Class_Matrix<C, R>{{__A.Data[E % R][E / R]...}});
+}
+
+/**
+ * @brief   矩阵乘法（展开实现，E 为结果的行优先序号）
+ */
+template<uint32_t R, uint32_t K, uint32_t C, uint32_t... E>
+constexpr Class_Matrix<R, C> Matrix_Multiply(const Class_Matrix<R, K> & __A, const Class_Matrix<K, C> & __B, Matrix_Index<E...>)
+{
+    return (Class_Matrix<R, C>{{Matrix_Unroll_Dot<K>::Calculate(__A, __B, E / C, E % C)...}});
+}
+
+/**
+ * @brief   3x3 矩阵第0列代数余子式（伴随矩阵第0列，展开实现）
+ */
+constexpr Class_Vector<3> Matrix_Cofactor(const Class_Matrix<3, 3> & __A)
+{
+    return (Class_Vector<3>{{__A.Data[1][1] * __A.Data[2][2] - __A.Data[1][2] * __A.Data[2][1],
+                             __A.Data[1][2] * __A.Data[2][0] - __A.Data[1][0] * __A.Data[2][2],
+                             __A.Data[1][0] * __A.Data[2][1] - __A.Data[1][1] * __A.Data[2][0]}});
+}
+
+/**
+ * @brief   3x3 矩阵行列式（按第0行展开，__C 为 Matrix_Cofactor 结果）
+ */
+constexpr float Matrix_Determinant(const Class_Matrix<3, 3> & __A, const Class_Vector<3> & __C)
+{
+    return (__A.Data[0][0] * __C[0] + __A.Data[0][1] * __C[1] + __A.Data[0][2] * __C[2]);
+}
+
+/**
+ * @brief   3x3 矩阵求逆（伴随矩阵数乘 __Inv = 1 / det，展开实现）
+ */
+constexpr Class_Matrix<3, 3> Matrix_Inverse(const Class_Matrix<3, 3> & __A, const Class_Vector<3> & __C, float __Inv)
+{
+    return (Class_Matrix<3, 3>{{__C[0] * __Inv,
+                                (__A.Data[0][2] * __A.Data[2][1] - __A.Data[0][1] * __A.Data[2][2]) * __Inv,
+                                (__A.Data[0][1] * __A.Data[1][2] - __A.Data[0][2] * __A.Data[1][1]) * __Inv,
+                                __C[1] * __Inv,
+                                (__A.Data[0][0] * __A.Data[2][2] - __A.Data[0][2] * __A.Data[2][0]) * __Inv,
+                                (__A.Data[0][2] * __A.Data[1][0] - __A.Data[0][0] * __A.Data[1][2]) * __Inv,
+                                __C[2] * __Inv,
+                                (__A.Data[0][1] * __A.Data[2][0] - __A.Data[0][0] * __A.Data[2][1]) * __Inv,
+                                (__A.Data[0][0] * __A.Data[1][1] - __A.Data[0][1] * __A.Data[1][0]) * __Inv}});
+}
+
+/**
+ * @brief   3x3 矩阵求逆（不判断奇异）
+ */
+constexpr Class_Matrix<3, 3> Matrix_Inverse(const Class_Matrix<3, 3> & __A, const Class_Vector<3> & __C)
+{
+    return (Matrix_Inverse(__A, __C, 1.0f / Matrix_Determinant(__A, __C)));
+}
+
+/**
+ * @brief   4x4 矩阵 2x2 子式（第0行为上两行子式 s0 ~ s5，第1行为下两行子式 c0 ~ c5，展开实现）
+ */
+constexpr Class_Matrix<2, 6> Matrix_Minor(const Class_Matrix<4, 4> & __A)
+{
+    return (Class_Matrix<2, 6>{{__A.Data[0][0] * __A.Data[1][1] - __A.Data[1][0] * __A.Data[0][1],
+                                __A.Data[0][0] * __A.Data[1][2] - __A.Data[1][0] * __A.Data[0][2],
+                                __A.Data[0][0] * __A.Data[1][3] - __A.Data[1][0] * __A.Data[0][3],
+                                __A.Data[0][1] * __A.Data[1][2] - __A.Data[1][1] * __A.Data[0][2],
+                                __A.Data[0][1] * __A.Data[1][3] - __A.Data[1][1] * __A.Data[0][3],
+                                __A.Data[0][2] * __A.Data[1][3] - __A.Data[1][2] * __A.Data[0][3],
+                                __A.Data[2][0] * __A.Data[3][1] - __A.Data[3][0] * __A.Data[2][1],
+                                __A.Data[2][0] * __A.Data[3][2] - __A.Data[3][0] * __A.Data[2][2],
+                                __A.Data[2][0] * __A.Data[3][3] - __A.Data[3][0] * __A.Data[2][3],
+                                __A.Data[2][1] * __A.Data[3][2] - __A.Data[3][1] * __A.Data[2][2],
+                                __A.Data[2][1] * __A.Data[3][3] - __A.Data[3][1] * __A.Data[2][3],
+                                __A.Data[2][2] * __A.Data[3][3] - __A.Data[3][2] * __A.Data[2][3]}});
+}
+
+/**
+ * @brief   4x4 矩阵行列式（Laplace 展开，__M 为 Matrix_Minor 结果）
+ */
+constexpr float Matrix_Determinant(const Class_Matrix<2, 6> & __M)
+{
+    return (__M.Data[0][0] * __M.Data[1][5] - __M.Data[0][1] * __M.Data[1][4] + __M.Data[0][2] * __M.Data[1][3] +
+            __M.Data[0][3] * __M.Data[1][2] - __M.Data[0][4] * __M.Data[1][1] + __M.Data[0][5] * __M.Data[1][0]);
+}
+
+/**
+ * @brief   4x4 矩阵求逆（伴随矩阵数乘 __Inv = 1 / det，展开实现）
+ */
+constexpr Class_Matrix<4, 4> Matrix_Inverse(const Class_Matrix<4, 4> & __A, const Class_Matrix<2, 6> & __M, float __Inv)
+{
+    return (Class_Matrix<4, 4>{{
+        ( __A.Data[1][1] * __M.Data[1][5] - __A.Data[1][2] * __M.Data[1][4] + __A.Data[1][3] * __M.Data[1][3]) * __Inv,
+        (-__A.Data[0][1] * __M.Data[1][5] + __A.Data[0][2] * __M.Data[1][4] - __A.Data[0][3] * __M.Data[1][3]) * __Inv,
+        ( __A.Data[3][1] * __M.Data[0][5] - __A.Data[3][2] * __M.Data[0][4] + __A.Data[3][3] * __M.Data[0][3]) * __Inv,
+        (-__A.Data[2][1] * __M.Data[0][5] + __A.Data[2][2] * __M.Data[0][4] - __A.Data[2][3] * __M.Data[0][3]) * __Inv,
+        (-__A.Data[1][0] * __M.Data[1][5] + __A.Data[1][2] * __M.Data[1][2] - __A.Data[1][3] * __M.Data[1][1]) * __Inv,
+        ( __A.Data[0][0] * __M.Data[1][5] - __A.Data[0][2] * __M.Data[1][2] + __A.Data[0][3] * __M.Data[1][1]) * __Inv,
+        (-__A.Data[3][0] * __M.Data[0][5] + __A.Data[3][2] * __M.Data[0][2] - __A.Data[3][3] * __M.Data[0][1]) * __Inv,
+        ( __A.Data[2][0] * __M.Data[0][5] - __A.Data[2][2] * __M.Data[0][2] + __A.Data[2][3] * __M.Data[0][1]) * __Inv,
+        ( __A.Data[1][0] * __M.Data[1][4] - __A.Data[1][1] * __M.Data[1][2] + __A.Data[1][3] * __M.Data[1][0]) * __Inv,
+        (-__A.Data[0][0] * __M.Data[1][4] + __A.Data[0][1] * __M.Data[1][2] - __A.Data[0][3] * __M.Data[1][0]) * __Inv,
+        ( __A.Data[3][0] * __M.Data[0][4] - __A.Data[3][1] * __M.Data[0][2] + __A.Data[3][3] * __M.Data[0][0]) * __Inv,
+        (-__A.Data[2][0] * __M.Data[0][4] + __A.Data[2][1] * __M.Data[0][2] - __A.Data[2][3] * __M.Data[0][0]) * __Inv,
+        (-__A.Data[1][0] * __M.Data[1][3] + __A.Data[1][1] * __M.Data[1][1] - __A.Data[1][2] * __M.Data[1][0]) * __Inv,
+        ( __A.Data[0][0] * __M.Data[1][3] - __A.Data[0][1] * __M.Data[1][1] + __A.Data[0][2] * __M.Data[1][0]) * __Inv,
+        (-__A.Data[3][0] * __M.Data[0][3] + __A.Data[3][1] * __M.Data[0][1] - __A.Data[3][2] * __M.Data[0][0]) * __Inv,
+        ( __A.Data[2][0] * __M.Data[0][3] - __A.Data[2][1] * __M.Data[0][1] + __A.Data[2][2] * __M.Data[0][0]) * __Inv}});
+}
+
+/**
+ * @brief   4x4 矩阵求逆（不判断奇异）
+ */
+constexpr Class_Matrix<4, 4> Matrix_Inverse(const Class_Matrix<4, 4> & __A, const Class_Matrix<2, 6> & __M)
+{
+    return (Matrix_Inverse(__A, __M, 1.0f / Matrix_Determinant(__M)));
+}
+
+/**
+ * @brief   矩阵加法
+ *
+ * @param   __A     矩阵A
+ * @param   __B     矩阵B
+ * @return  Class_Matrix<R, C>  A + B
+ */
+template<uint32_t R, uint32_t C>
+constexpr Class_Matrix<R, C> operator+(const Class_Matrix<R, C> & __A, const Class_Matrix<R, C> & __B)
+{
+    return (Matrix_Add(__A, __B, typename Matrix_Make_Index<R * C>::Type()));
+}
+
+/**
+ * @brief   矩阵减法
+ *
+ * @param   __A     矩阵A
+ * @param   __B     矩阵B
+ * @return  Class_Matrix<R, C>  A - B
+ */
+template<uint32_t R, uint32_t C>
+constexpr Class_Matrix<R, C> operator-(const Class_Matrix<R, C> & __A, const Class_Matrix<R, C> & __B)
+{
+    return (Matrix_Subtract(__A, __B, typename Matrix_Make_Index<R * C>::Type()));
+}
+
+/**
+ * @brief   矩阵数乘
+ *
+ * @param   __A     矩阵A
+ * @param   __K     系数
+ * @return  Class_Matrix<R, C>  A * k
+ */
+template<uint32_t R, uint32_t C>
+constexpr Class_Matrix<R, C> operator*(const Class_Matrix<R, C> & __A, float __K)
+{
+    return (Matrix_Scale(__A, __K, typename Matrix_Make_Index<R * C>::Type()));
+}
+
+/**
+ * @brief   矩阵乘法（乘加次数不超过 MATRIX_UNROLL_MAX 时展开，否则调用 arm_mat_mult_f32）
+ *
+ * @param   __A     矩阵A (R x K)
+ * @param   __B     矩阵B (K x C)
+ * @return  Class_Matrix<R, C>  A * B
+ */
+template<uint32_t R, uint32_t K, uint32_t C>
+constexpr Class_Matrix<R, C> operator*(const Class_Matrix<R, K> & __A, const Class_Matrix<K, C> & __B)
+{
+    return (Matrix_Multiply_Dispatch<(R * K * C <= MATRIX_UNROLL_MAX)>::Calculate(__A, __B));
+}
+
+/**
+ * @brief   矩阵转置
+ *
+ * @param   __A     矩阵A (R x C)
+ * @return  Class_Matrix<C, R>  A^T
+ */
+template<uint32_t R, uint32_t C>
+constexpr Class_Matrix<C, R> Math_Matrix_Transpose(const Class_Matrix<R, C> & __A)
+{
+    return (Matrix_Transpose(__A, typename Matrix_Make_Index<R * C>::Type()));
+}
+
+/**
+ * @brief   向量点积
+ *
+ * @param   __A     向量A
+ * @param   __B     向量B
+ * @return  float   A . B
+ */
+template<uint32_t N>
+constexpr float Math_Vector_Dot(const Class_Vector<N> & __A, const Class_Vector<N> & __B)
+{
+    return (Matrix_Unroll_Dot<N>::Calculate(Math_Matrix_Transpose(__A), __B, 0U, 0U));
+}
+
+/**
+ * @brief   三维向量叉积
+ *
+ * @param   __A     向量A
+ * @param   __B     向量B
+ * @return  Class_Vector<3>     A x B
+ */
+constexpr Class_Vector<3> Math_Vector_Cross(const Class_Vector<3> & __A, const Class_Vector<3> & __B)
+{
+    return (Class_Vector<3>{{__A[1] * __B[2] - __A[2] * __B[1],
+                             __A[2] * __B[0] - __A[0] * __B[2],
+                             __A[0] * __B[1] - __A[1] * __B[0]}});
+}
+
+/**
+ * @brief   3x3 矩阵行列式
+ *
+ * @param   __A     矩阵A
+ * @return  float   det(A)
+ */
+constexpr float Math_Matrix_Determinant(const Class_Matrix<3, 3> & __A)
+{
+    return (Matrix_Determinant(__A, Matrix_Cofactor(__A)));
+}
+
+/**
+ * @brief   4x4 矩阵行列式
+ *
+ * @param   __A     矩阵A
+ * @return  float   det(A)
+ */
+constexpr float Math_Matrix_Determinant(const Class_Matrix<4, 4> & __A)
+{
+    return (Matrix_Determinant(Matrix_Minor(__A)));
+}
+
+/**
+ * @brief   3x3 矩阵求逆（伴随矩阵法，编译期可求值）
+ *
+ * @param   __A     矩阵A
+ * @return  Class_Matrix<3, 3>  A^-1（奇异时为 inf/NaN，需判断可逆时使用 bool 重载）
+ */
+constexpr Class_Matrix<3, 3> Math_Matrix_Inverse(const Class_Matrix<3, 3> & __A)
+{
+    return (Matrix_Inverse(__A, Matrix_Cofactor(__A)));
+}
+
+/**
+ * @brief   4x4 矩阵求逆（2x2 子式展开，Laplace 展开定理，编译期可求值）
+ *
+ * @param   __A     矩阵A
+ * @return  Class_Matrix<4, 4>  A^-1（奇异时为 inf/NaN，需判断可逆时使用 bool 重载）
+ */
+constexpr Class_Matrix<4, 4> Math_Matrix_Inverse(const Class_Matrix<4, 4> & __A)
+{
+    return (Matrix_Inverse(__A, Matrix_Minor(__A)));
+}
+
+/**
+ * @brief   3x3 矩阵求逆（伴随矩阵法）
+ *
+ * @param   __A     矩阵A
+ * @param   __Out   A^-1（奇异时不修改）
+ * @return  bool    是否可逆
+ */
+inline bool Math_Matrix_Inverse(const Class_Matrix<3, 3> & __A, Class_Matrix<3, 3> * __Out)
+{
+    const Class_Vector<3> cofactor = Matrix_Cofactor(__A);
+    float det = Matrix_Determinant(__A, cofactor);
+
+    if (Math_Abs(det) < FLT_MIN)
+    {
+        return (false);
+    }
+
+    *__Out = Matrix_Inverse(__A, cofactor, 1.0f / det);
+    return (true);
+}
+
+/**
+ * @brief   4x4 矩阵求逆（2x2 子式展开，Laplace 展开定理）
+ *
+ * @param   __A     矩阵A
+ * @param   __Out   A^-1（奇异时不修改）
+ * @return  bool    是否可逆
+ */
+inline bool Math_Matrix_Inverse(const Class_Matrix<4, 4> & __A, Class_Matrix<4, 4> * __Out)
+{
+    const Class_Matrix<2, 6> minor = Matrix_Minor(__A);
+    float det = Matrix_Determinant(minor);
+
+    if (Math_Abs(det) < FLT_MIN)
+    {
+        return (false);
+    }
+
+    *__Out = Matrix_Inverse(__A, minor, 1.0f / det);
+    return (true);
+}
+
+#endif /* MIL_Matrix.h */
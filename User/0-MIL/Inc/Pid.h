@@ -4,7 +4,7 @@
  *
  * @author  Tang-yucheng (QQ: 3143961287)
  * @date    2024-2-14
- * @version v1.0
+ * @version v1.5
  */
 
 #ifndef __MIL_PID_H
@@ -23,11 +23,50 @@ enum Enum_PID_D_First
     PID_D_First_ENABLE,
 };
 
+/* 结构体定义 ----------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   PID功能策略（作为 Class_PID_T 模板参数，未列出的功能在编译期被完全去除，对应参数被忽略）
+ */
+struct PID_Policy_Dead_Zone {};         /*!< 死区 */
+struct PID_Policy_I_Variable_Speed {};  /*!< 变速积分 */
+struct PID_Policy_I_Separate {};        /*!< 积分分离 */
+struct PID_Policy_D_First {};           /*!< 微分先行（由 Init 中 __D_First 选择是否启用） */
+struct PID_Policy_D_Filter {};          /*!< 微分一阶低通滤波（Set_D_Filter 设定滤波系数 N） */
+struct PID_Policy_Setpoint_Weight {};   /*!< 设定值加权（二自由度，Set_Setpoint_Weight 设定 b/c） */
+struct PID_Policy_Back_Calculation {};  /*!< 反算抗积分饱和（Set_K_T 设定跟踪增益，修改 K_I 时积分项输出不跳变） */
+
+/**
+ * @brief   编译期判断策略列表中是否包含某策略
+ */
+template<typename Policy, typename... Policies>
+struct PID_Has_Policy
+{
+    static const bool Value = false;
+};
+
+template<typename Policy, typename... Rest>
+struct PID_Has_Policy<Policy, Policy, Rest...>
+{
+    static const bool Value = true;
+};
+
+template<typename Policy, typename First, typename... Rest>
+struct PID_Has_Policy<Policy, First, Rest...>
+{
+    static const bool Value = PID_Has_Policy<Policy, Rest...>::Value;
+};
+
 /* 类定义 --------------------------------------------------------------------------------------------------------------*/
 /**
- * @brief   PID控制器类
+ * @brief   策略特化PID控制器类
+ *          功能由模板参数在编译期选择，未启用的功能分支在编译期消除；
+ *          1/D_T、I_Out_Max/K_I、K_T*D_T/K_I、1/(I_Variable_Speed_B - I_Variable_Speed_A)、微分滤波系数在 Init/Set_* 中预先计算，
+ *          Calculate中无除法
+ *
+ * @tparam  Policies    启用的功能策略 PID_Policy_xxx
  */
-class Class_PID
+template<typename... Policies>
+class Class_PID_T
 {
 public:
     /* 函数 */
@@ -39,6 +78,7 @@ public:
 
     inline float Get_Integral_Error();
     inline float Get_Out();
+    inline float Get_Out_Max();
     inline void Set_K_P(float __K_P);
     inline void Set_K_I(float __K_I);
     inline void Set_K_D(float __K_D);
@@ -50,13 +90,33 @@ public:
     inline void Set_I_Separate_Threshold(float __I_Separate_Threshold);
     inline void Set_Target(float __Target);
     inline void Set_Actual(float __Actual);
+    inline void Set_Target_Rate(float __Target_Rate);
     inline void Set_Integral_Error(float __Integral_Error);
+    inline void Set_Integral_Hold(bool __Integral_Hold);
+    inline void Set_D_Filter(float __D_Filter_N);
+    inline void Set_Setpoint_Weight(float __Weight_B, float __Weight_C);
+    inline void Set_K_T(float __K_T);
 protected:
+    /* 函数 */
+    inline void Update_Integral_Max();
+    inline void Update_I_Variable_Speed();
+    inline void Update_D_Filter();
+    inline void Update_Back_Calculation();
+
+    /* 常量 */
+    static const bool Dead_Zone_Enable = PID_Has_Policy<PID_Policy_Dead_Zone, Policies...>::Value;
+    static const bool I_Variable_Speed_Enable = PID_Has_Policy<PID_Policy_I_Variable_Speed, Policies...>::Value;
+    static const bool I_Separate_Enable = PID_Has_Policy<PID_Policy_I_Separate, Policies...>::Value;
+    static const bool D_First_Enable = PID_Has_Policy<PID_Policy_D_First, Policies...>::Value;
+    static const bool D_Filter_Enable = PID_Has_Policy<PID_Policy_D_Filter, Policies...>::Value;
+    static const bool Setpoint_Weight_Enable = PID_Has_Policy<PID_Policy_Setpoint_Weight, Policies...>::Value;
+    static const bool Back_Calculation_Enable = PID_Has_Policy<PID_Policy_Back_Calculation, Policies...>::Value;
+
     /* 读变量 */
     float Out = 0.0f;                       /*!< 输出值 */
 
     /* 写变量 */
-    float D_T;                              /*!< PID计时器周期（s） */
+    float D_T = 0.001f;                     /*!< PID计时器周期（s） */
     float K_P = 0.0f;                       /*!< P参数 */
     float K_I = 0.0f;                       /*!< I参数 */
     float K_D = 0.0f;                       /*!< D参数 */
@@ -68,28 +128,286 @@ protected:
     float I_Separate_Threshold = 0.0f;      /*!< 积分分离阈值，需为正数, 0为不限制 */
     float Target = 0.0f;                    /*!< 目标值 */
     float Actual = 0.0f;                    /*!< 实际值 */
-    float Dead_Zone;                        /*!< 死区, Error在其绝对值内不输出 */
-    Enum_PID_D_First D_First;               /*!< 微分先行 */
+    float Target_Rate_D_T = 0.0f;           /*!< 目标值变化率 * D_T（轨迹规划给出，仅作用于下一次计算的前馈） */
+    float Dead_Zone = 0.0f;                 /*!< 死区, Error在其绝对值内不输出 */
+    Enum_PID_D_First D_First =              /*!< 微分先行 */
+                     PID_D_First_DISABLE;
+    float D_Filter_N = 0.0f;                /*!< 微分滤波系数 N (rad/s)，D(s) = K_D * N * s / (s + N), 0为不滤波 */
+    float Weight_B = 1.0f;                  /*!< P项设定值权重 b */
+    float Weight_C = 1.0f;                  /*!< D项设定值权重 c（0 即对实际值微分） */
+    float K_T = 0.0f;                       /*!< 反算抗饱和跟踪增益 (1/s)，0为不反算 */
 
     /* 读写变量 */
     float Integral_Error = 0.0f;            /*!< 积分值 */
 
     /* 内部变量 */
+    float K_D_Div_D_T = 0.0f;               /*!< K_D / D_T */
+    float Integral_Max = 0.0f;              /*!< 积分值限幅 I_Out_Max / K_I, 0为不限制 */
+    float I_Variable_Speed_Inv = 0.0f;      /*!< 1 / (I_Variable_Speed_B - I_Variable_Speed_A) */
+    bool I_Variable_Speed_Active = false;   /*!< 变速积分是否生效 */
     float Pre_Target = 0.0f;                /*!< 之前的目标值 */
     float Pre_Actual = 0.0f;                /*!< 之前的实际值 */
     float Pre_Out = 0.0f;                   /*!< 之前的输出值 */
     float Pre_Error = 0.0f;                 /*!< 前向误差 */
+    float D_Filter_Alpha = 0.0f;            /*!< 微分滤波系数 T_F / (T_F + D_T) */
+    float D_Filter_Gain = 0.0f;             /*!< 微分滤波增益 K_D / (T_F + D_T) */
+    float K_T_D_T_Div_K_I = 0.0f;           /*!< 反算增益 K_T * D_T / K_I（饱和量折算为积分值）, K_I为0时为0 */
+    float Pre_D_Out = 0.0f;                 /*!< 之前的D输出（微分滤波） */
+    float Pre_Error_D = 0.0f;               /*!< 之前的D项加权误差 c * Target - Actual */
+    bool Target_Rate_Valid = false;         /*!< 本次计算是否使用外部目标值变化率前馈 */
+    bool Integral_Hold = false;             /*!< 积分保持（外部抗饱和，如串级内环饱和），为 true 时不累加积分 */
+};
+
+/**
+ * @brief   PID控制器类（全功能，兼容原有接口）
+ */
+class Class_PID : public Class_PID_T<PID_Policy_Dead_Zone, PID_Policy_I_Variable_Speed,
+                                     PID_Policy_I_Separate, PID_Policy_D_First>
+{
+};
+
+/**
+ * @brief   二自由度PID控制器类（微分滤波 + 设定值加权 + 反算抗积分饱和）
+ */
+class Class_PID_2DOF : public Class_PID_T<PID_Policy_D_Filter, PID_Policy_Setpoint_Weight, PID_Policy_Back_Calculation>
+{
 };
 
 /* 函数声明 ------------------------------------------------------------------------------------------------------------*/
+/* 全功能版本、二自由度版本在 Pid.cpp 中显式实例化 */
+extern template class Class_PID_T<PID_Policy_Dead_Zone, PID_Policy_I_Variable_Speed,
+                                  PID_Policy_I_Separate, PID_Policy_D_First>;
+extern template class Class_PID_T<PID_Policy_D_Filter, PID_Policy_Setpoint_Weight, PID_Policy_Back_Calculation>;
 
 /* 接口函数定义 --------------------------------------------------------------------------------------------------------*/
 /**
- * @brief 获取输出值
+ * @brief   PID控制器初始化
  *
- * @return float 输出值
+ * @param   __K_P                   P参数
+ * @param   __K_I                   I参数
+ * @param   __K_D                   D参数
+ * @param   __K_F                   前馈参数
+ * @param   __I_Out_Max             积分限幅
+ * @param   __Out_Max               输出限幅
+ * @param   __D_T                   控制周期
+ * @param   __Dead_Zone             死区（需启用 PID_Policy_Dead_Zone）
+ * @param   __I_Variable_Speed_A    变速积分定速内段阈值（需启用 PID_Policy_I_Variable_Speed）
+ * @param   __I_Variable_Speed_B    变速积分变速区间（需启用 PID_Policy_I_Variable_Speed）
+ * @param   __I_Separate_Threshold  积分分离阈值（需启用 PID_Policy_I_Separate）
+ * @param   __D_First               微分先行（需启用 PID_Policy_D_First）
+ */
+template<typename... Policies>
+void Class_PID_T<Policies...>::Init(float __K_P, float __K_I, float __K_D, float __K_F, float __I_Out_Max, float __Out_Max,
+                                    float __D_T, float __Dead_Zone, float __I_Variable_Speed_A, float __I_Variable_Speed_B,
+                                    float __I_Separate_Threshold, Enum_PID_D_First __D_First)
+{
+    K_P = __K_P;
+    K_I = __K_I;
+    K_D = __K_D;
+    K_F = __K_F;
+    I_Out_Max = __I_Out_Max;
+    Out_Max = __Out_Max;
+    D_T = __D_T;
+    Dead_Zone = __Dead_Zone;
+    I_Variable_Speed_A = __I_Variable_Speed_A;
+    I_Variable_Speed_B = __I_Variable_Speed_B;
+    I_Separate_Threshold = __I_Separate_Threshold;
+    D_First = __D_First;
+
+    /* 预计算 */
+    K_D_Div_D_T = K_D / D_T;
+    Update_Integral_Max();
+    Update_I_Variable_Speed();
+    Update_D_Filter();
+    Update_Back_Calculation();
+}
+
+/**
+ * @brief   PID计算输出值
+ */
+template<typename... Policies>
+void Class_PID_T<Policies...>::Calculate()
+{
+    float p_out = 0.0f;     // P输出
+    float i_out = 0.0f;     // I输出
+    float d_out = 0.0f;     // D输出
+    float f_out = 0.0f;     // F输出（前馈）
+    float error;            //误差
+    float abs_error;        //绝对值误差
+    float speed_ratio;      //线性变速积分
+    float error_d;          //D项误差（设定值加权）
+    float d_diff;           //D项差分
+
+    /* 计算误差 */
+    error = Target - Actual;
+    abs_error = Math_Abs(error);
+
+    /* 判断死区 */
+    if(Dead_Zone_Enable && abs_error < Dead_Zone)
+    {
+        Target = Actual;
+        error = 0.0f;
+        abs_error = 0.0f;
+    }
+
+    /* 计算p项 */
+    if(Setpoint_Weight_Enable)
+    {
+        /* 设定值加权 */
+        p_out = K_P * (Weight_B * Target - Actual);
+    }
+    else
+    {
+        p_out = K_P * error;
+    }
+
+    /* 计算i项 */
+    speed_ratio = 1.0f;
+    if(I_Variable_Speed_Enable && I_Variable_Speed_Active)
+    {
+        /* 变速积分 */
+        if(abs_error >= I_Variable_Speed_B)
+        {
+            speed_ratio = 0.0f;
+        }
+        else if(abs_error > I_Variable_Speed_A)
+        {
+            speed_ratio = (I_Variable_Speed_B - abs_error) * I_Variable_Speed_Inv;
+        }
+    }
+    if(Integral_Hold)
+    {
+        /* 积分保持 */
+        speed_ratio = 0.0f;
+    }
+    if(Integral_Max != 0.0f)
+    {
+        /* 积分限幅（先限幅上一周期积分值再累加，所有策略相同） */
+        Math_Constrain(&Integral_Error, -Integral_Max, Integral_Max);
+    }
+    if(I_Separate_Enable && I_Separate_Threshold != 0.0f && abs_error >= I_Separate_Threshold)
+    {
+        /* 积分分离 */
+        Integral_Error = 0.0f;
+        i_out = 0.0f;
+    }
+    else
+    {
+        Integral_Error += speed_ratio * D_T * error;
+        i_out = K_I * Integral_Error;
+    }
+
+    /* 计算d项 */
+    error_d = Setpoint_Weight_Enable ? (Weight_C * Target - Actual) : error;
+    if(D_First_Enable && D_First == PID_D_First_ENABLE)
+    {
+        /* 微分先行 */
+        d_diff = Out - Pre_Out;
+    }
+    else if(Setpoint_Weight_Enable)
+    {
+        /* 设定值加权 */
+        d_diff = error_d - Pre_Error_D;
+    }
+    else
+    {
+        /* 无微分先行 */
+        d_diff = error - Pre_Error;
+    }
+    if(D_Filter_Enable)
+    {
+        /* 一阶低通滤波（后向差分离散） */
+        d_out = D_Filter_Alpha * Pre_D_Out + D_Filter_Gain * d_diff;
+    }
+    else
+    {
+        d_out = K_D_Div_D_T * d_diff;
+    }
+
+    /* 计算前馈 */
+    if(Target_Rate_Valid)
+    {
+        /* 轨迹规划给出的目标值变化率 */
+        f_out = Target_Rate_D_T * K_F;
+        Target_Rate_Valid = false;
+    }
+    else
+    {
+        f_out = (Target - Pre_Target) * K_F;
+    }
+
+    /* 计算输出 */
+    Out = p_out + i_out + d_out + f_out;
+    /* 输出限幅 */
+    if(Out_Max != 0.0f)
+    {
+        float out_unsat = Out;
+
+        Math_Constrain(&Out, -Out_Max, Out_Max);
+
+        /* 反算抗积分饱和：饱和量按跟踪增益回馈积分 */
+        if(Back_Calculation_Enable)
+        {
+            Integral_Error += K_T_D_T_Div_K_I * (Out - out_unsat);
+        }
+    }
+
+    /* 数据记录 */
+    Pre_Actual = Actual;
+    Pre_Target = Target;
+    Pre_Out = Out;
+    Pre_Error = error;
+    Pre_Error_D = error_d;
+    Pre_D_Out = d_out;
+}
+
+/**
+ * @brief 更新积分值限幅 (I_Out_Max / K_I)
+ */
+template<typename... Policies>
+void Class_PID_T<Policies...>::Update_Integral_Max()
+{
+    Integral_Max = (I_Out_Max != 0.0f && K_I != 0.0f) ? Math_Abs(I_Out_Max / K_I) : 0.0f;
+}
+
+/**
+ * @brief 更新变速积分参数 1 / (I_Variable_Speed_B - I_Variable_Speed_A)
+ */
+template<typename... Policies>
+void Class_PID_T<Policies...>::Update_I_Variable_Speed()
+{
+    I_Variable_Speed_Active = !(I_Variable_Speed_A == 0.0f && I_Variable_Speed_B == 0.0f);
+    I_Variable_Speed_Inv = (I_Variable_Speed_B > I_Variable_Speed_A) ? 1.0f / (I_Variable_Speed_B - I_Variable_Speed_A) : 0.0f;
+}
+
+/**
+ * @brief 更新微分滤波参数 T_F / (T_F + D_T)、K_D / (T_F + D_T)（T_F = 1 / N）
+ */
+template<typename... Policies>
+void Class_PID_T<Policies...>::Update_D_Filter()
+{
+    float t_f = (D_Filter_N > 0.0f) ? 1.0f / D_Filter_N : 0.0f;
+
+    D_Filter_Alpha = t_f / (t_f + D_T);
+    D_Filter_Gain = K_D / (t_f + D_T);
+}
+
+/**
+ * @brief 更新反算增益 K_T * D_T / K_I
+ */
+template<typename... Policies>
+void Class_PID_T<Policies...>::Update_Back_Calculation()
+{
+    K_T_D_T_Div_K_I = (K_I != 0.0f) ? K_T * D_T / K_I : 0.0f;
+}
+
+/**
+ * @brief 获取积分值
+ *
+ * @return float 积分值
  */
-float Class_PID::Get_Integral_Error()
+template<typename... Policies>
+float Class_PID_T<Policies...>::Get_Integral_Error()
 {
     return (Integral_Error);
 }
@@ -99,29 +417,49 @@ float Class_PID::Get_Integral_Error()
  *
  * @return float 输出值
  */
-float Class_PID::Get_Out()
+template<typename... Policies>
+float Class_PID_T<Policies...>::Get_Out()
 {
     return (Out);
 }
 
+/**
+ * @brief 获取输出限幅
+ *
+ * @return float 输出限幅, 0为不限制
+ */
+template<typename... Policies>
+float Class_PID_T<Policies...>::Get_Out_Max()
+{
+    return (Out_Max);
+}
+
 /**
  * @brief 设定PID的P
  *
  * @param __K_P PID的P
  */
-void Class_PID::Set_K_P(float __K_P)
+template<typename... Policies>
+void Class_PID_T<Policies...>::Set_K_P(float __K_P)
 {
     K_P = __K_P;
 }
 
 /**
- * @brief 设定PID的I
+ * @brief 设定PID的I（PID_Policy_Back_Calculation 下新旧K_I均非0时按比例折算积分值，积分项输出不跳变，用于增益调度）
  *
  * @param __K_I PID的I
  */
-void Class_PID::Set_K_I(float __K_I)
+template<typename... Policies>
+void Class_PID_T<Policies...>::Set_K_I(float __K_I)
 {
+    if(Back_Calculation_Enable && K_I != 0.0f && __K_I != 0.0f)
+    {
+        Integral_Error *= K_I / __K_I;
+    }
     K_I = __K_I;
+    Update_Integral_Max();
+    Update_Back_Calculation();
 }
 
 /**
@@ -129,9 +467,12 @@ void Class_PID::Set_K_I(float __K_I)
  *
  * @param __K_D PID的D
  */
-void Class_PID::Set_K_D(float __K_D)
+template<typename... Policies>
+void Class_PID_T<Policies...>::Set_K_D(float __K_D)
 {
     K_D = __K_D;
+    K_D_Div_D_T = K_D / D_T;
+    Update_D_Filter();
 }
 
 /**
@@ -139,7 +480,8 @@ void Class_PID::Set_K_D(float __K_D)
  *
  * @param __K_D 前馈
  */
-void Class_PID::Set_K_F(float __K_F)
+template<typename... Policies>
+void Class_PID_T<Policies...>::Set_K_F(float __K_F)
 {
     K_F = __K_F;
 }
@@ -149,9 +491,11 @@ void Class_PID::Set_K_F(float __K_F)
  *
  * @param __I_Out_Max 积分限幅, 0为不限制
  */
-void Class_PID::Set_I_Out_Max(float __I_Out_Max)
+template<typename... Policies>
+void Class_PID_T<Policies...>::Set_I_Out_Max(float __I_Out_Max)
 {
     I_Out_Max = __I_Out_Max;
+    Update_Integral_Max();
 }
 
 /**
@@ -159,7 +503,8 @@ void Class_PID::Set_I_Out_Max(float __I_Out_Max)
  *
  * @param __Out_Max 输出限幅, 0为不限制
  */
-void Class_PID::Set_Out_Max(float __Out_Max)
+template<typename... Policies>
+void Class_PID_T<Policies...>::Set_Out_Max(float __Out_Max)
 {
     Out_Max = __Out_Max;
 }
@@ -169,9 +514,11 @@ void Class_PID::Set_Out_Max(float __Out_Max)
  *
  * @param __I_Variable_Speed_A 定速内段阈值, 0为不限制
  */
-void Class_PID::Set_I_Variable_Speed_A(float __I_Variable_Speed_A)
+template<typename... Policies>
+void Class_PID_T<Policies...>::Set_I_Variable_Speed_A(float __I_Variable_Speed_A)
 {
     I_Variable_Speed_A = __I_Variable_Speed_A;
+    Update_I_Variable_Speed();
 }
 
 /**
@@ -179,9 +526,11 @@ void Class_PID::Set_I_Variable_Speed_A(float __I_Variable_Speed_A)
  *
  * @param __I_Variable_Speed_B 变速区间, 0为不限制
  */
-void Class_PID::Set_I_Variable_Speed_B(float __I_Variable_Speed_B)
+template<typename... Policies>
+void Class_PID_T<Policies...>::Set_I_Variable_Speed_B(float __I_Variable_Speed_B)
 {
     I_Variable_Speed_B = __I_Variable_Speed_B;
+    Update_I_Variable_Speed();
 }
 
 /**
@@ -189,7 +538,8 @@ void Class_PID::Set_I_Variable_Speed_B(float __I_Variable_Speed_B)
  *
  * @param __I_Separate_Threshold 积分分离阈值，需为正数, 0为不限制
  */
-void Class_PID::Set_I_Separate_Threshold(float __I_Separate_Threshold)
+template<typename... Policies>
+void Class_PID_T<Policies...>::Set_I_Separate_Threshold(float __I_Separate_Threshold)
 {
     I_Separate_Threshold = __I_Separate_Threshold;
 }
@@ -199,7 +549,8 @@ void Class_PID::Set_I_Separate_Threshold(float __I_Separate_Threshold)
  *
  * @param __Target 目标值
  */
-void Class_PID::Set_Target(float __Target)
+template<typename... Policies>
+void Class_PID_T<Policies...>::Set_Target(float __Target)
 {
     Target = __Target;
 }
@@ -209,19 +560,82 @@ void Class_PID::Set_Target(float __Target)
  *
  * @param __Now 当前值
  */
-void Class_PID::Set_Actual(float __Actual)
+template<typename... Policies>
+void Class_PID_T<Policies...>::Set_Actual(float __Actual)
 {
     Actual = __Actual;
 }
 
+/**
+ * @brief 设定目标值变化率（仅作用于下一次 Calculate 的前馈，此时前馈为 K_F * 变化率 * D_T，
+ *        与未设定时的 K_F * 目标值单周期差分含义相同，K_F 单位均为 输出 / (目标值/周期)，启用S曲线无需重新整定）
+ *
+ * @param __Target_Rate 目标值变化率（如S曲线规划的加速度）
+ */
+template<typename... Policies>
+void Class_PID_T<Policies...>::Set_Target_Rate(float __Target_Rate)
+{
+    Target_Rate_D_T = __Target_Rate * D_T;
+    Target_Rate_Valid = true;
+}
+
 /**
  * @brief 设定积分, 一般用于积分清零
  *
  * @param __Set_Integral_Error 积分值
  */
-void Class_PID::Set_Integral_Error(float __Integral_Error)
+template<typename... Policies>
+void Class_PID_T<Policies...>::Set_Integral_Error(float __Integral_Error)
 {
     Integral_Error = __Integral_Error;
 }
 
+/**
+ * @brief 设定积分保持，保持期间 Calculate 不累加积分（积分限幅、积分分离、反算抗饱和仍生效）
+ *
+ * @param __Integral_Hold 是否保持积分
+ */
+template<typename... Policies>
+void Class_PID_T<Policies...>::Set_Integral_Hold(bool __Integral_Hold)
+{
+    Integral_Hold = __Integral_Hold;
+}
+
+/**
+ * @brief 设定微分滤波系数（需启用 PID_Policy_D_Filter）
+ *
+ * @param __D_Filter_N 滤波系数 N (rad/s)，即微分滤波截止角频率, 0为不滤波
+ */
+template<typename... Policies>
+void Class_PID_T<Policies...>::Set_D_Filter(float __D_Filter_N)
+{
+    D_Filter_N = __D_Filter_N;
+    Update_D_Filter();
+}
+
+/**
+ * @brief 设定设定值权重（需启用 PID_Policy_Setpoint_Weight）
+ *
+ * @param __Weight_B P项设定值权重 b（减小可抑制设定值阶跃超调）
+ * @param __Weight_C D项设定值权重 c（0 即对实际值微分，设定值阶跃无微分冲击）
+ */
+template<typename... Policies>
+void Class_PID_T<Policies...>::Set_Setpoint_Weight(float __Weight_B, float __Weight_C)
+{
+    Weight_B = __Weight_B;
+    Weight_C = __Weight_C;
+}
+
+/**
+ * @brief 设定反算抗饱和跟踪增益（需启用 PID_Policy_Back_Calculation）
+ *
+ * @param __K_T 跟踪增益 (1/s)，常取 1/T_T，T_T 介于 sqrt(T_I * T_D) 与 T_I 之间, 0为不反算
+ */
+template<typename... Policies>
+void Class_PID_T<Policies...>::Set_K_T(float __K_T)
+{
+    K_T = __K_T;
+    Update_Back_Calculation();
+}
+
 #endif /* MIL_Pid.h */
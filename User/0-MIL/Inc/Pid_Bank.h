@@ -0,0 +1,319 @@
+/**
+ * @file    Pid_Bank.h
+ * @brief   PID控制器组（多路同构PID向量化计算）
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.1
+ */
+
+#ifndef __MIL_PID_BANK_H
+#define __MIL_PID_BANK_H
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "User_Math.h"
+
+/* 类定义 --------------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   PID控制器组类
+ *          参数、积分、前向误差按数组存储（结构体数组化），Calculate中调用CMSIS-DSP向量函数一次完成N路计算
+ *          仅包含 P/I/D/前馈 + 积分限幅 + 输出限幅，死区、变速积分、积分分离、微分先行请使用Class_PID
+ *          积分按误差单位保存，先限幅上一周期积分值再累加（与 Class_PID 相同，相同输入下各路输出与 Class_PID 逐位一致），
+ *          积分值限幅 I_Out_Max / K_I 在参数修改时预先计算
+ *
+ * @tparam  N   控制器路数
+ */
+template<uint32_t N>
+class Class_PID_Bank
+{
+public:
+    /* 函数 */
+    void Init(float __K_P, float __K_I, float __K_D, float __K_F = 0.0f, float __I_Out_Max = 0.0f,
+              float __Out_Max = 0.0f, float __D_T = 0.001f);
+    void Calculate();
+    void Reset(uint32_t Index);
+
+    inline float Get_Out(uint32_t Index);
+    inline float Get_Integral_Error(uint32_t Index);
+    inline void Set_K_P(uint32_t Index, float __K_P);
+    inline void Set_K_I(uint32_t Index, float __K_I);
+    inline void Set_K_D(uint32_t Index, float __K_D);
+    inline void Set_K_F(uint32_t Index, float __K_F);
+    inline void Set_I_Out_Max(float __I_Out_Max);
+    inline void Set_Out_Max(float __Out_Max);
+    inline void Set_Target(uint32_t Index, float __Target);
+    inline void Set_Actual(uint32_t Index, float __Actual);
+    inline void Set_Integral_Error(uint32_t Index, float __Integral_Error);
+protected:
+    /* 函数 */
+    inline void Update_Integral_Max(uint32_t Index);
+
+    /* 写变量 */
+    float D_T = 0.001f;                     /*!< PID计时器周期（s） */
+    float I_Out_Max = 0.0f;                 /*!< 积分输出限幅（各路共用）, 0为不限制 */
+    float Out_Max = 0.0f;                   /*!< 输出限幅（各路共用）, 0为不限制 */
+    float K_P[N];                           /*!< P参数 */
+    float K_I[N];                           /*!< I参数 */
+    float K_D[N];                           /*!< D参数 */
+    float K_F[N];                           /*!< 前馈参数 */
+    float Target[N];                        /*!< 目标值 */
+    float Actual[N];                        /*!< 实际值 */
+
+    /* 读变量 */
+    float Out[N];                           /*!< 输出值 */
+
+    /* 内部变量 */
+    float K_D_Div_D_T[N];                   /*!< K_D / D_T（参数修改时更新） */
+    float Integral_Max[N];                  /*!< 积分值限幅 I_Out_Max / K_I（参数修改时更新）, 0为不限制 */
+    float Integral_Error[N];                /*!< 积分值 */
+    float Pre_Target[N];                    /*!< 之前的目标值 */
+    float Pre_Error[N];                     /*!< 前向误差 */
+};
+
+/* 接口函数定义 --------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   PID控制器组初始化（各路参数相同，可再用Set_K_x单独修改）
+ *
+ * @param   __K_P       P参数
+ * @param   __K_I       I参数
+ * @param   __K_D       D参数
+ * @param   __K_F       前馈参数
+ * @param   __I_Out_Max 积分输出限幅, 0为不限制
+ * @param   __Out_Max   输出限幅, 0为不限制
+ * @param   __D_T       控制周期 (s)
+ */
+template<uint32_t N>
+void Class_PID_Bank<N>::Init(float __K_P, float __K_I, float __K_D, float __K_F, float __I_Out_Max,
+                             float __Out_Max, float __D_T)
+{
+    this->D_T = __D_T;
+    this->I_Out_Max = __I_Out_Max;
+    this->Out_Max = __Out_Max;
+
+    for (uint32_t i = 0; i < N; i++)
+    {
+        this->K_P[i] = __K_P;
+        this->K_I[i] = __K_I;
+        this->K_D[i] = __K_D;
+        this->K_F[i] = __K_F;
+        this->K_D_Div_D_T[i] = __K_D / __D_T;
+        this->Update_Integral_Max(i);
+        this->Reset(i);
+    }
+}
+
+/**
+ * @brief   PID控制器组计算输出值（N路一次计算）
+ */
+template<uint32_t N>
+void Class_PID_Bank<N>::Calculate()
+{
+    float error[N];     // 误差
+    float temp[N];      // 中间结果
+
+    /* 计算误差 */
+    arm_sub_f32(this->Target, this->Actual, error, N);
+
+    /* 计算p项 */
+    arm_mult_f32(this->K_P, error, this->Out, N);
+
+    /* 计算i项（各路积分值限幅不同，逐路限幅后再累加） */
+    for (uint32_t i = 0; i < N; i++)
+    {
+        if (this->Integral_Max[i] != 0.0f)
+        {
+            Math_Constrain(&this->Integral_Error[i], -this->Integral_Max[i], this->Integral_Max[i]);
+        }
+    }
+    arm_scale_f32(error, this->D_T, temp, N);
+    arm_add_f32(this->Integral_Error, temp, this->Integral_Error, N);
+    arm_mult_f32(this->K_I, this->Integral_Error, temp, N);
+    arm_add_f32(this->Out, temp, this->Out, N);
+
+    /* 计算d项 */
+    arm_sub_f32(error, this->Pre_Error, temp, N);
+    arm_mult_f32(this->K_D_Div_D_T, temp, temp, N);
+    arm_add_f32(this->Out, temp, this->Out, N);
+
+    /* 计算前馈 */
+    arm_sub_f32(this->Target, this->Pre_Target, temp, N);
+    arm_mult_f32(this->K_F, temp, temp, N);
+    arm_add_f32(this->Out, temp, this->Out, N);
+
+    /* 输出限幅 */
+    if (this->Out_Max != 0.0f)
+    {
+        arm_clip_f32(this->Out, this->Out, -this->Out_Max, this->Out_Max, N);
+    }
+
+    /* 数据记录 */
+    memcpy(this->Pre_Target, this->Target, sizeof(this->Target));
+    memcpy(this->Pre_Error, error, sizeof(error));
+}
+
+/**
+ * @brief   单路状态清零（目标值、实际值、积分、前向误差、之前的目标值、输出），该路离开控制器组时调用，
+ *          再次加入时与新初始化的 Class_PID 相同，无微分、前馈冲击
+ *
+ * @param   Index   控制器序号
+ */
+template<uint32_t N>
+void Class_PID_Bank<N>::Reset(uint32_t Index)
+{
+    this->Target[Index] = 0.0f;
+    this->Actual[Index] = 0.0f;
+    this->Out[Index] = 0.0f;
+    this->Integral_Error[Index] = 0.0f;
+    this->Pre_Target[Index] = 0.0f;
+    this->Pre_Error[Index] = 0.0f;
+}
+
+/**
+ * @brief   更新单路积分值限幅 I_Out_Max / K_I
+ *
+ * @param   Index   控制器序号
+ */
+template<uint32_t N>
+void Class_PID_Bank<N>::Update_Integral_Max(uint32_t Index)
+{
+    this->Integral_Max[Index] = (this->I_Out_Max != 0.0f && this->K_I[Index] != 0.0f) ?
+                                Math_Abs(this->I_Out_Max / this->K_I[Index]) : 0.0f;
+}
+
+/**
+ * @brief   获取输出值
+ *
+ * @param   Index   控制器序号
+ * @return  float   输出值
+ */
+template<uint32_t N>
+float Class_PID_Bank<N>::Get_Out(uint32_t Index)
+{
+    return (this->Out[Index]);
+}
+
+/**
+ * @brief   获取积分值
+ *
+ * @param   Index   控制器序号
+ * @return  float   积分值
+ */
+template<uint32_t N>
+float Class_PID_Bank<N>::Get_Integral_Error(uint32_t Index)
+{
+    return (this->Integral_Error[Index]);
+}
+
+/**
+ * @brief   设定单路PID的P
+ *
+ * @param   Index   控制器序号
+ * @param   __K_P   PID的P
+ */
+template<uint32_t N>
+void Class_PID_Bank<N>::Set_K_P(uint32_t Index, float __K_P)
+{
+    this->K_P[Index] = __K_P;
+}
+
+/**
+ * @brief   设定单路PID的I（积分值不变，积分项输出随K_I缩放，与 Class_PID 相同）
+ *
+ * @param   Index   控制器序号
+ * @param   __K_I   PID的I
+ */
+template<uint32_t N>
+void Class_PID_Bank<N>::Set_K_I(uint32_t Index, float __K_I)
+{
+    this->K_I[Index] = __K_I;
+    this->Update_Integral_Max(Index);
+}
+
+/**
+ * @brief   设定单路PID的D
+ *
+ * @param   Index   控制器序号
+ * @param   __K_D   PID的D
+ */
+template<uint32_t N>
+void Class_PID_Bank<N>::Set_K_D(uint32_t Index, float __K_D)
+{
+    this->K_D[Index] = __K_D;
+    this->K_D_Div_D_T[Index] = __K_D / this->D_T;
+}
+
+/**
+ * @brief   设定单路前馈
+ *
+ * @param   Index   控制器序号
+ * @param   __K_F   前馈
+ */
+template<uint32_t N>
+void Class_PID_Bank<N>::Set_K_F(uint32_t Index, float __K_F)
+{
+    this->K_F[Index] = __K_F;
+}
+
+/**
+ * @brief   设定积分输出限幅, 0为不限制
+ *
+ * @param   __I_Out_Max 积分输出限幅, 0为不限制
+ */
+template<uint32_t N>
+void Class_PID_Bank<N>::Set_I_Out_Max(float __I_Out_Max)
+{
+    this->I_Out_Max = __I_Out_Max;
+    for (uint32_t i = 0; i < N; i++)
+    {
+        this->Update_Integral_Max(i);
+    }
+}
+
+/**
+ * @brief   设定输出限幅, 0为不限制
+ *
+ * @param   __Out_Max   输出限幅, 0为不限制
+ */
+template<uint32_t N>
+void Class_PID_Bank<N>::Set_Out_Max(float __Out_Max)
+{
+    this->Out_Max = __Out_Max;
+}
+
+/**
+ * @brief   设定单路目标值
+ *
+ * @param   Index       控制器序号
+ * @param   __Target    目标值
+ */
+template<uint32_t N>
+void Class_PID_Bank<N>::Set_Target(uint32_t Index, float __Target)
+{
+    this->Target[Index] = __Target;
+}
+
+/**
+ * @brief   设定单路当前值
+ *
+ * @param   Index       控制器序号
+ * @param   __Actual    当前值
+ */
+template<uint32_t N>
+void Class_PID_Bank<N>::Set_Actual(uint32_t Index, float __Actual)
+{
+    this->Actual[Index] = __Actual;
+}
+
+/**
+ * @brief   设定单路积分, 一般用于积分清零
+ *
+ * @param   Index               控制器序号
+ * @param   __Integral_Error    积分值
+ */
+template<uint32_t N>
+void Class_PID_Bank<N>::Set_Integral_Error(uint32_t Index, float __Integral_Error)
+{
+    this->Integral_Error[Index] = __Integral_Error;
+}
+
+#endif /* MIL_Pid_Bank.h */
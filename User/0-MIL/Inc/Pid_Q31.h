@@ -0,0 +1,176 @@
+/**
+ * @file    Pid_Q31.h
+ * @brief   定点PID算法（Q31，基于CMSIS-DSP arm_pid_q31）
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.1
+ */
+
+#ifndef __MIL_PID_Q31_H
+#define __MIL_PID_Q31_H
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "User_Math.h"
+
+/* 类定义 --------------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   Q31定标类（实际值/整型原始值 <-> Q31，满量程 Full_Scale 对应 Q31 的 1.0）
+ *          换算系数在 Init 中预先计算，换算过程无除法；整型换算全程定点
+ */
+class Class_Q31_Scale
+{
+public:
+    /* 函数 */
+    void Init(float __Full_Scale);
+
+    inline q31_t To_Q31(float __Value);
+    inline float To_Float(q31_t __Value);
+    inline q31_t Raw_To_Q31(int32_t __Raw);
+    inline int32_t Q31_To_Raw(q31_t __Value);
+    inline float Get_Full_Scale();
+protected:
+    /* 常量 */
+    float Full_Scale = 1.0f;                /*!< 满量程（Q31 的 1.0 对应的实际值） */
+    float Float_To_Q31 = 2147483648.0f;     /*!< 2^31 / Full_Scale */
+    float Q31_To_Float = 1.0f / 2147483648.0f;  /*!< Full_Scale / 2^31 */
+    q63_t Raw_Gain = 2147483648LL;          /*!< round(2^31 / Full_Scale)（整型 -> Q31） */
+    int32_t Full_Scale_Q8 = 256;            /*!< round(Full_Scale * 2^8)（Q31 -> 整型） */
+};
+
+/**
+ * @brief   Q31定点PID控制器类
+ *          基于 arm_pid_q31 增量式计算，每周期运算量固定；保留 Class_PID 的积分限幅与输出限幅行为：
+ *          由增量式状态反推积分项 (I = y - P - D) 并限幅，状态中保存输出限幅前的值，输出限幅不影响积分
+ *          定标：目标值、实际值满量程为 __Error_Max，输出满量程取 4 * max(Out_Max, I_Out_Max)；
+ *          若增益过大导致 |A0|+|A1|+|A2| > 0.7，则误差按 Error_Gain * 2^Error_Shift 放大（饱和）后再参与计算，
+ *          保证中间结果不溢出（误差饱和阈值约为 1.4 * Out_Max / K_P，即P项已饱和的范围）
+ *          与 Class_PID 的差异：不含前馈、死区、变速积分、积分分离、微分先行；积分限幅在累加后进行；
+ *          I_Out_Max 为 0 时积分项限幅为 Out_Max（定点需有界）
+ *          精度：与相同算式的浮点实现（积分累加后限幅，积分限幅、误差饱和取相同值）输出偏差不超过
+ *          2e-5 * Out_Max；积分长期不饱和且无闭环反馈时，截断误差每周期至多累积 1 LSB (4 * Out_Max / 2^31)
+ *          （见 Host/Tests/Pid_Q31_Test.cpp）
+ */
+class Class_PID_Q31
+{
+public:
+    /* 变量 */
+    Class_Q31_Scale Scale_Error;            /*!< 误差（目标值、实际值）定标 */
+    Class_Q31_Scale Scale_Out;              /*!< 输出定标 */
+
+    /* 函数 */
+    float Init(float __K_P, float __K_I, float __K_D, float __I_Out_Max, float __Out_Max, float __Error_Max,
+               float __D_T = 0.001f);
+    void Calculate();
+    void Reset();
+
+    inline q31_t Get_Out();
+    inline void Set_Target(q31_t __Target);
+    inline void Set_Actual(q31_t __Actual);
+protected:
+    /* 读变量 */
+    q31_t Out = 0;                          /*!< 输出值 */
+
+    /* 写变量 */
+    q31_t Target = 0;                       /*!< 目标值 */
+    q31_t Actual = 0;                       /*!< 实际值 */
+
+    /* 内部变量 */
+    arm_pid_instance_q31 PID_Instance;      /*!< CMSIS-DSP PID实例（Kp = K_P, Ki = K_I * D_T, Kd = K_D / D_T, 已定标） */
+    q31_t I_Out_Max_Q31 = 0;                /*!< 积分项限幅（Q31） */
+    q31_t Out_Max_Q31 = 0;                  /*!< 输出限幅（Q31） */
+    q31_t Error_Gain = 0x40000000;          /*!< 误差放大系数尾数（[0.5, 1)） */
+    uint32_t Error_Shift = 1;               /*!< 误差放大系数指数 */
+};
+
+/* 接口函数定义 --------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   实际值换算为Q31（饱和）
+ *
+ * @param   __Value     实际值
+ * @return  q31_t       Q31值
+ */
+q31_t Class_Q31_Scale::To_Q31(float __Value)
+{
+    float tmp = __Value * this->Float_To_Q31;
+
+    /* 2147483520.0f 为小于 2^31 的最大单精度浮点数 */
+    Math_Constrain(&tmp, -2147483648.0f, 2147483520.0f);
+
+    return ((q31_t)tmp);
+}
+
+/**
+ * @brief   Q31换算为实际值
+ *
+ * @param   __Value     Q31值
+ * @return  float       实际值
+ */
+float Class_Q31_Scale::To_Float(q31_t __Value)
+{
+    return ((float)__Value * this->Q31_To_Float);
+}
+
+/**
+ * @brief   整型原始值换算为Q31（饱和，纯定点）
+ *
+ * @param   __Raw       整型原始值（如编码器计数、电调转速反馈）
+ * @return  q31_t       Q31值
+ */
+q31_t Class_Q31_Scale::Raw_To_Q31(int32_t __Raw)
+{
+    return (clip_q63_to_q31((q63_t)__Raw * this->Raw_Gain));
+}
+
+/**
+ * @brief   Q31换算为整型原始值（纯定点，向负无穷取整）
+ *
+ * @param   __Value     Q31值
+ * @return  int32_t     整型原始值（如PWM比较值、电调电流指令）
+ */
+int32_t Class_Q31_Scale::Q31_To_Raw(q31_t __Value)
+{
+    return ((int32_t)(((q63_t)__Value * this->Full_Scale_Q8) >> 39));
+}
+
+/**
+ * @brief   获取满量程
+ *
+ * @return  float   满量程（Q31 的 1.0 对应的实际值）
+ */
+float Class_Q31_Scale::Get_Full_Scale()
+{
+    return (this->Full_Scale);
+}
+
+/**
+ * @brief   获取输出值
+ *
+ * @return  q31_t   输出值（按 Scale_Out 定标）
+ */
+q31_t Class_PID_Q31::Get_Out()
+{
+    return (this->Out);
+}
+
+/**
+ * @brief   设定目标值
+ *
+ * @param   __Target    目标值（按 Scale_Error 定标）
+ */
+void Class_PID_Q31::Set_Target(q31_t __Target)
+{
+    this->Target = __Target;
+}
+
+/**
+ * @brief   设定当前值
+ *
+ * @param   __Actual    当前值（按 Scale_Error 定标）
+ */
+void Class_PID_Q31::Set_Actual(q31_t __Actual)
+{
+    this->Actual = __Actual;
+}
+
+#endif /* MIL_Pid_Q31.h */
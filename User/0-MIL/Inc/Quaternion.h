@@ -0,0 +1,215 @@
+/**
+ * @file    Quaternion.h
+ * @brief   四元数与旋转矩阵运算库（基于 CMSIS-DSP QuaternionMathFunctions）
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+#ifndef __MIL_QUATERNION_H
+#define __MIL_QUATERNION_H
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "Math_Fast.h"
+#include "Matrix.h"
+
+/* 宏定义 --------------------------------------------------------------------------------------------------------------*/
+#define QUATERNION_SMALL_ANGLE  0.05f   /* 指数映射半转角小于该值 (rad) 时用四阶泰勒展开（截断误差 < 1e-10） */
+
+/* 类定义 --------------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   四元数类（w, x, y, z，标量在前，与 CMSIS-DSP 存储一致，数组可直接传入批量函数）
+ *          聚合类型，可用 {{w, x, y, z}} 初始化；表示姿态时为 机体系 -> 参考系 的旋转
+ */
+class Class_Quaternion
+{
+public:
+    /* 变量 */
+    float Data[4];                          /*!< 四元数元素 (w, x, y, z) */
+
+    /* 函数 */
+    inline float & operator[](uint32_t __Index);
+    constexpr float operator[](uint32_t __Index) const;
+};
+
+/**
+ * @brief   三维旋转矩阵类（行优先，与 CMSIS-DSP 存储一致）
+ *          与一般 3x3 矩阵区分类型，仅能由四元数转换、复合或求逆得到（求逆即转置）
+ */
+class Class_Rotation
+{
+public:
+    /* 变量 */
+    Class_Matrix<3, 3> Matrix;              /*!< 旋转矩阵 */
+};
+
+/* 函数声明 ------------------------------------------------------------------------------------------------------------*/
+void Math_Quaternion_To_Euler(const Class_Quaternion & __Q, float * __Roll, float * __Pitch, float * __Yaw);
+Class_Quaternion Math_Quaternion_Integrate(const Class_Quaternion & __Q, const Class_Vector<3> & __Omega, float __D_T);
+Class_Vector<3> Math_Quaternion_Rotate(const Class_Quaternion & __Q, const Class_Vector<3> & __V);
+
+/* 接口函数定义 --------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   访问元素
+ *
+ * @param   __Index     下标 (0 w, 1 x, 2 y, 3 z)
+ * @return  float &     元素引用
+ */
+float & Class_Quaternion::operator[](uint32_t __Index)
+{
+    return (this->Data[__Index]);
+}
+
+/**
+ * @brief   访问元素（只读）
+ *
+ * @param   __Index     下标 (0 w, 1 x, 2 y, 3 z)
+ * @return  float       元素
+ */
+constexpr float Class_Quaternion::operator[](uint32_t __Index) const
+{
+    return (this->Data[__Index]);
+}
+
+/**
+ * @brief   单位四元数
+ *
+ * @return  Class_Quaternion    (1, 0, 0, 0)
+ */
+constexpr Class_Quaternion Math_Quaternion_Identity()
+{
+    return (Class_Quaternion{{1.0f, 0.0f, 0.0f, 0.0f}});
+}
+
+/**
+ * @brief   共轭四元数（单位四元数的逆）
+ *
+ * @param   __Q     四元数
+ * @return  Class_Quaternion    q*
+ */
+constexpr Class_Quaternion Math_Quaternion_Conjugate(const Class_Quaternion & __Q)
+{
+    return (Class_Quaternion{{__Q[0], -__Q[1], -__Q[2], -__Q[3]}});
+}
+
+/**
+ * @brief   四元数乘法（arm_quaternion_product_single_f32）
+ *
+ * @param   __A     四元数A
+ * @param   __B     四元数B
+ * @return  Class_Quaternion    A ⊗ B（先 B 后 A 的旋转）
+ */
+inline Class_Quaternion operator*(const Class_Quaternion & __A, const Class_Quaternion & __B)
+{
+    Class_Quaternion out;
+
+    arm_quaternion_product_single_f32(__A.Data, __B.Data, out.Data);
+    return (out);
+}
+
+/**
+ * @brief   四元数批量乘法（arm_quaternion_product_f32）
+ *
+ * @param   __A     四元数数组A
+ * @param   __B     四元数数组B
+ * @param   __Out   结果数组 A[i] ⊗ B[i]
+ * @param   __N     数量
+ */
+inline void Math_Quaternion_Product(const Class_Quaternion * __A, const Class_Quaternion * __B, Class_Quaternion * __Out,
+                                    uint32_t __N)
+{
+    arm_quaternion_product_f32(__A[0].Data, __B[0].Data, __Out[0].Data, __N);
+}
+
+/**
+ * @brief   四元数批量归一化（arm_quaternion_normalize_f32，可原地）
+ *
+ * @param   __Q     四元数数组（原地归一化）
+ * @param   __N     数量
+ */
+inline void Math_Quaternion_Normalize(Class_Quaternion * __Q, uint32_t __N)
+{
+    static_assert(sizeof(Class_Quaternion) == 4U * sizeof(float), "Class_Quaternion must be 4 packed floats");
+
+    arm_quaternion_normalize_f32(__Q[0].Data, __Q[0].Data, __N);
+}
+
+/**
+ * @brief   四元数归一化
+ *
+ * @param   __Q     四元数
+ * @return  Class_Quaternion    q / |q|
+ */
+inline Class_Quaternion Math_Quaternion_Normalize(const Class_Quaternion & __Q)
+{
+    Class_Quaternion out = __Q;
+
+    Math_Quaternion_Normalize(&out, 1U);
+    return (out);
+}
+
+/**
+ * @brief   四元数转旋转矩阵（arm_quaternion2rotation_f32，需为单位四元数）
+ *
+ * @param   __Q     单位四元数
+ * @return  Class_Rotation  旋转矩阵
+ */
+inline Class_Rotation Math_Quaternion_To_Rotation(const Class_Quaternion & __Q)
+{
+    Class_Rotation out;
+
+    arm_quaternion2rotation_f32(__Q.Data, &out.Matrix.Data[0][0], 1U);
+    return (out);
+}
+
+/**
+ * @brief   旋转矩阵转四元数（arm_rotation2quaternion_f32）
+ *
+ * @param   __R     旋转矩阵
+ * @return  Class_Quaternion    单位四元数
+ */
+inline Class_Quaternion Math_Rotation_To_Quaternion(const Class_Rotation & __R)
+{
+    Class_Quaternion out;
+
+    arm_rotation2quaternion_f32(&__R.Matrix.Data[0][0], out.Data, 1U);
+    return (out);
+}
+
+/**
+ * @brief   旋转复合
+ *
+ * @param   __A     旋转A
+ * @param   __B     旋转B
+ * @return  Class_Rotation  A B（先 B 后 A）
+ */
+inline Class_Rotation operator*(const Class_Rotation & __A, const Class_Rotation & __B)
+{
+    return (Class_Rotation{__A.Matrix * __B.Matrix});
+}
+
+/**
+ * @brief   旋转向量
+ *
+ * @param   __R     旋转
+ * @param   __V     向量
+ * @return  Class_Vector<3>     R v
+ */
+inline Class_Vector<3> operator*(const Class_Rotation & __R, const Class_Vector<3> & __V)
+{
+    return (__R.Matrix * __V);
+}
+
+/**
+ * @brief   逆旋转（转置）
+ *
+ * @param   __R     旋转
+ * @return  Class_Rotation  R^T
+ */
+inline Class_Rotation Math_Rotation_Inverse(const Class_Rotation & __R)
+{
+    return (Class_Rotation{Math_Matrix_Transpose(__R.Matrix)});
+}
+
+#endif /* MIL_Quaternion.h */
@@ -0,0 +1,152 @@
+/**
+ * @file    Relay_Tune.h
+ * @brief   继电反馈PID自整定（Astrom-Hagglund）
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+#ifndef __MIL_RELAY_TUNE_H
+#define __MIL_RELAY_TUNE_H
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "User_Math.h"
+
+/* 枚举类型定义 --------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   自整定状态枚举类型
+ */
+enum Enum_Relay_Tune_State
+{
+    Relay_Tune_Idle     = 0U,   /*!< 空闲 */
+    Relay_Tune_Running  = 1U,   /*!< 继电实验进行中 */
+    Relay_Tune_Done     = 2U,   /*!< 完成（临界增益、临界周期有效） */
+    Relay_Tune_Failed   = 3U,   /*!< 失败（超时未形成稳定振荡） */
+};
+
+/**
+ * @brief   整定规则枚举类型
+ */
+enum Enum_Relay_Tune_Rule
+{
+    Relay_Tune_Rule_ZN_PI   = 0U,   /*!< Ziegler-Nichols PI:  K_P = 0.45 K_U, T_I = T_U / 1.2 */
+    Relay_Tune_Rule_ZN_PID  = 1U,   /*!< Ziegler-Nichols PID: K_P = 0.6 K_U, T_I = T_U / 2, T_D = T_U / 8 */
+    Relay_Tune_Rule_TL_PI   = 2U,   /*!< Tyreus-Luyben PI:    K_P = K_U / 3.2, T_I = 2.2 T_U（超调小，适合速度环） */
+};
+
+/* 类定义 --------------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   继电反馈自整定类
+ *          输出 = 偏置 ± 继电幅值（带滞环），被控量形成极限环振荡后测量振幅 a 与周期 T_U，
+ *          临界增益 K_U = 4 * d / (PI * sqrt(a^2 - eps^2))（eps 为滞环宽度），再按整定规则计算PID参数
+ *          首个振荡周期视为过渡过程不计入，之后取 Cycles 个周期平均
+ */
+class Class_Relay_Tune
+{
+public:
+    /* 函数 */
+    void Init(float __Relay_Amplitude, float __Hysteresis, float __D_T, uint8_t __Cycles = 4U, uint32_t __Timeout = 0U);
+    void Start(float __Setpoint, float __Bias = 0.0f);
+    void Calculate();
+    bool Get_Gains(Enum_Relay_Tune_Rule __Rule, float * __K_P, float * __K_I, float * __K_D);
+
+    inline Enum_Relay_Tune_State Get_State();
+    inline float Get_Out();
+    inline float Get_K_U();
+    inline float Get_T_U();
+    inline float Get_Setpoint();
+    inline void Set_Actual(float __Actual);
+protected:
+    /* 常量 */
+    float Relay_Amplitude = 0.0f;           /*!< 继电幅值 d */
+    float Hysteresis = 0.0f;                /*!< 滞环宽度 eps */
+    float D_T = 0.001f;                     /*!< 调用周期 (s) */
+    uint8_t Cycles = 4U;                    /*!< 参与平均的振荡周期数 */
+    uint32_t Timeout = 0U;                  /*!< 超时（调用次数）, 0为不限制 */
+
+    /* 写变量 */
+    float Setpoint = 0.0f;                  /*!< 设定值 */
+    float Bias = 0.0f;                      /*!< 输出偏置 */
+    float Actual = 0.0f;                    /*!< 实际值 */
+
+    /* 读变量 */
+    Enum_Relay_Tune_State State =           /*!< 自整定状态 */
+                          Relay_Tune_Idle;
+    float Out = 0.0f;                       /*!< 输出值 */
+    float K_U = 0.0f;                       /*!< 临界增益 */
+    float T_U = 0.0f;                       /*!< 临界周期 (s) */
+
+    /* 内部变量 */
+    int8_t Relay_Sign = 1;                  /*!< 当前继电方向 */
+    uint8_t Cycle_Counter = 0U;             /*!< 已完成振荡周期数（含过渡周期） */
+    uint32_t Tick = 0U;                     /*!< 实验开始后调用次数 */
+    uint32_t Pre_Rising_Tick = 0U;          /*!< 上次继电正向切换时刻 */
+    float Peak_Max = 0.0f;                  /*!< 本周期实际值最大值 */
+    float Peak_Min = 0.0f;                  /*!< 本周期实际值最小值 */
+    float Sum_Amplitude = 0.0f;             /*!< 振幅累加 */
+    float Sum_Period = 0.0f;                /*!< 周期累加 (s) */
+};
+
+/* 接口函数定义 --------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   获取自整定状态
+ *
+ * @return  Enum_Relay_Tune_State   自整定状态
+ */
+Enum_Relay_Tune_State Class_Relay_Tune::Get_State()
+{
+    return (this->State);
+}
+
+/**
+ * @brief   获取输出值
+ *
+ * @return  float   输出值（偏置 ± 继电幅值）
+ */
+float Class_Relay_Tune::Get_Out()
+{
+    return (this->Out);
+}
+
+/**
+ * @brief   获取临界增益
+ *
+ * @return  float   临界增益 K_U
+ */
+float Class_Relay_Tune::Get_K_U()
+{
+    return (this->K_U);
+}
+
+/**
+ * @brief   获取临界周期
+ *
+ * @return  float   临界周期 T_U (s)
+ */
+float Class_Relay_Tune::Get_T_U()
+{
+    return (this->T_U);
+}
+
+/**
+ * @brief   获取设定值
+ *
+ * @return  float   设定值
+ */
+float Class_Relay_Tune::Get_Setpoint()
+{
+    return (this->Setpoint);
+}
+
+/**
+ * @brief   设定当前值
+ *
+ * @param   __Actual    当前值
+ */
+void Class_Relay_Tune::Set_Actual(float __Actual)
+{
+    this->Actual = __Actual;
+}
+
+#endif /* MIL_Relay_Tune.h */
@@ -0,0 +1,185 @@
+/**
+ * @file    Telemetry_Codec.h
+ * @brief   遥测压缩编解码（定点量化 + 相对关键帧的 zigzag/varint 差分）
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.1
+ */
+
+#ifndef __MIL_TELEMETRY_CODEC_H
+#define __MIL_TELEMETRY_CODEC_H
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "stdint.h"
+#include "string.h"
+
+/* 宏定义 --------------------------------------------------------------------------------------------------------------*/
+#define CODEC_FIELD_MAX         24U     /* 最大字段数 */
+#define CODEC_KEY_HISTORY       4U      /* 关键帧记录数（2的幂，编码端为待确认的已发送关键帧，解码端为已接收关键帧） */
+#define CODEC_KEYFRAME          0x80U   /* 帧头：关键帧标志（低7位为关键帧序号） */
+#define CODEC_SEQUENCE_MASK     0x7FU   /* 帧头：关键帧序号掩码 */
+#define CODEC_SEQUENCE_NONE     0x7FU   /* 帧头：独立帧序号（不记录、不确认，关键帧序号跳过该值） */
+#define CODEC_ACK_NONE          0xFFU   /* 无待处理确认 */
+
+/* 枚举类型定义 --------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   解码结果枚举类型
+ */
+enum Enum_Codec_Result : uint8_t
+{
+    Codec_Invalid   = 0U,   /*!< 格式错误或引用的关键帧未收到（丢弃，等待下一个关键帧） */
+    Codec_Keyframe  = 1U,   /*!< 关键帧（需向编码端确认其序号） */
+    Codec_Delta     = 2U,   /*!< 差分帧 */
+    Codec_Absolute  = 3U,   /*!< 独立帧（尚无确认时发送，无需确认） */
+};
+
+/* 结构体定义 ----------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   量化字段描述结构体
+ */
+struct Struct_Codec_Field
+{
+    float Min;                          /*!< 量程下限（超出时限幅） */
+    float Max;                          /*!< 量程上限（超出时限幅） */
+    float Resolution;                   /*!< 分辨率（量化步长） */
+};
+
+/* 类定义 --------------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   遥测编码类
+ *          各字段按声明的量程、分辨率量化为有符号整数 q = round(x / Resolution)（量程需使 |q| < 2^30）；
+ *          帧格式：帧头 (1byte) + 各字段 varint（LEB128，每字节7位）；
+ *          关键帧：帧头为 CODEC_KEYFRAME | 序号，字段为 zigzag(q)，每 Key_Period 帧发送一次，确认后作为新的差分基准；
+ *          差分帧：帧头为引用的关键帧序号，字段为 zigzag(q - q_key)，q_key 取自解码端已确认收到的关键帧，
+ *          因此任一差分帧都可独立解码，丢帧不会累积误差；
+ *          独立帧：尚无确认时关键帧之间的帧，格式同关键帧但序号为 CODEC_SEQUENCE_NONE，不记录也不确认
+ *          （确认往返超过 CODEC_KEY_HISTORY 帧时，逐帧记录会使待确认的关键帧被覆盖）；
+ *          解码端复位或丢失基准时，至多一个关键帧周期后恢复
+ */
+class Class_Telemetry_Encoder
+{
+public:
+    /* 函数 */
+    Class_Telemetry_Encoder(const Struct_Codec_Field * __Field, uint8_t __Field_Number, uint16_t __Key_Period);
+    uint8_t Encode(const float * __Value, uint8_t * __Data, uint8_t __Size);
+    inline void Acknowledge(uint8_t __Sequence);
+
+    inline uint8_t Get_Length_MAX();
+    inline uint32_t Get_Keyframe_Number();
+protected:
+    /* 常量 */
+    const Struct_Codec_Field * Field;           /*!< 字段描述表 */
+    uint8_t Field_Number;                       /*!< 字段数 */
+    uint16_t Key_Period;                        /*!< 关键帧周期（帧数） */
+    uint8_t Length_MAX;                         /*!< 编码后最大长度 (byte) */
+    double Scale[CODEC_FIELD_MAX];              /*!< 各字段量化系数 (1 / Resolution，double 保证 2^30 内量化精度) */
+    int32_t Code_Min[CODEC_FIELD_MAX];          /*!< 各字段量化下限 */
+    int32_t Code_Max[CODEC_FIELD_MAX];          /*!< 各字段量化上限 */
+
+    /* 读写变量 */
+    uint32_t Keyframe_Number = 0U;              /*!< 已发送关键帧数（不含独立帧） */
+
+    /* 内部变量 */
+    int32_t Key[CODEC_KEY_HISTORY]              /*!< 已发送关键帧（按序号低位存放） */
+               [CODEC_FIELD_MAX];
+    uint8_t Key_Tag[CODEC_KEY_HISTORY];         /*!< 各记录对应的关键帧序号（CODEC_ACK_NONE 为空） */
+    int32_t Reference[CODEC_FIELD_MAX];         /*!< 差分基准（已确认的关键帧） */
+    uint8_t Reference_Sequence =                /*!< 差分基准序号（CODEC_ACK_NONE 为尚无确认） */
+                               CODEC_ACK_NONE;
+    uint8_t Key_Sequence = 0U;                  /*!< 下一个关键帧序号 */
+    uint16_t Key_Counter = 0U;                  /*!< 关键帧周期计数（0时发送关键帧） */
+    volatile uint8_t Ack = CODEC_ACK_NONE;      /*!< 待处理的确认序号（接收中断写入，Encode 处理） */
+};
+
+/**
+ * @brief   遥测解码类
+ *          按收到的顺序保存最近 CODEC_KEY_HISTORY 个关键帧，差分帧引用的关键帧不在其中时返回 Codec_Invalid
+ */
+class Class_Telemetry_Decoder
+{
+public:
+    /* 函数 */
+    Class_Telemetry_Decoder(const Struct_Codec_Field * __Field, uint8_t __Field_Number);
+    Enum_Codec_Result Decode(const uint8_t * __Data, uint8_t __Length, float * __Value, uint8_t * __Sequence);
+    void Reset();
+protected:
+    /* 常量 */
+    const Struct_Codec_Field * Field;           /*!< 字段描述表 */
+    uint8_t Field_Number;                       /*!< 字段数 */
+
+    /* 内部变量 */
+    int32_t Key[CODEC_KEY_HISTORY]              /*!< 已接收关键帧（按序号低位存放） */
+               [CODEC_FIELD_MAX];
+    uint8_t Key_Tag[CODEC_KEY_HISTORY];         /*!< 各记录对应的关键帧序号（CODEC_ACK_NONE 为空） */
+};
+
+/* 接口函数定义 --------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   zigzag 编码（小绝对值的负数映射为小正数）
+ */
+inline uint32_t Codec_Zigzag(int32_t __Value)
+{
+    return (((uint32_t) __Value << 1) ^ (uint32_t) (__Value >> 31));
+}
+
+/**
+ * @brief   zigzag 解码
+ */
+inline int32_t Codec_Unzigzag(uint32_t __Value)
+{
+    return ((int32_t) (__Value >> 1) ^ -(int32_t) (__Value & 1U));
+}
+
+/**
+ * @brief   varint 编码（LEB128，低位在前，最高位为后续字节标志）
+ *
+ * @param   __Value     数值
+ * @param   __Data      输出（至少5字节）
+ * @return  uint8_t     编码长度 (1 ~ 5byte)
+ */
+inline uint8_t Codec_Varint_Encode(uint32_t __Value, uint8_t * __Data)
+{
+    uint8_t length = 0U;
+
+    while (__Value >= 0x80U)
+    {
+        __Data[length++] = (uint8_t) (__Value | 0x80U);
+        __Value >>= 7;
+    }
+    __Data[length++] = (uint8_t) __Value;
+
+    return (length);
+}
+
+/**
+ * @brief   确认关键帧（在接收处理中调用，下一次 Encode 时生效）
+ *
+ * @param   __Sequence  关键帧序号
+ */
+void Class_Telemetry_Encoder::Acknowledge(uint8_t __Sequence)
+{
+    this->Ack = __Sequence & CODEC_SEQUENCE_MASK;
+}
+
+/**
+ * @brief   获取编码后最大长度
+ *
+ * @return  uint8_t     长度 (byte)
+ */
+uint8_t Class_Telemetry_Encoder::Get_Length_MAX()
+{
+    return (this->Length_MAX);
+}
+
+/**
+ * @brief   获取已发送关键帧数
+ *
+ * @return  uint32_t    帧数
+ */
+uint32_t Class_Telemetry_Encoder::Get_Keyframe_Number()
+{
+    return (this->Keyframe_Number);
+}
+
+#endif /* MIL_Telemetry_Codec.h */
@@ -0,0 +1,286 @@
+/**
+ * @file    Unit.h
+ * @brief   强类型物理量与单位换算
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+#ifndef __MIL_UNIT_H
+#define __MIL_UNIT_H
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "User_Math.h"
+
+/* 结构体定义 ----------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   单位标签（仅用于区分类型，不占存储）
+ */
+struct Struct_Unit_Tick {};                 /*!< 编码器刻度 */
+struct Struct_Unit_Rad {};                  /*!< 角度 (rad) */
+struct Struct_Unit_Radps {};                /*!< 角速度 (rad/s) */
+struct Struct_Unit_RPM {};                  /*!< 转速 (rpm) */
+struct Struct_Unit_Ampere {};               /*!< 电流 (A) */
+struct Struct_Unit_Raw {};                  /*!< 原始整型量（如电调电流的LSB） */
+
+/* 类定义 --------------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   物理量类
+ *          仅包含一个 float，同单位之间可加减比较，与标量可乘除；不同单位之间不能直接运算，
+ *          也不能与 float 隐式互转，需经 Class_Unit_Scale 换算或 Get() 显式取值
+ *
+ * @tparam  Unit    单位标签
+ */
+template<typename Unit>
+class Class_Quantity
+{
+public:
+    /* 函数 */
+    constexpr Class_Quantity();
+    constexpr explicit Class_Quantity(float __Value);
+
+    constexpr float Get() const;
+    inline Class_Quantity & operator+=(Class_Quantity __X);
+    inline Class_Quantity & operator-=(Class_Quantity __X);
+protected:
+    /* 内部变量 */
+    float Value;                            /*!< 数值 */
+};
+
+typedef Class_Quantity<Struct_Unit_Tick> Class_Tick;
+typedef Class_Quantity<Struct_Unit_Rad> Class_Rad;
+typedef Class_Quantity<Struct_Unit_Radps> Class_Radps;
+typedef Class_Quantity<Struct_Unit_RPM> Class_RPM;
+typedef Class_Quantity<Struct_Unit_Ampere> Class_Ampere;
+typedef Class_Quantity<Struct_Unit_Raw> Class_Raw;
+
+/**
+ * @brief   单位换算类
+ *          换算系数在编译期（constexpr）或 Init 中折叠为一个乘数，每次换算仅一次乘法；
+ *          换算可求逆、可复合（Scale<B, C> * Scale<A, B> = Scale<A, C>），单位不匹配时编译报错
+ *
+ * @tparam  From    源单位标签
+ * @tparam  To      目标单位标签
+ */
+template<typename From, typename To>
+class Class_Unit_Scale
+{
+public:
+    /* 函数 */
+    constexpr Class_Unit_Scale();
+    constexpr explicit Class_Unit_Scale(float __K);
+
+    constexpr Class_Quantity<To> operator()(Class_Quantity<From> __X) const;
+    constexpr Class_Unit_Scale<To, From> Inverse() const;
+    constexpr float Get_K() const;
+protected:
+    /* 常量 */
+    float K;                                /*!< 换算系数 */
+};
+
+/* 运算符定义 ----------------------------------------------------------------------------------------------------------*/
+template<typename Unit>
+constexpr Class_Quantity<Unit> operator+(Class_Quantity<Unit> __A, Class_Quantity<Unit> __B)
+{
+    return (Class_Quantity<Unit>(__A.Get() + __B.Get()));
+}
+
+template<typename Unit>
+constexpr Class_Quantity<Unit> operator-(Class_Quantity<Unit> __A, Class_Quantity<Unit> __B)
+{
+    return (Class_Quantity<Unit>(__A.Get() - __B.Get()));
+}
+
+template<typename Unit>
+constexpr Class_Quantity<Unit> operator-(Class_Quantity<Unit> __A)
+{
+    return (Class_Quantity<Unit>(-__A.Get()));
+}
+
+template<typename Unit>
+constexpr Class_Quantity<Unit> operator*(Class_Quantity<Unit> __A, float __K)
+{
+    return (Class_Quantity<Unit>(__A.Get() * __K));
+}
+
+template<typename Unit>
+constexpr Class_Quantity<Unit> operator*(float __K, Class_Quantity<Unit> __A)
+{
+    return (Class_Quantity<Unit>(__K * __A.Get()));
+}
+
+template<typename Unit>
+constexpr Class_Quantity<Unit> operator/(Class_Quantity<Unit> __A, float __K)
+{
+    return (Class_Quantity<Unit>(__A.Get() / __K));
+}
+
+template<typename Unit>
+constexpr float operator/(Class_Quantity<Unit> __A, Class_Quantity<Unit> __B)
+{
+    return (__A.Get() / __B.Get());
+}
+
+template<typename Unit>
+constexpr bool operator<(Class_Quantity<Unit> __A, Class_Quantity<Unit> __B)
+{
+    return (__A.Get() < __B.Get());
+}
+
+template<typename Unit>
+constexpr bool operator>(Class_Quantity<Unit> __A, Class_Quantity<Unit> __B)
+{
+    return (__A.Get() > __B.Get());
+}
+
+/**
+ * @brief   换算复合（先 __Inner 后 __Outer）
+ */
+template<typename A, typename B, typename C>
+constexpr Class_Unit_Scale<A, C> operator*(Class_Unit_Scale<B, C> __Outer, Class_Unit_Scale<A, B> __Inner)
+{
+    return (Class_Unit_Scale<A, C>(__Outer.Get_K() * __Inner.Get_K()));
+}
+
+/* 接口函数定义 --------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   构造零值
+ */
+template<typename Unit>
+constexpr Class_Quantity<Unit>::Class_Quantity() : Value(0.0f)
+{
+}
+
+/**
+ * @brief   由数值构造（需显式）
+ *
+ * @param   __Value     数值
+ */
+template<typename Unit>
+constexpr Class_Quantity<Unit>::Class_Quantity(float __Value) : Value(__Value)
+{
+}
+
+/**
+ * @brief   获取数值
+ *
+ * @return  float   数值
+ */
+template<typename Unit>
+constexpr float Class_Quantity<Unit>::Get() const
+{
+    return (this->Value);
+}
+
+/**
+ * @brief   累加同单位物理量
+ */
+template<typename Unit>
+Class_Quantity<Unit> & Class_Quantity<Unit>::operator+=(Class_Quantity<Unit> __X)
+{
+    this->Value += __X.Get();
+    return (*this);
+}
+
+/**
+ * @brief   累减同单位物理量
+ */
+template<typename Unit>
+Class_Quantity<Unit> & Class_Quantity<Unit>::operator-=(Class_Quantity<Unit> __X)
+{
+    this->Value -= __X.Get();
+    return (*this);
+}
+
+/**
+ * @brief   构造零换算（未初始化）
+ */
+template<typename From, typename To>
+constexpr Class_Unit_Scale<From, To>::Class_Unit_Scale() : K(0.0f)
+{
+}
+
+/**
+ * @brief   由换算系数构造
+ *
+ * @param   __K     换算系数（目标值 = __K * 源值）
+ */
+template<typename From, typename To>
+constexpr Class_Unit_Scale<From, To>::Class_Unit_Scale(float __K) : K(__K)
+{
+}
+
+/**
+ * @brief   换算
+ *
+ * @param   __X                 源物理量
+ * @return  Class_Quantity<To>  目标物理量
+ */
+template<typename From, typename To>
+constexpr Class_Quantity<To> Class_Unit_Scale<From, To>::operator()(Class_Quantity<From> __X) const
+{
+    return (Class_Quantity<To>(this->K * __X.Get()));
+}
+
+/**
+ * @brief   逆换算
+ *
+ * @return  Class_Unit_Scale<To, From>  逆换算
+ */
+template<typename From, typename To>
+constexpr Class_Unit_Scale<To, From> Class_Unit_Scale<From, To>::Inverse() const
+{
+    return (Class_Unit_Scale<To, From>(1.0f / this->K));
+}
+
+/**
+ * @brief   获取换算系数
+ *
+ * @return  float   换算系数
+ */
+template<typename From, typename To>
+constexpr float Class_Unit_Scale<From, To>::Get_K() const
+{
+    return (this->K);
+}
+
+/* 常用换算 ------------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   转速 (rpm) -> 角速度 (rad/s)
+ */
+constexpr Class_Unit_Scale<Struct_Unit_RPM, Struct_Unit_Radps> Unit_RPM_To_Radps(RPM_TO_RADPS);
+
+/**
+ * @brief   编码器刻度 -> 输出轴角度 (rad)
+ *
+ * @param   __Ticks_Per_Round   电机轴每圈刻度数（正交编码器为 4 * 线数）
+ * @param   __Reduction_Ratio   减速比
+ */
+constexpr Class_Unit_Scale<Struct_Unit_Tick, Struct_Unit_Rad> Unit_Encoder_Scale(float __Ticks_Per_Round,
+                                                                                 float __Reduction_Ratio)
+{
+    return (Class_Unit_Scale<Struct_Unit_Tick, Struct_Unit_Rad>(2.0f * PI / (__Ticks_Per_Round * __Reduction_Ratio)));
+}
+
+/**
+ * @brief   电机轴转速 (rpm) -> 输出轴角速度 (rad/s)
+ *
+ * @param   __Reduction_Ratio   减速比
+ */
+constexpr Class_Unit_Scale<Struct_Unit_RPM, Struct_Unit_Radps> Unit_Gearbox_Scale(float __Reduction_Ratio)
+{
+    return (Class_Unit_Scale<Struct_Unit_RPM, Struct_Unit_Radps>(RPM_TO_RADPS / __Reduction_Ratio));
+}
+
+/**
+ * @brief   单个采样周期内的角度增量 (rad) -> 角速度 (rad/s)
+ *
+ * @param   __D_T   采样周期 (s)
+ */
+constexpr Class_Unit_Scale<Struct_Unit_Rad, Struct_Unit_Radps> Unit_Increment_Rate(float __D_T)
+{
+    return (Class_Unit_Scale<Struct_Unit_Rad, Struct_Unit_Radps>(1.0f / __D_T));
+}
+
+#endif /* MIL_Unit.h */
@@ -29,6 +29,26 @@ union Union_uint8_float
     float Data_float;
 };
 
+/* 类定义 --------------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief 浮点数-整型仿射映射类（如电机协议中的定点编码），Init 中预先计算斜率与截距，每次映射仅一次乘加
+ */
+class Class_Math_Affine
+{
+public:
+    /* 函数 */
+    void Init(float __Float_Min, float __Float_Max, int32_t __Int_Min, int32_t __Int_Max);
+
+    inline int32_t To_Int(float __X);
+    inline float To_Float(int32_t __X);
+protected:
+    /* 常量 */
+    float K_To_Int = 1.0f;                  /*!< 浮点数 -> 整型 斜率 */
+    float B_To_Int = 0.0f;                  /*!< 浮点数 -> 整型 截距 */
+    float K_To_Float = 1.0f;                /*!< 整型 -> 浮点数 斜率 */
+    float B_To_Float = 0.0f;                /*!< 整型 -> 浮点数 截距 */
+};
+
 /* 函数声明 ------------------------------------------------------------------------------------------------------------*/
 void Math_Endian_Reverse_16(void *Address);
 void Math_Endian_Reverse_16(void *Source, void *Destination);
@@ -37,6 +57,8 @@ void Math_Endian_Reverse_32(void *Source, void *Destination);
 uint8_t Math_Sum_8(uint8_t *Address, uint32_t Length);
 uint16_t Math_Sum_16(uint16_t *Address, uint32_t Length);
 uint32_t Math_Sum_32(uint32_t *Address, uint32_t Length);
+uint16_t Math_Fletcher_16(uint8_t *Address, uint32_t Length);
+uint32_t Math_Adler_32(uint8_t *Address, uint32_t Length);
 float Math_Sinc(float x);
 int32_t Math_Float_To_Int(float x, float Float_Min, float Float_Max, int32_t Int_Min, int32_t Int_Max);
 float Math_Int_To_Float(int32_t x, int32_t Int_Min, int32_t Int_Max, float Float_Min, float Float_Max);
@@ -77,4 +99,120 @@ Type Math_Abs(Type x)
     return ((x > 0) ? x : -x);
 }
 
+/* 接口函数定义 --------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief 浮点数映射到整型（向零取整，与 Math_Float_To_Int 一致）
+ *
+ * @param __X 浮点数
+ * @return int32_t 整型
+ */
+int32_t Class_Math_Affine::To_Int(float __X)
+{
+    return ((int32_t) (__X * this->K_To_Int + this->B_To_Int));
+}
+
+/**
+ * @brief 整型映射到浮点数
+ *
+ * @param __X 整型
+ * @return float 浮点数
+ */
+float Class_Math_Affine::To_Float(int32_t __X)
+{
+    return ((float) __X * this->K_To_Float + this->B_To_Float);
+}
+
+/**
+ * @brief 字节序反转（按数据宽度特化，目标平台为单条 REV16/REV 指令）
+ *
+ * @tparam Size 数据宽度（字节）
+ */
+template<uint32_t Size>
+struct Struct_Math_Byte_Reverse;
+
+template<>
+struct Struct_Math_Byte_Reverse<1U>
+{
+    typedef uint8_t Type;
+    static inline uint8_t Reverse(uint8_t x)
+    {
+        return (x);
+    }
+};
+
+template<>
+struct Struct_Math_Byte_Reverse<2U>
+{
+    typedef uint16_t Type;
+    static inline uint16_t Reverse(uint16_t x)
+    {
+#if defined(__arm__)
+        return ((uint16_t) __REV16(x));
+#else
+        return ((uint16_t) (x << 8 | x >> 8));
+#endif
+    }
+};
+
+template<>
+struct Struct_Math_Byte_Reverse<4U>
+{
+    typedef uint32_t Type;
+    static inline uint32_t Reverse(uint32_t x)
+    {
+#if defined(__arm__)
+        return (__REV(x));
+#else
+        return ((x << 24) | ((x << 8) & 0x00FF0000U) | ((x >> 8) & 0x0000FF00U) | (x >> 24));
+#endif
+    }
+};
+
+template<>
+struct Struct_Math_Byte_Reverse<8U>
+{
+    typedef uint64_t Type;
+    static inline uint64_t Reverse(uint64_t x)
+    {
+        return ((uint64_t) Struct_Math_Byte_Reverse<4U>::Reverse((uint32_t) x) << 32 |
+                Struct_Math_Byte_Reverse<4U>::Reverse((uint32_t) (x >> 32)));
+    }
+};
+
+/**
+ * @brief 读取大端数据（地址可非对齐）
+ *
+ * @tparam Type 数据类型（1/2/4/8字节整型或浮点）
+ * @param Address 数据地址
+ * @return Type 数据
+ */
+template<typename Type>
+inline Type Math_Load_BE(const void *Address)
+{
+    typename Struct_Math_Byte_Reverse<sizeof(Type)>::Type raw;
+    Type x;
+
+    memcpy(&raw, Address, sizeof(Type));
+    raw = Struct_Math_Byte_Reverse<sizeof(Type)>::Reverse(raw);
+    memcpy(&x, &raw, sizeof(Type));
+    return (x);
+}
+
+/**
+ * @brief 写入大端数据（地址可非对齐）
+ *
+ * @tparam Type 数据类型（1/2/4/8字节整型或浮点）
+ * @param Address 数据地址
+ * @param x 数据
+ */
+template<typename Type>
+inline void Math_Store_BE(void *Address, Type x)
+{
+    typename Struct_Math_Byte_Reverse<sizeof(Type)>::Type raw;
+
+    memcpy(&raw, &x, sizeof(Type));
+    raw = Struct_Math_Byte_Reverse<sizeof(Type)>::Reverse(raw);
+    memcpy(Address, &raw, sizeof(Type));
+}
+
 #endif /* MIL_Math.h */
@@ -0,0 +1,160 @@
+/**
+ * @file    Clock_Sync.cpp
+ * @brief   双端时钟同步（NTP式四时间戳交换，最小时延滤波 + 线性拟合估计偏移与漂移）
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "Clock_Sync.h"
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/************************************************************************************************************************
+ * @brief   复位（清空拟合点，映射恢复为原样返回）
+ ***********************************************************************************************************************/
+void Class_Clock_Sync::Reset()
+{
+    this->Valid = false;
+    this->Drift = 0.0f;
+    this->Delay = 0U;
+    this->Anchor_Local = 0U;
+    this->Anchor_Offset = 0U;
+    this->History_Number = 0U;
+    this->History_Index = 0U;
+    this->Filter_Number = 0U;
+    this->Provisional = false;
+}
+
+/************************************************************************************************************************
+ * @brief   输入一次交换的四个时间戳
+ * @note    T1、T4 为请求方时钟，T2、T3 为应答方时钟；滤波窗口满时取窗口内时延最小的交换作为拟合点
+ *          （尚无拟合点时立即加入暂定拟合点，窗口满之前随窗口内时延最小的交换更新），
+ *          与当前映射的偏差超过 CLOCK_SYNC_STEP_MAX、或距上一个拟合点超过 CLOCK_SYNC_GAP_MAX 时先清空拟合点
+ *
+ * @param   __T1        请求方发送时刻 (us)
+ * @param   __T2        应答方接收时刻 (us)
+ * @param   __T3        应答方发送时刻 (us)
+ * @param   __T4        请求方接收时刻 (us)
+ * @param   __Client    本端是否为请求方
+ * @return  bool        是否有效（时间戳顺序错误、往返时延超过 CLOCK_SYNC_DELAY_MAX 时丢弃）
+ ***********************************************************************************************************************/
+bool Class_Clock_Sync::Update(uint32_t __T1, uint32_t __T2, uint32_t __T3, uint32_t __T4, bool __Client)
+{
+    int32_t round_trip = (int32_t) (__T4 - __T1);
+    int32_t process = (int32_t) (__T3 - __T2);
+    int32_t delay = round_trip - process;
+
+    if (round_trip < 0 || process < 0 || delay > (int32_t) CLOCK_SYNC_DELAY_MAX)
+    {
+        return (false);
+    }
+
+    /* 两端在各自收发中点处对齐（时间戳的帧长补偿误差可使时延略小于0，按0计） */
+    uint32_t client_middle = __T1 + (uint32_t) round_trip / 2U;
+    uint32_t server_middle = __T2 + (uint32_t) process / 2U;
+    uint32_t local = __Client ? client_middle : server_middle;
+    uint32_t offset = __Client ? (server_middle - client_middle) : (client_middle - server_middle);
+
+    delay = (delay > 0) ? delay : 0;
+    this->Exchange_Number += 1U;
+
+    /* 最小时延滤波 */
+    if (this->Filter_Number == 0U || (uint32_t) delay < this->Best_Delay)
+    {
+        this->Best_Local = local;
+        this->Best_Offset = offset;
+        this->Best_Delay = (uint32_t) delay;
+    }
+    this->Filter_Number += 1U;
+
+    bool full = (this->Filter_Number >= CLOCK_SYNC_FILTER);
+
+    if (!full && this->History_Number > 0U && !this->Provisional)
+    {
+        return (true);
+    }
+    if (full)
+    {
+        this->Filter_Number = 0U;
+    }
+
+    /* 暂定拟合点：覆盖最新拟合点 */
+    if (this->Provisional)
+    {
+        this->History_Index = (this->History_Index + CLOCK_SYNC_HISTORY - 1U) % CLOCK_SYNC_HISTORY;
+        this->History_Number -= 1U;
+    }
+    /* 时钟跳变、长时间中断检测 */
+    else if (this->Valid)
+    {
+        int32_t error = (int32_t) (this->Best_Local + this->Best_Offset - this->To_Remote(this->Best_Local));
+        uint32_t gap = this->Best_Local - this->Anchor_Local;
+
+        if (error > (int32_t) CLOCK_SYNC_STEP_MAX || error < -(int32_t) CLOCK_SYNC_STEP_MAX ||
+            gap > CLOCK_SYNC_GAP_MAX)
+        {
+            this->History_Number = 0U;
+            this->History_Index = 0U;
+            this->Step_Number += 1U;
+        }
+    }
+
+    /* 加入拟合点并拟合 */
+    this->History_Local[this->History_Index] = this->Best_Local;
+    this->History_Offset[this->History_Index] = this->Best_Offset;
+    this->History_Index = (this->History_Index + 1U < CLOCK_SYNC_HISTORY) ? (this->History_Index + 1U) : 0U;
+    if (this->History_Number < CLOCK_SYNC_HISTORY)
+    {
+        this->History_Number += 1U;
+    }
+    this->Provisional = !full;
+    this->Delay = this->Best_Delay;
+    this->Fit();
+
+    return (true);
+}
+
+/************************************************************************************************************************
+ * @brief   最小二乘拟合
+ * @note    以最新拟合点为原点（时刻、偏移均为相对量，不受32位回绕影响），整数累加后仅在求斜率、截距时转为浮点；
+ *          映射基准点取最新拟合点处的拟合值，漂移取斜率
+ ***********************************************************************************************************************/
+void Class_Clock_Sync::Fit()
+{
+    const uint8_t number = this->History_Number;
+    uint8_t newest = (this->History_Index + CLOCK_SYNC_HISTORY - 1U) % CLOCK_SYNC_HISTORY;
+    uint32_t local = this->History_Local[newest];
+    uint32_t offset = this->History_Offset[newest];
+    int64_t sum_x = 0;
+    int64_t sum_y = 0;
+    int64_t sum_xx = 0;
+    int64_t sum_xy = 0;
+
+    for (uint8_t i = 0; i < number; i++)
+    {
+        int64_t x = (int32_t) (this->History_Local[i] - local);
+        int64_t y = (int32_t) (this->History_Offset[i] - offset);
+
+        sum_x += x;
+        sum_y += y;
+        sum_xx += x * x;
+        sum_xy += x * y;
+    }
+
+    double slope = 0.0;
+    int64_t denominator = number * sum_xx - sum_x * sum_x;
+
+    if (number >= 2U && denominator > 0)
+    {
+        slope = (double) (number * sum_xy - sum_x * sum_y) / (double) denominator;
+    }
+
+    double intercept = ((double) sum_y - slope * (double) sum_x) / number;
+
+    this->Anchor_Local = local;
+    this->Anchor_Offset = offset + (uint32_t) (int32_t) ((intercept >= 0.0) ? (intercept + 0.5) : (intercept - 0.5));
+    this->Drift = (float) slope;
+    this->Valid = true;
+}
@@ -0,0 +1,141 @@
+/**
+ * @file    Cobs.cpp
+ * @brief   COBS (Consistent Overhead Byte Stuffing) 编解码
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.1
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "Cobs.h"
+
+/* 宏定义 --------------------------------------------------------------------------------------------------------------*/
+#define COBS_SHORT_RUN  16U     /* 短段长度（逐字节处理，避免库函数调用开销） */
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/************************************************************************************************************************
+ * @brief   COBS编码（不含结束符）
+ * @note    编码后不含 0x00，每 254 字节至多增加 1 字节；__Length 不超过 COBS_BYTEWISE_LENGTH（所有收发帧）时逐字节编码，
+ *          更长时按段处理（查找 0x00 后整段搬移），长段用 memchr 查找；
+ *          帧中 0x00 密集（浮点遥测、小整数）时按段处理每段都要判断、调用库函数，比逐字节慢 1.2 ~ 2 倍，仅 0x00 稀疏时更快；
+ *          __Length 不超过 254 时可原地编码（__Destination = __Source - 1）
+ *
+ * @param   __Source        原始数据
+ * @param   __Length        原始数据长度
+ * @param   __Destination   编码结果（至少 COBS_MAX_ENCODED(__Length) 字节）
+ * @return  uint32_t        编码后长度
+ ***********************************************************************************************************************/
+uint32_t COBS_Encode(const uint8_t * __Source, uint32_t __Length, uint8_t * __Destination)
+{
+    uint8_t * out = __Destination;
+
+    if (__Length <= COBS_BYTEWISE_LENGTH)
+    {
+        /* 逐字节：写入位置始终不超过读取位置，不足 254 字节不会出现整段，输出与按段处理相同 */
+        uint8_t * code = out++;
+
+        for (uint32_t i = 0; i < __Length; i++)
+        {
+            if (__Source[i] == 0U)
+            {
+                *code = (uint8_t) (out - code);
+                code = out++;
+            }
+            else
+            {
+                *out++ = __Source[i];
+            }
+        }
+        *code = (uint8_t) (out - code);
+
+        return ((uint32_t) (out - __Destination));
+    }
+
+    for (;;)
+    {
+        uint32_t limit = (__Length < 254U) ? __Length : 254U;
+        uint8_t * code = out++;
+        uint32_t run = 0U;
+
+        /* 短段边查找边拷贝（原地编码时写入位置始终落后读取位置），超过 COBS_SHORT_RUN 仍无 0x00 时改用 memchr 整段搬移 */
+        while (run < limit && run < COBS_SHORT_RUN && __Source[run] != 0U)
+        {
+            *out++ = __Source[run];
+            run++;
+        }
+        if (run == COBS_SHORT_RUN && run < limit)
+        {
+            const uint8_t * zero = (const uint8_t *) memchr(&__Source[run], 0, limit - run);
+            uint32_t rest = ((zero != nullptr) ? (uint32_t) (zero - __Source) : limit) - run;
+
+            memmove(out, &__Source[run], rest);
+            out += rest;
+            run += rest;
+        }
+
+        /* 一段：长度码 + 不含 0x00 的数据 */
+        *code = (uint8_t) (run + 1U);
+        __Source += run;
+        __Length -= run;
+
+        if (run < limit)
+        {
+            /* 遇到 0x00，由长度码隐含 */
+            __Source += 1;
+            __Length -= 1U;
+        }
+        else if (run < 254U || __Length == 0U)
+        {
+            break;
+        }
+    }
+
+    return ((uint32_t) (out - __Destination));
+}
+
+/************************************************************************************************************************
+ * @brief   COBS解码（输入不含结束符）
+ * @note    可原地解码（__Destination = __Source）
+ *
+ * @param   __Source        编码数据
+ * @param   __Length        编码数据长度
+ * @param   __Destination   解码结果（至少 __Length - 1 字节）
+ * @return  uint32_t        解码后长度，格式错误（长度码为0或越界）时返回0
+ ***********************************************************************************************************************/
+uint32_t COBS_Decode(const uint8_t * __Source, uint32_t __Length, uint8_t * __Destination)
+{
+    const uint8_t * end = __Source + __Length;
+    uint8_t * out = __Destination;
+
+    while (__Source < end)
+    {
+        uint32_t code = *__Source++;
+
+        if (code == 0U || code - 1U > (uint32_t) (end - __Source))
+        {
+            return (0U);
+        }
+
+        if (code <= COBS_SHORT_RUN)
+        {
+            for (uint32_t i = 1U; i < code; i++)
+            {
+                *out++ = *__Source++;
+            }
+        }
+        else
+        {
+            memmove(out, __Source, code - 1U);
+            out += code - 1U;
+            __Source += code - 1U;
+        }
+
+        if (code != 0xFFU && __Source < end)
+        {
+            *out++ = 0x00U;
+        }
+    }
+
+    return ((uint32_t) (out - __Destination));
+}
@@ -0,0 +1,241 @@
+/**
+ * @file    Frame_Parser.cpp
+ * @brief   环形缓冲区流式帧解析
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.4
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "Frame_Parser.h"
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/************************************************************************************************************************
+ * @brief   流式帧解析器初始化（所有包类型均未注册）
+ *
+ * @param   __Ring          环形缓冲区（DMA写入）
+ * @param   __Ring_Size     环形缓冲区长度（需为2的幂，且不小于最大帧长度的2倍）
+ * @param   __Pack_Head     包头 (4byte，按小端字节序发送，COBS模式不使用)
+ * @param   __Mode          分帧方式
+ ***********************************************************************************************************************/
+void Class_Frame_Parser::Init(const uint8_t * __Ring, uint16_t __Ring_Size, uint32_t __Pack_Head, Enum_Frame_Mode __Mode)
+{
+    /* 参数赋值 */
+    this->Mode = __Mode;
+    this->Ring = __Ring;
+    this->Ring_Mask = __Ring_Size - 1U;
+    memcpy(this->Head, &__Pack_Head, 4);
+    memset(this->Frame_Length, 0, sizeof(this->Frame_Length));
+    memset(this->Variable, 0, sizeof(this->Variable));
+
+    this->Reset();
+}
+
+/************************************************************************************************************************
+ * @brief   注册可接收的包类型
+ *
+ * @param   __Type      包类型
+ * @param   __Length    数据长度（变长包为最大数据长度；帧长度不超过 FRAME_MAX_LENGTH，超过时不注册）
+ * @param   __Variable  是否为变长包
+ ***********************************************************************************************************************/
+void Class_Frame_Parser::Register(uint8_t __Type, uint8_t __Length, bool __Variable)
+{
+    if (__Length + FRAME_OVERHEAD <= FRAME_MAX_LENGTH)
+    {
+        this->Frame_Length[__Type] = __Length + FRAME_OVERHEAD;
+        if (__Variable)
+        {
+            this->Variable[__Type >> 5] |= 1UL << (__Type & 31U);
+        }
+        else
+        {
+            this->Variable[__Type >> 5] &= ~(1UL << (__Type & 31U));
+        }
+    }
+}
+
+/************************************************************************************************************************
+ * @brief   复位读指针（DMA重新开始接收时调用）
+ *
+ * @param   __Read_Index    新的读指针
+ ***********************************************************************************************************************/
+void Class_Frame_Parser::Reset(uint16_t __Read_Index)
+{
+    this->Read_Index = __Read_Index & this->Ring_Mask;
+    this->Scan_Index = this->Read_Index;
+    this->Discard = false;
+}
+
+/************************************************************************************************************************
+ * @brief   取出下一帧
+ * @note    返回的包在下一次调用前有效；DMA写指针追上读指针（溢出）时无法检测，环形缓冲区长度需覆盖两次调用之间的最大接收字节数
+ *
+ * @param   __Write_Index   DMA写指针
+ * @return  const uint8_t * 包类型地址（其后依次为数据长度、数据、时间戳、CRC8，数据位于偏移2处，时间戳见 Frame_Get_Time），
+ *                          无完整帧时返回 nullptr
+ ***********************************************************************************************************************/
+const uint8_t * Class_Frame_Parser::Next(uint16_t __Write_Index)
+{
+    return ((this->Mode == Frame_Mode_COBS) ? this->Next_COBS(__Write_Index) : this->Next_Head(__Write_Index));
+}
+
+/************************************************************************************************************************
+ * @brief   取出下一帧（包头模式）
+ * @note    未跨越环尾时直接指向环形缓冲区（零拷贝），跨越时指向内部拷贝
+ *
+ * @param   __Write_Index   DMA写指针
+ * @return  const uint8_t * 包类型地址，无完整帧时返回 nullptr
+ ***********************************************************************************************************************/
+const uint8_t * Class_Frame_Parser::Next_Head(uint16_t __Write_Index)
+{
+    const uint16_t mask = this->Ring_Mask;
+
+    while (((__Write_Index - this->Read_Index) & mask) >= FRAME_HEADER_LENGTH)
+    {
+        uint16_t read = this->Read_Index;
+
+        /* 包头校验 */
+        if (this->Ring[read] != this->Head[0] || this->Ring[(read + 1U) & mask] != this->Head[1] ||
+            this->Ring[(read + 2U) & mask] != this->Head[2] || this->Ring[(read + 3U) & mask] != this->Head[3])
+        {
+            this->Read_Index = (read + 1U) & mask;
+            this->Skip_Number += 1U;
+            continue;
+        }
+
+        /* 包类型、数据长度校验 */
+        uint16_t length = this->Ring[(read + 5U) & mask] + FRAME_OVERHEAD;
+
+        if (!this->Length_Check(this->Ring[(read + 4U) & mask], length))
+        {
+            this->Read_Index = (read + 1U) & mask;
+            this->Error_Number += 1U;
+            continue;
+        }
+        if (((__Write_Index - read) & mask) < length)
+        {
+            /* 等待整帧到达 */
+            break;
+        }
+
+        /* CRC校验（原地，跨越环尾时分两段） */
+        uint16_t first = mask + 1U - read;
+        uint16_t first_crc = (first < length - 1U) ? first : (length - 1U);
+        Class_CRC8_MAXIM crc;
+
+        crc.Update(&this->Ring[read], first_crc);
+        crc.Update(this->Ring, length - 1U - first_crc);
+        if (crc.Finish() != this->Ring[(read + length - 1U) & mask])
+        {
+            /* 伪包头或损坏帧，仅跳过一个字节，避免吞掉其后的有效帧 */
+            this->Read_Index = (read + 1U) & mask;
+            this->Error_Number += 1U;
+            continue;
+        }
+
+        /* 校验通过 */
+        this->Read_Index = (read + length) & mask;
+        this->Frame_Number += 1U;
+        if (first >= length)
+        {
+            return (&this->Ring[read + 4U]);
+        }
+        memcpy(this->Buffer, &this->Ring[read], first);
+        memcpy(&this->Buffer[first], this->Ring, length - first);
+        return (&this->Buffer[4]);
+    }
+
+    return (nullptr);
+}
+
+/************************************************************************************************************************
+ * @brief   取出下一帧（COBS模式）
+ * @note    以 0x00 定界，未跨越环尾时直接从环中解码到内部缓冲区，跨越时先拼接再原地解码；
+ *          超过最大长度仍未出现结束符时丢弃至下一个结束符
+ *
+ * @param   __Write_Index   DMA写指针
+ * @return  const uint8_t * 包类型地址，无完整帧时返回 nullptr
+ ***********************************************************************************************************************/
+const uint8_t * Class_Frame_Parser::Next_COBS(uint16_t __Write_Index)
+{
+    const uint16_t mask = this->Ring_Mask;
+
+    __Write_Index &= mask;
+    while (this->Scan_Index != __Write_Index)
+    {
+        /* 搜索结束符（按连续段） */
+        uint16_t scan = this->Scan_Index;
+        uint16_t scan_end = (__Write_Index > scan) ? __Write_Index : (uint16_t) (mask + 1U);
+        const uint8_t * delimiter = (const uint8_t *) memchr(&this->Ring[scan], COBS_DELIMITER, scan_end - scan);
+
+        if (delimiter == nullptr)
+        {
+            this->Scan_Index = scan_end & mask;
+            continue;
+        }
+
+        uint16_t read = this->Read_Index;
+        uint16_t end = (uint16_t) (delimiter - this->Ring);
+        uint16_t encoded = (end - read) & mask;
+
+        this->Read_Index = (end + 1U) & mask;
+        this->Scan_Index = this->Read_Index;
+
+        /* 超长帧尾部、空帧、超长帧 */
+        if (this->Discard)
+        {
+            this->Discard = false;
+            this->Skip_Number += encoded + 1U;
+            continue;
+        }
+        if (encoded == 0U)
+        {
+            continue;
+        }
+        if (encoded > FRAME_COBS_MAX_ENCODED)
+        {
+            this->Error_Number += 1U;
+            continue;
+        }
+
+        /* 解码 */
+        uint16_t first = mask + 1U - read;
+        uint32_t length;
+
+        if (first >= encoded)
+        {
+            length = COBS_Decode(&this->Ring[read], encoded, this->Buffer);
+        }
+        else
+        {
+            memcpy(this->Buffer, &this->Ring[read], first);
+            memcpy(&this->Buffer[first], this->Ring, encoded - first);
+            length = COBS_Decode(this->Buffer, encoded, this->Buffer);
+        }
+
+        /* 包类型、数据长度、CRC校验（解码结果为不含包头的帧） */
+        if (length < FRAME_OVERHEAD - 4U || this->Buffer[1] + FRAME_OVERHEAD - 4U != length ||
+            !this->Length_Check(this->Buffer[0], length + 4U) ||
+            Class_CRC8_MAXIM::Calculate(this->Buffer, length - 1U) != this->Buffer[length - 1U])
+        {
+            this->Error_Number += 1U;
+            continue;
+        }
+
+        this->Frame_Number += 1U;
+        return (this->Buffer);
+    }
+
+    /* 超过最大长度仍无结束符，丢弃已接收部分 */
+    uint16_t pending = (__Write_Index - this->Read_Index) & mask;
+
+    if (pending > FRAME_COBS_MAX_ENCODED)
+    {
+        this->Skip_Number += pending;
+        this->Read_Index = __Write_Index;
+        this->Discard = true;
+    }
+
+    return (nullptr);
+}
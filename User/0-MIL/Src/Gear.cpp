@@ -4,7 +4,7 @@
  *
  * @author  Tang-yucheng (QQ: 3143961287)
  * @date    2024-2-15
- * @version v1.0
+ * @version v1.2
  */
 
 /* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
@@ -13,14 +13,11 @@
 /************************************************************************************************************************
  * @brief   斜坡变速控制器初始化
  *
- * @param   __Step_Length   变速步长
+ * @param   __Step_Length   变速步长, 0为不限制（输出直接跟随设定值）
  ***********************************************************************************************************************/
 void Class_Gear_Slope::Init(float __Step_Length)
 {
-    if (__Step_Length > 0.0f)
-    {
-        this->Step_Length = __Step_Length;
-    }
+    this->Step_Length = (__Step_Length > 0.0f) ? __Step_Length : 0.0f;
 }
 
 /************************************************************************************************************************
@@ -29,7 +26,7 @@ void Class_Gear_Slope::Init(float __Step_Length)
 void Class_Gear_Slope::Calculate()
 {
     /* 判断是否需要计算 */
-    if (Math_Abs(this->Set_Val - this->Out_Val) <= this->Step_Length)
+    if (this->Step_Length == 0.0f || Math_Abs(this->Set_Val - this->Out_Val) <= this->Step_Length)
     {
         /* 无需计算，直接赋值 */
         this->Out_Val = this->Set_Val;
@@ -47,3 +44,129 @@ void Class_Gear_Slope::Calculate()
         }
     }
 }
+
+/************************************************************************************************************************
+ * @brief   S曲线变速控制器初始化
+ *
+ * @param   __V_Max     输出限幅, 0为不限制
+ * @param   __A_Max     加速度限幅（单位/s，需大于0）
+ * @param   __J_Max     加加速度限幅（单位/s^2，需大于0）
+ * @param   __D_T       计算周期 (s)
+ ***********************************************************************************************************************/
+void Class_Gear_SCurve::Init(float __V_Max, float __A_Max, float __J_Max, float __D_T)
+{
+    if (__A_Max > 0.0f && __J_Max > 0.0f && __D_T > 0.0f)
+    {
+        this->V_Max = Math_Abs(__V_Max);
+        this->A_Max = __A_Max;
+        this->J_Max = __J_Max;
+        this->D_T = __D_T;
+        this->J_Max_Inv = 1.0f / __J_Max;
+        this->J_D_T = __J_Max * __D_T;
+    }
+}
+
+/************************************************************************************************************************
+ * @brief   S曲线变速控制器变速计算一次
+ ***********************************************************************************************************************/
+void Class_Gear_SCurve::Calculate()
+{
+    float remain;       // 计入本周期已有加速度后的剩余速度差
+    float root;
+    float acc;          // 下一周期加速度
+
+    remain = this->Set_Val - this->Out_Val - this->Acceleration * 0.5f * this->D_T;
+
+    /* 末周期：加速度可在一个周期内减至0，且剩余速度差不超过半个周期的最大变化量，直接到达设定值 */
+    if (Math_Abs(this->Acceleration) <= this->J_D_T && Math_Abs(remain) <= 0.5f * this->J_D_T * this->D_T)
+    {
+        this->Out_Val = this->Set_Val;
+        this->Acceleration = 0.0f;
+        return;
+    }
+
+    /* 求解 a' * D_T / 2 + a' * |a'| / (2 * J_Max) = remain（左式关于 a' 单调） */
+    arm_sqrt_f32(0.25f * this->D_T * this->D_T + 2.0f * Math_Abs(remain) * this->J_Max_Inv, &root);
+    acc = this->J_Max * (root - 0.5f * this->D_T);
+    if (remain < 0.0f)
+    {
+        acc = -acc;
+    }
+
+    /* 加加速度、加速度限幅 */
+    Math_Constrain(&acc, this->Acceleration - this->J_D_T, this->Acceleration + this->J_D_T);
+    Math_Constrain(&acc, -this->A_Max, this->A_Max);
+
+    /* 梯形积分得到输出值 */
+    this->Out_Val += (this->Acceleration + acc) * 0.5f * this->D_T;
+    this->Acceleration = acc;
+}
+
+/************************************************************************************************************************
+ * @brief   S曲线变速控制器复位（输出置为指定值，加速度清零），一般用于电机停止
+ *
+ * @param   __Value     复位后的输出值与设定值
+ ***********************************************************************************************************************/
+void Class_Gear_SCurve::Reset(float __Value)
+{
+    this->Set_Val = __Value;
+    this->Out_Val = __Value;
+    this->Acceleration = 0.0f;
+}
+
+/************************************************************************************************************************
+ * @brief   平面速度变速控制器初始化
+ *
+ * @param   __Step_Linear   每周期平移速度最大变化量（平移加速度限幅 * 计算周期）, 0为不限制
+ * @param   __Step_Angular  每周期角速度最大变化量（角加速度限幅 * 计算周期）, 0为不限制
+ ***********************************************************************************************************************/
+void Class_Gear_Twist::Init(float __Step_Linear, float __Step_Angular)
+{
+    this->Step_Linear = Math_Abs(__Step_Linear);
+    this->Step_Angular = Math_Abs(__Step_Angular);
+}
+
+/************************************************************************************************************************
+ * @brief   平面速度变速控制器变速计算一次
+ ***********************************************************************************************************************/
+void Class_Gear_Twist::Calculate()
+{
+    float delta_x = this->Set_Velocity_X - this->Out_Velocity_X;
+    float delta_y = this->Set_Velocity_Y - this->Out_Velocity_Y;
+    float delta_omega = this->Set_Omega - this->Out_Omega;
+    float delta_linear;
+    float ratio = 1.0f;
+
+    /* 平移加速度限幅 */
+    if (this->Step_Linear != 0.0f)
+    {
+        arm_sqrt_f32(delta_x * delta_x + delta_y * delta_y, &delta_linear);
+        if (delta_linear > this->Step_Linear)
+        {
+            ratio = this->Step_Linear / delta_linear;
+        }
+    }
+
+    /* 旋转角加速度限幅 */
+    if (this->Step_Angular != 0.0f && Math_Abs(delta_omega) * ratio > this->Step_Angular)
+    {
+        ratio = this->Step_Angular / Math_Abs(delta_omega);
+    }
+
+    this->Out_Velocity_X += ratio * delta_x;
+    this->Out_Velocity_Y += ratio * delta_y;
+    this->Out_Omega += ratio * delta_omega;
+}
+
+/************************************************************************************************************************
+ * @brief   平面速度变速控制器复位（设定值、输出值清零），一般用于底盘停止
+ ***********************************************************************************************************************/
+void Class_Gear_Twist::Reset()
+{
+    this->Set_Velocity_X = 0.0f;
+    this->Set_Velocity_Y = 0.0f;
+    this->Set_Omega = 0.0f;
+    this->Out_Velocity_X = 0.0f;
+    this->Out_Velocity_Y = 0.0f;
+    this->Out_Omega = 0.0f;
+}
@@ -0,0 +1,233 @@
+/**
+ * @file    Math_Fast.cpp
+ * @brief   快速数学函数（查表三角函数、多项式反正切、硬件开方、无分支角度归一化）
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.1
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "Math_Fast.h"
+
+/* 全局变量创建 --------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   正弦表 sin(2 * PI * i / MATH_FAST_TABLE_SIZE), i = 0 ~ MATH_FAST_TABLE_SIZE
+ *          （与 CMSIS-DSP sinTable_f32 相同，工程未包含 arm_common_tables.c，故单独保存）
+ */
+static const float Math_Fast_Sin_Table[MATH_FAST_TABLE_SIZE + 1U] =
+{
+     0.000000000e+00f,  1.227153829e-02f,  2.454122852e-02f,  3.680722294e-02f,  4.906767433e-02f,  6.132073630e-02f,
+     7.356456360e-02f,  8.579731234e-02f,  9.801714033e-02f,  1.102222073e-01f,  1.224106752e-01f,  1.345807085e-01f,
+     1.467304745e-01f,  1.588581433e-01f,  1.709618888e-01f,  1.830398880e-01f,  1.950903220e-01f,  2.071113762e-01f,
+     2.191012402e-01f,  2.310581083e-01f,  2.429801799e-01f,  2.548656596e-01f,  2.667127575e-01f,  2.785196894e-01f,
+     2.902846773e-01f,  3.020059493e-01f,  3.136817404e-01f,  3.253102922e-01f,  3.368898534e-01f,  3.484186802e-01f,
+     3.598950365e-01f,  3.713171940e-01f,  3.826834324e-01f,  3.939920401e-01f,  4.052413140e-01f,  4.164295601e-01f,
+     4.275550934e-01f,  4.386162385e-01f,  4.496113297e-01f,  4.605387110e-01f,  4.713967368e-01f,  4.821837721e-01f,
+     4.928981922e-01f,  5.035383837e-01f,  5.141027442e-01f,  5.245896827e-01f,  5.349976199e-01f,  5.453249884e-01f,
+     5.555702330e-01f,  5.657318108e-01f,  5.758081914e-01f,  5.857978575e-01f,  5.956993045e-01f,  6.055110414e-01f,
+     6.152315906e-01f,  6.248594881e-01f,  6.343932842e-01f,  6.438315429e-01f,  6.531728430e-01f,  6.624157776e-01f,
+     6.715589548e-01f,  6.806009978e-01f,  6.895405447e-01f,  6.983762494e-01f,  7.071067812e-01f,  7.157308253e-01f,
+     7.242470830e-01f,  7.326542717e-01f,  7.409511254e-01f,  7.491363945e-01f,  7.572088465e-01f,  7.651672656e-01f,
+     7.730104534e-01f,  7.807372286e-01f,  7.883464276e-01f,  7.958369046e-01f,  8.032075315e-01f,  8.104571983e-01f,
+     8.175848132e-01f,  8.245893028e-01f,  8.314696123e-01f,  8.382247056e-01f,  8.448535652e-01f,  8.513551931e-01f,
+     8.577286100e-01f,  8.639728561e-01f,  8.700869911e-01f,  8.760700942e-01f,  8.819212643e-01f,  8.876396204e-01f,
+     8.932243012e-01f,  8.986744657e-01f,  9.039892931e-01f,  9.091679831e-01f,  9.142097557e-01f,  9.191138517e-01f,
+     9.238795325e-01f,  9.285060805e-01f,  9.329927988e-01f,  9.373390119e-01f,  9.415440652e-01f,  9.456073254e-01f,
+     9.495281806e-01f,  9.533060404e-01f,  9.569403357e-01f,  9.604305194e-01f,  9.637760658e-01f,  9.669764710e-01f,
+     9.700312532e-01f,  9.729399522e-01f,  9.757021300e-01f,  9.783173707e-01f,  9.807852804e-01f,  9.831054874e-01f,
+     9.852776424e-01f,  9.873014182e-01f,  9.891765100e-01f,  9.909026354e-01f,  9.924795346e-01f,  9.939069700e-01f,
+     9.951847267e-01f,  9.963126122e-01f,  9.972904567e-01f,  9.981181129e-01f,  9.987954562e-01f,  9.993223846e-01f,
+     9.996988187e-01f,  9.999247018e-01f,  1.000000000e+00f,  9.999247018e-01f,  9.996988187e-01f,  9.993223846e-01f,
+     9.987954562e-01f,  9.981181129e-01f,  9.972904567e-01f,  9.963126122e-01f,  9.951847267e-01f,  9.939069700e-01f,
+     9.924795346e-01f,  9.909026354e-01f,  9.891765100e-01f,  9.873014182e-01f,  9.852776424e-01f,  9.831054874e-01f,
+     9.807852804e-01f,  9.783173707e-01f,  9.757021300e-01f,  9.729399522e-01f,  9.700312532e-01f,  9.669764710e-01f,
+     9.637760658e-01f,  9.604305194e-01f,  9.569403357e-01f,  9.533060404e-01f,  9.495281806e-01f,  9.456073254e-01f,
+     9.415440652e-01f,  9.373390119e-01f,  9.329927988e-01f,  9.285060805e-01f,  9.238795325e-01f,  9.191138517e-01f,
+     9.142097557e-01f,  9.091679831e-01f,  9.039892931e-01f,  8.986744657e-01f,  8.932243012e-01f,  8.876396204e-01f,
+     8.819212643e-01f,  8.760700942e-01f,  8.700869911e-01f,  8.639728561e-01f,  8.577286100e-01f,  8.513551931e-01f,
+     8.448535652e-01f,  8.382247056e-01f,  8.314696123e-01f,  8.245893028e-01f,  8.175848132e-01f,  8.104571983e-01f,
+     8.032075315e-01f,  7.958369046e-01f,  7.883464276e-01f,  7.807372286e-01f,  7.730104534e-01f,  7.651672656e-01f,
+     7.572088465e-01f,  7.491363945e-01f,  7.409511254e-01f,  7.326542717e-01f,  7.242470830e-01f,  7.157308253e-01f,
+     7.071067812e-01f,  6.983762494e-01f,  6.895405447e-01f,  6.806009978e-01f,  6.715589548e-01f,  6.624157776e-01f,
+     6.531728430e-01f,  6.438315429e-01f,  6.343932842e-01f,  6.248594881e-01f,  6.152315906e-01f,  6.055110414e-01f,
+     5.956993045e-01f,  5.857978575e-01f,  5.758081914e-01f,  5.657318108e-01f,  5.555702330e-01f,  5.453249884e-01f,
+     5.349976199e-01f,  5.245896827e-01f,  5.141027442e-01f,  5.035383837e-01f,  4.928981922e-01f,  4.821837721e-01f,
+     4.713967368e-01f,  4.605387110e-01f,  4.496113297e-01f,  4.386162385e-01f,  4.275550934e-01f,  4.164295601e-01f,
+     4.052413140e-01f,  3.939920401e-01f,  3.826834324e-01f,  3.713171940e-01f,  3.598950365e-01f,  3.484186802e-01f,
+     3.368898534e-01f,  3.253102922e-01f,  3.136817404e-01f,  3.020059493e-01f,  2.902846773e-01f,  2.785196894e-01f,
+     2.667127575e-01f,  2.548656596e-01f,  2.429801799e-01f,  2.310581083e-01f,  2.191012402e-01f,  2.071113762e-01f,
+     1.950903220e-01f,  1.830398880e-01f,  1.709618888e-01f,  1.588581433e-01f,  1.467304745e-01f,  1.345807085e-01f,
+     1.224106752e-01f,  1.102222073e-01f,  9.801714033e-02f,  8.579731234e-02f,  7.356456360e-02f,  6.132073630e-02f,
+     4.906767433e-02f,  3.680722294e-02f,  2.454122852e-02f,  1.227153829e-02f,  0.000000000e+00f, -1.227153829e-02f,
+    -2.454122852e-02f, -3.680722294e-02f, -4.906767433e-02f, -6.132073630e-02f, -7.356456360e-02f, -8.579731234e-02f,
+    -9.801714033e-02f, -1.102222073e-01f, -1.224106752e-01f, -1.345807085e-01f, -1.467304745e-01f, -1.588581433e-01f,
+    -1.709618888e-01f, -1.830398880e-01f, -1.950903220e-01f, -2.071113762e-01f, -2.191012402e-01f, -2.310581083e-01f,
+    -2.429801799e-01f, -2.548656596e-01f, -2.667127575e-01f, -2.785196894e-01f, -2.902846773e-01f, -3.020059493e-01f,
+    -3.136817404e-01f, -3.253102922e-01f, -3.368898534e-01f, -3.484186802e-01f, -3.598950365e-01f, -3.713171940e-01f,
+    -3.826834324e-01f, -3.939920401e-01f, -4.052413140e-01f, -4.164295601e-01f, -4.275550934e-01f, -4.386162385e-01f,
+    -4.496113297e-01f, -4.605387110e-01f, -4.713967368e-01f, -4.821837721e-01f, -4.928981922e-01f, -5.035383837e-01f,
+    -5.141027442e-01f, -5.245896827e-01f, -5.349976199e-01f, -5.453249884e-01f, -5.555702330e-01f, -5.657318108e-01f,
+    -5.758081914e-01f, -5.857978575e-01f, -5.956993045e-01f, -6.055110414e-01f, -6.152315906e-01f, -6.248594881e-01f,
+    -6.343932842e-01f, -6.438315429e-01f, -6.531728430e-01f, -6.624157776e-01f, -6.715589548e-01f, -6.806009978e-01f,
+    -6.895405447e-01f, -6.983762494e-01f, -7.071067812e-01f, -7.157308253e-01f, -7.242470830e-01f, -7.326542717e-01f,
+    -7.409511254e-01f, -7.491363945e-01f, -7.572088465e-01f, -7.651672656e-01f, -7.730104534e-01f, -7.807372286e-01f,
+    -7.883464276e-01f, -7.958369046e-01f, -8.032075315e-01f, -8.104571983e-01f, -8.175848132e-01f, -8.245893028e-01f,
+    -8.314696123e-01f, -8.382247056e-01f, -8.448535652e-01f, -8.513551931e-01f, -8.577286100e-01f, -8.639728561e-01f,
+    -8.700869911e-01f, -8.760700942e-01f, -8.819212643e-01f, -8.876396204e-01f, -8.932243012e-01f, -8.986744657e-01f,
+    -9.039892931e-01f, -9.091679831e-01f, -9.142097557e-01f, -9.191138517e-01f, -9.238795325e-01f, -9.285060805e-01f,
+    -9.329927988e-01f, -9.373390119e-01f, -9.415440652e-01f, -9.456073254e-01f, -9.495281806e-01f, -9.533060404e-01f,
+    -9.569403357e-01f, -9.604305194e-01f, -9.637760658e-01f, -9.669764710e-01f, -9.700312532e-01f, -9.729399522e-01f,
+    -9.757021300e-01f, -9.783173707e-01f, -9.807852804e-01f, -9.831054874e-01f, -9.852776424e-01f, -9.873014182e-01f,
+    -9.891765100e-01f, -9.909026354e-01f, -9.924795346e-01f, -9.939069700e-01f, -9.951847267e-01f, -9.963126122e-01f,
+    -9.972904567e-01f, -9.981181129e-01f, -9.987954562e-01f, -9.993223846e-01f, -9.996988187e-01f, -9.999247018e-01f,
+    -1.000000000e+00f, -9.999247018e-01f, -9.996988187e-01f, -9.993223846e-01f, -9.987954562e-01f, -9.981181129e-01f,
+    -9.972904567e-01f, -9.963126122e-01f, -9.951847267e-01f, -9.939069700e-01f, -9.924795346e-01f, -9.909026354e-01f,
+    -9.891765100e-01f, -9.873014182e-01f, -9.852776424e-01f, -9.831054874e-01f, -9.807852804e-01f, -9.783173707e-01f,
+    -9.757021300e-01f, -9.729399522e-01f, -9.700312532e-01f, -9.669764710e-01f, -9.637760658e-01f, -9.604305194e-01f,
+    -9.569403357e-01f, -9.533060404e-01f, -9.495281806e-01f, -9.456073254e-01f, -9.415440652e-01f, -9.373390119e-01f,
+    -9.329927988e-01f, -9.285060805e-01f, -9.238795325e-01f, -9.191138517e-01f, -9.142097557e-01f, -9.091679831e-01f,
+    -9.039892931e-01f, -8.986744657e-01f, -8.932243012e-01f, -8.876396204e-01f, -8.819212643e-01f, -8.760700942e-01f,
+    -8.700869911e-01f, -8.639728561e-01f, -8.577286100e-01f, -8.513551931e-01f, -8.448535652e-01f, -8.382247056e-01f,
+    -8.314696123e-01f, -8.245893028e-01f, -8.175848132e-01f, -8.104571983e-01f, -8.032075315e-01f, -7.958369046e-01f,
+    -7.883464276e-01f, -7.807372286e-01f, -7.730104534e-01f, -7.651672656e-01f, -7.572088465e-01f, -7.491363945e-01f,
+    -7.409511254e-01f, -7.326542717e-01f, -7.242470830e-01f, -7.157308253e-01f, -7.071067812e-01f, -6.983762494e-01f,
+    -6.895405447e-01f, -6.806009978e-01f, -6.715589548e-01f, -6.624157776e-01f, -6.531728430e-01f, -6.438315429e-01f,
+    -6.343932842e-01f, -6.248594881e-01f, -6.152315906e-01f, -6.055110414e-01f, -5.956993045e-01f, -5.857978575e-01f,
+    -5.758081914e-01f, -5.657318108e-01f, -5.555702330e-01f, -5.453249884e-01f, -5.349976199e-01f, -5.245896827e-01f,
+    -5.141027442e-01f, -5.035383837e-01f, -4.928981922e-01f, -4.821837721e-01f, -4.713967368e-01f, -4.605387110e-01f,
+    -4.496113297e-01f, -4.386162385e-01f, -4.275550934e-01f, -4.164295601e-01f, -4.052413140e-01f, -3.939920401e-01f,
+    -3.826834324e-01f, -3.713171940e-01f, -3.598950365e-01f, -3.484186802e-01f, -3.368898534e-01f, -3.253102922e-01f,
+    -3.136817404e-01f, -3.020059493e-01f, -2.902846773e-01f, -2.785196894e-01f, -2.667127575e-01f, -2.548656596e-01f,
+    -2.429801799e-01f, -2.310581083e-01f, -2.191012402e-01f, -2.071113762e-01f, -1.950903220e-01f, -1.830398880e-01f,
+    -1.709618888e-01f, -1.588581433e-01f, -1.467304745e-01f, -1.345807085e-01f, -1.224106752e-01f, -1.102222073e-01f,
+    -9.801714033e-02f, -8.579731234e-02f, -7.356456360e-02f, -6.132073630e-02f, -4.906767433e-02f, -3.680722294e-02f,
+    -2.454122852e-02f, -1.227153829e-02f,  0.000000000e+00f
+};
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/************************************************************************************************************************
+ * @brief   同时计算正弦、余弦（查表 + 三次 Hermite 插值，导数同样由表得到，与 arm_sin_cos_f32 算法相同）
+ * @note    |x| <= PI 时最大绝对误差约 4.2e-7（主机测量），误差随 |x| 增大按 x 的浮点精度增长（|x| <= 100 时约 7e-6）
+ *
+ * @param   x       角度 (rad)
+ * @param   Sin     正弦输出（可为 NULL）
+ * @param   Cos     余弦输出（可为 NULL）
+ ***********************************************************************************************************************/
+void Math_Fast_Sin_Cos(float x, float *Sin, float *Cos)
+{
+    const float delta = 2.0f * PI / MATH_FAST_TABLE_SIZE;
+    float turn;         // 归一化到 [0, 1) 的圈数
+    float index_f;
+    float fract;        // 插值系数
+    uint32_t index_s;   // 正弦表下标
+    uint32_t index_c;   // 余弦表下标（正弦表下标 + 1/4 周期）
+    float s1, s2, c1, c2;
+    float fract_2, fract_3;
+
+    /* 计算表下标与插值系数 */
+    turn = x * (0.5f / PI);
+    turn -= Math_Fast_Floor(turn);
+    index_f = turn * MATH_FAST_TABLE_SIZE;
+    index_s = (uint32_t)index_f;
+    fract = index_f - (float)index_s;
+    index_s &= MATH_FAST_TABLE_SIZE - 1U;
+    index_c = (index_s + MATH_FAST_TABLE_SIZE / 4U) & (MATH_FAST_TABLE_SIZE - 1U);
+
+    s1 = Math_Fast_Sin_Table[index_s];
+    s2 = Math_Fast_Sin_Table[index_s + 1U];
+    c1 = Math_Fast_Sin_Table[index_c];
+    c2 = Math_Fast_Sin_Table[index_c + 1U];
+
+    /* 三次 Hermite 插值：p(t) = f1 + t * d1 + t^2 * (3 * (f2 - f1) - 2 * d1 - d2) + t^3 * (d1 + d2 - 2 * (f2 - f1)) */
+    fract_2 = fract * fract;
+    fract_3 = fract_2 * fract;
+    if (Sin != NULL)
+    {
+        /* sin' = cos */
+        float d1 = c1 * delta;
+        float d2 = c2 * delta;
+        float diff = s2 - s1;
+
+        *Sin = s1 + fract * d1 + fract_2 * (3.0f * diff - 2.0f * d1 - d2) + fract_3 * (d1 + d2 - 2.0f * diff);
+    }
+    if (Cos != NULL)
+    {
+        /* cos' = -sin */
+        float d1 = -s1 * delta;
+        float d2 = -s2 * delta;
+        float diff = c2 - c1;
+
+        *Cos = c1 + fract * d1 + fract_2 * (3.0f * diff - 2.0f * d1 - d2) + fract_3 * (d1 + d2 - 2.0f * diff);
+    }
+}
+
+/************************************************************************************************************************
+ * @brief   正弦（查表）
+ *
+ * @param   x       角度 (rad)
+ * @return  float   sin(x)
+ ***********************************************************************************************************************/
+float Math_Fast_Sin(float x)
+{
+    float out;
+
+    Math_Fast_Sin_Cos(x, &out, NULL);
+    return (out);
+}
+
+/************************************************************************************************************************
+ * @brief   余弦（查表）
+ *
+ * @param   x       角度 (rad)
+ * @return  float   cos(x)
+ ***********************************************************************************************************************/
+float Math_Fast_Cos(float x)
+{
+    float out;
+
+    Math_Fast_Sin_Cos(x, NULL, &out);
+    return (out);
+}
+
+/************************************************************************************************************************
+ * @brief   反正切（象限还原 + 多项式逼近，Abramowitz & Stegun 4.4.49）
+ * @note    atan(z) = z * (1 + a2 z^2 + ... + a16 z^16), |z| <= 1，多项式截断误差 2e-8，
+ *          单精度计算最大绝对误差 3.1e-7 rad（主机测量 3.001e-7，含结果在 ±PI 附近的单精度舍入）
+ *
+ * @param   y       纵坐标
+ * @param   x       横坐标
+ * @return  float   atan2(y, x)，范围 [-PI, PI]，x、y 均为0时返回0
+ ***********************************************************************************************************************/
+float Math_Fast_Atan2(float y, float x)
+{
+    float abs_x = fabsf(x);     // Math_Abs(+0) 为 -0，此处需保留 atan2(+0, x) 的符号
+    float abs_y = fabsf(y);
+    float z;
+    float z_2;
+    float out;
+
+    if (abs_x == 0.0f && abs_y == 0.0f)
+    {
+        return (0.0f);
+    }
+
+    /* 化到 [0, 1] 区间 */
+    z = (abs_y < abs_x) ? (abs_y / abs_x) : (abs_x / abs_y);
+    z_2 = z * z;
+    out = z * (1.0f + z_2 * (-0.3333314528f + z_2 * (0.1999355085f + z_2 * (-0.1420889944f + z_2 * (0.1065626393f +
+          z_2 * (-0.0752896400f + z_2 * (0.0429096138f + z_2 * (-0.0161657367f + z_2 * 0.0028662257f))))))));
+
+    /* 象限还原 */
+    if (abs_y > abs_x)
+    {
+        out = 0.5f * PI - out;
+    }
+    if (x < 0.0f)
+    {
+        out = PI - out;
+    }
+
+    /* 取 y 的符号（含 -0：atan2(-0, -x) = -PI） */
+    return (copysignf(out, y));
+}
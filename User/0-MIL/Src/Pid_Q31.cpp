@@ -0,0 +1,126 @@
+/**
+ * @file    Pid_Q31.cpp
+ * @brief   定点PID算法（Q31，基于CMSIS-DSP arm_pid_q31）
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "Pid_Q31.h"
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/************************************************************************************************************************
+ * @brief   Q31定标初始化
+ *
+ * @param   __Full_Scale    满量程（Q31 的 1.0 对应的实际值，需大于0；整型换算时需不小于1）
+ ***********************************************************************************************************************/
+void Class_Q31_Scale::Init(float __Full_Scale)
+{
+    this->Full_Scale = __Full_Scale;
+    this->Float_To_Q31 = 2147483648.0f / __Full_Scale;
+    this->Q31_To_Float = __Full_Scale / 2147483648.0f;
+    this->Raw_Gain = (q63_t)(2147483648.0 / __Full_Scale + 0.5);
+    this->Full_Scale_Q8 = (int32_t)(__Full_Scale * 256.0f + 0.5f);
+}
+
+/************************************************************************************************************************
+ * @brief   Q31定点PID初始化（参数均为实际单位，内部完成定标）
+ *
+ * @param   __K_P           P参数
+ * @param   __K_I           I参数
+ * @param   __K_D           D参数
+ * @param   __I_Out_Max     积分输出限幅, 0为限幅至 __Out_Max
+ * @param   __Out_Max       输出限幅（需大于0）
+ * @param   __Error_Max     目标值、实际值满量程（超出部分饱和）
+ * @param   __D_T           控制周期 (s)
+ * @return  float           误差饱和阈值（增益过大时误差放大定标，阈值小于 __Error_Max）
+ ***********************************************************************************************************************/
+float Class_PID_Q31::Init(float __K_P, float __K_I, float __K_D, float __I_Out_Max, float __Out_Max, float __Error_Max,
+                          float __D_T)
+{
+    float k_p = __K_P;
+    float k_i = __K_I * __D_T;
+    float k_d = __K_D / __D_T;
+    float i_out_max = (__I_Out_Max != 0.0f) ? __I_Out_Max : __Out_Max;
+    float out_scale = 4.0f * ((i_out_max > __Out_Max) ? i_out_max : __Out_Max);
+    float coef_sum = Math_Abs(k_p + k_i + k_d) + Math_Abs(k_p + 2.0f * k_d) + Math_Abs(k_d);
+    float error_scale = __Error_Max;
+    float ratio;
+    float gain;
+
+    this->Scale_Error.Init(__Error_Max);
+    this->Scale_Out.Init(out_scale);
+
+    /* 误差定标（保证 |A0|+|A1|+|A2| <= 0.7，积分项不超过 0.25，中间结果不溢出） */
+    if (coef_sum * error_scale > 0.7f * out_scale)
+    {
+        error_scale = 0.7f * out_scale / coef_sum;
+    }
+    /* 放大倍数 __Error_Max / error_scale 拆分为 Error_Gain（[0.5, 1) Q31）* 2^Error_Shift */
+    ratio = __Error_Max / error_scale;
+    this->Error_Shift = 0;
+    while (ratio >= 1.0f && this->Error_Shift < 31U)
+    {
+        ratio *= 0.5f;
+        this->Error_Shift += 1;
+    }
+    this->Error_Gain = (q31_t)(ratio * 2147483648.0f);
+
+    /* 参数定标 */
+    gain = error_scale / out_scale * 2147483648.0f;
+    this->PID_Instance.Kp = (q31_t)(k_p * gain);
+    this->PID_Instance.Ki = (q31_t)(k_i * gain);
+    this->PID_Instance.Kd = (q31_t)(k_d * gain);
+    arm_pid_init_q31(&this->PID_Instance, 1);
+
+    /* 限幅定标 */
+    this->I_Out_Max_Q31 = this->Scale_Out.To_Q31(i_out_max);
+    this->Out_Max_Q31 = this->Scale_Out.To_Q31(__Out_Max);
+
+    this->Target = 0;
+    this->Actual = 0;
+    this->Out = 0;
+
+    return (error_scale);
+}
+
+/************************************************************************************************************************
+ * @brief   Q31定点PID计算输出值
+ ***********************************************************************************************************************/
+void Class_PID_Q31::Calculate()
+{
+    q31_t error;        // 误差
+    q31_t pd_out;       // P输出 + D输出
+    q31_t i_out;        // I输出
+    q31_t out;          // 输出（限幅前）
+
+    /* 计算误差（饱和）并按增益定标放大（饱和） */
+    error = clip_q63_to_q31((q63_t)this->Target - this->Actual);
+    error = clip_q63_to_q31(((q63_t)error * this->Error_Gain) >> (31U - this->Error_Shift));
+
+    /* 增量式计算 y[n] = y[n-1] + A0 * e[n] + A1 * e[n-1] + A2 * e[n-2] */
+    out = arm_pid_q31(&this->PID_Instance, error);
+
+    /* 反推积分项并限幅（计算后 state[1] 为 e[n-1]） */
+    pd_out = (q31_t)(((q63_t)this->PID_Instance.Kp * error +
+                      (q63_t)this->PID_Instance.Kd * ((q63_t)error - this->PID_Instance.state[1])) >> 31);
+    i_out = out - pd_out;
+    Math_Constrain(&i_out, -this->I_Out_Max_Q31, this->I_Out_Max_Q31);
+    out = pd_out + i_out;
+    this->PID_Instance.state[2] = out;
+
+    /* 输出限幅 */
+    Math_Constrain(&out, -this->Out_Max_Q31, this->Out_Max_Q31);
+    this->Out = out;
+}
+
+/************************************************************************************************************************
+ * @brief   Q31定点PID状态清零（含积分项），一般用于电机停止或掉线
+ ***********************************************************************************************************************/
+void Class_PID_Q31::Reset()
+{
+    arm_pid_reset_q31(&this->PID_Instance);
+    this->Out = 0;
+}
@@ -0,0 +1,87 @@
+/**
+ * @file    Quaternion.cpp
+ * @brief   四元数与旋转矩阵运算库（基于 CMSIS-DSP QuaternionMathFunctions）
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "Quaternion.h"
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/************************************************************************************************************************
+ * @brief   四元数转欧拉角（ZYX 顺序：先偏航、再俯仰、后横滚）
+ * @note    反正切使用 Math_Fast_Atan2，俯仰角 asin(s) 按 atan2(s, sqrt(1 - s^2)) 计算，奇异点（俯仰 ±90°）附近横滚、偏航不唯一
+ *
+ * @param   __Q         单位四元数
+ * @param   __Roll      横滚角输出 (rad)，范围 [-PI, PI]
+ * @param   __Pitch     俯仰角输出 (rad)，范围 [-PI/2, PI/2]
+ * @param   __Yaw       偏航角输出 (rad)，范围 [-PI, PI]
+ ***********************************************************************************************************************/
+void Math_Quaternion_To_Euler(const Class_Quaternion & __Q, float * __Roll, float * __Pitch, float * __Yaw)
+{
+    float w = __Q[0], x = __Q[1], y = __Q[2], z = __Q[3];
+    float sin_pitch = 2.0f * (w * y - z * x);
+
+    Math_Constrain(&sin_pitch, -1.0f, 1.0f);
+
+    *__Roll = Math_Fast_Atan2(2.0f * (w * x + y * z), 1.0f - 2.0f * (x * x + y * y));
+    *__Pitch = Math_Fast_Atan2(sin_pitch, Math_Fast_Sqrt(1.0f - sin_pitch * sin_pitch));
+    *__Yaw = Math_Fast_Atan2(2.0f * (w * z + x * y), 1.0f - 2.0f * (y * y + z * z));
+}
+
+/************************************************************************************************************************
+ * @brief   姿态积分一步（指数映射）
+ * @note    q(t + dt) = q(t) ⊗ exp(omega * dt / 2)，角速度在周期内视为常值，无一阶欧拉积分的模长漂移；
+ *          半转角小于 QUATERNION_SMALL_ANGLE 时 cos、sin(a)/a 用泰勒展开（无三角函数、无开方），
+ *          1kHz 下转速低于 100 rad/s 均走该分支；结果不做归一化，可每周期或批量调用 Math_Quaternion_Normalize
+ *
+ * @param   __Q         当前姿态（机体系 -> 参考系）
+ * @param   __Omega     机体系角速度 (rad/s)
+ * @param   __D_T       积分步长 (s)
+ * @return  Class_Quaternion    积分后姿态
+ ***********************************************************************************************************************/
+Class_Quaternion Math_Quaternion_Integrate(const Class_Quaternion & __Q, const Class_Vector<3> & __Omega, float __D_T)
+{
+    float half_dt = 0.5f * __D_T;
+    float h_x = __Omega[0] * half_dt;
+    float h_y = __Omega[1] * half_dt;
+    float h_z = __Omega[2] * half_dt;
+    float angle_2 = h_x * h_x + h_y * h_y + h_z * h_z;
+    float cos_a, sinc_a;
+
+    if (angle_2 < QUATERNION_SMALL_ANGLE * QUATERNION_SMALL_ANGLE)
+    {
+        /* cos(a) = 1 - a^2 / 2 + a^4 / 24, sin(a) / a = 1 - a^2 / 6 + a^4 / 120 */
+        cos_a = 1.0f - angle_2 * (0.5f - angle_2 * (1.0f / 24.0f));
+        sinc_a = 1.0f - angle_2 * ((1.0f / 6.0f) - angle_2 * (1.0f / 120.0f));
+    }
+    else
+    {
+        float angle = Math_Fast_Sqrt(angle_2);
+        float sin_a;
+
+        Math_Fast_Sin_Cos(angle, &sin_a, &cos_a);
+        sinc_a = sin_a / angle;
+    }
+
+    return (__Q * Class_Quaternion{{cos_a, sinc_a * h_x, sinc_a * h_y, sinc_a * h_z}});
+}
+
+/************************************************************************************************************************
+ * @brief   四元数旋转向量（不构造旋转矩阵）
+ * @note    v' = v + w t + u x t, t = 2 u x v（u 为四元数虚部），共 15 次乘法
+ *
+ * @param   __Q         单位四元数
+ * @param   __V         向量
+ * @return  Class_Vector<3>     q v q*
+ ***********************************************************************************************************************/
+Class_Vector<3> Math_Quaternion_Rotate(const Class_Quaternion & __Q, const Class_Vector<3> & __V)
+{
+    Class_Vector<3> u = {{__Q[1], __Q[2], __Q[3]}};
+    Class_Vector<3> t = Math_Vector_Cross(u, __V) * 2.0f;
+
+    return (__V + t * __Q[0] + Math_Vector_Cross(u, t));
+}
@@ -0,0 +1,177 @@
+/**
+ * @file    Relay_Tune.cpp
+ * @brief   继电反馈PID自整定（Astrom-Hagglund）
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "Relay_Tune.h"
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/************************************************************************************************************************
+ * @brief   继电自整定初始化
+ *
+ * @param   __Relay_Amplitude   继电幅值 d（与被整定PID输出同单位）
+ * @param   __Hysteresis        滞环宽度 eps（与被控量同单位，需大于测量噪声）
+ * @param   __D_T               调用周期 (s)
+ * @param   __Cycles            参与平均的振荡周期数
+ * @param   __Timeout           超时（调用次数）, 0为不限制
+ ***********************************************************************************************************************/
+void Class_Relay_Tune::Init(float __Relay_Amplitude, float __Hysteresis, float __D_T, uint8_t __Cycles, uint32_t __Timeout)
+{
+    this->Relay_Amplitude = Math_Abs(__Relay_Amplitude);
+    this->Hysteresis = Math_Abs(__Hysteresis);
+    this->D_T = __D_T;
+    this->Cycles = (__Cycles == 0U) ? 1U : __Cycles;
+    this->Timeout = __Timeout;
+    this->State = Relay_Tune_Idle;
+}
+
+/************************************************************************************************************************
+ * @brief   开始继电实验
+ *
+ * @param   __Setpoint  设定值（振荡中心）
+ * @param   __Bias      输出偏置（维持设定值附近工作点的输出，速度环可取设定值对应的开环输出）
+ ***********************************************************************************************************************/
+void Class_Relay_Tune::Start(float __Setpoint, float __Bias)
+{
+    this->Setpoint = __Setpoint;
+    this->Bias = __Bias;
+    this->Relay_Sign = 1;
+    this->Out = __Bias + this->Relay_Amplitude;
+    this->Cycle_Counter = 0U;
+    this->Tick = 0U;
+    this->Pre_Rising_Tick = 0U;
+    this->Peak_Max = -FLT_MAX;
+    this->Peak_Min = FLT_MAX;
+    this->Sum_Amplitude = 0.0f;
+    this->Sum_Period = 0.0f;
+    this->K_U = 0.0f;
+    this->T_U = 0.0f;
+    this->State = Relay_Tune_Running;
+}
+
+/************************************************************************************************************************
+ * @brief   继电实验计算一次（按 D_T 周期调用，调用前 Set_Actual）
+ ***********************************************************************************************************************/
+void Class_Relay_Tune::Calculate()
+{
+    float error;
+    float amplitude;
+
+    if (this->State != Relay_Tune_Running)
+    {
+        return;
+    }
+
+    this->Tick += 1U;
+    error = this->Setpoint - this->Actual;
+
+    /* 记录峰值 */
+    if (this->Actual > this->Peak_Max)
+    {
+        this->Peak_Max = this->Actual;
+    }
+    if (this->Actual < this->Peak_Min)
+    {
+        this->Peak_Min = this->Actual;
+    }
+
+    /* 继电切换（带滞环） */
+    if (this->Relay_Sign > 0 && error < -this->Hysteresis)
+    {
+        this->Relay_Sign = -1;
+    }
+    else if (this->Relay_Sign < 0 && error > this->Hysteresis)
+    {
+        /* 正向切换，完成一个振荡周期 */
+        this->Relay_Sign = 1;
+
+        if (this->Cycle_Counter > 0U)
+        {
+            this->Sum_Amplitude += (this->Peak_Max - this->Peak_Min) * 0.5f;
+            this->Sum_Period += (float)(this->Tick - this->Pre_Rising_Tick) * this->D_T;
+        }
+        this->Cycle_Counter += 1U;
+        this->Pre_Rising_Tick = this->Tick;
+        this->Peak_Max = this->Actual;
+        this->Peak_Min = this->Actual;
+
+        /* 首个周期为过渡过程，之后 Cycles 个周期取平均 */
+        if (this->Cycle_Counter > this->Cycles)
+        {
+            amplitude = this->Sum_Amplitude / this->Cycles;
+            this->T_U = this->Sum_Period / this->Cycles;
+
+            if (amplitude > this->Hysteresis)
+            {
+                arm_sqrt_f32(amplitude * amplitude - this->Hysteresis * this->Hysteresis, &amplitude);
+                this->K_U = 4.0f * this->Relay_Amplitude / (PI * amplitude);
+                this->State = Relay_Tune_Done;
+            }
+            else
+            {
+                this->State = Relay_Tune_Failed;
+            }
+        }
+    }
+    this->Out = this->Bias + this->Relay_Sign * this->Relay_Amplitude;
+
+    /* 超时判断 */
+    if (this->State == Relay_Tune_Running && this->Timeout != 0U && this->Tick >= this->Timeout)
+    {
+        this->State = Relay_Tune_Failed;
+    }
+    if (this->State != Relay_Tune_Running)
+    {
+        this->Out = this->Bias;
+    }
+}
+
+/************************************************************************************************************************
+ * @brief   按整定规则计算PID参数（Class_PID 形式：K_I = K_P / T_I, K_D = K_P * T_D）
+ *
+ * @param   __Rule  整定规则
+ * @param   __K_P   P参数输出
+ * @param   __K_I   I参数输出
+ * @param   __K_D   D参数输出
+ * @return  bool    是否有效（自整定完成）
+ ***********************************************************************************************************************/
+bool Class_Relay_Tune::Get_Gains(Enum_Relay_Tune_Rule __Rule, float * __K_P, float * __K_I, float * __K_D)
+{
+    if (this->State != Relay_Tune_Done || this->T_U <= 0.0f)
+    {
+        return (false);
+    }
+
+    switch (__Rule)
+    {
+        case (Relay_Tune_Rule_ZN_PI):
+        {
+            *__K_P = 0.45f * this->K_U;
+            *__K_I = *__K_P * 1.2f / this->T_U;
+            *__K_D = 0.0f;
+            break;
+        }
+        case (Relay_Tune_Rule_ZN_PID):
+        {
+            *__K_P = 0.6f * this->K_U;
+            *__K_I = *__K_P * 2.0f / this->T_U;
+            *__K_D = *__K_P * this->T_U * 0.125f;
+            break;
+        }
+        case (Relay_Tune_Rule_TL_PI):
+        default:
+        {
+            *__K_P = this->K_U / 3.2f;
+            *__K_I = *__K_P / (2.2f * this->T_U);
+            *__K_D = 0.0f;
+            break;
+        }
+    }
+
+    return (true);
+}
@@ -0,0 +1,270 @@
+/**
+ * @file    Telemetry_Codec.cpp
+ * @brief   遥测压缩编解码（定点量化 + 相对关键帧的 zigzag/varint 差分）
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.1
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "Telemetry_Codec.h"
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/************************************************************************************************************************
+ * @brief   四舍五入取整
+ ***********************************************************************************************************************/
+static inline int32_t Codec_Round(double __Value)
+{
+    return ((int32_t) (__Value + ((__Value >= 0.0) ? 0.5 : -0.5)));
+}
+
+/************************************************************************************************************************
+ * @brief   varint 编码长度
+ ***********************************************************************************************************************/
+static inline uint8_t Codec_Varint_Length(uint32_t __Value)
+{
+    uint8_t length = 1U;
+
+    while (__Value >= 0x80U)
+    {
+        __Value >>= 7;
+        length += 1U;
+    }
+
+    return (length);
+}
+
+/************************************************************************************************************************
+ * @brief   遥测编码类构造函数
+ * @note    按各字段量程计算量化上下限与编码后最大长度（关键帧取量程端点，差分帧取量程全幅）
+ *
+ * @param   __Field         字段描述表（需在对象生命周期内有效，通常为 const 全局数组）
+ * @param   __Field_Number  字段数（不超过 CODEC_FIELD_MAX）
+ * @param   __Key_Period    关键帧周期（帧数）
+ ***********************************************************************************************************************/
+Class_Telemetry_Encoder::Class_Telemetry_Encoder(const Struct_Codec_Field * __Field, uint8_t __Field_Number,
+                                                 uint16_t __Key_Period)
+{
+    this->Field = __Field;
+    this->Field_Number = (__Field_Number < CODEC_FIELD_MAX) ? __Field_Number : CODEC_FIELD_MAX;
+    this->Key_Period = (__Key_Period > 0U) ? __Key_Period : 1U;
+    this->Length_MAX = 1U;
+
+    for (uint8_t i = 0; i < this->Field_Number; i++)
+    {
+        this->Scale[i] = 1.0 / (double) __Field[i].Resolution;
+        this->Code_Min[i] = Codec_Round(__Field[i].Min * this->Scale[i]);
+        this->Code_Max[i] = Codec_Round(__Field[i].Max * this->Scale[i]);
+
+        uint32_t key_max = Codec_Zigzag(this->Code_Min[i]);
+        uint32_t delta_max = Codec_Zigzag(this->Code_Max[i] - this->Code_Min[i]);
+
+        key_max = (Codec_Zigzag(this->Code_Max[i]) > key_max) ? Codec_Zigzag(this->Code_Max[i]) : key_max;
+        this->Length_MAX += Codec_Varint_Length((key_max > delta_max) ? key_max : delta_max);
+    }
+    memset(this->Key_Tag, CODEC_ACK_NONE, sizeof(this->Key_Tag));
+}
+
+/************************************************************************************************************************
+ * @brief   编码一帧
+ * @note    先处理待确认序号（切换差分基准），再量化；到关键帧周期时编码为关键帧，尚无基准时编码为独立帧，否则相对基准差分
+ *
+ * @param   __Value     各字段数值（按字段描述表顺序）
+ * @param   __Data      输出
+ * @param   __Size      输出缓冲区长度（小于 Get_Length_MAX 时不编码）
+ * @return  uint8_t     编码长度 (byte)，0为未编码
+ ***********************************************************************************************************************/
+uint8_t Class_Telemetry_Encoder::Encode(const float * __Value, uint8_t * __Data, uint8_t __Size)
+{
+    const uint8_t number = this->Field_Number;
+    int32_t code[CODEC_FIELD_MAX];
+    uint8_t length = 1U;
+
+    if (__Size < this->Length_MAX)
+    {
+        return (0U);
+    }
+
+    /* 确认处理：确认的关键帧仍在记录中时作为新的差分基准 */
+    uint8_t ack = this->Ack;
+
+    if (ack != CODEC_ACK_NONE)
+    {
+        uint8_t slot = ack & (CODEC_KEY_HISTORY - 1U);
+
+        this->Ack = CODEC_ACK_NONE;
+        if (this->Key_Tag[slot] == ack)
+        {
+            memcpy(this->Reference, this->Key[slot], number * sizeof(int32_t));
+            this->Reference_Sequence = ack;
+        }
+    }
+
+    /* 量化（按 double 计算：大量程字段的量化值超出 float 的24位精度；限幅，NaN 取下限） */
+    for (uint8_t i = 0; i < number; i++)
+    {
+        double scaled = (double) __Value[i] * this->Scale[i];
+
+        if (!(scaled > (double) this->Code_Min[i]))
+        {
+            code[i] = this->Code_Min[i];
+        }
+        else if (scaled >= (double) this->Code_Max[i])
+        {
+            code[i] = this->Code_Max[i];
+        }
+        else
+        {
+            code[i] = Codec_Round(scaled);
+        }
+    }
+
+    bool keyframe = (this->Key_Counter == 0U);
+
+    this->Key_Counter = (this->Key_Counter + 1U < this->Key_Period) ? (this->Key_Counter + 1U) : 0U;
+
+    if (keyframe || this->Reference_Sequence == CODEC_ACK_NONE)
+    {
+        if (keyframe)
+        {
+            /* 关键帧：记录待确认（序号跳过 CODEC_SEQUENCE_NONE） */
+            uint8_t sequence = this->Key_Sequence;
+            uint8_t slot = sequence & (CODEC_KEY_HISTORY - 1U);
+
+            this->Key_Sequence = (sequence + 1U < CODEC_SEQUENCE_NONE) ? (sequence + 1U) : 0U;
+            memcpy(this->Key[slot], code, number * sizeof(int32_t));
+            this->Key_Tag[slot] = sequence;
+            this->Keyframe_Number += 1U;
+            __Data[0] = CODEC_KEYFRAME | sequence;
+        }
+        else
+        {
+            /* 独立帧 */
+            __Data[0] = CODEC_KEYFRAME | CODEC_SEQUENCE_NONE;
+        }
+
+        for (uint8_t i = 0; i < number; i++)
+        {
+            length += Codec_Varint_Encode(Codec_Zigzag(code[i]), &__Data[length]);
+        }
+    }
+    else
+    {
+        /* 差分帧 */
+        __Data[0] = this->Reference_Sequence;
+        for (uint8_t i = 0; i < number; i++)
+        {
+            length += Codec_Varint_Encode(Codec_Zigzag(code[i] - this->Reference[i]), &__Data[length]);
+        }
+    }
+
+    return (length);
+}
+
+/************************************************************************************************************************
+ * @brief   遥测解码类构造函数
+ *
+ * @param   __Field         字段描述表（需与编码端一致）
+ * @param   __Field_Number  字段数（不超过 CODEC_FIELD_MAX）
+ ***********************************************************************************************************************/
+Class_Telemetry_Decoder::Class_Telemetry_Decoder(const Struct_Codec_Field * __Field, uint8_t __Field_Number)
+{
+    this->Field = __Field;
+    this->Field_Number = (__Field_Number < CODEC_FIELD_MAX) ? __Field_Number : CODEC_FIELD_MAX;
+    this->Reset();
+}
+
+/************************************************************************************************************************
+ * @brief   解码一帧
+ * @note    关键帧记录后返回 Codec_Keyframe，调用方需向编码端确认 *__Sequence；
+ *          数值按 double 反量化（大量程字段的量化值超出 float 的24位精度）
+ *
+ * @param   __Data      编码数据
+ * @param   __Length    编码长度
+ * @param   __Value     各字段数值（输出，仅在返回值不为 Codec_Invalid 时写入）
+ * @param   __Sequence  关键帧序号（输出）
+ * @return  Enum_Codec_Result   解码结果
+ ***********************************************************************************************************************/
+Enum_Codec_Result Class_Telemetry_Decoder::Decode(const uint8_t * __Data, uint8_t __Length, float * __Value,
+                                                  uint8_t * __Sequence)
+{
+    const uint8_t number = this->Field_Number;
+    const uint8_t * end = __Data + __Length;
+    int32_t code[CODEC_FIELD_MAX];
+
+    if (__Length == 0U)
+    {
+        return (Codec_Invalid);
+    }
+
+    uint8_t head = *__Data++;
+    uint8_t sequence = head & CODEC_SEQUENCE_MASK;
+    uint8_t slot = sequence & (CODEC_KEY_HISTORY - 1U);
+
+    /* varint 解码（超过5字节或提前结束为格式错误） */
+    for (uint8_t i = 0; i < number; i++)
+    {
+        uint32_t value = 0U;
+        uint8_t shift = 0U;
+        uint8_t byte;
+
+        do
+        {
+            if (__Data == end || shift > 28U)
+            {
+                return (Codec_Invalid);
+            }
+            byte = *__Data++;
+            value |= (uint32_t) (byte & 0x7FU) << shift;
+            shift += 7U;
+        } while (byte & 0x80U);
+
+        code[i] = Codec_Unzigzag(value);
+    }
+    if (__Data != end)
+    {
+        return (Codec_Invalid);
+    }
+
+    Enum_Codec_Result result;
+
+    if (head == (CODEC_KEYFRAME | CODEC_SEQUENCE_NONE))
+    {
+        result = Codec_Absolute;
+    }
+    else if (head & CODEC_KEYFRAME)
+    {
+        memcpy(this->Key[slot], code, number * sizeof(int32_t));
+        this->Key_Tag[slot] = sequence;
+        result = Codec_Keyframe;
+    }
+    else
+    {
+        if (sequence == CODEC_SEQUENCE_NONE || this->Key_Tag[slot] != sequence)
+        {
+            return (Codec_Invalid);
+        }
+        for (uint8_t i = 0; i < number; i++)
+        {
+            code[i] += this->Key[slot][i];
+        }
+        result = Codec_Delta;
+    }
+
+    for (uint8_t i = 0; i < number; i++)
+    {
+        __Value[i] = (float) ((double) code[i] * this->Field[i].Resolution);
+    }
+    *__Sequence = sequence;
+
+    return (result);
+}
+
+/************************************************************************************************************************
+ * @brief   解码端复位（清空关键帧记录，等待下一个关键帧）
+ ***********************************************************************************************************************/
+void Class_Telemetry_Decoder::Reset()
+{
+    memset(this->Key_Tag, CODEC_ACK_NONE, sizeof(this->Key_Tag));
+}
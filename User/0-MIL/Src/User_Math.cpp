@@ -9,7 +9,106 @@
 
 /* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
 #include "User_Math.h"
+#include "Math_Fast.h"
 
+/* 宏定义 -------------------------------------------------------------------------------------------------------------*/
+#define MATH_FLETCHER_16_MOD    (255U)      /* Fletcher-16 模数 */
+#define MATH_ADLER_32_MOD       (65521U)    /* Adler-32 模数（小于 2^16 的最大素数） */
+#define MATH_CHECKSUM_BLOCK     (5552U)     /* 两路累加和不溢出 32 位的最大连续字节数（zlib NMAX），每块结束取模一次 */
+
+/* 内部函数定义 --------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   读取一个字（Cortex-M4 支持非对齐 LDR，memcpy 编译为单条加载指令）
+ *
+ * @param   Address     地址
+ * @return  uint32_t    字（小端）
+ */
+static inline uint32_t Math_Load_32(const void *Address)
+{
+    uint32_t word;
+    memcpy(&word, Address, 4U);
+    return (word);
+}
+
+/**
+ * @brief   字内 4 字节求和并累加
+ *
+ * @param   Word        字
+ * @param   Sum         累加值
+ * @return  uint32_t    Sum + b0 + b1 + b2 + b3
+ */
+static inline uint32_t Math_Byte_Sum_4(uint32_t Word, uint32_t Sum)
+{
+#if defined(ARM_MATH_DSP)
+    return (__USADA8(Word, 0U, Sum));
+#else
+    Word = (Word & 0x00FF00FFU) + ((Word >> 8) & 0x00FF00FFU);
+    return (Sum + (Word & 0xFFFFU) + (Word >> 16));
+#endif
+}
+
+/**
+ * @brief   字内 4 字节加权求和并累加（Fletcher/Adler 第二路累加和的 4 字节增量）
+ *
+ * @param   Word        字
+ * @param   Sum         累加值
+ * @return  uint32_t    Sum + 4 * b0 + 3 * b1 + 2 * b2 + b3
+ */
+static inline uint32_t Math_Byte_Weighted_Sum_4(uint32_t Word, uint32_t Sum)
+{
+#if defined(ARM_MATH_DSP)
+    /* UXTB16 取出 (b0, b2) 与 (b1, b3) 两个半字对，SMLAD 各做一次双 16 位乘加 */
+    Sum = __SMLAD(__UXTB16(Word), 0x00020004U, Sum);
+    return (__SMLAD(__UXTB16(__ROR(Word, 8U)), 0x00010003U, Sum));
+#else
+    uint32_t even = Word & 0x00FF00FFU;
+    uint32_t odd = (Word >> 8) & 0x00FF00FFU;
+    return (Sum + 4U * (even & 0xFFFFU) + 2U * (even >> 16) + 3U * (odd & 0xFFFFU) + (odd >> 16));
+#endif
+}
+
+/**
+ * @brief   Fletcher/Adler 公共核：按字推进两路累加和，每块结束取模
+ *
+ * @param   Address     起始地址
+ * @param   Length      字节数
+ * @param   Modulus     模数
+ * @param   Sum_1       第一路累加和（输入输出, 小于模数）
+ * @param   Sum_2       第二路累加和（输入输出, 小于模数）
+ */
+static void Math_Checksum_Kernel(const uint8_t *Address, uint32_t Length, uint32_t Modulus, uint32_t *Sum_1,
+                                 uint32_t *Sum_2)
+{
+    uint32_t sum_1 = *Sum_1;
+    uint32_t sum_2 = *Sum_2;
+
+    while (Length > 0U)
+    {
+        uint32_t block = (Length < MATH_CHECKSUM_BLOCK) ? Length : MATH_CHECKSUM_BLOCK;
+        Length -= block;
+
+        /* 每次处理 4 字节：sum_2 依次加上 4 个前缀和，即 4 * sum_1 + 4 * b0 + 3 * b1 + 2 * b2 + b3 */
+        for (; block >= 4U; block -= 4U, Address += 4U)
+        {
+            uint32_t word = Math_Load_32(Address);
+            sum_2 = Math_Byte_Weighted_Sum_4(word, sum_2 + 4U * sum_1);
+            sum_1 = Math_Byte_Sum_4(word, sum_1);
+        }
+        for (; block > 0U; block--, Address++)
+        {
+            sum_1 += *Address;
+            sum_2 += sum_1;
+        }
+
+        sum_1 %= Modulus;
+        sum_2 %= Modulus;
+    }
+
+    *Sum_1 = sum_1;
+    *Sum_2 = sum_2;
+}
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
 /************************************************************************************************************************
  * @brief   16位大小端转换
  *
@@ -69,7 +168,7 @@ void Math_Endian_Reverse_32(void *Source, void *Destination)
 }
 
 /************************************************************************************************************************
- * @brief   求和
+ * @brief   求和（每次处理 4 字节）
  *
  * @param   Address     起始地址
  * @param   Length      被加的数据的数量, 注意不是字节数
@@ -77,16 +176,22 @@ void Math_Endian_Reverse_32(void *Source, void *Destination)
  ***********************************************************************************************************************/
 uint8_t Math_Sum_8(uint8_t *Address, uint32_t Length)
 {
-    uint8_t sum = 0;
-    for(int i = 0; i < Length; i++)
+    uint32_t sum = 0U;
+    uint32_t i = 0U;
+
+    for (; i + 4U <= Length; i += 4U)
+    {
+        sum = Math_Byte_Sum_4(Math_Load_32(&Address[i]), sum);
+    }
+    for (; i < Length; i++)
     {
         sum += Address[i];
     }
-    return (sum);
+    return ((uint8_t) sum);
 }
 
 /************************************************************************************************************************
- * @brief   求和
+ * @brief   求和（每次处理 2 个半字）
  *
  * @param   Address     起始地址
  * @param   Length      被加的数据的数量, 注意不是字节数
@@ -94,16 +199,28 @@ uint8_t Math_Sum_8(uint8_t *Address, uint32_t Length)
  ***********************************************************************************************************************/
 uint16_t Math_Sum_16(uint16_t *Address, uint32_t Length)
 {
-    uint16_t sum = 0;
-    for(int i = 0; i < Length; i++)
+    uint32_t sum = 0U;
+    uint32_t i = 0U;
+
+    for (; i + 2U <= Length; i += 2U)
+    {
+        uint32_t word = Math_Load_32(&Address[i]);
+#if defined(ARM_MATH_DSP)
+        /* 双 16 位乘加 (h0 * 1 + h1 * 1)，按有符号计算，低 16 位与无符号求和一致 */
+        sum = __SMLAD(word, 0x00010001U, sum);
+#else
+        sum += (word & 0xFFFFU) + (word >> 16);
+#endif
+    }
+    if (i < Length)
     {
         sum += Address[i];
     }
-    return (sum);
+    return ((uint16_t) sum);
 }
 
 /************************************************************************************************************************
- * @brief   求和
+ * @brief   求和（展开 4 次）
  *
  * @param   Address     起始地址
  * @param   Length      被加的数据的数量, 注意不是字节数
@@ -111,12 +228,51 @@ uint16_t Math_Sum_16(uint16_t *Address, uint32_t Length)
  ***********************************************************************************************************************/
 uint32_t Math_Sum_32(uint32_t *Address, uint32_t Length)
 {
-    uint32_t sum = 0;
-    for(int i = 0; i < Length; i++)
+    uint32_t sum_0 = 0U, sum_1 = 0U, sum_2 = 0U, sum_3 = 0U;
+    uint32_t i = 0U;
+
+    for (; i + 4U <= Length; i += 4U)
     {
-        sum += Address[i];
+        sum_0 += Address[i];
+        sum_1 += Address[i + 1U];
+        sum_2 += Address[i + 2U];
+        sum_3 += Address[i + 3U];
+    }
+    for (; i < Length; i++)
+    {
+        sum_0 += Address[i];
     }
-    return (sum);
+    return (sum_0 + sum_1 + sum_2 + sum_3);
+}
+
+/************************************************************************************************************************
+ * @brief   Fletcher-16 校验
+ *
+ * @param   Address     起始地址
+ * @param   Length      字节数
+ * @return  uint16_t    校验值 (sum_2 << 8 | sum_1)
+ ***********************************************************************************************************************/
+uint16_t Math_Fletcher_16(uint8_t *Address, uint32_t Length)
+{
+    uint32_t sum_1 = 0U, sum_2 = 0U;
+
+    Math_Checksum_Kernel(Address, Length, MATH_FLETCHER_16_MOD, &sum_1, &sum_2);
+    return ((uint16_t) (sum_2 << 8 | sum_1));
+}
+
+/************************************************************************************************************************
+ * @brief   Adler-32 校验（RFC 1950）
+ *
+ * @param   Address     起始地址
+ * @param   Length      字节数
+ * @return  uint32_t    校验值 (B << 16 | A)
+ ***********************************************************************************************************************/
+uint32_t Math_Adler_32(uint8_t *Address, uint32_t Length)
+{
+    uint32_t sum_1 = 1U, sum_2 = 0U;
+
+    Math_Checksum_Kernel(Address, Length, MATH_ADLER_32_MOD, &sum_1, &sum_2);
+    return (sum_2 << 16 | sum_1);
 }
 
 /************************************************************************************************************************
@@ -133,11 +289,13 @@ float Math_Sinc(float x)
         return (1.0f);
     }
 
-    return (sinf(x) / x);
+    /* 偶函数，取正值计算（正值查表在0附近保持相对精度） */
+    x = fabsf(x);
+    return (Math_Fast_Sin(x) / x);
 }
 
 /************************************************************************************************************************
- * @brief   将浮点数映射到整型
+ * @brief   将浮点数映射到整型（单次映射；周期调用时直接使用 Class_Math_Affine，映射系数只计算一次）
  *
  * @param   x           浮点数
  * @param   Float_Min   浮点数最小值
@@ -148,13 +306,14 @@ float Math_Sinc(float x)
  ***********************************************************************************************************************/
 int32_t Math_Float_To_Int(float x, float Float_Min, float Float_Max, int32_t Int_Min, int32_t Int_Max)
 {
-    float tmp = (x - Float_Min) / (Float_Max - Float_Min);
-    int32_t out = tmp * (float) (Int_Max - Int_Min) + Int_Max;
-    return (out);
+    Class_Math_Affine affine;
+
+    affine.Init(Float_Min, Float_Max, Int_Min, Int_Max);
+    return (affine.To_Int(x));
 }
 
 /************************************************************************************************************************
- * @brief   将整型映射到浮点数
+ * @brief   将整型映射到浮点数（单次映射；周期调用时直接使用 Class_Math_Affine，映射系数只计算一次）
  *
  * @param   x           整型
  * @param   Int_Min     整型最小值
@@ -165,9 +324,29 @@ int32_t Math_Float_To_Int(float x, float Float_Min, float Float_Max, int32_t Int
  ***********************************************************************************************************************/
 float Math_Int_To_Float(int32_t x, int32_t Int_Min, int32_t Int_Max, float Float_Min, float Float_Max)
 {
-    float tmp = (float) (x - Int_Min) / (float) (Int_Max - Int_Min);
-    float out = tmp * (Float_Max - Float_Min) + Float_Min;
-    return (out);
+    Class_Math_Affine affine;
+
+    affine.Init(Float_Min, Float_Max, Int_Min, Int_Max);
+    return (affine.To_Float(x));
+}
+
+/************************************************************************************************************************
+ * @brief   浮点数-整型仿射映射初始化（预先计算双向映射的斜率与截距）
+ *
+ * @param   __Float_Min     浮点数最小值
+ * @param   __Float_Max     浮点数最大值
+ * @param   __Int_Min       整型最小值
+ * @param   __Int_Max       整型最大值
+ ***********************************************************************************************************************/
+void Class_Math_Affine::Init(float __Float_Min, float __Float_Max, int32_t __Int_Min, int32_t __Int_Max)
+{
+    float float_span = __Float_Max - __Float_Min;
+    float int_span = (float) __Int_Max - (float) __Int_Min;
+
+    this->K_To_Int = int_span / float_span;
+    this->B_To_Int = (float) __Int_Min - __Float_Min * this->K_To_Int;
+    this->K_To_Float = float_span / int_span;
+    this->B_To_Float = __Float_Min - (float) __Int_Min * this->K_To_Float;
 }
 
 /************************************************************************************************************************
@@ -4,7 +4,7 @@
  *
  * @author  Tang-yucheng (QQ: 3143961287)
  * @date    2024-2-14
- * @version v1.0
+ * @version v1.1
  */
 
 #ifndef __APL_CALLBACK_TIM_H
@@ -16,9 +16,14 @@
 
 #include "Chassis.h"
 #include "Communication.h"
+#include "User_Dwt.h"
 
 #include "Motor_Fir.h"
 
 //#include "Motor_DJI.h"
 
+/* 变量声明 ------------------------------------------------------------------------------------------------------------*/
+extern uint32_t Callback_Tim_Cycles;
+extern uint32_t Callback_Tim_Cycles_MAX;
+
 #endif /* APL_Callback_Tim.h */
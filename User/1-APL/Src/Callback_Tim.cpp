@@ -4,12 +4,19 @@
  *
  * @author  Tang-yucheng (QQ: 3143961287)
  * @date    2024-2-14
- * @version v1.0
+ * @version v1.3
  */
 
 /* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
 #include "Callback_Tim.h"
 
+/* 全局变量创建 --------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   系统心跳中断单次耗时 (CPU周期)，最近一次与最大值（调试器观察，用于比较不同闭环实现的中断耗时）
+ */
+uint32_t Callback_Tim_Cycles = 0U;
+uint32_t Callback_Tim_Cycles_MAX = 0U;
+
 /************************************************************************************************************************
  * @brief   TIM更新中断回调函数重写
  *
@@ -19,11 +26,17 @@ void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef * htim)
 {
     if (htim->Instance == htim6.Instance)
     {
-        static uint16_t count;
+        uint32_t start = DWT_Get_Cycle();
+
+        /* 微秒时基更新（DWT回绕前并入） */
+        Time_Update();
 
         /* 串口离线检测，10Hz */
         COM_LuBanCat.AliveCheck(100);
 
+        /* 串口链路协商与回退 */
+        COM_LuBanCat.LinkCheck();
+
         /* 摩擦轮离线检测，10Hz */
 //        frictiongear[0].AliveCheck(100);
 //        frictiongear[1].AliveCheck(100);
@@ -42,10 +55,14 @@ void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef * htim)
         Committee_Chariot.Motor_Wheel[2].Control();
         Committee_Chariot.Motor_Wheel[3].Control(); */
 
-        Committee_Chariot.Motor_Wheel[0].Control_test();
-        Committee_Chariot.Motor_Wheel[1].Control_test();
-        Committee_Chariot.Motor_Wheel[2].Control_test();
-        Committee_Chariot.Motor_Wheel[3].Control_test();
+        /* 底盘统一闭环时电机输出已由底盘给出 */
+        if (Committee_Chariot.Get_Wheel_Control() == Chassis_Wheel_Separate)
+        {
+            Committee_Chariot.Motor_Wheel[0].Control_test();
+            Committee_Chariot.Motor_Wheel[1].Control_test();
+            Committee_Chariot.Motor_Wheel[2].Control_test();
+            Committee_Chariot.Motor_Wheel[3].Control_test();
+        }
 
 
         /* 摩擦轮闭环控制 */
@@ -55,15 +72,14 @@ void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef * htim)
         /* 大疆电机CAN数据发送 */
         //DJI_CAN_SendData();
 
-        /* 数据上传，50Hz */
-        if (count < 19U)
-        {
-            count += 1;
-        }
-        else
+        /* 遥测调度（各包速率等级见包描述表） */
+        COM_LuBanCat.Schedule();
+
+        /* 中断耗时统计 */
+        Callback_Tim_Cycles = DWT_Get_Elapsed(start);
+        if (Callback_Tim_Cycles > Callback_Tim_Cycles_MAX)
         {
-            count = 0;
-            COM_LuBanCat.DataSend(0x00);
+            Callback_Tim_Cycles_MAX = Callback_Tim_Cycles;
         }
     }
 }
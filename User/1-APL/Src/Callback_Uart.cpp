@@ -4,7 +4,7 @@
  *
  * @author  Tang-yucheng (QQ: 3143961287)
  * @date    2024-2-14
- * @version v1.0
+ * @version v1.1
  */
 
 /* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
@@ -21,12 +21,22 @@ void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef * huart, uint16_t Size)
 {
     if (huart->Instance == huart3.Instance)
     {
-        /* 鲁班猫上位机串口数据处理 */
-        // COM_LuBanCat.DataProcess(Size);
-        
-        
-        /* 开启新一次串口接收（DMA-IDLE） */
-        UART_ReceiveToIdle_DMA(&UART3_Manage_Object);
+        /* 鲁班猫上位机串口数据处理（环形DMA持续接收，无需重新开启） */
+        COM_LuBanCat.DataProcess();
+    }
+}
+
+/***********************************************************************************************************************
+ * @brief   UART-TX发送完成中断回调函数重写
+ *
+ * @param   huart   UART外设句柄
+ **********************************************************************************************************************/
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef * huart)
+{
+    if (huart->Instance == huart3.Instance)
+    {
+        /* 鲁班猫上位机串口接续发送 */
+        COM_LuBanCat.TxProcess();
     }
 }
 
@@ -61,7 +71,7 @@ void HAL_UART_ErrorCallback(UART_HandleTypeDef * huart)
     // 当这个串口发生了错误，一定要在重新使能接收中断
     if (huart->Instance == huart3.Instance)
     {
-        /* 开启新一次串口接收（DMA-IDLE） */
-        UART_ReceiveToIdle_DMA(&UART3_Manage_Object);
+        /* 重新开启环形DMA接收 */
+        COM_LuBanCat.ErrorProcess();
     }
 }
@@ -15,7 +15,10 @@
 #include "Motor.h"
 //#include "Motor_DJI.h"
 #include "User_Can.h"
+#include "User_Crc.h"
 #include "User_Delay.h"
+#include "User_Dwt.h"
+#include "User_Time.h"
 #include "tim.h"
 #include "User_Math.h"
 #include "Motor_Fir.h"
@@ -28,6 +31,15 @@ void User_setup(void)
     /* 用户延时初始化 */
     Delay_Init(168U);
 
+    /* DWT周期计数器初始化（执行周期测量） */
+    DWT_Init();
+
+    /* 微秒时基初始化（帧时间戳、时钟同步） */
+    Time_Init();
+
+    /* 硬件CRC外设初始化 */
+    CRC_HW_Init();
+
     /* 使能CAN外设 */
     CAN_Init(&CAN1_Manage_Object);
     
@@ -52,7 +64,7 @@ void User_setup(void)
     Committee_Chariot.Init();
 
     /* 串口初始化 */
-    COM_LuBanCat.Init(22U, 19U);
+    COM_LuBanCat.Init();
 
     /* 使能系统心跳定时器 */
     HAL_TIM_Base_Start_IT(&htim6);
@@ -4,14 +4,17 @@
  *
  * @author  Tang-yucheng (QQ: 3143961287)
  * @date    2024-2-14
- * @version v1.0
+ * @version v1.4
  */
 
 #ifndef __FML_CHASSIS_H
 #define __FML_CHASSIS_H
 
 /* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "Gear.h"
+#include "Matrix.h"
 #include "Motor.h"
+#include "Pid_Bank.h"
 
 /* 结构体定义 ----------------------------------------------------------------------------------------------------------*/
 
@@ -27,6 +30,16 @@ enum Enum_ChassisState : uint8_t
     Chassis_Run     = 3U,   /*!< 底盘运行 */
 };
 
+/**
+ * @brief   底盘轮速闭环方式枚举类型
+ */
+enum Enum_Chassis_Wheel_Control : uint8_t
+{
+    Chassis_Wheel_Separate  = 0U,   /*!< 各电机独立闭环（电机 Control() 中各自计算 PID） */
+    Chassis_Wheel_Bank      = 1U,   /*!< 底盘统一闭环（PID控制器组一次计算四轮，此时不要再调用电机 Control()；
+                                         位置、自整定模式或启用增益调度、S曲线的电机由底盘改调其 Control_Loop()） */
+};
+
 /* 类定义 --------------------------------------------------------------------------------------------------------------*/
 /**
  * @brief   麦克纳姆轮底盘功能模块类
@@ -38,23 +51,34 @@ class Class_Chassis_Macnum
 public:
     /* 变量 */
     Class_Motor_BDC Motor_Wheel[4];         /*!< 四轮驱动电机对象 */
+    Class_PID_Bank<4> PID_Omega_Bank;       /*!< 四轮角速度 PID 控制器组（统一闭环时使用） */
+    Class_Gear_Twist Gear_Twist;            /*!< 底盘速度空间变速控制器（逆运动学解算前） */
 
     /* 函数 */
-    void Init(float __Wheel_Omega_MAX = 26.0f, uint16_t __Control_Cycle = 50U);
+    void Init(float __Wheel_Omega_MAX = 26.0f, uint16_t __Control_Cycle = 50U,
+              Enum_Chassis_Wheel_Control __Wheel_Control = Chassis_Wheel_Separate,
+              float __Acceleration_Linear = 10.0f, float __Acceleration_Angular = 27.0f);
     void Control();
 
     inline void Enable();
     inline void Disable();
     inline void Set_Motion(float __Velocity_X, float __Velocity_Y, float __Omega);
     inline void Set_Stop(Enum_ChassisState __Stop_State);
+    inline Enum_ChassisState Get_State();
+    inline Enum_Chassis_Wheel_Control Get_Wheel_Control();
 
 protected:
+    /* 函数 */
+    void Wheel_Control_Bank();
+
     /* 常量 */
     const float Wheel_Radius = 0.1f;     /*!< 底盘轮子半径 (m) */
     const float Wheel_Spacing = 0.43f;       /*!< 底盘轮间距（左右）(m) */
     const float Wheel_Base = 0.3f;          /*!< 底盘轴距（前后）(m) */
     float Wheel_Omega_MAX;                  /*!< 轮子最大角速度 (rad/s) */
     uint16_t Control_Cycle;                 /*!< 底盘控制周期 (控制周期 = Control_Cycle * 系统心跳周期) */
+    Enum_Chassis_Wheel_Control Wheel_Control;   /*!< 轮速闭环方式 */
+    Class_Matrix<4, 3> Inverse_Kinematics;  /*!< 逆运动学矩阵 (vx, vy, omega) -> 四轮角速度 */
 
     /* 读写变量 */
     float Velocity_X = 0.0f;                /*!< X方向目标速度 (m/s) */
@@ -118,4 +142,20 @@ void Class_Chassis_Macnum::Set_Stop(Enum_ChassisState __Stop_State)
     }
 }
 
+/**
+ * @brief   获取底盘状态
+ */
+Enum_ChassisState Class_Chassis_Macnum::Get_State()
+{
+    return (this->Chassis_State);
+}
+
+/**
+ * @brief   获取轮速闭环方式（统一闭环时电机输出由底盘给出，不要再调用电机 Control()、Control_test()）
+ */
+Enum_Chassis_Wheel_Control Class_Chassis_Macnum::Get_Wheel_Control()
+{
+    return (this->Wheel_Control);
+}
+
 #endif  /* FML_Chassis.h */
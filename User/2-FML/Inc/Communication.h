@@ -4,7 +4,7 @@
  *
  * @author  Tang-yucheng (QQ: 3143961287)
  * @date    2024-2-15
- * @version v1.0
+ * @version v1.8
  */
 
 #ifndef __FML_COMMUNICATION_H
@@ -12,39 +12,98 @@
 
 /* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
 #include "User_Uart.h"
+#include "User_Time.h"
 
 #include "Crc.h"
-#include "Chassis.h"
+#include "Frame_Parser.h"
+#include "Clock_Sync.h"
+#include "Communication_Link.h"
+#include "Communication_Sync.h"
+#include "Communication_LuBanCat.h"
 
 /* 宏定义 ----------------------------------------------------------------------------------------------------------------*/
 
 #define __packed __attribute__((packed))
 
-/* 结构体定义 ----------------------------------------------------------------------------------------------------------*/
+#define COM_SCHEDULE_FREQUENCY      1000U   /* 遥测调度频率（Schedule 调用频率，即系统心跳频率, Hz） */
+#define COM_SCHEDULE_HYPERPERIOD    100U    /* 调度超周期（各速率等级周期的最小公倍数，系统心跳数） */
+#define COM_SCHEDULE_CHECK_PERIOD   10U     /* 变化检测周期（系统心跳数） */
+#define COM_SCHEDULE_REFRESH        100U    /* 变化检测保底刷新（检测次数，数据不变时也每 1s 发送一次） */
+
+#define COM_LINK_ERROR_WINDOW       100U    /* 链路错误统计窗口（系统心跳数） */
+#define COM_LINK_ERROR_THRESHOLD    8U      /* 窗口内串口错误 + 校验错误次数达到该值时回退 */
+#define COM_LINK_BAUD_TOLERANCE     20U     /* 协商波特率允许的实际误差 (‰) */
+
+/* 枚举类型定义 --------------------------------------------------------------------------------------------------------*/
 /**
- * @brief   鲁班猫上位机Rx数据结构体
+ * @brief   遥测速率等级枚举类型（数值为发送周期，系统心跳数）
  */
-struct __packed Struct_RxData_LuBanCat
+enum Enum_COM_Rate : uint8_t
 {
-    Enum_ChassisState Chassis_State;    /*!< 底盘设定状态 */
-    float Chassis_Vel_X;                /*!< 底盘X轴速度 (m/s) */
-    float Chassis_Vel_Y;                /*!< 底盘Y轴速度 (m/s) */
-    float Chassis_Omega;                /*!< 底盘旋转角速度 (rad/s) */
+    COM_Rate_None       = 0U,       /*!< 不参与调度（仅由 DataSend 手动发送） */
+    COM_Rate_1000Hz     = 1U,       /*!< 1kHz */
+    COM_Rate_100Hz      = 10U,      /*!< 100Hz */
+    COM_Rate_50Hz       = 20U,      /*!< 50Hz */
+    COM_Rate_10Hz       = 100U,     /*!< 10Hz */
+    COM_Rate_On_Change  = 0xFFU,    /*!< 数据变化时发送（每 COM_SCHEDULE_CHECK_PERIOD 检测一次，附带保底刷新） */
 };
 
 /**
- * @brief   鲁班猫上位机Tx数据结构体
+ * @brief   链路状态枚举类型
  */
-struct __packed Struct_TxData_LuBanCat
+enum Enum_COM_Link_State : uint8_t
 {
-    float Chassis_Motor_Omega[4];       /*!< 底盘电机实际转速 */
+    COM_Link_Stable     = 0U,       /*!< 稳定（基础波特率或已提交的波特率） */
+    COM_Link_Switching  = 1U,       /*!< 已同意切换，等待发送队列清空（暂停遥测） */
+    COM_Link_Trial      = 2U,       /*!< 试用新波特率，等待探测与提交 */
 };
 
-/* 枚举类型定义 --------------------------------------------------------------------------------------------------------*/
+/* 结构体定义 ----------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   数据包描述结构体（包描述表的一项）
+ */
+struct Struct_COM_Packet
+{
+    uint8_t Type;                                               /*!< 包类型 */
+    uint8_t Length;                                             /*!< 数据长度 (byte，变长发送包为最大长度) */
+    Enum_COM_Rate Rate;                                         /*!< 遥测速率等级（仅发送包） */
+    uint8_t Priority;                                           /*!< 遥测优先级（0最高，带宽不足时优先发送） */
+    void (* Rx_Handler)(const void * Data);                     /*!< Rx处理函数（nullptr 为仅发送） */
+    uint8_t (* Tx_Handler)(void * Data, void * Data_Parameter); /*!< Tx填充函数，返回数据长度（nullptr 为仅接收） */
+};
+
+/**
+ * @brief   遥测调度项结构体
+ */
+struct Struct_COM_Schedule
+{
+    uint8_t Index;                      /*!< 包描述表下标 */
+    uint8_t Period;                     /*!< 调度周期（系统心跳数，变化检测包为检测周期） */
+    uint8_t Phase;                      /*!< 调度相位（系统心跳数，0 ~ Period-1） */
+    uint8_t Wire_Length;                /*!< 线上最大帧长度 (byte) */
+    uint8_t Pending;                    /*!< 已到期待发送（变化检测包为待检测） */
+    uint8_t Refresh;                    /*!< 变化检测：距保底刷新剩余检测次数 */
+    uint32_t Hash;                      /*!< 变化检测：上次发送数据的CRC32 */
+};
 
 /* 类定义 --------------------------------------------------------------------------------------------------------------*/
 /**
- * @brief   自定义串口功能模块类（定长数据包）
+ * @brief   自定义串口功能模块类（变长数据包）
+ *          帧格式见 Class_Frame_Parser（包头模式或COBS模式），数据长度随帧发送，同一链路可混合长短不同的多种数据包；
+ *          各包类型的长度与收发处理函数由包描述表给出（包类型 COM_PACKET_LINK 保留），收发时以包类型为下标直接查表分发；
+ *          Rx为循环DMA写入环形缓冲区 + 流式解析，一次接收事件中的多帧粘连、分片、垃圾字节均可正确处理；
+ *          Tx为帧槽队列，Tx填充函数直接在空闲槽内填充数据，DMA发送完成中断中自动发送下一帧，单周期可连续发送多帧而不阻塞；
+ *          变长发送包（COM_Packet_Tx_Variable）由填充函数返回本帧数据长度，按实际长度组帧并扣除字节预算；
+ *          遥测调度：发送包在描述表中登记速率等级与优先级，Schedule 每个系统心跳按优先级发送到期的包，
+ *          发送量受波特率折算的字节预算（令牌桶）与队列空槽限制，超出时顺延至后续心跳；各包相位在初始化时错开，
+ *          使每个心跳的峰值字节数最小；
+ *          链路协商：保留包类型 COM_PACKET_LINK（见 Communication_Link.h），由上位机发起切换波特率，
+ *          新波特率下往返探测通过并提交后生效；试用超时、错误突发（串口错误回调 + 校验错误计数）、高速下长时间无有效帧时
+ *          自动回退（试用中回退至原波特率，其余回退至基础波特率）；
+ *          时间戳与时钟同步：每帧携带发送方组帧时刻（Time_Get_us，见 Frame_Get_Time），Rx处理函数中可由 Get_Rx_Timestamp
+ *          取得上位机发送时刻、Get_Rx_Time 取得本端接收时刻；保留包类型 COM_PACKET_SYNC（见 Communication_Sync.h），
+ *          由上位机周期性发起四时间戳交换，下位机应答并以同一组交换估计上位机时钟，经 Get_Host_Time / Get_Local_Time
+ *          向固件模块提供同步时基（如计算指令传输时延、按上位机时间对齐数据）
  */
 class Class_CustomCOM
 {
@@ -53,49 +112,381 @@ public:
     Struct_UART_Manage_Object * UART;           /*!< 串口处理结构体指针 */
 
     /* 函数 */
-    Class_CustomCOM(void (* __COM_TxCallback)(uint8_t Pack_Type_Tx, void * Data_Parameter, void * Data_Tx) = nullptr,
-                    void (* __COM_RxCallback)(void * Data_Rx, uint8_t Pack_Type_Rx) = nullptr,
+    Class_CustomCOM(const Struct_COM_Packet * __Packet_Table = nullptr, uint8_t __Packet_Number = 0U,
                     void (* __COM_OffCallback)() = nullptr,
                     Struct_UART_Manage_Object * __UART = nullptr);
-    void Init(uint8_t __Packet_Length_Tx = MAX_Len_Tx, uint8_t __Packet_Length_Rx = MAX_Len_Rx, uint32_t __Pack_Head = 0x20250301);
+    void Init(uint32_t __Pack_Head = LUBANCAT_PACK_HEAD, Enum_Frame_Mode __Frame_Mode = Frame_Mode_Head);
     void AliveCheck(uint16_t Period);
-    void DataSend(uint8_t Pack_Type_Tx, void * Data_Parameter = nullptr);
-    void DataProcess(uint8_t Pack_Size);
+    bool DataSend(uint8_t Pack_Type_Tx, void * Data_Parameter = nullptr);
+    void Schedule();
+    void LinkCheck();
+    void DataProcess();
+    void TxProcess();
+    void ErrorProcess();
+
+    inline uint32_t Get_Error_Number();
+    inline uint32_t Get_Tx_Full_Number();
+    inline uint32_t Get_Overrun_Number();
+    inline uint32_t Get_Tx_Byte_Number();
+    inline float Get_Link_Utilization();
+    inline uint32_t Get_Baud_Rate();
+    inline Enum_COM_Link_State Get_Link_State();
+    inline uint32_t Get_UART_Error_Number();
+    inline uint32_t Get_Fallback_Number();
+    inline uint32_t Get_Rx_Time();
+    inline uint32_t Get_Rx_Timestamp();
+    inline bool Get_Clock_Valid();
+    inline uint32_t Get_Host_Time(uint32_t __Local_Time);
+    inline uint32_t Get_Local_Time(uint32_t __Host_Time);
+    inline Class_Clock_Sync * Get_Clock();
 protected:
+    /* 函数 */
+    void Schedule_Init();
+    void Set_Budget(uint32_t __Baud_Rate);
+    void Link_Process(const Struct_COM_Link & __Link);
+    bool Link_Send(uint8_t __Command, uint8_t __Sequence, uint32_t __Baud_Rate, bool __Pattern);
+    void Link_Switch(uint32_t __Baud_Rate);
+    void Sync_Process(const Struct_COM_Sync & __Sync, uint32_t __Origin, uint32_t __Receive);
+    inline uint32_t Wire_Time(uint8_t __Length, uint16_t __Trailing);
+    bool Tx_Push(const Struct_COM_Packet & __Packet, void * __Data_Parameter, uint32_t * __Hash);
+    void Tx_Start(bool __Burst);
+
     /* 常量 */
     uint32_t Pack_Head;                         /*!< 包头 (4byte) */
-    uint8_t Packet_Length_Tx;                   /*!< Tx数据包长度 */
-    uint8_t Packet_Length_Rx;                   /*!< Rx数据包长度 */
-    void (* COM_TxCallback)                     /*!< Tx回调函数指针 */
-         (uint8_t Pack_Type_Tx, void * Data_Parameter, void * Data_Tx);
-    void (* COM_RxCallback)                     /*!< Rx回调函数指针 */
-         (void * Data_Rx, uint8_t Pack_Type_Rx);
+    Enum_Frame_Mode Frame_Mode;                 /*!< 分帧方式 */
+    const Struct_COM_Packet * Packet_Table;     /*!< 包描述表 */
+    uint8_t Packet_Number;                      /*!< 包描述表项数 */
+    uint8_t Packet_Index[256];                  /*!< 包类型 -> 包描述表下标（0xFF为未注册） */
     void (* COM_OffCallback)                    /*!< 离线回调函数指针 */
          ();
-    constexpr static uint8_t MAX_Len_Tx         /*!< Tx缓冲区最大长度 */
-                             = 128U;
-    constexpr static uint8_t MAX_Len_Rx         /*!< Rx缓冲区最大长度 */
-                             = 128U;
+    constexpr static uint8_t MAX_Len_Tx         /*!< Tx帧最大长度 */
+                             = FRAME_MAX_LENGTH;
+    constexpr static uint8_t MAX_Slot_Tx        /*!< Tx队列槽数（2的幂） */
+                             = 4U;
+    constexpr static uint8_t MAX_Schedule       /*!< 遥测调度项最大数量 */
+                             = 8U;
+    uint32_t Baud_Rate_Base;                    /*!< 基础波特率（串口初始化配置，上位机需与之一致） */
+    uint8_t Wire_MAX;                           /*!< 调度包线上最大帧长度 (byte) */
 
     /* 读写变量 */
-    uint8_t Buffer_Tx[MAX_Len_Tx];              /*!< Tx缓冲区 */
-    uint8_t Buffer_Rx[MAX_Len_Rx];              /*!< Rx缓冲区 */
-    void * Data_Tx;                             /*!< 发送的数据指针 */
-    void * Data_Rx;                             /*!< 解析到的数据指针 */
-    uint32_t Error_Number = 0U;                 /*!< 接收数据校验错误次数 */
+    uint8_t Buffer_Tx[MAX_Slot_Tx]              /*!< Tx队列（每槽一帧，DMA直接发送；COBS模式帧自偏移3处开始，多1字节结束符） */
+                     [MAX_Len_Tx + 1U];
+    uint8_t Length_Tx[MAX_Slot_Tx];             /*!< Tx队列各槽帧长度 */
+    uint32_t Tx_Full_Number = 0U;               /*!< Tx队列满丢帧次数 */
+    uint32_t Overrun_Number = 0U;               /*!< 遥测超时次数（下一周期到期时仍未发出） */
+    float Link_Utilization = 0.0f;              /*!< 上行链路占用率（最近 1s 实际发送字节折算） */
+    uint32_t Baud_Rate;                         /*!< 当前波特率 (bit/s, 8N1) */
+    uint32_t Budget_Tick;                       /*!< 每个系统心跳的字节预算 (Q8) */
+    uint32_t Budget_MAX;                        /*!< 字节预算累积上限 (Q8) */
+    uint32_t Byte_Time;                         /*!< 每字节线上时间 (us, Q8) */
+    volatile uint32_t UART_Error_Number = 0U;   /*!< 串口错误回调次数 */
+    uint32_t Fallback_Number = 0U;              /*!< 链路回退次数 */
 
     /* 内部变量 */
+    Class_Frame_Parser Parser;                  /*!< Rx流式帧解析器 */
     volatile uint8_t Flag = 0;                  /*!< 存活检测标志 */
+    volatile uint8_t Tx_Write_Index = 0U;       /*!< Tx队列写计数（自由计数，取低位为槽号） */
+    volatile uint8_t Tx_Read_Index = 0U;        /*!< Tx队列读计数（已发送完成帧数） */
+    volatile uint8_t Tx_Busy = 0U;              /*!< DMA发送中标志 */
+    uint8_t Tx_Sending_Length = 0U;             /*!< DMA发送中的字节数 */
+    volatile uint32_t Tx_Byte_Number = 0U;      /*!< 已发送完成字节数（自由计数） */
+    Struct_COM_Schedule Schedule_List           /*!< 遥测调度项（按优先级排序） */
+                        [MAX_Schedule];
+    uint8_t Schedule_Number = 0U;               /*!< 遥测调度项数 */
+    uint8_t Schedule_Tick = 0U;                 /*!< 调度心跳计数（0 ~ COM_SCHEDULE_HYPERPERIOD-1） */
+    uint16_t Window_Tick = 0U;                  /*!< 链路占用率统计窗口计数 */
+    uint32_t Budget = 0U;                       /*!< 当前可用字节预算 (Q8) */
+    uint32_t Window_Byte_Number = 0U;           /*!< 统计窗口起点的已发送字节数 */
+    Struct_COM_Link Link_Rx;                    /*!< 接收到的链路协商包（接收中断写入，LinkCheck 处理） */
+    volatile uint8_t Link_Rx_Flag = 0U;         /*!< 链路协商包待处理标志 */
+    Enum_COM_Link_State Link_State =            /*!< 链路状态 */
+                        COM_Link_Stable;
+    uint32_t Link_Baud_Rate_Target = 0U;        /*!< 切换目标波特率 */
+    uint32_t Link_Baud_Rate_Stable = 0U;        /*!< 切换前的波特率（试用失败时回退） */
+    uint16_t Link_Timer = 0U;                   /*!< 试用计时（系统心跳数） */
+    volatile uint16_t Link_Silence = 0U;        /*!< 距上一个有效帧的系统心跳数 */
+    uint8_t Link_Probe_Number = 0U;             /*!< 试用中回显的探测帧数 */
+    uint16_t Link_Error_Tick = 0U;              /*!< 错误统计窗口计数 */
+    uint32_t Link_Error_Last = 0U;              /*!< 统计窗口起点的错误总数 */
+    uint32_t Tx_Time = 0U;                      /*!< 最近一次组帧的帧时间戳 (us) */
+    uint32_t Rx_Time = 0U;                      /*!< 当前接收事件的接收时刻（最后一个字节结束时刻, us） */
+    uint32_t Rx_Timestamp = 0U;                 /*!< 当前分发帧的帧时间戳 (us, 上位机时钟) */
+    Class_Clock_Sync Clock;                     /*!< 上位机时钟同步 */
+    Struct_COM_Sync Sync_Rx;                    /*!< 接收到的时钟同步请求（接收中断写入，LinkCheck 处理） */
+    uint32_t Sync_Rx_Origin = 0U;               /*!< 时钟同步请求的 T1 (us, 上位机时钟) */
+    uint32_t Sync_Rx_Receive = 0U;              /*!< 时钟同步请求的 T2 (us) */
+    volatile uint8_t Sync_Rx_Flag = 0U;         /*!< 时钟同步请求待处理标志 */
+    uint8_t Sync_Sequence = COM_SYNC_NONE;      /*!< 上一次应答的交换序号 */
+    uint32_t Sync_Origin = 0U;                  /*!< 上一次交换的 T1 (us, 上位机时钟) */
+    uint32_t Sync_Receive = 0U;                 /*!< 上一次交换的 T2 (us) */
+    uint32_t Sync_Transmit = 0U;                /*!< 上一次交换的 T3 (us) */
 };
 
 /* 变量声明 ------------------------------------------------------------------------------------------------------------*/
 extern Class_CustomCOM COM_LuBanCat;
 
 /* 函数声明 ------------------------------------------------------------------------------------------------------------*/
-void COM_TxCallback_LuBanCat(uint8_t Pack_Type_Tx, void * Data_Parameter, void * Data_Tx);
-void COM_RxCallback_LuBanCat(void * Data_Rx, uint8_t Pack_Type_Rx);
+void COM_Tx_Link(Struct_COM_Link * Data, void * Data_Parameter);
+void COM_Tx_Sync(Struct_COM_Sync * Data, void * Data_Parameter);
+void COM_Tx_Motor_LuBanCat(Struct_TxData_LuBanCat * Data, void * Data_Parameter);
+void COM_Tx_Odometry_LuBanCat(Struct_TxData_Odometry_LuBanCat * Data, void * Data_Parameter);
+void COM_Tx_Diagnostic_LuBanCat(Struct_TxData_Diagnostic_LuBanCat * Data, void * Data_Parameter);
+uint8_t COM_Tx_Telemetry_LuBanCat(uint8_t * Data, uint8_t Size, void * Data_Parameter);
+void COM_Rx_Chassis_LuBanCat(const Struct_RxData_LuBanCat * Data);
+void COM_Rx_Telemetry_Ack_LuBanCat(const Struct_RxData_Telemetry_Ack_LuBanCat * Data);
 void COM_OffCallback_LuBanCat();
 
 /* 接口函数定义 --------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   Rx处理函数适配（由 COM_Packet 生成，检查数据结构体大小与声明的数据长度一致）
+ */
+template<typename Type, uint8_t Length, void (* Handler)(const Type * Data)>
+void COM_Rx_Adapter(const void * __Data)
+{
+    static_assert(sizeof(Type) == Length, "COM packet struct size does not match declared length");
+    static_assert(Length + FRAME_OVERHEAD <= FRAME_MAX_LENGTH, "COM packet exceeds FRAME_MAX_LENGTH");
+
+    Handler((const Type *) __Data);
+}
+
+/**
+ * @brief   Tx填充函数适配（由 COM_Packet 生成，检查数据结构体大小与声明的数据长度一致）
+ */
+template<typename Type, uint8_t Length, void (* Handler)(Type * Data, void * Data_Parameter)>
+uint8_t COM_Tx_Adapter(void * __Data, void * __Data_Parameter)
+{
+    static_assert(sizeof(Type) == Length, "COM packet struct size does not match declared length");
+    static_assert(Length + FRAME_OVERHEAD <= FRAME_MAX_LENGTH, "COM packet exceeds FRAME_MAX_LENGTH");
+
+    Handler((Type *) __Data, __Data_Parameter);
+
+    return (Length);
+}
+
+/**
+ * @brief   变长Tx填充函数适配（由 COM_Packet_Tx_Variable 生成）
+ */
+template<uint8_t Length, uint8_t (* Handler)(uint8_t * Data, uint8_t Size, void * Data_Parameter)>
+uint8_t COM_Tx_Variable_Adapter(void * __Data, void * __Data_Parameter)
+{
+    static_assert(Length + FRAME_OVERHEAD <= FRAME_MAX_LENGTH, "COM packet exceeds FRAME_MAX_LENGTH");
+
+    return (Handler((uint8_t *) __Data, Length, __Data_Parameter));
+}
+
+/**
+ * @brief   生成下行（接收）包描述
+ *
+ * @tparam  Type        数据结构体（需 __packed）
+ * @tparam  Length      协议规定的数据长度，与 sizeof(Type) 不一致时编译报错
+ * @tparam  Handler     Rx处理函数
+ * @param   __Type      包类型
+ */
+template<typename Type, uint8_t Length, void (* Handler)(const Type * Data)>
+constexpr Struct_COM_Packet COM_Packet_Rx(uint8_t __Type)
+{
+    return (Struct_COM_Packet{__Type, Length, COM_Rate_None, 0U, &COM_Rx_Adapter<Type, Length, Handler>, nullptr});
+}
+
+/**
+ * @brief   生成上行（发送）包描述
+ *
+ * @tparam  Type        数据结构体（需 __packed）
+ * @tparam  Length      协议规定的数据长度，与 sizeof(Type) 不一致时编译报错
+ * @tparam  Handler     Tx填充函数
+ * @param   __Type      包类型
+ * @param   __Rate      遥测速率等级（COM_Rate_None 为仅手动发送）
+ * @param   __Priority  遥测优先级（0最高）
+ */
+template<typename Type, uint8_t Length, void (* Handler)(Type * Data, void * Data_Parameter)>
+constexpr Struct_COM_Packet COM_Packet_Tx(uint8_t __Type, Enum_COM_Rate __Rate = COM_Rate_None, uint8_t __Priority = 0U)
+{
+    return (Struct_COM_Packet{__Type, Length, __Rate, __Priority, nullptr, &COM_Tx_Adapter<Type, Length, Handler>});
+}
+
+/**
+ * @brief   生成变长上行（发送）包描述
+ *
+ * @tparam  Length      最大数据长度
+ * @tparam  Handler     Tx填充函数（写入不超过 Size 字节，返回本帧数据长度，返回0时放弃本帧）
+ * @param   __Type      包类型
+ * @param   __Rate      遥测速率等级（COM_Rate_None 为仅手动发送）
+ * @param   __Priority  遥测优先级（0最高）
+ */
+template<uint8_t Length, uint8_t (* Handler)(uint8_t * Data, uint8_t Size, void * Data_Parameter)>
+constexpr Struct_COM_Packet COM_Packet_Tx_Variable(uint8_t __Type, Enum_COM_Rate __Rate = COM_Rate_None,
+                                                   uint8_t __Priority = 0U)
+{
+    return (Struct_COM_Packet{__Type, Length, __Rate, __Priority, nullptr, &COM_Tx_Variable_Adapter<Length, Handler>});
+}
+
+/**
+ * @brief   获取接收数据校验错误次数
+ *
+ * @return  uint32_t    CRC校验错误次数
+ */
+uint32_t Class_CustomCOM::Get_Error_Number()
+{
+    return (this->Parser.Get_Error_Number());
+}
+
+/**
+ * @brief   获取Tx队列满丢帧次数
+ *
+ * @return  uint32_t    丢帧次数
+ */
+uint32_t Class_CustomCOM::Get_Tx_Full_Number()
+{
+    return (this->Tx_Full_Number);
+}
+
+/**
+ * @brief   获取遥测超时次数（带宽或队列不足，包在下一周期到期时仍未发出）
+ *
+ * @return  uint32_t    超时次数
+ */
+uint32_t Class_CustomCOM::Get_Overrun_Number()
+{
+    return (this->Overrun_Number);
+}
+
+/**
+ * @brief   获取已发送完成字节数（自由计数）
+ *
+ * @return  uint32_t    字节数
+ */
+uint32_t Class_CustomCOM::Get_Tx_Byte_Number()
+{
+    return (this->Tx_Byte_Number);
+}
+
+/**
+ * @brief   获取上行链路占用率（最近 1s 实际发送字节数 / 波特率折算字节数）
+ *
+ * @return  float       占用率 (0 ~ 1)
+ */
+float Class_CustomCOM::Get_Link_Utilization()
+{
+    return (this->Link_Utilization);
+}
+
+/**
+ * @brief   获取当前波特率
+ *
+ * @return  uint32_t    波特率 (bit/s)
+ */
+uint32_t Class_CustomCOM::Get_Baud_Rate()
+{
+    return (this->Baud_Rate);
+}
+
+/**
+ * @brief   获取链路状态
+ *
+ * @return  Enum_COM_Link_State     链路状态
+ */
+Enum_COM_Link_State Class_CustomCOM::Get_Link_State()
+{
+    return (this->Link_State);
+}
+
+/**
+ * @brief   获取串口错误回调次数（奇偶、噪声、帧格式、溢出、DMA错误）
+ *
+ * @return  uint32_t    错误次数
+ */
+uint32_t Class_CustomCOM::Get_UART_Error_Number()
+{
+    return (this->UART_Error_Number);
+}
+
+/**
+ * @brief   获取链路回退次数
+ *
+ * @return  uint32_t    回退次数
+ */
+uint32_t Class_CustomCOM::Get_Fallback_Number()
+{
+    return (this->Fallback_Number);
+}
+
+/**
+ * @brief   获取当前接收事件的接收时刻（在Rx处理函数中调用）
+ *
+ * @return  uint32_t    最后一个字节结束时刻 (us)
+ */
+uint32_t Class_CustomCOM::Get_Rx_Time()
+{
+    return (this->Rx_Time);
+}
+
+/**
+ * @brief   获取当前分发帧的帧时间戳（在Rx处理函数中调用）
+ *
+ * @return  uint32_t    上位机组帧时刻 (us, 上位机时钟，经 Get_Local_Time 映射为本端时刻)
+ */
+uint32_t Class_CustomCOM::Get_Rx_Timestamp()
+{
+    return (this->Rx_Timestamp);
+}
+
+/**
+ * @brief   获取上位机时钟是否已同步
+ *
+ * @return  bool    是否已同步（未同步时 Get_Host_Time、Get_Local_Time 原样返回）
+ */
+bool Class_CustomCOM::Get_Clock_Valid()
+{
+    return (this->Clock.Get_Valid());
+}
+
+/**
+ * @brief   本端时刻映射为上位机时刻
+ *
+ * @param   __Local_Time    本端时刻 (us, Time_Get_us)
+ * @return  uint32_t        上位机时刻 (us)
+ */
+uint32_t Class_CustomCOM::Get_Host_Time(uint32_t __Local_Time)
+{
+    return (this->Clock.To_Remote(__Local_Time));
+}
+
+/**
+ * @brief   上位机时刻映射为本端时刻
+ *
+ * @param   __Host_Time     上位机时刻 (us)
+ * @return  uint32_t        本端时刻 (us, Time_Get_us)
+ */
+uint32_t Class_CustomCOM::Get_Local_Time(uint32_t __Host_Time)
+{
+    return (this->Clock.To_Local(__Host_Time));
+}
+
+/**
+ * @brief   获取上位机时钟同步对象（漂移、往返时延等诊断信息）
+ *
+ * @return  Class_Clock_Sync *  时钟同步对象
+ */
+Class_Clock_Sync * Class_CustomCOM::Get_Clock()
+{
+    return (&this->Clock);
+}
+
+/**
+ * @brief   帧及同批其后字节的线上时间（当前波特率）
+ *
+ * @param   __Length    数据长度 (byte)
+ * @param   __Trailing  同一批接收中位于该帧之后的字节数
+ * @return  uint32_t    线上时间 (us)
+ */
+uint32_t Class_CustomCOM::Wire_Time(uint8_t __Length, uint16_t __Trailing)
+{
+    uint32_t wire = (this->Frame_Mode == Frame_Mode_COBS) ?
+                    (COBS_MAX_ENCODED(__Length + FRAME_OVERHEAD - 4U) + 1U) : (__Length + FRAME_OVERHEAD);
+
+    wire += __Trailing;
+
+    return ((wire * this->Byte_Time) >> 8);
+}
 
 #endif  /* FML_Communication.h */
@@ -0,0 +1,57 @@
+/**
+ * @file    Communication_Link.h
+ * @brief   自定义串口链路协商协议（下位机与上位机共用，仅依赖 stdint.h）
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+#ifndef __FML_COMMUNICATION_LINK_H
+#define __FML_COMMUNICATION_LINK_H
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "stdint.h"
+
+/* 宏定义 --------------------------------------------------------------------------------------------------------------*/
+#ifndef __packed
+#define __packed __attribute__((packed))
+#endif
+
+#define COM_PACKET_LINK             0xFFU       /* 链路协商包类型（保留，收发双向） */
+#define COM_LINK_LENGTH             14U         /* 链路协商包数据长度 (byte) */
+#define COM_LINK_BAUD_RATE_BASE     115200U     /* 基础波特率（上电、回退时使用，与下位机串口初始化配置一致） */
+#define COM_LINK_PROBE_NUMBER       16U         /* 提交前需往返成功的探测帧数 */
+#define COM_LINK_TRIAL_TIMEOUT      500U        /* 试用新波特率的超时 (ms)，超时未提交则双方回退 */
+#define COM_LINK_SILENCE_TIMEOUT    1000U       /* 高于基础波特率时无有效帧的超时 (ms)，超时则双方回退至基础波特率（双方需在此时间内至少发送一帧） */
+
+/* 探测帧数据（全0、全1、交替位、半字节交替，覆盖采样点偏差最敏感的位型） */
+#define COM_LINK_PATTERN            {0x00U, 0xFFU, 0x55U, 0xAAU, 0x0FU, 0xF0U, 0x33U, 0xCCU}
+
+/* 枚举类型定义 --------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   链路协商命令枚举类型
+ *          上位机发起：Propose -> (下位机 Accept 后双方切换) -> Probe x COM_LINK_PROBE_NUMBER（下位机逐帧回显）-> Commit
+ */
+enum Enum_COM_Link_Command : uint8_t
+{
+    COM_Link_Propose    = 0x01U,    /*!< 上位机：请求切换至 Baud_Rate */
+    COM_Link_Accept     = 0x02U,    /*!< 下位机：同意，发送完本帧后切换 */
+    COM_Link_Reject     = 0x03U,    /*!< 下位机：拒绝（波特率不可达或正在切换），Baud_Rate 为当前波特率 */
+    COM_Link_Probe      = 0x04U,    /*!< 上位机：探测帧（新波特率下），下位机原样回显 */
+    COM_Link_Commit     = 0x05U,    /*!< 上位机：探测通过，确认新波特率；下位机回显表示确认 */
+};
+
+/* 结构体定义 ----------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   链路协商包数据结构体
+ */
+struct __packed Struct_COM_Link
+{
+    uint8_t Command;                    /*!< 命令 (Enum_COM_Link_Command) */
+    uint8_t Sequence;                   /*!< 序号（探测帧递增，回显时原样返回） */
+    uint32_t Baud_Rate;                 /*!< 波特率 (bit/s) */
+    uint8_t Pattern[8];                 /*!< 探测数据（COM_LINK_PATTERN，其余命令填0） */
+};
+
+#endif /* FML_Communication_Link.h */
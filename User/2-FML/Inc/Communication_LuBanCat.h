@@ -0,0 +1,121 @@
+/**
+ * @file    Communication_LuBanCat.h
+ * @brief   鲁班猫上位机数据包定义（下位机与上位机共用，仅依赖 stdint.h）
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.1
+ */
+
+#ifndef __FML_COMMUNICATION_LUBANCAT_H
+#define __FML_COMMUNICATION_LUBANCAT_H
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "stdint.h"
+
+/* 宏定义 --------------------------------------------------------------------------------------------------------------*/
+#ifndef __packed
+#define __packed __attribute__((packed))
+#endif
+
+#define LUBANCAT_PACK_HEAD          0x20250301U     /* 包头（包头模式） */
+
+#define LUBANCAT_TELEMETRY_FIELD_NUMBER 17U         /* 压缩遥测字段数 */
+#define LUBANCAT_TELEMETRY_LENGTH       43U         /* 压缩遥测最大数据长度（由字段量程折算，见 Class_Telemetry_Encoder） */
+#define LUBANCAT_TELEMETRY_KEY_PERIOD   50U         /* 压缩遥测关键帧周期（帧数，100Hz 下 0.5s） */
+
+#define LUBANCAT_FLAG_CHASSIS_STATE     0x03U       /* 状态标志位0-1：底盘状态 (Enum_ChassisState) */
+#define LUBANCAT_FLAG_AUTOTUNE_FAILED   0x04U       /* 状态标志位2-5：电机0-3自整定失败（左移电机序号） */
+
+/* 压缩遥测字段描述（量程下限, 量程上限, 分辨率），与 Struct_Telemetry_LuBanCat 逐项对应，超出量程限幅 */
+#define LUBANCAT_TELEMETRY_FIELD_X4(Min, Max, Resolution) \
+    {Min, Max, Resolution}, {Min, Max, Resolution}, {Min, Max, Resolution}, {Min, Max, Resolution}
+#define LUBANCAT_TELEMETRY_FIELDS \
+{ \
+    LUBANCAT_TELEMETRY_FIELD_X4(-32.0f, 32.0f, 0.01f),          /* 实际转速 (rad/s) */ \
+    LUBANCAT_TELEMETRY_FIELD_X4(-32.0f, 32.0f, 0.01f),          /* 目标转速 (rad/s) */ \
+    LUBANCAT_TELEMETRY_FIELD_X4(-1.0f, 1.0f, 0.001f),           /* PWM占空比 */ \
+    LUBANCAT_TELEMETRY_FIELD_X4(-65536.0f, 65536.0f, 0.001f),   /* 输出轴累计角度 (rad) */ \
+    {0.0f, 255.0f, 1.0f},                                       /* 状态标志 */ \
+}
+
+/* 枚举类型定义 --------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   鲁班猫上位机包类型枚举
+ */
+enum Enum_LuBanCat_Packet : uint8_t
+{
+    LuBanCat_Packet_Motor       = 0x00U,    /*!< 上行：底盘电机转速 */
+    LuBanCat_Packet_Odometry    = 0x01U,    /*!< 上行：里程计 */
+    LuBanCat_Packet_Diagnostic  = 0x02U,    /*!< 上行：诊断信息 */
+    LuBanCat_Packet_Telemetry   = 0x03U,    /*!< 上行：压缩遥测（变长） */
+    LuBanCat_Packet_Chassis     = 0xF0U,    /*!< 下行：底盘运动指令 */
+    LuBanCat_Packet_Telemetry_Ack = 0xF1U,  /*!< 下行：压缩遥测关键帧确认 */
+};
+
+/* 结构体定义 ----------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   鲁班猫上位机Rx数据结构体
+ */
+struct __packed Struct_RxData_LuBanCat
+{
+    uint8_t Chassis_State;              /*!< 底盘设定状态 (Enum_ChassisState) */
+    float Chassis_Vel_X;                /*!< 底盘X轴速度 (m/s) */
+    float Chassis_Vel_Y;                /*!< 底盘Y轴速度 (m/s) */
+    float Chassis_Omega;                /*!< 底盘旋转角速度 (rad/s) */
+};
+
+/**
+ * @brief   鲁班猫上位机Tx数据结构体
+ */
+struct __packed Struct_TxData_LuBanCat
+{
+    float Chassis_Motor_Omega[4];       /*!< 底盘电机实际转速 */
+};
+
+/**
+ * @brief   鲁班猫上位机Tx数据结构体：里程计（电机输出轴累计角度与转速，上位机积分得到底盘位姿）
+ */
+struct __packed Struct_TxData_Odometry_LuBanCat
+{
+    float Wheel_Angle[4];               /*!< 底盘电机输出轴累计角度 (rad) */
+    float Wheel_Omega[4];               /*!< 底盘电机实际转速 (rad/s) */
+};
+
+/**
+ * @brief   鲁班猫上位机Tx数据结构体：诊断信息（计数均为低16位）
+ */
+struct __packed Struct_TxData_Diagnostic_LuBanCat
+{
+    uint8_t Autotune_State[4];          /*!< 底盘电机自整定状态 (Enum_Relay_Tune_State) */
+    uint16_t Link_Utilization;          /*!< 上行链路占用率 (0.01%) */
+    uint16_t Rx_Error_Number;           /*!< 接收校验错误次数 */
+    uint16_t Tx_Full_Number;            /*!< Tx队列满丢帧次数 */
+    uint16_t Overrun_Number;            /*!< 遥测超时次数 */
+    uint16_t Encode_Cycles_MAX;         /*!< 压缩遥测单帧编码最大耗时 (CPU周期) */
+};
+
+/**
+ * @brief   鲁班猫上位机Rx数据结构体：压缩遥测关键帧确认
+ */
+struct __packed Struct_RxData_Telemetry_Ack_LuBanCat
+{
+    uint8_t Sequence;                   /*!< 收到的关键帧序号 */
+};
+
+/**
+ * @brief   压缩遥测数值结构体（编码前、解码后；线上格式见 Class_Telemetry_Encoder，字段量程见 LUBANCAT_TELEMETRY_FIELDS）
+ */
+struct Struct_Telemetry_LuBanCat
+{
+    float Wheel_Omega[4];               /*!< 底盘电机实际转速 (rad/s) */
+    float Wheel_Target[4];              /*!< 底盘电机目标转速 (rad/s) */
+    float Wheel_Duty[4];                /*!< 底盘电机PWM占空比（带方向, -1 ~ 1） */
+    float Wheel_Angle[4];               /*!< 底盘电机输出轴累计角度 (rad) */
+    float Flags;                        /*!< 状态标志（整数值，按位见 LUBANCAT_FLAG_*） */
+};
+
+static_assert(sizeof(Struct_Telemetry_LuBanCat) == LUBANCAT_TELEMETRY_FIELD_NUMBER * sizeof(float),
+              "Struct_Telemetry_LuBanCat does not match LUBANCAT_TELEMETRY_FIELDS");
+
+#endif /* FML_Communication_LuBanCat.h */
@@ -0,0 +1,43 @@
+/**
+ * @file    Communication_Sync.h
+ * @brief   自定义串口时钟同步协议（下位机与上位机共用，仅依赖 stdint.h）
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+#ifndef __FML_COMMUNICATION_SYNC_H
+#define __FML_COMMUNICATION_SYNC_H
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "stdint.h"
+
+/* 宏定义 --------------------------------------------------------------------------------------------------------------*/
+#ifndef __packed
+#define __packed __attribute__((packed))
+#endif
+
+#define COM_PACKET_SYNC             0xFEU       /* 时钟同步包类型（保留，收发双向） */
+#define COM_SYNC_LENGTH             10U         /* 时钟同步包数据长度 (byte，上下行相同，两个方向的串行化时延一致) */
+#define COM_SYNC_PERIOD             100U        /* 上位机发起交换的周期 (ms) */
+#define COM_SYNC_NONE               0xFFU       /* 无上一次交换（Previous 字段） */
+
+/* 结构体定义 ----------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   时钟同步包数据结构体
+ *          上位机每 COM_SYNC_PERIOD 发起一次交换：请求帧的帧时间戳为 T1，下位机接收时刻为 T2，
+ *          下位机应答帧的帧时间戳为 T3，上位机接收时刻为 T4（见 Class_Clock_Sync）；
+ *          两端的接收时刻均按帧的线上长度折算回帧起始时刻，与发送方组帧时刻（帧时间戳）对应同一位置；
+ *          上位机在收到应答时拿到全部四个时间戳，下位机则在下一次请求中收到上一次交换的 T1、T4，
+ *          两端以同一组交换各自估计偏移与漂移
+ */
+struct __packed Struct_COM_Sync
+{
+    uint8_t Sequence;                   /*!< 交换序号（应答原样返回） */
+    uint8_t Previous;                   /*!< 请求：Origin、Receive 所属的上一次交换序号（COM_SYNC_NONE 为无）；应答：COM_SYNC_NONE */
+    uint32_t Origin;                    /*!< 请求：上一次交换的 T1；应答：本次交换的 T1 (us, 上位机时钟) */
+    uint32_t Receive;                   /*!< 请求：上一次交换的 T4 (us, 上位机时钟)；应答：本次交换的 T2 (us, 下位机时钟) */
+};
+
+#endif /* FML_Communication_Sync.h */
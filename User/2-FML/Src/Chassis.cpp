@@ -4,7 +4,7 @@
  *
  * @author  Tang-yucheng (QQ: 3143961287)
  * @date    2024-2-14
- * @version v1.0
+ * @version v1.3
  */
 
 /* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
@@ -17,25 +17,45 @@ Class_Chassis_Macnum Committee_Chariot;
 /************************************************************************************************************************
  * @brief   麦轮底盘初始化函数
  *
- * @param   __Control_Cycle     底盘控制周期 (控制周期 = __Control_Cycle * 系统心跳周期)
+ * @param   __Wheel_Omega_MAX       轮子最大角速度 (rad/s)
+ * @param   __Control_Cycle         底盘控制周期 (控制周期 = __Control_Cycle * 系统心跳周期)
+ * @param   __Wheel_Control         轮速闭环方式
+ * @param   __Acceleration_Linear   底盘平移加速度限幅 (m/s^2)
+ * @param   __Acceleration_Angular  底盘旋转角加速度限幅 (rad/s^2)
+ * @note    两者均为0时不在底盘速度空间变速，改由各轮斜坡变速（5 rad/s 每控制周期）
  ***********************************************************************************************************************/
-void Class_Chassis_Macnum::Init(float __Wheel_Omega_MAX, uint16_t __Control_Cycle)
+void Class_Chassis_Macnum::Init(float __Wheel_Omega_MAX, uint16_t __Control_Cycle, Enum_Chassis_Wheel_Control __Wheel_Control,
+                                float __Acceleration_Linear, float __Acceleration_Angular)
 {
+    float d_t = __Control_Cycle / 1000.0f;
+    float k_linear = 1.0f / this->Wheel_Radius;
+    float k_angular = (this->Wheel_Spacing + this->Wheel_Base) / 2.0f / this->Wheel_Radius;
+
     /* 参数赋值 */
     this->Wheel_Omega_MAX = __Wheel_Omega_MAX;
     this->Control_Cycle = __Control_Cycle;
+    this->Wheel_Control = __Wheel_Control;
+    this->Gear_Twist.Init(__Acceleration_Linear * d_t, __Acceleration_Angular * d_t);
+
+    /* 逆运动学矩阵 */
+    this->Inverse_Kinematics = {{{ k_linear, -k_linear, -k_angular},
+                                 {-k_linear, -k_linear, -k_angular},
+                                 { k_linear,  k_linear, -k_angular},
+                                 {-k_linear,  k_linear, -k_angular}}};
 
-    /* 电机初始化 */
-    this->Motor_Wheel[0].Init(&htim2, &htim8, TIM_CHANNEL_1, GPIOC, GPIOC, GPIO_PIN_1, GPIO_PIN_3 , 20.0f);
-    this->Motor_Wheel[1].Init(&htim3, &htim8, TIM_CHANNEL_2, GPIOG, GPIOG, GPIO_PIN_12, GPIO_PIN_14, 20.0f);
-    this->Motor_Wheel[2].Init(&htim4, &htim8, TIM_CHANNEL_3, GPIOG, GPIOG, GPIO_PIN_11 , GPIO_PIN_13, 20.0f);
-    this->Motor_Wheel[3].Init(&htim5, &htim8, TIM_CHANNEL_4, GPIOC, GPIOC, GPIO_PIN_0, GPIO_PIN_2, 20.0f);
+    /* 电机初始化（电机控制周期与底盘一致，统一闭环时测速周期才正确） */
+    this->Motor_Wheel[0].Init(&htim2, &htim8, TIM_CHANNEL_1, GPIOC, GPIOC, GPIO_PIN_1, GPIO_PIN_3 , 20.0f, 27.0f, 13U, this->Control_Cycle);
+    this->Motor_Wheel[1].Init(&htim3, &htim8, TIM_CHANNEL_2, GPIOG, GPIOG, GPIO_PIN_12, GPIO_PIN_14, 20.0f, 27.0f, 13U, this->Control_Cycle);
+    this->Motor_Wheel[2].Init(&htim4, &htim8, TIM_CHANNEL_3, GPIOG, GPIOG, GPIO_PIN_11 , GPIO_PIN_13, 20.0f, 27.0f, 13U, this->Control_Cycle);
+    this->Motor_Wheel[3].Init(&htim5, &htim8, TIM_CHANNEL_4, GPIOC, GPIOC, GPIO_PIN_0, GPIO_PIN_2, 20.0f, 27.0f, 13U, this->Control_Cycle);
 
     for (uint8_t i = 0; i < 4; i++)
     {
         this->Motor_Wheel[i].PID_Omega.Init(0.1f, 5.0f, 0.0f, 0.0f, 10.0f, 20.0f, 0.05f);
-        this->Motor_Wheel[i].Gear_Slope.Init(5.0f);
+        /* 底盘速度空间变速时各轮斜坡旁路 */
+        this->Motor_Wheel[i].Gear_Slope.Init(this->Gear_Twist.Get_Enable() ? 0.0f : 5.0f);
     }
+    this->PID_Omega_Bank.Init(0.1f, 5.0f, 0.0f, 0.0f, 10.0f, 20.0f, 0.05f);
 
     /* 初始化完成，底盘使能 */
     this->Enable();
@@ -63,6 +83,7 @@ void Class_Chassis_Macnum::Control()
             this->Velocity_X = 0.0f;
             this->Velocity_Y = 0.0f;
             this->Omega = 0.0f;
+            this->Gear_Twist.Reset();
 
             /* 电机设置为悬空 */
             for (uint8_t i = 0; i < 4; i++)
@@ -76,6 +97,7 @@ void Class_Chassis_Macnum::Control()
             this->Velocity_X = 0.0f;
             this->Velocity_Y = 0.0f;
             this->Omega = 0.0f;
+            this->Gear_Twist.Reset();
 
             /* 电机设置为刹车 */
             for (uint8_t i = 0; i < 4; i++)
@@ -85,19 +107,18 @@ void Class_Chassis_Macnum::Control()
         }
         else if (this->Chassis_State == Chassis_Run)
         {
-            float Wheel_Omega_Preliminary[4];
+            Class_Vector<4> Wheel_Omega_Preliminary;
             float Wheel_Omega_Max = 0.0f;
             float Limit_Factor = 1.0f;
 
+            /* 底盘速度空间变速 */
+            this->Gear_Twist.Set_Value(this->Velocity_X, this->Velocity_Y, this->Omega);
+            this->Gear_Twist.Calculate();
+
             /* 四轮角速度初步解算 (rad/s) */
-            Wheel_Omega_Preliminary[0] =
-            (this->Velocity_X - this->Velocity_Y - this->Omega * (this->Wheel_Spacing + this->Wheel_Base) / 2) / this->Wheel_Radius;
-            Wheel_Omega_Preliminary[1] =
-            -(this->Velocity_X + this->Velocity_Y + this->Omega * (this->Wheel_Spacing + this->Wheel_Base) / 2) / this->Wheel_Radius;
-            Wheel_Omega_Preliminary[2] =
-            (this->Velocity_X + this->Velocity_Y - this->Omega * (this->Wheel_Spacing + this->Wheel_Base) / 2) / this->Wheel_Radius;
-            Wheel_Omega_Preliminary[3] =
-            -(this->Velocity_X - this->Velocity_Y + this->Omega * (this->Wheel_Spacing + this->Wheel_Base) / 2) / this->Wheel_Radius;
+            Class_Vector<3> Twist = {{this->Gear_Twist.Get_Velocity_X(), this->Gear_Twist.Get_Velocity_Y(),
+                                      this->Gear_Twist.Get_Omega()}};
+            Wheel_Omega_Preliminary = this->Inverse_Kinematics * Twist;
 
             /* 轮速限幅因子计算 */
             for (uint8_t i = 0; i < 4; i++)
@@ -118,6 +139,61 @@ void Class_Chassis_Macnum::Control()
                 this->Motor_Wheel[i].MotionSet(Wheel_Omega_Preliminary[i] * Limit_Factor);
             }
         }
+
+        /* 底盘统一闭环 */
+        if (this->Wheel_Control == Chassis_Wheel_Bank)
+        {
+            this->Wheel_Control_Bank();
+        }
+    }
+}
+
+/************************************************************************************************************************
+ * @brief   四轮统一闭环控制（PID控制器组一次计算四路，替代四个电机各自的 Control()）
+ * @note    PID控制器组仅有 P/I/D/前馈，处于位置、自整定模式或启用增益调度、S曲线变速的电机不进入控制器组，
+ *          由其 Control_Loop() 完成本周期闭环，对应一路清零
+ ***********************************************************************************************************************/
+void Class_Chassis_Macnum::Wheel_Control_Bank()
+{
+    bool Wheel_Run[4];
+
+    /* 测速、斜坡变速，装载PID控制器组 */
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        Class_Motor_BDC & motor = this->Motor_Wheel[i];
+
+        if (motor.Get_Mode() == Motor_Mode_Omega && !motor.Gain_Schedule.Get_Enable() && !motor.Gear_SCurve.Get_Enable())
+        {
+            Wheel_Run[i] = motor.Control_Prepare();
+        }
+        else
+        {
+            motor.Control_Loop();
+            Wheel_Run[i] = false;
+        }
+
+        if (Wheel_Run[i])
+        {
+            this->PID_Omega_Bank.Set_Target(i, motor.Get_TargetOmega());
+            this->PID_Omega_Bank.Set_Actual(i, motor.Get_ActualOmega());
+        }
+        else
+        {
+            /* 电机停止或不经控制器组，该路状态清零（再次加入时无微分、前馈冲击） */
+            this->PID_Omega_Bank.Reset(i);
+        }
+    }
+
+    /* 四路PID一次计算 */
+    this->PID_Omega_Bank.Calculate();
+
+    /* 电机输出 */
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        if (Wheel_Run[i])
+        {
+            this->Motor_Wheel[i].Control_Output(this->PID_Omega_Bank.Get_Out(i));
+        }
     }
 }
 
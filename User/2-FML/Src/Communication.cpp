@@ -4,61 +4,214 @@
  *
  * @author  Tang-yucheng (QQ: 3143961287)
  * @date    2024-2-15
- * @version v1.0
+ * @version v1.8
  */
 
 /* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
 #include "Communication.h"
+#include "Chassis.h"
+#include "Telemetry_Codec.h"
+#include "User_Dwt.h"
 
 /* 全局变量创建 --------------------------------------------------------------------------------------------------------*/
-Class_CustomCOM COM_LuBanCat(COM_TxCallback_LuBanCat, COM_RxCallback_LuBanCat, COM_OffCallback_LuBanCat, &UART3_Manage_Object);
+/**
+ * @brief   鲁班猫上位机包描述表
+ */
+const Struct_COM_Packet COM_Packet_LuBanCat[] =
+{
+    COM_Packet_Tx<Struct_TxData_LuBanCat, 16U, COM_Tx_Motor_LuBanCat>(LuBanCat_Packet_Motor),
+    COM_Packet_Tx<Struct_TxData_Odometry_LuBanCat, 32U, COM_Tx_Odometry_LuBanCat>(LuBanCat_Packet_Odometry),
+    COM_Packet_Tx<Struct_TxData_Diagnostic_LuBanCat, 14U, COM_Tx_Diagnostic_LuBanCat>(LuBanCat_Packet_Diagnostic,
+                                                                                       COM_Rate_On_Change, 2U),
+    COM_Packet_Tx_Variable<LUBANCAT_TELEMETRY_LENGTH, COM_Tx_Telemetry_LuBanCat>(LuBanCat_Packet_Telemetry,
+                                                                                  COM_Rate_100Hz, 0U),
+    COM_Packet_Rx<Struct_RxData_LuBanCat, 13U, COM_Rx_Chassis_LuBanCat>(LuBanCat_Packet_Chassis),
+    COM_Packet_Rx<Struct_RxData_Telemetry_Ack_LuBanCat, 1U, COM_Rx_Telemetry_Ack_LuBanCat>(
+        LuBanCat_Packet_Telemetry_Ack),
+};
+
+/**
+ * @brief   鲁班猫上位机压缩遥测编码器（替代定长的底盘电机转速、里程计遥测，两者保留为手动发送）
+ */
+const Struct_Codec_Field COM_Telemetry_Field_LuBanCat[LUBANCAT_TELEMETRY_FIELD_NUMBER] = LUBANCAT_TELEMETRY_FIELDS;
+
+Class_Telemetry_Encoder COM_Telemetry_LuBanCat(COM_Telemetry_Field_LuBanCat, LUBANCAT_TELEMETRY_FIELD_NUMBER,
+                                               LUBANCAT_TELEMETRY_KEY_PERIOD);
+
+/**
+ * @brief   压缩遥测单帧编码最大耗时 (CPU周期)
+ */
+uint32_t COM_Telemetry_Cycles_LuBanCat = 0U;
+
+/**
+ * @brief   链路协商包描述（各链路共用，不在包描述表中）
+ */
+const Struct_COM_Packet COM_Packet_Link =
+    COM_Packet_Tx<Struct_COM_Link, COM_LINK_LENGTH, COM_Tx_Link>(COM_PACKET_LINK);
+
+/**
+ * @brief   时钟同步包描述（各链路共用，不在包描述表中）
+ */
+const Struct_COM_Packet COM_Packet_Sync =
+    COM_Packet_Tx<Struct_COM_Sync, COM_SYNC_LENGTH, COM_Tx_Sync>(COM_PACKET_SYNC);
+
+/**
+ * @brief   链路探测数据
+ */
+const uint8_t COM_Link_Pattern[8] = COM_LINK_PATTERN;
+
+Class_CustomCOM COM_LuBanCat(COM_Packet_LuBanCat, sizeof(COM_Packet_LuBanCat) / sizeof(COM_Packet_LuBanCat[0]),
+                             COM_OffCallback_LuBanCat, &UART3_Manage_Object);
 
 /* 函数定义 ------------------------------------------------------------------------------------------------------------*/
 /************************************************************************************************************************
- * @brief       串口Tx回调函数
+ * @brief       链路协商包填充
+ *
+ * @param[out]  Data            发送包数据
+ * @param[in]   Data_Parameter  待发送的链路协商包 (Struct_COM_Link *)
+ ***********************************************************************************************************************/
+void COM_Tx_Link(Struct_COM_Link * Data, void * Data_Parameter)
+{
+    memcpy(Data, Data_Parameter, sizeof(Struct_COM_Link));
+}
+
+/************************************************************************************************************************
+ * @brief       时钟同步包填充
+ *
+ * @param[out]  Data            发送包数据
+ * @param[in]   Data_Parameter  待发送的时钟同步包 (Struct_COM_Sync *)
+ ***********************************************************************************************************************/
+void COM_Tx_Sync(Struct_COM_Sync * Data, void * Data_Parameter)
+{
+    memcpy(Data, Data_Parameter, sizeof(Struct_COM_Sync));
+}
+
+/************************************************************************************************************************
+ * @brief       上行包填充：底盘电机转速
  * 
- * @param[in]   Pack_Type_Tx    发送包类型
+ * @param[out]  Data            发送包数据
  * @param[in]   Data_Parameter  发送数据可能需要的参数指针
- * @param[out]  Data_Tx         发送包数据
  ***********************************************************************************************************************/
-void COM_TxCallback_LuBanCat(uint8_t Pack_Type_Tx, void * Data_Parameter, void * Data_Tx)
+void COM_Tx_Motor_LuBanCat(Struct_TxData_LuBanCat * Data, void * Data_Parameter)
 {
-    if (Pack_Type_Tx == 0x00)
+    (void) Data_Parameter;
+
+    for (uint8_t i = 0; i < 4; i++)
     {
-        /* 当前包为上行包0 */
-        auto Data = (Struct_TxData_LuBanCat *)Data_Tx;
+        Data->Chassis_Motor_Omega[i] = Committee_Chariot.Motor_Wheel[i].Get_TargetOmega();
+    }
+}
 
-        for (uint8_t i = 0; i < 4; i++)
-        {
-            Data->Chassis_Motor_Omega[i] = Committee_Chariot.Motor_Wheel[i].Get_TargetOmega();
-        }
+/************************************************************************************************************************
+ * @brief       上行包填充：里程计
+ *
+ * @param[out]  Data            发送包数据
+ * @param[in]   Data_Parameter  发送数据可能需要的参数指针
+ ***********************************************************************************************************************/
+void COM_Tx_Odometry_LuBanCat(Struct_TxData_Odometry_LuBanCat * Data, void * Data_Parameter)
+{
+    (void) Data_Parameter;
+
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        Data->Wheel_Angle[i] = Committee_Chariot.Motor_Wheel[i].Get_ActualAngle();
+        Data->Wheel_Omega[i] = Committee_Chariot.Motor_Wheel[i].Get_ActualOmega();
     }
 }
 
 /************************************************************************************************************************
- * @brief   串口Rx回调函数
+ * @brief       上行包填充：诊断信息（变化时发送）
  *
- * @param   Data_Rx         解析到的数据结构体指针
- * @param   Pack_Type_Rx    解析到的包类型
+ * @param[out]  Data            发送包数据
+ * @param[in]   Data_Parameter  发送数据可能需要的参数指针
  ***********************************************************************************************************************/
-void COM_RxCallback_LuBanCat(void * Data_Rx, uint8_t Pack_Type_Rx)
+void COM_Tx_Diagnostic_LuBanCat(Struct_TxData_Diagnostic_LuBanCat * Data, void * Data_Parameter)
 {
-    if (Pack_Type_Rx == 0xF0)
+    (void) Data_Parameter;
+
+    for (uint8_t i = 0; i < 4; i++)
     {
-        /* 当前包为下行包0 */
-        auto Data = (Struct_RxData_LuBanCat *)Data_Rx;
+        Data->Autotune_State[i] = (uint8_t) Committee_Chariot.Motor_Wheel[i].Get_AutotuneState();
+    }
+    Data->Link_Utilization = (uint16_t) (COM_LuBanCat.Get_Link_Utilization() * 10000.0f);
+    Data->Rx_Error_Number = (uint16_t) COM_LuBanCat.Get_Error_Number();
+    Data->Tx_Full_Number = (uint16_t) COM_LuBanCat.Get_Tx_Full_Number();
+    Data->Overrun_Number = (uint16_t) COM_LuBanCat.Get_Overrun_Number();
+    Data->Encode_Cycles_MAX = (COM_Telemetry_Cycles_LuBanCat < 0xFFFFU) ?
+                              (uint16_t) COM_Telemetry_Cycles_LuBanCat : 0xFFFFU;
+}
 
-        if (Data->Chassis_State == Chassis_Run)
-        {
-            /* 底盘运动设置 */
-            Committee_Chariot.Set_Motion(Data->Chassis_Vel_X, Data->Chassis_Vel_Y, Data->Chassis_Omega);
-        }
-        else if (Data->Chassis_State == Chassis_Suspend || Data->Chassis_State == Chassis_Brake)
+/************************************************************************************************************************
+ * @brief       上行包填充：压缩遥测（变长）
+ * @note        四轮转速、目标转速、占空比、累计角度与状态标志按 LUBANCAT_TELEMETRY_FIELDS 量化后差分编码，
+ *              编码耗时（DWT周期）的最大值随诊断信息上报
+ *
+ * @param[out]  Data            发送包数据
+ * @param[in]   Size            发送包数据最大长度
+ * @param[in]   Data_Parameter  发送数据可能需要的参数指针
+ * @return      uint8_t         数据长度
+ ***********************************************************************************************************************/
+uint8_t COM_Tx_Telemetry_LuBanCat(uint8_t * Data, uint8_t Size, void * Data_Parameter)
+{
+    Struct_Telemetry_LuBanCat value;
+    uint32_t flags = (uint32_t) Committee_Chariot.Get_State() & LUBANCAT_FLAG_CHASSIS_STATE;
+
+    (void) Data_Parameter;
+
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        Class_Motor_BDC & motor = Committee_Chariot.Motor_Wheel[i];
+
+        value.Wheel_Omega[i] = motor.Get_ActualOmega();
+        value.Wheel_Target[i] = motor.Get_TargetOmega();
+        value.Wheel_Duty[i] = motor.Get_Duty();
+        value.Wheel_Angle[i] = motor.Get_ActualAngle();
+        if (motor.Get_AutotuneState() == Relay_Tune_Failed)
         {
-            /* 底盘停止设置 */
-            Committee_Chariot.Set_Stop(Data->Chassis_State);
+            flags |= LUBANCAT_FLAG_AUTOTUNE_FAILED << i;
         }
     }
+    value.Flags = (float) flags;
+
+    uint32_t start = DWT_Get_Cycle();
+    uint8_t length = COM_Telemetry_LuBanCat.Encode((const float *) &value, Data, Size);
+    uint32_t cycles = DWT_Get_Elapsed(start);
+
+    if (cycles > COM_Telemetry_Cycles_LuBanCat)
+    {
+        COM_Telemetry_Cycles_LuBanCat = cycles;
+    }
+
+    return (length);
+}
+
+/************************************************************************************************************************
+ * @brief   下行包处理：底盘运动指令
+ *
+ * @param   Data    解析到的数据结构体指针
+ ***********************************************************************************************************************/
+void COM_Rx_Chassis_LuBanCat(const Struct_RxData_LuBanCat * Data)
+{
+    if (Data->Chassis_State == Chassis_Run)
+    {
+        /* 底盘运动设置 */
+        Committee_Chariot.Set_Motion(Data->Chassis_Vel_X, Data->Chassis_Vel_Y, Data->Chassis_Omega);
+    }
+    else if (Data->Chassis_State == Chassis_Suspend || Data->Chassis_State == Chassis_Brake)
+    {
+        /* 底盘停止设置 */
+        Committee_Chariot.Set_Stop((Enum_ChassisState) Data->Chassis_State);
+    }
+}
+
+/************************************************************************************************************************
+ * @brief   下行包处理：压缩遥测关键帧确认（下一帧起以该关键帧为差分基准）
+ *
+ * @param   Data    解析到的数据结构体指针
+ ***********************************************************************************************************************/
+void COM_Rx_Telemetry_Ack_LuBanCat(const Struct_RxData_Telemetry_Ack_LuBanCat * Data)
+{
+    COM_Telemetry_LuBanCat.Acknowledge(Data->Sequence);
 }
 
 /************************************************************************************************************************
@@ -73,17 +226,17 @@ void COM_OffCallback_LuBanCat()
 /************************************************************************************************************************
  * @brief   自定义串口类构造函数
  *
- * @param   __COM_TxCallback    Tx回调函数指针
- * @param   __COM_RxCallback    Rx回调函数指针
+ * @param   __Packet_Table      包描述表（需在对象生命周期内有效，通常为 const 全局数组）
+ * @param   __Packet_Number     包描述表项数（不超过255）
+ * @param   __COM_OffCallback   离线回调函数指针
  * @param   __UART              串口外设句柄
  ***********************************************************************************************************************/
-Class_CustomCOM::Class_CustomCOM(void (* __COM_TxCallback)(uint8_t Pack_Type_Tx, void * Data_Parameter, void * Data_Tx),
-                                 void (* __COM_RxCallback)(void * Data_Rx, uint8_t Pack_Type_Rx),
+Class_CustomCOM::Class_CustomCOM(const Struct_COM_Packet * __Packet_Table, uint8_t __Packet_Number,
                                  void (* __COM_OffCallback)(),
                                  Struct_UART_Manage_Object * __UART)
 {
-    this->COM_TxCallback = __COM_TxCallback;
-    this->COM_RxCallback = __COM_RxCallback;
+    this->Packet_Table = __Packet_Table;
+    this->Packet_Number = __Packet_Number;
     this->COM_OffCallback = __COM_OffCallback;
     this->UART = __UART;
 }
@@ -91,33 +244,161 @@ Class_CustomCOM::Class_CustomCOM(void (* __COM_TxCallback)(uint8_t Pack_Type_Tx,
 /************************************************************************************************************************
  * @brief   自定义串口类初始化函数
  * 
- * @param   __Packet_Length_Tx  Tx数据包长度（最大不超过Tx缓冲区长度）
- * @param   __Packet_Length_Rx  Rx数据包长度（最大不超过Rx缓冲区长度）
- * @param   __Pack_Head         包头 (4byte)
+ * @param   __Pack_Head         包头 (4byte，COBS模式不使用)
+ * @param   __Frame_Mode        分帧方式（需与上位机一致）
  ***********************************************************************************************************************/
-void Class_CustomCOM::Init(uint8_t __Packet_Length_Tx, uint8_t __Packet_Length_Rx, uint32_t __Pack_Head)
+void Class_CustomCOM::Init(uint32_t __Pack_Head, Enum_Frame_Mode __Frame_Mode)
 {
     /* 参数赋值 */
-    if (__Packet_Length_Tx > this->MAX_Len_Tx)
+    this->Pack_Head = __Pack_Head;
+    this->Frame_Mode = __Frame_Mode;
+
+    /* Tx包头填充（各槽） */
+    for (uint8_t i = 0; i < this->MAX_Slot_Tx; i++)
     {
-        __Packet_Length_Tx = this->MAX_Len_Tx;
+        memcpy(this->Buffer_Tx[i], &this->Pack_Head, 4);
     }
-    if (__Packet_Length_Rx > this->MAX_Len_Rx)
+
+    /* Rx流式解析器初始化 */
+    this->Parser.Init(this->UART->Rx_Buffer, UART_RX_BUFFER_SIZE, this->Pack_Head, this->Frame_Mode);
+
+    /* 链路状态复位，注册链路协商包 */
+    this->Baud_Rate_Base = this->UART->huart->Init.BaudRate;
+    this->Link_State = COM_Link_Stable;
+    this->Parser.Register(COM_PACKET_LINK, COM_LINK_LENGTH);
+
+    /* 时钟同步复位，注册时钟同步包 */
+    this->Clock.Reset();
+    this->Sync_Sequence = COM_SYNC_NONE;
+    this->Parser.Register(COM_PACKET_SYNC, COM_SYNC_LENGTH);
+
+    /* 建立包类型索引，注册可接收的包类型 */
+    memset(this->Packet_Index, 0xFF, sizeof(this->Packet_Index));
+    for (uint8_t i = 0; i < this->Packet_Number; i++)
     {
-        __Packet_Length_Rx = this->MAX_Len_Rx;
+        const Struct_COM_Packet & packet = this->Packet_Table[i];
+
+        this->Packet_Index[packet.Type] = i;
+        if (packet.Rx_Handler != nullptr)
+        {
+            this->Parser.Register(packet.Type, packet.Length);
+        }
     }
-    this->Packet_Length_Tx = __Packet_Length_Tx;
-    this->Packet_Length_Rx = __Packet_Length_Rx;
-    this->Pack_Head = __Pack_Head;
 
-    /* Tx包头填充 */
-    memcpy(this->Buffer_Tx, &this->Pack_Head, 4);
-    
-    /* UART用户层初始化 */
-    UART_Init(this->UART, this->Packet_Length_Rx);
+    /* 遥测调度初始化 */
+    this->Schedule_Init();
+
+    /* 开启环形DMA串口数据接收 */
+    UART_ReceiveToRing_DMA(this->UART);
+}
+
+/************************************************************************************************************************
+ * @brief   遥测调度初始化
+ * @note    收集登记了速率等级的发送包，按优先级排序，按当前波特率折算字节预算；
+ *          再按周期从短到长、帧从长到短依次在超周期内贪心选择相位，使各心跳累计字节数的峰值最小
+ ***********************************************************************************************************************/
+void Class_CustomCOM::Schedule_Init()
+{
+    uint16_t load[COM_SCHEDULE_HYPERPERIOD] = {0};
+    uint8_t wire_max = 0U;
+
+    /* 收集调度项，按优先级插入排序 */
+    this->Schedule_Number = 0U;
+    for (uint8_t i = 0; i < this->Packet_Number && this->Schedule_Number < this->MAX_Schedule; i++)
+    {
+        const Struct_COM_Packet & packet = this->Packet_Table[i];
+
+        if (packet.Tx_Handler == nullptr || packet.Rate == COM_Rate_None)
+        {
+            continue;
+        }
+
+        Struct_COM_Schedule item;
+
+        item.Index = i;
+        item.Period = (packet.Rate == COM_Rate_On_Change) ? COM_SCHEDULE_CHECK_PERIOD : (uint8_t) packet.Rate;
+        item.Phase = 0U;
+        item.Wire_Length = (this->Frame_Mode == Frame_Mode_COBS) ?
+                           (uint8_t) (COBS_MAX_ENCODED(packet.Length + FRAME_OVERHEAD - 4U) + 2U) :
+                           (uint8_t) (packet.Length + FRAME_OVERHEAD);
+        item.Pending = 0U;
+        item.Refresh = 0U;
+        item.Hash = 0U;
+        wire_max = (item.Wire_Length > wire_max) ? item.Wire_Length : wire_max;
+
+        uint8_t j = this->Schedule_Number;
+
+        while (j > 0U && this->Packet_Table[this->Schedule_List[j - 1U].Index].Priority > packet.Priority)
+        {
+            this->Schedule_List[j] = this->Schedule_List[j - 1U];
+            j--;
+        }
+        this->Schedule_List[j] = item;
+        this->Schedule_Number += 1U;
+    }
+
+    /* 字节预算 */
+    this->Wire_MAX = wire_max;
+    this->Set_Budget(this->UART->huart->Init.BaudRate);
+    this->Budget = this->Budget_MAX;
+
+    /* 相位错开 */
+    uint32_t placed = 0U;
+
+    for (uint8_t n = 0; n < this->Schedule_Number; n++)
+    {
+        uint8_t next = 0xFFU;
+
+        for (uint8_t i = 0; i < this->Schedule_Number; i++)
+        {
+            const Struct_COM_Schedule & item = this->Schedule_List[i];
+
+            if ((placed & (1UL << i)) == 0U &&
+                (next == 0xFFU || item.Period < this->Schedule_List[next].Period ||
+                 (item.Period == this->Schedule_List[next].Period && item.Wire_Length > this->Schedule_List[next].Wire_Length)))
+            {
+                next = i;
+            }
+        }
+
+        Struct_COM_Schedule & item = this->Schedule_List[next];
+        uint16_t peak_min = 0xFFFFU;
 
-    /* 开启一次 DMA-IDLE 串口数据接收 */
-    UART_ReceiveToIdle_DMA(this->UART);
+        for (uint8_t phase = 0; phase < item.Period; phase++)
+        {
+            uint16_t peak = 0U;
+
+            for (uint8_t tick = phase; tick < COM_SCHEDULE_HYPERPERIOD; tick += item.Period)
+            {
+                peak = (load[tick] > peak) ? load[tick] : peak;
+            }
+            if (peak < peak_min)
+            {
+                peak_min = peak;
+                item.Phase = phase;
+            }
+        }
+        for (uint8_t tick = item.Phase; tick < COM_SCHEDULE_HYPERPERIOD; tick += item.Period)
+        {
+            load[tick] += item.Wire_Length;
+        }
+        placed |= 1UL << next;
+    }
+}
+
+/************************************************************************************************************************
+ * @brief   按波特率设置字节预算
+ * @note    8N1 每字节10位；预算上限为一个心跳的预算 + 最长调度帧，保证任一帧都能攒够预算，同时限制突发；
+ *          每字节线上时间用于把接收时刻折算回帧起始时刻（时钟同步）
+ *
+ * @param   __Baud_Rate     波特率 (bit/s)
+ ***********************************************************************************************************************/
+void Class_CustomCOM::Set_Budget(uint32_t __Baud_Rate)
+{
+    this->Baud_Rate = __Baud_Rate;
+    this->Budget_Tick = (uint32_t) (((uint64_t) __Baud_Rate << 8) / (10U * COM_SCHEDULE_FREQUENCY));
+    this->Budget_MAX = this->Budget_Tick + ((uint32_t) this->Wire_MAX << 8);
+    this->Byte_Time = (10000000UL << 8) / __Baud_Rate;
 }
 
 /************************************************************************************************************************
@@ -151,68 +432,541 @@ void Class_CustomCOM::AliveCheck(uint16_t Period)
 
 /************************************************************************************************************************
  * @brief   自定义串口数据发送函数
+ * @note    按包类型查包描述表，在队列空闲槽内原地组帧后入队，DMA空闲时立即发送，否则由 TxProcess 在上一帧发送完成后接续发送；
+ *          与 Schedule 共用同一发送队列，仅允许与 Schedule 位于同一中断（如TIM6中断）中调用
  * 
  * @param   Pack_Type_Tx    发送包类型
  * @param   Data_Parameter  发送数据可能需要的参数指针
+ * @return  bool            是否入队成功（包类型未注册发送、队列满时丢弃本帧）
+ ***********************************************************************************************************************/
+bool Class_CustomCOM::DataSend(uint8_t Pack_Type_Tx, void * Data_Parameter)
+{
+    uint8_t index = this->Packet_Index[Pack_Type_Tx];
+
+    /* 包类型校验 */
+    if (index == 0xFFU || this->Packet_Table[index].Tx_Handler == nullptr)
+    {
+        return (false);
+    }
+
+    return (this->Tx_Push(this->Packet_Table[index], Data_Parameter, nullptr));
+}
+
+/************************************************************************************************************************
+ * @brief   遥测调度函数
+ * @note    每个系统心跳（COM_SCHEDULE_FREQUENCY）调用一次：累积字节预算，标记到期的周期包（上次仍未发出则计超时）
+ *          与到检测时刻的变化检测包，再按优先级依次发送（变化检测包数据未变化时不发送）；预算或队列空槽不足时停止，剩余包顺延至后续心跳，
+ *          不会被低优先级的短包插队；链路切换中暂停发送；每 1s 以已发送完成字节数更新链路占用率
  ***********************************************************************************************************************/
-void Class_CustomCOM::DataSend(uint8_t Pack_Type_Tx, void * Data_Parameter)
+void Class_CustomCOM::Schedule()
 {
-    /* 包类型填充 */
-    this->Buffer_Tx[4] = Pack_Type_Tx;
+    uint8_t tick = this->Schedule_Tick;
+    bool blocked = (this->Link_State == COM_Link_Switching);
+
+    this->Schedule_Tick = (tick + 1U < COM_SCHEDULE_HYPERPERIOD) ? (tick + 1U) : 0U;
+
+    /* 预算累积 */
+    this->Budget += this->Budget_Tick;
+    if (this->Budget > this->Budget_MAX)
+    {
+        this->Budget = this->Budget_MAX;
+    }
+
+    for (uint8_t i = 0; i < this->Schedule_Number; i++)
+    {
+        Struct_COM_Schedule & item = this->Schedule_List[i];
+        bool on_change = (this->Packet_Table[item.Index].Rate == COM_Rate_On_Change);
+
+        /* 到期（变化检测包为到检测时刻），周期包上次仍未发出时计超时 */
+        if (tick % item.Period == item.Phase)
+        {
+            if (item.Pending != 0U && !on_change)
+            {
+                this->Overrun_Number += 1U;
+            }
+            item.Pending = 1U;
+        }
+        if (blocked || item.Pending == 0U)
+        {
+            continue;
+        }
 
-    /* Tx包数据指针 */
-    this->Data_Tx = &this->Buffer_Tx[5];
+        /* 预算、队列空槽判断 */
+        if (this->Budget < ((uint32_t) item.Wire_Length << 8) ||
+            (uint8_t) (this->Tx_Write_Index - this->Tx_Read_Index) >= this->MAX_Slot_Tx)
+        {
+            blocked = true;
+            continue;
+        }
 
-    /* Tx回调函数调用（根据包类型填充包数据） */
-    this->COM_TxCallback(Pack_Type_Tx, Data_Parameter, this->Data_Tx);
+        bool sent;
 
-    /* CRC校验位填充 */
-    this->Buffer_Tx[this->Packet_Length_Tx - 1] = Calculate_CRC8(this->Buffer_Tx, this->Packet_Length_Tx - 1);
+        if (on_change)
+        {
+            /* 保底刷新：使记录的CRC失效，数据不变时也发送 */
+            if (item.Refresh == 0U)
+            {
+                item.Hash ^= 1U;
+            }
+            sent = this->Tx_Push(this->Packet_Table[item.Index], nullptr, &item.Hash);
+            if (sent)
+            {
+                item.Refresh = COM_SCHEDULE_REFRESH - 1U;
+            }
+            else if (item.Refresh != 0U)
+            {
+                item.Refresh -= 1U;
+            }
+            else
+            {
+                /* 保底刷新未入队（未入队时CRC不更新）：恢复CRC，计数保持为0，下次检测再次刷新 */
+                item.Hash ^= 1U;
+            }
+        }
+        else
+        {
+            sent = this->Tx_Push(this->Packet_Table[item.Index], nullptr, nullptr);
+        }
+        item.Pending = 0U;
+        if (sent)
+        {
+            /* 按实际帧长扣除预算（变长包短于 Wire_Length；COBS模式计入可能的前置结束符） */
+            uint8_t slot = (uint8_t) (this->Tx_Write_Index - 1U) & (this->MAX_Slot_Tx - 1U);
+            uint32_t wire = this->Length_Tx[slot] + ((this->Frame_Mode == Frame_Mode_COBS) ? 1U : 0U);
 
-    /* 数据发送 */
-    UART_Send(this->UART, this->Buffer_Tx, this->Packet_Length_Tx);
+            this->Budget -= wire << 8;
+        }
+    }
+
+    /* 链路占用率统计 */
+    if (this->Window_Tick < COM_SCHEDULE_FREQUENCY - 1U)
+    {
+        this->Window_Tick += 1U;
+    }
+    else
+    {
+        uint32_t byte = this->Tx_Byte_Number;
+
+        this->Window_Tick = 0U;
+        this->Link_Utilization = (float) ((byte - this->Window_Byte_Number) * 10U) / (float) this->Baud_Rate;
+        this->Window_Byte_Number = byte;
+    }
 }
 
 /************************************************************************************************************************
- * @brief   自定义串口数据处理函数
- * 
- * @param   Pack_Size   接收到的包大小
+ * @brief   组帧入队
+ * @note    在队列空闲槽内原地组帧后入队并尝试启动发送；帧时间戳取组帧时刻（队列为空时即为线上起始时刻）
+ *
+ * @param   __Packet            包描述（需为发送包）
+ * @param   __Data_Parameter    发送数据可能需要的参数指针
+ * @param   __Hash              变化检测：上次发送数据的CRC32（nullptr 为不检测）；数据CRC32与之相同时不入队，否则更新
+ * @return  bool                是否入队成功（队列满、数据未变化、变长包放弃本帧时不入队）
+ ***********************************************************************************************************************/
+bool Class_CustomCOM::Tx_Push(const Struct_COM_Packet & __Packet, void * __Data_Parameter, uint32_t * __Hash)
+{
+    uint8_t write = this->Tx_Write_Index;
+
+    /* 队列满判断 */
+    if ((uint8_t) (write - this->Tx_Read_Index) >= this->MAX_Slot_Tx)
+    {
+        this->Tx_Full_Number += 1U;
+        return (false);
+    }
+
+    const Struct_COM_Packet & packet = __Packet;
+    uint8_t slot = write & (this->MAX_Slot_Tx - 1U);
+    uint8_t * buffer = this->Buffer_Tx[slot];
+
+    /* Tx填充函数调用（直接填充至队列槽，返回数据长度；变长包返回0时放弃本帧） */
+    uint8_t data_length = packet.Tx_Handler(&buffer[FRAME_HEADER_LENGTH], __Data_Parameter);
+
+    if (data_length == 0U || data_length > packet.Length)
+    {
+        return (false);
+    }
+
+    /* 包类型、数据长度填充 */
+    uint8_t length = data_length + FRAME_OVERHEAD;
+
+    buffer[4] = packet.Type;
+    buffer[5] = data_length;
+
+    /* 变化检测（槽未入队，未变化时直接放弃） */
+    if (__Hash != nullptr)
+    {
+        uint32_t hash = Class_CRC32::Calculate(&buffer[FRAME_HEADER_LENGTH], data_length);
+
+        if (hash == *__Hash)
+        {
+            return (false);
+        }
+        *__Hash = hash;
+    }
+
+    /* 帧时间戳填充 */
+    uint32_t time = Time_Get_us();
+
+    memcpy(&buffer[FRAME_HEADER_LENGTH + data_length], &time, FRAME_TIME_LENGTH);
+    this->Tx_Time = time;
+
+    if (this->Frame_Mode == Frame_Mode_COBS)
+    {
+        /* CRC覆盖包类型至数据，原地COBS编码至 buffer[3] 起（与包头模式共用槽内布局），末尾补结束符，buffer[2] 为可选的前置结束符 */
+        buffer[length - 1] = Calculate_CRC8(&buffer[4], length - 5);
+        length = COBS_Encode(&buffer[4], length - 4, &buffer[3]);
+        buffer[2] = COBS_DELIMITER;
+        buffer[3 + length] = COBS_DELIMITER;
+        length += 1U;
+    }
+    else
+    {
+        /* CRC校验位填充 */
+        buffer[length - 1] = Calculate_CRC8(buffer, length - 1);
+    }
+    this->Length_Tx[slot] = length;
+
+    /* 入队并发送 */
+    this->Tx_Write_Index = write + 1U;
+    this->Tx_Start(true);
+
+    return (true);
+}
+
+/************************************************************************************************************************
+ * @brief   链路检测函数
+ * @note    每个系统心跳（COM_SCHEDULE_FREQUENCY）调用一次，需与 DataSend、Schedule 位于同一中断：
+ *          处理接收到的链路协商包与时钟同步请求（发送队列清空后应答）；切换中等待发送队列清空后切换波特率；试用超时回退至原波特率；
+ *          错误突发（每 COM_LINK_ERROR_WINDOW 内串口错误 + 校验错误达到 COM_LINK_ERROR_THRESHOLD）时，
+ *          试用中回退至原波特率，其余回退至基础波特率；高于基础波特率时超过 COM_LINK_SILENCE_TIMEOUT 无有效帧也回退至基础波特率
  ***********************************************************************************************************************/
-void Class_CustomCOM::DataProcess(uint8_t Pack_Size)
+void Class_CustomCOM::LinkCheck()
 {
-    /* 存活检测标志置位 */
-    this->Flag = 1U;
+    /* 链路协商包处理 */
+    if (this->Link_Rx_Flag != 0U)
+    {
+        Struct_COM_Link link = this->Link_Rx;
+
+        this->Link_Rx_Flag = 0U;
+        this->Link_Process(link);
+    }
+
+    /* 时钟同步请求处理：应答推迟至发送队列清空（帧时间戳即开始发送时刻，不含排队时延）；切换中不应答，上位机按丢失处理 */
+    if (this->Sync_Rx_Flag != 0U)
+    {
+        if (this->Link_State == COM_Link_Switching)
+        {
+            this->Sync_Rx_Flag = 0U;
+        }
+        else if (this->Tx_Busy == 0U && this->Tx_Write_Index == this->Tx_Read_Index)
+        {
+            Struct_COM_Sync sync = this->Sync_Rx;
 
-    /* 长度校验 */
-    if (Pack_Size != this->Packet_Length_Rx)
+            this->Sync_Rx_Flag = 0U;
+            this->Sync_Process(sync, this->Sync_Rx_Origin, this->Sync_Rx_Receive);
+        }
+    }
+
+    if (this->Link_Silence < 0xFFFFU)
+    {
+        this->Link_Silence += 1U;
+    }
+
+    /* 切换中：应答发送完成后切换 */
+    if (this->Link_State == COM_Link_Switching)
     {
-        this->Error_Number += 1U;
+        if (this->Tx_Busy == 0U && this->Tx_Write_Index == this->Tx_Read_Index)
+        {
+            this->Link_Switch(this->Link_Baud_Rate_Target);
+            this->Link_State = COM_Link_Trial;
+            this->Link_Timer = 0U;
+            this->Link_Probe_Number = 0U;
+        }
         return;
     }
 
-    /* 数据拷贝 */
-    memcpy(this->Buffer_Rx, this->UART->Rx_Buffer, this->Packet_Length_Rx);
+    /* 错误突发统计 */
+    bool burst = false;
 
-    /* 包头校验 */
-    for (uint8_t i = 0; i < 4; i++)
+    if (this->Link_Error_Tick < COM_LINK_ERROR_WINDOW - 1U)
+    {
+        this->Link_Error_Tick += 1U;
+    }
+    else
+    {
+        uint32_t error = this->UART_Error_Number + this->Parser.Get_Error_Number();
+
+        this->Link_Error_Tick = 0U;
+        burst = (error - this->Link_Error_Last >= COM_LINK_ERROR_THRESHOLD);
+        this->Link_Error_Last = error;
+    }
+
+    /* 回退 */
+    if (this->Link_State == COM_Link_Trial)
+    {
+        this->Link_Timer += 1U;
+        if (burst || this->Link_Timer >= COM_LINK_TRIAL_TIMEOUT * COM_SCHEDULE_FREQUENCY / 1000U)
+        {
+            this->Link_Switch(this->Link_Baud_Rate_Stable);
+            this->Link_State = COM_Link_Stable;
+            this->Fallback_Number += 1U;
+        }
+    }
+    else if (this->Baud_Rate != this->Baud_Rate_Base &&
+             (burst || this->Link_Silence >= COM_LINK_SILENCE_TIMEOUT * COM_SCHEDULE_FREQUENCY / 1000U))
     {
-        if (this->Buffer_Rx[i] != ((uint8_t *)&this->Pack_Head)[i])
+        this->Link_Switch(this->Baud_Rate_Base);
+        this->Fallback_Number += 1U;
+    }
+}
+
+/************************************************************************************************************************
+ * @brief   链路协商包处理
+ * @note    Propose：稳定状态下波特率可达（实际误差不超过 COM_LINK_BAUD_TOLERANCE）时应答 Accept 并进入切换，否则应答 Reject；
+ *          Probe：探测数据正确时回显，试用中计数；
+ *          Commit：试用中回显探测帧数足够时确认新波特率并回显，已为该波特率时重复回显（上位机未收到确认时重发）
+ *
+ * @param   __Link  链路协商包
+ ***********************************************************************************************************************/
+void Class_CustomCOM::Link_Process(const Struct_COM_Link & __Link)
+{
+    switch (__Link.Command)
+    {
+        case (COM_Link_Propose):
+        {
+            uint32_t actual = UART_Get_Baud_Rate_Actual(this->UART, __Link.Baud_Rate);
+            uint32_t error = (actual > __Link.Baud_Rate) ? (actual - __Link.Baud_Rate) : (__Link.Baud_Rate - actual);
+
+            if (this->Link_State == COM_Link_Stable && actual != 0U &&
+                (uint64_t) error * 1000U <= (uint64_t) __Link.Baud_Rate * COM_LINK_BAUD_TOLERANCE &&
+                this->Link_Send(COM_Link_Accept, __Link.Sequence, __Link.Baud_Rate, false))
+            {
+                this->Link_Baud_Rate_Target = __Link.Baud_Rate;
+                this->Link_Baud_Rate_Stable = this->Baud_Rate;
+                this->Link_State = COM_Link_Switching;
+            }
+            else
+            {
+                this->Link_Send(COM_Link_Reject, __Link.Sequence, this->Baud_Rate, false);
+            }
+            break;
+        }
+        case (COM_Link_Probe):
+        {
+            if (memcmp(__Link.Pattern, COM_Link_Pattern, sizeof(COM_Link_Pattern)) == 0 &&
+                this->Link_Send(COM_Link_Probe, __Link.Sequence, this->Baud_Rate, true) &&
+                this->Link_State == COM_Link_Trial && this->Link_Probe_Number < 0xFFU)
+            {
+                this->Link_Probe_Number += 1U;
+            }
+            break;
+        }
+        case (COM_Link_Commit):
+        {
+            if (this->Link_State == COM_Link_Trial && this->Link_Probe_Number >= COM_LINK_PROBE_NUMBER &&
+                __Link.Baud_Rate == this->Baud_Rate)
+            {
+                this->Link_State = COM_Link_Stable;
+            }
+            if (this->Link_State == COM_Link_Stable && __Link.Baud_Rate == this->Baud_Rate)
+            {
+                this->Link_Send(COM_Link_Commit, __Link.Sequence, this->Baud_Rate, false);
+            }
+            break;
+        }
+        default:
         {
-            this->Error_Number += 1U;
-            return;
+            break;
         }
     }
+}
+
+/************************************************************************************************************************
+ * @brief   发送链路协商包
+ *
+ * @param   __Command       命令 (Enum_COM_Link_Command)
+ * @param   __Sequence      序号
+ * @param   __Baud_Rate     波特率 (bit/s)
+ * @param   __Pattern       是否填充探测数据
+ * @return  bool            是否入队成功
+ ***********************************************************************************************************************/
+bool Class_CustomCOM::Link_Send(uint8_t __Command, uint8_t __Sequence, uint32_t __Baud_Rate, bool __Pattern)
+{
+    Struct_COM_Link link;
+
+    link.Command = __Command;
+    link.Sequence = __Sequence;
+    link.Baud_Rate = __Baud_Rate;
+    if (__Pattern)
+    {
+        memcpy(link.Pattern, COM_Link_Pattern, sizeof(COM_Link_Pattern));
+    }
+    else
+    {
+        memset(link.Pattern, 0, sizeof(link.Pattern));
+    }
 
-    /* CRC校验 */
-    if (this->Buffer_Rx[this->Packet_Length_Rx - 1] != Calculate_CRC8(this->Buffer_Rx, this->Packet_Length_Rx - 1))
+    return (this->Tx_Push(COM_Packet_Link, &link, nullptr));
+}
+
+/************************************************************************************************************************
+ * @brief   切换波特率
+ * @note    切换会中止发送中的帧，切换后以新波特率重发队首帧；解析器读指针、字节预算、错误统计起点随之复位
+ *
+ * @param   __Baud_Rate     波特率 (bit/s)
+ ***********************************************************************************************************************/
+void Class_CustomCOM::Link_Switch(uint32_t __Baud_Rate)
+{
+    if (UART_Set_Baud_Rate(this->UART, __Baud_Rate) != HAL_OK)
     {
-        this->Error_Number += 1U;
         return;
     }
 
-    /* 数据解析 */
-    this->Data_Rx = (void *)&this->Buffer_Rx[5];
+    this->Parser.Reset();
+    this->Set_Budget(__Baud_Rate);
+    this->Link_Silence = 0U;
+    this->Link_Error_Tick = 0U;
+    this->Link_Error_Last = this->UART_Error_Number + this->Parser.Get_Error_Number();
+
+    this->Tx_Busy = 0U;
+    this->Tx_Start(true);
+}
+
+/************************************************************************************************************************
+ * @brief   时钟同步请求处理
+ * @note    请求中带有上一次交换的 T1、T4 且与本端记录的上一次应答一致时，以该次交换更新上位机时钟同步；
+ *          随后应答本次请求（应答帧的帧时间戳即 T3），入队成功时记录本次交换，供下一次请求补全
+ *
+ * @param   __Sync      时钟同步请求
+ * @param   __Origin    本次交换的 T1（请求帧的帧时间戳, us, 上位机时钟）
+ * @param   __Receive   本次交换的 T2（按帧长折算的接收时刻, us）
+ ***********************************************************************************************************************/
+void Class_CustomCOM::Sync_Process(const Struct_COM_Sync & __Sync, uint32_t __Origin, uint32_t __Receive)
+{
+    if (__Sync.Previous != COM_SYNC_NONE && __Sync.Previous == this->Sync_Sequence &&
+        __Sync.Origin == this->Sync_Origin)
+    {
+        this->Clock.Update(__Sync.Origin, this->Sync_Receive, this->Sync_Transmit, __Sync.Receive, false);
+    }
+
+    Struct_COM_Sync reply;
+
+    reply.Sequence = __Sync.Sequence;
+    reply.Previous = COM_SYNC_NONE;
+    reply.Origin = __Origin;
+    reply.Receive = __Receive;
+    if (this->Tx_Push(COM_Packet_Sync, &reply, nullptr))
+    {
+        this->Sync_Sequence = __Sync.Sequence;
+        this->Sync_Origin = __Origin;
+        this->Sync_Receive = __Receive;
+        this->Sync_Transmit = this->Tx_Time;
+    }
+}
+
+/************************************************************************************************************************
+ * @brief   自定义串口数据处理函数
+ * @note    在 HAL_UARTEx_RxEventCallback（半满、全满、IDLE）中调用，取出环形缓冲区中已到达的全部完整帧；
+ *          接收时刻取回调时刻减去一个字节时间（IDLE 在线路空闲一个字节后触发），分发前更新当前帧的帧时间戳
+ ***********************************************************************************************************************/
+void Class_CustomCOM::DataProcess()
+{
+    const uint8_t * packet;
+    uint16_t write = UART_Get_Rx_Write_Index(this->UART);
+
+    this->Rx_Time = Time_Get_us() - (this->Byte_Time >> 8);
+    while ((packet = this->Parser.Next(write)) != nullptr)
+    {
+        /* 存活检测标志置位 */
+        this->Flag = 1U;
+        this->Link_Silence = 0U;
+
+        /* 链路协商包暂存，由 LinkCheck 处理（应答与发送队列的其余写入方位于同一中断） */
+        if (packet[0] == COM_PACKET_LINK)
+        {
+            memcpy(&this->Link_Rx, &packet[2], sizeof(Struct_COM_Link));
+            this->Link_Rx_Flag = 1U;
+            continue;
+        }
+
+        /* 时钟同步请求暂存，由 LinkCheck 应答（接收时刻减去本帧及同批其后字节的线上时间，折算回帧起始时刻，
+           与上位机的帧时间戳对应同一位置） */
+        if (packet[0] == COM_PACKET_SYNC)
+        {
+            memcpy(&this->Sync_Rx, &packet[2], sizeof(Struct_COM_Sync));
+            this->Sync_Rx_Origin = Frame_Get_Time(packet);
+            this->Sync_Rx_Receive = this->Rx_Time -
+                                    this->Wire_Time(COM_SYNC_LENGTH, this->Parser.Get_Pending_Length(write));
+            this->Sync_Rx_Flag = 1U;
+            continue;
+        }
+
+        /* 按包类型查表分发（解析器仅接受已注册的包类型） */
+        this->Rx_Timestamp = Frame_Get_Time(packet);
+        this->Packet_Table[this->Packet_Index[packet[0]]].Rx_Handler(&packet[2]);
+    }
+}
+
+/************************************************************************************************************************
+ * @brief   自定义串口发送完成处理函数
+ * @note    在 HAL_UART_TxCpltCallback 中调用，统计已发送字节数，释放已发送的槽并接续发送队列中的下一帧
+ ***********************************************************************************************************************/
+void Class_CustomCOM::TxProcess()
+{
+    this->Tx_Byte_Number += this->Tx_Sending_Length;
+    this->Tx_Read_Index += 1U;
+    this->Tx_Busy = 0U;
+
+    this->Tx_Start(false);
+}
+
+/************************************************************************************************************************
+ * @brief   自定义串口错误处理函数
+ * @note    在 HAL_UART_ErrorCallback 中调用，计入链路错误；HAL出错时会中止接收DMA，需重新开启并复位解析器读指针；
+ *          发送DMA出错被中止时不会产生发送完成回调，此时重发当前帧
+ ***********************************************************************************************************************/
+void Class_CustomCOM::ErrorProcess()
+{
+    this->UART_Error_Number += 1U;
+    this->Parser.Reset();
+    UART_ReceiveToRing_DMA(this->UART);
+
+    if (this->Tx_Busy != 0U && this->UART->huart->gState == HAL_UART_STATE_READY)
+    {
+        this->Tx_Busy = 0U;
+        this->Tx_Start(true);
+    }
+}
+
+/************************************************************************************************************************
+ * @brief   启动队首帧的DMA发送（DMA空闲且队列非空时）
+ * @note    DataSend 与 TxProcess 可能位于不同优先级的中断，判断与启动需在临界区内完成；
+ *          DMA启动失败时帧保留在队首，下次调用时重试
+ *
+ * @param   __Burst     是否为连续发送的首帧（此前线路空闲）；COBS模式下首帧额外前置一个结束符，
+ *                      使接收端丢弃空闲期间的噪声后从本帧开始同步，连续发送的后续帧共用前一帧的结束符
+ ***********************************************************************************************************************/
+void Class_CustomCOM::Tx_Start(bool __Burst)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    if (this->Tx_Busy == 0U && this->Tx_Write_Index != this->Tx_Read_Index)
+    {
+        uint8_t slot = this->Tx_Read_Index & (this->MAX_Slot_Tx - 1U);
+        uint8_t offset = 0U;
+        uint8_t length = this->Length_Tx[slot];
+
+        if (this->Frame_Mode == Frame_Mode_COBS)
+        {
+            offset = __Burst ? 2U : 3U;
+            length += __Burst ? 1U : 0U;
+        }
 
-    /* Rx回调函数调用 */
-    this->COM_RxCallback(this->Data_Rx, this->Buffer_Rx[4]);
+        if (UART_Send(this->UART, &this->Buffer_Tx[slot][offset], length) == HAL_OK)
+        {
+            this->Tx_Busy = 1U;
+            this->Tx_Sending_Length = length;
+        }
+    }
+    __set_PRIMASK(primask);
 }
@@ -15,8 +15,14 @@
 #include "gpio.h"
 #include "tim.h"
 
+#include "Cascade.h"
+#include "Gain_Schedule.h"
 #include "Gear.h"
+#include "Math_Fast.h"
 #include "Pid.h"
+#include "Pid_Q31.h"
+#include "Relay_Tune.h"
+#include "Unit.h"
 #include "User_Delay.h"
 
 /* 枚举类型定义 --------------------------------------------------------------------------------------------------------*/
@@ -30,6 +36,16 @@ enum Enum_MotorState_BDC
     Motor_Run       = 2U,   /*!< 运行 */
 };
 
+/**
+ * @brief   BDC电机控制模式枚举类型
+ */
+enum Enum_MotorMode_BDC
+{
+    Motor_Mode_Omega    = 0U,   /*!< 速度模式 */
+    Motor_Mode_Angle    = 1U,   /*!< 位置模式（角度-速度串级） */
+    Motor_Mode_Autotune = 2U,   /*!< 角速度环继电自整定模式 */
+};
+
 /**
  * @brief   步进电机控制模式枚举类型
  */
@@ -48,8 +64,15 @@ class Class_Motor_BDC
 {
 public:
     /* 变量 */
-    Class_PID PID_Omega;                    /*!< 角速度 PID 控制器 */
+    Class_PID_2DOF PID_Omega;               /*!< 角速度 PID 控制器（二自由度，编码器分辨率低时配合微分滤波使用微分） */
+    Class_PID_Q31 PID_Omega_Q31;            /*!< 角速度 Q31定点PID 控制器（编码器计数 -> PWM比较值） */
+    Class_PID PID_Angle;                    /*!< 角度 PID 控制器（位置模式外环） */
+    Class_Cascade<Class_PID, Class_PID_2DOF>    /*!< 角度-角速度串级控制器（绑定 PID_Angle、PID_Omega） */
+                Cascade_Angle;
+    Class_Relay_Tune Relay_Tune;            /*!< 角速度环继电自整定 */
+    Class_Gain_Schedule<5U> Gain_Schedule;  /*!< 角速度环增益调度（按 |目标角速度|，Init 后由 Control() 覆盖 PID_Omega 参数） */
     Class_Gear_Slope Gear_Slope;            /*!< 斜坡变速控制器 */
+    Class_Gear_SCurve Gear_SCurve;          /*!< S曲线变速控制器（Init 后替代 Gear_Slope，规划加速度经 K_F 前馈至 PID_Omega） */
 
     TIM_HandleTypeDef * TIM_Encoder;        /*!< TIM-编码器句柄 */
     TIM_HandleTypeDef * TIM_PWM;            /*!< TIM-PWM 句柄 */
@@ -60,16 +83,30 @@ public:
     /* 函数 */
     void Init(TIM_HandleTypeDef * __TIM_Encoder, TIM_HandleTypeDef * __TIM_PWM, uint32_t __PWM_Channel,
               GPIO_TypeDef * __GPIOx_Dir_A, GPIO_TypeDef * __GPIOx_Dir_B, uint32_t __GPIO_Pin_Dir_A, uint32_t __GPIO_Pin_Dir_B,
-              float __Omega_MAX = 26.0f, float __Reduction_Ratio = 27.0f, uint16_t __Encoder_Lines = 13U, uint16_t __Control_Cycle = 50U);
+              float __Omega_MAX = 26.0f, float __Reduction_Ratio = 27.0f, uint16_t __Encoder_Lines = 13U, uint16_t __Control_Cycle = 50U,
+              uint16_t __Angle_Divider = 1U);
+    void Init_Q31(float __K_P, float __K_I, float __K_D, float __I_Out_Max = 0.0f);
     void Control();
+    void Control_Loop();
+    void Control_Q31();
+    bool Control_Prepare();
+    void Control_Output(float __Out_Omega);
+    void Control_Output_Compare(int32_t __Compare);
+    void AutotuneStart(float __Set_Omega, float __Relay_Amplitude, float __Hysteresis,
+                       Enum_Relay_Tune_Rule __Rule = Relay_Tune_Rule_TL_PI, uint8_t __Cycles = 4U);
 
 
     void Control_test();
     
     inline float MotionSet(float __Set_Omega);
+    inline float AngleSet(float __Set_Angle);
     inline void StopSet(Enum_MotorState_BDC __Stop_State);
     inline float Get_ActualOmega();
     inline float Get_TargetOmega();
+    inline float Get_ActualAngle();
+    inline float Get_Duty();
+    inline Enum_MotorMode_BDC Get_Mode();
+    inline Enum_Relay_Tune_State Get_AutotuneState();
 private:
     /* 函数 */
     inline void Msp_Init();
@@ -80,17 +117,32 @@ private:
     uint16_t Encoder_Lines;                 /*!< 电机编码器线数 */
     uint16_t Control_Cycle;                 /*!< 电机控制周期 (控制周期 = Control_Cycle * 系统心跳周期) */
     const float Heartbeat_Period = 1.0f;    /*!< 系统心跳定时器周期 (ms) */
+    Class_Unit_Scale<Struct_Unit_Tick, Struct_Unit_Rad>     /*!< 编码器计数 -> 输出轴角度增量（Init 中计算） */
+                     Tick_To_Angle;
+    Class_Unit_Scale<Struct_Unit_Tick, Struct_Unit_Radps>   /*!< 控制周期内编码器计数 -> 输出轴角速度（Init 中计算） */
+                     Tick_To_Omega;
+    float Omega_To_Encoder = 0.0f;          /*!< 角速度 (rad/s) -> 控制周期内编码器计数（Init_Q31 中计算） */
+    float Compare_To_Omega = 0.0f;          /*!< PWM比较值 -> 输出角速度 (rad/s)（Init_Q31 中计算） */
 
     /* 读写变量 */
     float Set_Omega = 0.0f;                 /*!< 电机输出轴设定角速度 (rad/s) */
     float Target_Omega = 0.0f;              /*!< 电机输出轴目标角速度 (rad/s) */
+    float Target_Alpha = 0.0f;              /*!< 电机输出轴目标角加速度 (rad/s^2)（S曲线规划） */
     float Actual_Omega = 0.0f;              /*!< 电机输出轴实际角速度 (rad/s) */
     float Out_Omega = 0.0f;                 /*!< 电机输出轴输出角速度 (rad/s) */
+    int32_t Out_Compare = 0;                /*!< 电机PWM输出比较值（带符号，正值为正转） */
+    float Target_Angle = 0.0f;              /*!< 电机输出轴目标角度 (rad)（位置模式） */
+    float Actual_Angle = 0.0f;              /*!< 电机输出轴累计角度 (rad) */
 
     /* 内部变量 */
     Enum_MotorState_BDC Motor_State =       /*!< 电机当前状态 状态机 */
                         Motor_Suspend;
+    Enum_MotorMode_BDC Motor_Mode =         /*!< 电机控制模式 */
+                       Motor_Mode_Omega;
+    Enum_Relay_Tune_Rule Autotune_Rule =    /*!< 自整定规则 */
+                         Relay_Tune_Rule_TL_PI;
     uint16_t Cycle_Counter = 0U;            /*!< 电机控制周期计数器 */
+    int16_t Encoder_Count = 0;              /*!< 控制周期内编码器计数 */
 };
 
 /**
@@ -101,6 +153,7 @@ class Class_Motor_Step
 public:
 	/* 变量 */
     Class_Gear_Slope Gear_Slope;            /*!< 斜坡变速控制器 */
+    Class_Gear_SCurve Gear_SCurve;          /*!< S曲线变速控制器（Init 后替代 Gear_Slope） */
 
 	TIM_HandleTypeDef * TIM_Slave;		    /*!< TIM-Slave 句柄（用于脉冲计数进行角度控制） */
     TIM_HandleTypeDef * TIM_PWM;            /*!< TIM-PWM 句柄 */
@@ -193,9 +246,26 @@ float Class_Motor_BDC::MotionSet(float __Set_Omega)
 
     /* 状态设置 */
     this->Motor_State = Motor_Run;
+    this->Motor_Mode = Motor_Mode_Omega;
     return this->Set_Omega;
 }
 
+/**
+ * @brief   BDC电机位置设置函数（角度-角速度串级控制，仅 Control() 中生效）
+ *
+ * @param   __Set_Angle     设定的输出轴角度 (rad)（相对上电位置的累计角度）
+ * @return  float           返回设定的角度 (rad)
+ */
+float Class_Motor_BDC::AngleSet(float __Set_Angle)
+{
+    this->Target_Angle = __Set_Angle;
+
+    /* 状态设置 */
+    this->Motor_State = Motor_Run;
+    this->Motor_Mode = Motor_Mode_Angle;
+    return this->Target_Angle;
+}
+
 /**
  * @brief   BDC电机停止设置函数
  *
@@ -227,6 +297,38 @@ float Class_Motor_BDC::Get_ActualOmega()
     return this->Actual_Omega;
 }
 
+/**
+ * @brief   BDC电机获取输出轴累计角度
+ */
+float Class_Motor_BDC::Get_ActualAngle()
+{
+    return this->Actual_Angle;
+}
+
+/**
+ * @brief   BDC电机获取PWM占空比（带符号，正值为正转；悬空、刹车时为0）
+ */
+float Class_Motor_BDC::Get_Duty()
+{
+    return ((float) this->Out_Compare / (float) this->TIM_PWM->Init.Period);
+}
+
+/**
+ * @brief   BDC电机获取控制模式
+ */
+Enum_MotorMode_BDC Class_Motor_BDC::Get_Mode()
+{
+    return this->Motor_Mode;
+}
+
+/**
+ * @brief   BDC电机获取自整定状态
+ */
+Enum_Relay_Tune_State Class_Motor_BDC::Get_AutotuneState()
+{
+    return this->Relay_Tune.Get_State();
+}
+
 /**
  * @brief   步进电机角速度设定函数
  * 
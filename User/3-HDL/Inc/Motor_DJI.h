@@ -4,14 +4,18 @@
  *
  * @author  Tang-yucheng (QQ: 3143961287)
  * @date    2024-3-16
- * @version v1.0
+ * @version v1.1
  */
 
 #ifndef __HDL_MOTOR_DJI_H
 #define __HDL_MOTOR_DJI_H
 
 /* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "Cascade.h"
+#include "Frame.h"
 #include "Pid.h"
+#include "Pid_Q31.h"
+#include "Unit.h"
 #include "User_Can.h"
 
 /* 枚举类型定义 --------------------------------------------------------------------------------------------------------*/
@@ -52,20 +56,20 @@ enum Enum_DJI_Motor_Control_Method
     DJI_Motor_Control_Method_TORQUE,
     DJI_Motor_Control_Method_OMEGA,
     DJI_Motor_Control_Method_ANGLE,
+    DJI_Motor_Control_Method_OMEGA_Q31,
 };
 
 /* 结构体定义 ----------------------------------------------------------------------------------------------------------*/
 /**
- * @brief 大疆电机源数据
+ * @brief 大疆电机源数据（CAN帧解包后）
  */
 struct Struct_DJI_Motor_CAN_Data
 {
-    uint16_t Encoder_Reverse;
-    int16_t Omega_Reverse;
-    int16_t Torque_Reverse;
+    uint16_t Encoder;
+    int16_t Omega;
+    int16_t Torque;
     int8_t Temperature;
-    uint8_t Reserved;
-} __attribute__((packed));
+};
 
 /**
  * @brief 大疆电机经过处理数据，均为标准单位
@@ -82,6 +86,17 @@ struct Struct_DJI_Motor_Data
     int32_t Total_Round;
 };
 
+/* 类型定义 ------------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief 大疆电机反馈帧布局（大端：编码器、转速、转矩电流各2字节，温度1字节）
+ */
+typedef Class_Frame_Layout<Struct_DJI_Motor_CAN_Data, 8U,
+        Struct_Frame_Field_BE<Struct_DJI_Motor_CAN_Data, uint16_t, &Struct_DJI_Motor_CAN_Data::Encoder, 0U>,
+        Struct_Frame_Field_BE<Struct_DJI_Motor_CAN_Data, int16_t, &Struct_DJI_Motor_CAN_Data::Omega, 2U>,
+        Struct_Frame_Field_BE<Struct_DJI_Motor_CAN_Data, int16_t, &Struct_DJI_Motor_CAN_Data::Torque, 4U>,
+        Struct_Frame_Field_BE<Struct_DJI_Motor_CAN_Data, int8_t, &Struct_DJI_Motor_CAN_Data::Temperature, 6U>>
+        Class_DJI_Motor_CAN_Layout;
+
 /* 类定义 -------------------------------------------------------------------------------------------------------------*/
 /**
  * @brief DJI-C620无刷电调, 电流控制（力矩）
@@ -92,11 +107,14 @@ public:
     /* 变量 */
     Class_PID PID_Angle;            /*!< PID位置环控制 */
     Class_PID PID_Omega;            /*!< PID速度环控制 */
+    Class_PID_Q31 PID_Omega_Q31;    /*!< Q31定点PID速度环控制（转子转速 rpm -> 电流指令） */
+    Class_Cascade<Class_PID, Class_PID> Cascade_Angle;  /*!< 角度-速度串级控制（绑定 PID_Angle、PID_Omega） */
 
     /* 函数 */
     void Init(Struct_CAN_Manage_Object * CAN_Manage_Obj, Enum_DJI_Motor_ID __CAN_ID,
               Enum_DJI_Motor_Control_Method __Control_Method = DJI_Motor_Control_Method_OMEGA,
-              float __Gearbox_Rate = 3591.0f / 187.0f, float __Torque_Max = 20.0f);
+              float __Gearbox_Rate = 3591.0f / 187.0f, float __Torque_Max = 20.0f, uint16_t __Angle_Divider = 1U);
+    void Init_Omega_Q31(float __K_P, float __K_I, float __K_D, float __I_Out_Max, float __Out_Max, float __D_T = 0.001f);
     void DataGet();
     void AliveCheck(uint16_t Period);
     void Control();
@@ -127,6 +145,13 @@ protected:
     float Gearbox_Rate;                             /*!< 减速比, 默认带减速箱 */
     uint16_t Encoder_Num_Per_Round = 8192;          /*!< 一圈编码器刻度 */
     uint16_t Output_Max = 16384;                    /*!< 最大输出扭矩 */
+    float Omega_To_RPM = 0.0f;                      /*!< 输出轴角速度 (rad/s) -> 转子转速 (rpm)（Init_Omega_Q31 中计算） */
+    Class_Unit_Scale<Struct_Unit_Tick, Struct_Unit_Rad>     /*!< 累计编码器值 -> 输出轴角度（Init 中计算） */
+                     Tick_To_Angle;
+    Class_Unit_Scale<Struct_Unit_RPM, Struct_Unit_Radps>    /*!< 转子转速 -> 输出轴角速度（Init 中计算） */
+                     RPM_To_Omega;
+    Class_Unit_Scale<Struct_Unit_Raw, Struct_Unit_Ampere>   /*!< 转矩电流反馈原始值 -> 电流（Init 中计算） */
+                     Raw_To_Current;
 
     /* 读变量 */
     Struct_DJI_Motor_Data Data;                     /*!< 电机对外接口信息 */
@@ -143,6 +168,8 @@ protected:
     /* 内部变量 */
     uint32_t Flag = 0;                              /*!< 当前时刻的电机接收flag */
     uint32_t Pre_Flag = 0;                          /*!< 前一时刻的电机接收flag */
+    int16_t Omega_Raw = 0;                          /*!< 转子转速反馈原始值 (rpm) */
+    int8_t Temperature_Raw = 0;                     /*!< 温度反馈原始值 (摄氏度) */
     Enum_DJI_Motor_Status DJI_Motor_Status =        /*!< 电机状态 */
                           DJI_Motor_Status_DISABLE;
 };
@@ -210,13 +237,13 @@ float Class_DJI_Motor_C620::Get_Now_Torque()
 }
 
 /**
- * @brief 获取当前的温度, 摄氏度
+ * @brief 获取当前的温度, 摄氏度（低于0摄氏度时为0；开氏度见 Data.Now_Temperature）
  *
  * @return uint8_t 当前的温度, 摄氏度
  */
 uint8_t Class_DJI_Motor_C620::Get_Now_Temperature()
 {
-    return (Data.Now_Temperature);
+    return ((Temperature_Raw < 0) ? 0U : (uint8_t) Temperature_Raw);
 }
 
 /**
@@ -26,11 +26,13 @@ Class_Motor_Servo Motor_Test_Servo;
  * @param   __Reduction_Ratio   电机减速比
  * @param   __Encoder_Lines     电机编码器线数
  * @param   __Control_Cycle     电机控制周期 (控制周期 = __Control_Cycle * 系统心跳周期)
+ * @param   __Angle_Divider     位置模式角度环分频系数（角度环每 __Angle_Divider 个控制周期执行一次, PID_Angle 的 D_T 需相应放大）
  ***********************************************************************************************************************/
 void Class_Motor_BDC::Init(TIM_HandleTypeDef * __TIM_Encoder, TIM_HandleTypeDef * __TIM_PWM, uint32_t __PWM_Channel,
                            GPIO_TypeDef * __GPIOx_Dir_A, GPIO_TypeDef * __GPIOx_Dir_B,
                            uint32_t __GPIO_Pin_Dir_A, uint32_t __GPIO_Pin_Dir_B,
-                           float __Omega_MAX, float __Reduction_Ratio, uint16_t __Encoder_Lines, uint16_t __Control_Cycle)
+                           float __Omega_MAX, float __Reduction_Ratio, uint16_t __Encoder_Lines, uint16_t __Control_Cycle,
+                           uint16_t __Angle_Divider)
 {
     /* 参数赋值 */
     this->TIM_Encoder = __TIM_Encoder;
@@ -45,8 +47,16 @@ void Class_Motor_BDC::Init(TIM_HandleTypeDef * __TIM_Encoder, TIM_HandleTypeDef
     this->Encoder_Lines = __Encoder_Lines;
     this->Control_Cycle = __Control_Cycle;
 
+    /* 测速换算系数（正交编码器四倍频） */
+    this->Tick_To_Angle = Unit_Encoder_Scale(4.0f * this->Encoder_Lines, this->Reduction_Ratio);
+    this->Tick_To_Omega = Unit_Increment_Rate(this->Control_Cycle * this->Heartbeat_Period / 1000.0f) * this->Tick_To_Angle;
+
     /* PID 输出限幅 */
     this->PID_Omega.Set_Out_Max(this->Omega_MAX);
+    this->PID_Angle.Set_Out_Max(this->Omega_MAX);
+
+    /* 位置模式串级控制器绑定 */
+    this->Cascade_Angle.Init(&this->PID_Angle, &this->PID_Omega, __Angle_Divider);
 
     /* 底层初始化 */
     this->Msp_Init();
@@ -107,6 +117,34 @@ void Class_Motor_BDC::Msp_Init()
 	}
 }
 
+/************************************************************************************************************************
+ * @brief   BDC电机Q31定点速度环初始化（需在 Init 之后调用，配合 Control_Q31 使用）
+ * @note    参数与 PID_Omega 同单位（输入、输出均为角速度 rad/s），内部换算为 编码器计数 -> PWM比较值 并定标，
+ *          目标值、实际值满量程为 2 * Omega_MAX，输出限幅为PWM周期
+ *
+ * @param   __K_P       P参数
+ * @param   __K_I       I参数
+ * @param   __K_D       D参数
+ * @param   __I_Out_Max 积分输出限幅 (rad/s), 0为限幅至 Omega_MAX
+ ***********************************************************************************************************************/
+void Class_Motor_BDC::Init_Q31(float __K_P, float __K_I, float __K_D, float __I_Out_Max)
+{
+    float d_t = this->Control_Cycle * this->Heartbeat_Period / 1000.0f;
+    float period = (float)this->TIM_PWM->Init.Period;
+    float encoder_to_omega;
+    float gain;
+
+    /* 单位换算系数 */
+    encoder_to_omega = this->Tick_To_Omega.Get_K();
+    this->Omega_To_Encoder = this->Tick_To_Omega.Inverse().Get_K();
+    this->Compare_To_Omega = this->Omega_MAX / period;
+
+    /* 参数换算至 编码器计数 -> PWM比较值 */
+    gain = encoder_to_omega / this->Compare_To_Omega;
+    this->PID_Omega_Q31.Init(__K_P * gain, __K_I * gain, __K_D * gain, __I_Out_Max / this->Compare_To_Omega, period,
+                             2.0f * this->Omega_MAX * this->Omega_To_Encoder, d_t);
+}
+
 /************************************************************************************************************************
  * @brief   BDC电机控制函数（需在系统心跳定时器更新中断中执行）
  ***********************************************************************************************************************/
@@ -122,78 +160,258 @@ void Class_Motor_BDC::Control()
     {
         /* 到达控制周期，进行电机控制 */
         this->Cycle_Counter = 0;
+        this->Control_Loop();
+    }
+}
 
-        /* 获取电机实际速度 */
-        int16_t Actual_Omega_Raw = __HAL_TIM_GetCounter(this->TIM_Encoder);
-        __HAL_TIM_SetCounter(this->TIM_Encoder, 0);
-        this->Actual_Omega = (float)Actual_Omega_Raw / 4.0f / this->Encoder_Lines / this->Reduction_Ratio /
-                             (this->Control_Cycle * this->Heartbeat_Period) * 1000 * 2 * PI;
+/************************************************************************************************************************
+ * @brief   BDC电机闭环控制（测速、变速、增益调度及各控制模式计算，不含控制周期分频）
+ * @note    由 Control() 在每个控制周期调用；底盘统一闭环时，不满足PID控制器组条件的电机由底盘按控制周期直接调用
+ ***********************************************************************************************************************/
+void Class_Motor_BDC::Control_Loop()
+{
+    if (this->Control_Prepare())
+    {
+        /* 增益调度：按 |目标角速度| 插值得到角速度环参数（位置模式下为上一周期角度环输出），结果变化时才写入 */
+        if (this->Gain_Schedule.Get_Enable() && this->Motor_Mode != Motor_Mode_Autotune)
+        {
+            this->Gain_Schedule.Calculate(Math_Abs(this->Target_Omega));
+            if (this->Gain_Schedule.Get_Changed())
+            {
+                this->PID_Omega.Set_K_P(this->Gain_Schedule.Get_K_P());
+                this->PID_Omega.Set_K_I(this->Gain_Schedule.Get_K_I());
+                this->PID_Omega.Set_K_D(this->Gain_Schedule.Get_K_D());
+            }
+        }
 
-        /* 判断电机当前状态 */
-        if (this->Motor_State == Motor_Suspend)
-        {   
-            /* 速度清零 */
-            this->Set_Omega = 0.0f;
-            this->Target_Omega = 0.0f;
-            this->Out_Omega = 0.0f;
+        if (this->Motor_Mode == Motor_Mode_Angle)
+        {
+            /* 串级计算得到输出值（角度环分频执行，角速度环饱和时角度环停止积分） */
+            this->Cascade_Angle.Set_Target(this->Target_Angle);
+            this->Cascade_Angle.Set_Actual_Outer(this->Actual_Angle);
+            this->Cascade_Angle.Set_Actual_Inner(this->Actual_Omega);
+            this->Cascade_Angle.Calculate();
+            this->Target_Omega = this->Cascade_Angle.Get_Inner_Target();
+
+            /* 输出 */
+            this->Control_Output(this->Cascade_Angle.Get_Out());
+        }
+        else if (this->Motor_Mode == Motor_Mode_Autotune)
+        {
+            /* 继电实验（偏置 ± 继电幅值输出） */
+            this->Relay_Tune.Set_Actual(this->Actual_Omega);
+            this->Relay_Tune.Calculate();
+            this->Control_Output(this->Relay_Tune.Get_Out());
 
-            /* PID积分项归零 */
-            this->PID_Omega.Set_Integral_Error(0.0f);
+            /* 实验结束：写入整定参数（失败时保留原参数），回到速度模式 */
+            if (this->Relay_Tune.Get_State() != Relay_Tune_Running)
+            {
+                float k_p, k_i, k_d;
 
-            /* 方向引脚输出悬空信号 */
-            HAL_GPIO_WritePin(this->GPIOx_Dir[0], this->GPIO_Pin_Dir[0], GPIO_PIN_SET);
-            HAL_GPIO_WritePin(this->GPIOx_Dir[1], this->GPIO_Pin_Dir[1], GPIO_PIN_SET);
+                if (this->Relay_Tune.Get_Gains(this->Autotune_Rule, &k_p, &k_i, &k_d))
+                {
+                    this->PID_Omega.Set_K_P(k_p);
+                    this->PID_Omega.Set_K_I(k_i);
+                    this->PID_Omega.Set_K_D(k_d);
+                }
+                this->PID_Omega.Set_Integral_Error(0.0f);
+                this->Motor_Mode = Motor_Mode_Omega;
+            }
         }
-        else if (this->Motor_State == Motor_Brake)
+        else
         {
-            /* 速度清零 */
-            this->Set_Omega = 0.0f;
-            this->Target_Omega = 0.0f;
-            this->Out_Omega = 0.0f;
+            /* PID 计算得到输出值（S曲线变速时以规划加速度前馈） */
+            this->PID_Omega.Set_Target(this->Target_Omega);
+            this->PID_Omega.Set_Actual(this->Actual_Omega);
+            if (this->Gear_SCurve.Get_Enable())
+            {
+                this->PID_Omega.Set_Target_Rate(this->Target_Alpha);
+            }
+            this->PID_Omega.Calculate();
 
-            /* PID积分项归零 */
-            this->PID_Omega.Set_Integral_Error(0.0f);
+            /* 输出 */
+            this->Control_Output(this->PID_Omega.Get_Out());
+        }
+    }
+}
 
-            /* 方向引脚输出刹车信号 */
-            HAL_GPIO_WritePin(this->GPIOx_Dir[0], this->GPIO_Pin_Dir[0], GPIO_PIN_RESET);
-            HAL_GPIO_WritePin(this->GPIOx_Dir[1], this->GPIO_Pin_Dir[1], GPIO_PIN_RESET);
+/************************************************************************************************************************
+ * @brief   BDC电机Q31定点控制函数（需在系统心跳定时器更新中断中执行，与 Control() 二选一，仅速度模式）
+ * @note    编码器计数直接定标为Q31，PID输出直接换算为PWM比较值，闭环计算中无浮点运算
+ ***********************************************************************************************************************/
+void Class_Motor_BDC::Control_Q31()
+{
+    /* 判断是否到达控制周期 */
+    if (this->Cycle_Counter < this->Control_Cycle - 1)
+    {
+        /* 未到达控制周期 */
+        this->Cycle_Counter += 1;
+    }
+    else
+    {
+        /* 到达控制周期，进行电机控制 */
+        this->Cycle_Counter = 0;
+
+        if (this->Control_Prepare())
+        {
+            /* PID 计算得到输出值 */
+            this->PID_Omega_Q31.Set_Target(this->PID_Omega_Q31.Scale_Error.To_Q31(this->Target_Omega * this->Omega_To_Encoder));
+            this->PID_Omega_Q31.Set_Actual(this->PID_Omega_Q31.Scale_Error.Raw_To_Q31(this->Encoder_Count));
+            this->PID_Omega_Q31.Calculate();
+
+            /* 输出 */
+            int32_t compare = this->PID_Omega_Q31.Scale_Out.Q31_To_Raw(this->PID_Omega_Q31.Get_Out());
+            this->Out_Omega = (float)compare * this->Compare_To_Omega;
+            this->Control_Output_Compare(compare);
         }
-        else if (this->Motor_State == Motor_Run)
-        {   
+    }
+}
+
+/************************************************************************************************************************
+ * @brief   BDC电机闭环控制前处理（测速、状态处理、斜坡变速）
+ * @note    由 Control() 在每个控制周期调用；外部统一闭环（如底盘PID控制器组）时按控制周期直接调用，
+ *          此时不要再调用 Control()
+ *
+ * @return  bool    电机是否处于运行状态（true 时需计算闭环输出并调用 Control_Output()）
+ ***********************************************************************************************************************/
+bool Class_Motor_BDC::Control_Prepare()
+{
+    /* 获取电机实际速度 */
+    this->Encoder_Count = __HAL_TIM_GetCounter(this->TIM_Encoder);
+    __HAL_TIM_SetCounter(this->TIM_Encoder, 0);
+    Class_Tick encoder_tick((float)this->Encoder_Count);
+    this->Actual_Omega = this->Tick_To_Omega(encoder_tick).Get();
+    this->Actual_Angle += this->Tick_To_Angle(encoder_tick).Get();
+
+    /* 判断电机当前状态 */
+    if (this->Motor_State == Motor_Suspend)
+    {   
+        /* 速度清零 */
+        this->Set_Omega = 0.0f;
+        this->Target_Omega = 0.0f;
+        this->Target_Alpha = 0.0f;
+        this->Out_Omega = 0.0f;
+        this->Out_Compare = 0;
+        this->Gear_SCurve.Reset();
+
+        /* PID积分项归零 */
+        this->Cascade_Angle.Reset();
+        this->PID_Omega_Q31.Reset();
+
+        /* 方向引脚输出悬空信号 */
+        HAL_GPIO_WritePin(this->GPIOx_Dir[0], this->GPIO_Pin_Dir[0], GPIO_PIN_SET);
+        HAL_GPIO_WritePin(this->GPIOx_Dir[1], this->GPIO_Pin_Dir[1], GPIO_PIN_SET);
+    }
+    else if (this->Motor_State == Motor_Brake)
+    {
+        /* 速度清零 */
+        this->Set_Omega = 0.0f;
+        this->Target_Omega = 0.0f;
+        this->Target_Alpha = 0.0f;
+        this->Out_Omega = 0.0f;
+        this->Out_Compare = 0;
+        this->Gear_SCurve.Reset();
+
+        /* PID积分项归零 */
+        this->Cascade_Angle.Reset();
+        this->PID_Omega_Q31.Reset();
+
+        /* 方向引脚输出刹车信号 */
+        HAL_GPIO_WritePin(this->GPIOx_Dir[0], this->GPIO_Pin_Dir[0], GPIO_PIN_RESET);
+        HAL_GPIO_WritePin(this->GPIOx_Dir[1], this->GPIO_Pin_Dir[1], GPIO_PIN_RESET);
+    }
+    else if (this->Motor_State == Motor_Run)
+    {   
+        if (this->Gear_SCurve.Get_Enable())
+        {
+            /* S曲线变速获得当前目标速度、目标加速度 */
+            this->Gear_SCurve.Set_Value(this->Set_Omega);
+            this->Gear_SCurve.Calculate();
+            this->Target_Omega = this->Gear_SCurve.Get_Out();
+            this->Target_Alpha = this->Gear_SCurve.Get_Acceleration();
+        }
+        else
+        {
             /* 梯形变速获得当前目标速度 */
             this->Gear_Slope.Set_Value(this->Set_Omega);
             this->Gear_Slope.Calculate();
             this->Target_Omega = this->Gear_Slope.Get_Out();
+        }
 
-            /* PID 计算得到输出值 */
-            this->PID_Omega.Set_Target(this->Target_Omega);
-            this->PID_Omega.Set_Actual(this->Actual_Omega);
-            this->PID_Omega.Calculate();
-            this->Out_Omega = this->PID_Omega.Get_Out();
+        return (true);
+    }
 
-            /* 正反转控制，将输出值映射到PWM输出比较寄存器上 */
-            if (this->Out_Omega > 0)
-            {
-                /* 输出比较寄存器赋值 */
-                __HAL_TIM_SET_COMPARE(this->TIM_PWM, this->PWM_Channel,
-                                      (uint32_t)(this->Out_Omega / this->Omega_MAX * this->TIM_PWM->Init.Period));
-                /* 方向引脚输出正转信号 */
-                HAL_GPIO_WritePin(this->GPIOx_Dir[0], this->GPIO_Pin_Dir[0], GPIO_PIN_RESET);
-                HAL_GPIO_WritePin(this->GPIOx_Dir[1], this->GPIO_Pin_Dir[1], GPIO_PIN_SET);
-            }
-            else
-            {
-                /* 输出比较寄存器赋值 */
-                __HAL_TIM_SET_COMPARE(this->TIM_PWM, this->PWM_Channel,
-                                      (uint32_t)(-this->Out_Omega / this->Omega_MAX * this->TIM_PWM->Init.Period));
-                /* 方向引脚输出反转信号 */
-                HAL_GPIO_WritePin(this->GPIOx_Dir[0], this->GPIO_Pin_Dir[0], GPIO_PIN_SET);
-                HAL_GPIO_WritePin(this->GPIOx_Dir[1], this->GPIO_Pin_Dir[1], GPIO_PIN_RESET);
-            }
-        }
+    return (false);
+}
+
+/************************************************************************************************************************
+ * @brief   BDC电机输出（正反转控制，将输出值映射到PWM输出比较寄存器上）
+ *
+ * @param   __Out_Omega     闭环计算得到的输出角速度 (rad/s)
+ ***********************************************************************************************************************/
+void Class_Motor_BDC::Control_Output(float __Out_Omega)
+{
+    this->Out_Omega = __Out_Omega;
+    this->Control_Output_Compare((int32_t)(this->Out_Omega / this->Omega_MAX * this->TIM_PWM->Init.Period));
+}
+
+/************************************************************************************************************************
+ * @brief   BDC电机输出（正反转控制，带符号PWM比较值）
+ *
+ * @param   __Compare   带符号PWM输出比较寄存器值（正值为正转）
+ ***********************************************************************************************************************/
+void Class_Motor_BDC::Control_Output_Compare(int32_t __Compare)
+{
+    this->Out_Compare = __Compare;
+
+    if (__Compare > 0)
+    {
+        /* 输出比较寄存器赋值 */
+        __HAL_TIM_SET_COMPARE(this->TIM_PWM, this->PWM_Channel, (uint32_t)__Compare);
+        /* 方向引脚输出正转信号 */
+        HAL_GPIO_WritePin(this->GPIOx_Dir[0], this->GPIO_Pin_Dir[0], GPIO_PIN_RESET);
+        HAL_GPIO_WritePin(this->GPIOx_Dir[1], this->GPIO_Pin_Dir[1], GPIO_PIN_SET);
+    }
+    else
+    {
+        /* 输出比较寄存器赋值 */
+        __HAL_TIM_SET_COMPARE(this->TIM_PWM, this->PWM_Channel, (uint32_t)(-__Compare));
+        /* 方向引脚输出反转信号 */
+        HAL_GPIO_WritePin(this->GPIOx_Dir[0], this->GPIO_Pin_Dir[0], GPIO_PIN_SET);
+        HAL_GPIO_WritePin(this->GPIOx_Dir[1], this->GPIO_Pin_Dir[1], GPIO_PIN_RESET);
     }
 }
 
+/************************************************************************************************************************
+ * @brief   BDC电机角速度环自整定开始（Astrom-Hagglund继电实验，由 Control() 执行）
+ * @note    输出在 __Set_Omega ± __Relay_Amplitude 间切换，测得临界增益与临界周期后按 __Rule 写入 PID_Omega，
+ *          随后回到速度模式并保持 __Set_Omega 运行；30 s 内未完成则判定失败，保留原参数；
+ *          Control() 位于心跳中断，继电实验初始化与模式切换在临界区内完成，中断中不会看到未初始化的实验
+ *
+ * @param   __Set_Omega         实验设定角速度 (rad/s)
+ * @param   __Relay_Amplitude   继电幅值 (rad/s)
+ * @param   __Hysteresis        滞环宽度 (rad/s)（需大于测速噪声）
+ * @param   __Rule              整定规则
+ * @param   __Cycles            参与平均的振荡周期数
+ ***********************************************************************************************************************/
+void Class_Motor_BDC::AutotuneStart(float __Set_Omega, float __Relay_Amplitude, float __Hysteresis,
+                                    Enum_Relay_Tune_Rule __Rule, uint8_t __Cycles)
+{
+    float d_t = this->Control_Cycle * this->Heartbeat_Period / 1000.0f;
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    this->MotionSet(__Set_Omega);
+    this->Autotune_Rule = __Rule;
+
+    /* 开环输出与角速度成正比，偏置取设定角速度 */
+    this->Relay_Tune.Init(__Relay_Amplitude, __Hysteresis, d_t, __Cycles, (uint32_t)(30.0f / d_t));
+    this->Relay_Tune.Start(this->Set_Omega, this->Set_Omega);
+
+    /* 实验就绪后最后切换模式 */
+    this->Motor_Mode = Motor_Mode_Autotune;
+    __set_PRIMASK(primask);
+}
 
 /************************************************************************************************************************
  * @brief   BDC电机测试控制函数（需在系统心跳定时器更新中断中执行）
@@ -451,10 +669,20 @@ void Class_Motor_Step::Control()
         /* 判断电机当前控制模式 */
         if (this->control_mode == Motor_Speed)
         {
-            /* 梯形变速速度控制 */
-            this->Gear_Slope.Set_Value(this->Set_Omega);
-            this->Gear_Slope.Calculate();
-            this->OmegaControl(this->Gear_Slope.Get_Out());
+            if (this->Gear_SCurve.Get_Enable())
+            {
+                /* S曲线变速速度控制 */
+                this->Gear_SCurve.Set_Value(this->Set_Omega);
+                this->Gear_SCurve.Calculate();
+                this->OmegaControl(this->Gear_SCurve.Get_Out());
+            }
+            else
+            {
+                /* 梯形变速速度控制 */
+                this->Gear_Slope.Set_Value(this->Set_Omega);
+                this->Gear_Slope.Calculate();
+                this->OmegaControl(this->Gear_Slope.Get_Out());
+            }
         }
         else if ((this->control_mode == Motor_RelativeAngle) || (this->control_mode == Motor_AbsoluteAngle))
         {
@@ -717,7 +945,7 @@ float Class_Motor_Servo::AngleSet(float __Set_Angle)
     __Set_Angle = __Set_Angle + this->Zero_Offset;
 
     /* 角度限定 */
-    __Set_Angle = fmodf(__Set_Angle, 360.0f);
+    __Set_Angle = Math_Fast_Fmod(__Set_Angle, 360.0f);
     if (__Set_Angle > this->Angle_MAX)
     {
         __Set_Angle = this->Angle_MAX;
@@ -4,7 +4,7 @@
  *
  * @author  Tang-yucheng (QQ: 3143961287)
  * @date    2024-3-16
- * @version v1.0
+ * @version v1.1
  */
 
 /* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
@@ -126,10 +126,11 @@ uint8_t *allocate_tx_buffer_C6x0(Struct_CAN_Manage_Object * CAN_Manage_Obj, Enum
  * @param __DJI_Motor_Control_Method    电机控制方式, 默认速度
  * @param __Gearbox_Rate                减速箱减速比, 默认为原装减速箱, 如拆去减速箱则该值设为1
  * @param __Torque_Max                  最大扭矩, 需根据不同负载测量后赋值, 也就开环和扭矩环输出用得到, 不过我感觉应该没有奇葩喜欢开环输出这玩意
+ * @param __Angle_Divider               角度环分频系数（角度环每 __Angle_Divider 次控制执行一次, PID_Angle 的 D_T 需相应放大）
  **********************************************************************************************************************/
 void Class_DJI_Motor_C620::Init(Struct_CAN_Manage_Object * CAN_Manage_Obj, Enum_DJI_Motor_ID __CAN_ID,
                                 Enum_DJI_Motor_Control_Method __DJI_Motor_Control_Method,
-                                float __Gearbox_Rate, float __Torque_Max)
+                                float __Gearbox_Rate, float __Torque_Max, uint16_t __Angle_Divider)
 {
     CAN_Manage_Object = CAN_Manage_Obj;
     CAN_ID = __CAN_ID;
@@ -137,6 +138,34 @@ void Class_DJI_Motor_C620::Init(Struct_CAN_Manage_Object * CAN_Manage_Obj, Enum_
     Gearbox_Rate = __Gearbox_Rate;
     Torque_Max = __Torque_Max;
     CAN_Tx_Data = allocate_tx_buffer_C6x0(CAN_Manage_Obj, __CAN_ID);
+    Tick_To_Angle = Unit_Encoder_Scale(Encoder_Num_Per_Round, Gearbox_Rate);
+    RPM_To_Omega = Unit_Gearbox_Scale(Gearbox_Rate);
+    Raw_To_Current = Class_Unit_Scale<Struct_Unit_Raw, Struct_Unit_Ampere>(Current_Conversion);
+    Cascade_Angle.Init(&PID_Angle, &PID_Omega, __Angle_Divider);
+}
+
+/***********************************************************************************************************************
+ * @brief C620 Q31定点速度环初始化（需在 Init 之后调用，控制方式设为 DJI_Motor_Control_Method_OMEGA_Q31 时生效）
+ * @note  参数与 PID_Omega 同单位（输入 rad/s，输出电流 A），内部换算为 转子转速 (rpm) -> 电流指令 并定标，
+ *        目标值、实际值满量程为转子 16384 rpm
+ *
+ * @param __K_P         P参数
+ * @param __K_I         I参数
+ * @param __K_D         D参数
+ * @param __I_Out_Max   积分输出限幅 (A), 0为限幅至 __Out_Max
+ * @param __Out_Max     输出限幅 (A)
+ * @param __D_T         控制周期 (s)
+ **********************************************************************************************************************/
+void Class_DJI_Motor_C620::Init_Omega_Q31(float __K_P, float __K_I, float __K_D, float __I_Out_Max, float __Out_Max,
+                                          float __D_T)
+{
+    /* 单位换算系数 */
+    float gain = RPM_To_Omega.Get_K() / Current_Conversion;
+    Omega_To_RPM = RPM_To_Omega.Inverse().Get_K();
+
+    /* 参数换算至 转子转速 (rpm) -> 电流指令 */
+    PID_Omega_Q31.Init(__K_P * gain, __K_I * gain, __K_D * gain, __I_Out_Max / Current_Conversion,
+                       __Out_Max / Current_Conversion, 16384.0f, __D_T);
 }
 
 /***********************************************************************************************************************
@@ -149,15 +178,14 @@ void Class_DJI_Motor_C620::DataGet()
 
     //数据处理过程
     int16_t delta_encoder;
-    uint16_t tmp_encoder;
-    int16_t tmp_omega, tmp_torque, tmp_temperature;
-    auto tmp_buffer = (Struct_DJI_Motor_CAN_Data *)CAN_Manage_Object->Rx_Buffer.Data;
+    Struct_DJI_Motor_CAN_Data tmp_data;
 
-    //处理大小端
-    Math_Endian_Reverse_16((void *) &tmp_buffer->Encoder_Reverse, (void *) &tmp_encoder);
-    Math_Endian_Reverse_16((void *) &tmp_buffer->Omega_Reverse, (void *) &tmp_omega);
-    Math_Endian_Reverse_16((void *) &tmp_buffer->Torque_Reverse, (void *) &tmp_torque);
-    Math_Endian_Reverse_16((void *) &tmp_buffer->Temperature, (void *) &tmp_temperature);
+    //整帧解包（处理大小端）
+    Class_DJI_Motor_CAN_Layout::Decode(CAN_Manage_Object->Rx_Buffer.Data, &tmp_data);
+    uint16_t tmp_encoder = tmp_data.Encoder;
+    int16_t tmp_omega = tmp_data.Omega;
+    int16_t tmp_torque = tmp_data.Torque;
+    int8_t tmp_temperature = tmp_data.Temperature;
 
     //计算圈数与总编码器值
     delta_encoder = tmp_encoder - Data.Pre_Encoder;
@@ -174,13 +202,15 @@ void Class_DJI_Motor_C620::DataGet()
     Data.Total_Encoder = Data.Total_Round * Encoder_Num_Per_Round + tmp_encoder;
 
     //计算电机本身信息
-    Data.Now_Angle = (float)Data.Total_Encoder / (float)Encoder_Num_Per_Round * 2.0f * PI / Gearbox_Rate;
-    Data.Now_Omega = (float)tmp_omega * RPM_TO_RADPS / Gearbox_Rate;
-    Data.Now_Torque = (float)tmp_torque * Current_Conversion;
+    Data.Now_Angle = Tick_To_Angle(Class_Tick((float)Data.Total_Encoder)).Get();
+    Data.Now_Omega = RPM_To_Omega(Class_RPM((float)tmp_omega)).Get();
+    Data.Now_Torque = Raw_To_Current(Class_Raw((float)tmp_torque)).Get();
     Data.Now_Temperature = (float)tmp_temperature + CELSIUS_TO_KELVIN;
 
     //存储预备信息
     Data.Pre_Encoder = tmp_encoder;
+    Omega_Raw = tmp_omega;
+    Temperature_Raw = tmp_temperature;
 }
 
 /***********************************************************************************************************************
@@ -203,8 +233,8 @@ void Class_DJI_Motor_C620::AliveCheck(uint16_t Period)
         {
             //电机断开连接
             DJI_Motor_Status = DJI_Motor_Status_DISABLE;
-            PID_Angle.Set_Integral_Error(0.0f);
-            PID_Omega.Set_Integral_Error(0.0f);
+            Cascade_Angle.Reset();
+            PID_Omega_Q31.Reset();
         }
         else
         {
@@ -220,6 +250,8 @@ void Class_DJI_Motor_C620::AliveCheck(uint16_t Period)
  **********************************************************************************************************************/
 void Class_DJI_Motor_C620::Control()
 {
+    int16_t Out = 0;
+
     switch(DJI_Motor_Control_Method)
     {
         case (DJI_Motor_Control_Method_OPENLOOP):
@@ -245,17 +277,25 @@ void Class_DJI_Motor_C620::Control()
         }
         case (DJI_Motor_Control_Method_ANGLE):
         {
-            PID_Angle.Set_Target(Target_Angle);
-            PID_Angle.Set_Actual(Data.Now_Angle);
-            PID_Angle.Calculate();
-
-            Target_Omega = PID_Angle.Get_Out();
+            //角度环分频执行, 速度环饱和时角度环停止积分
+            Cascade_Angle.Set_Target(Target_Angle);
+            Cascade_Angle.Set_Actual_Outer(Data.Now_Angle);
+            Cascade_Angle.Set_Actual_Inner(Data.Now_Omega);
+            Cascade_Angle.Calculate();
 
-            PID_Omega.Set_Target(Target_Omega);
-            PID_Omega.Set_Actual(Data.Now_Omega);
-            PID_Omega.Calculate();
+            Target_Omega = Cascade_Angle.Get_Inner_Target();
+            Out_Current = Cascade_Angle.Get_Out();
+            break;
+        }
+        case (DJI_Motor_Control_Method_OMEGA_Q31):
+        {
+            //转速反馈原始值直接定标, 输出直接为电流指令
+            PID_Omega_Q31.Set_Target(PID_Omega_Q31.Scale_Error.To_Q31(Target_Omega * Omega_To_RPM));
+            PID_Omega_Q31.Set_Actual(PID_Omega_Q31.Scale_Error.Raw_To_Q31(Omega_Raw));
+            PID_Omega_Q31.Calculate();
 
-            Out_Current = PID_Omega.Get_Out();
+            Out = (int16_t)PID_Omega_Q31.Scale_Out.Q31_To_Raw(PID_Omega_Q31.Get_Out());
+            Out_Current = (float)Out * Current_Conversion;
             break;
         }
         default:
@@ -265,10 +305,12 @@ void Class_DJI_Motor_C620::Control()
         }
     }
 
-    /* 输出换算 */
-    int16_t Out = this->Out_Current / this->Current_Conversion;
+    /* 输出换算（定点控制已得到电流指令） */
+    if (DJI_Motor_Control_Method != DJI_Motor_Control_Method_OMEGA_Q31)
+    {
+        Out = this->Out_Current / this->Current_Conversion;
+    }
 
     /* CAN-TX缓冲区填充 */
-    CAN_Tx_Data[0] = (int16_t) Out >> 8;
-    CAN_Tx_Data[1] = (int16_t) Out;
+    Math_Store_BE<int16_t>(CAN_Tx_Data, Out);
 }
@@ -0,0 +1,42 @@
+/**
+ * @file    User_Crc.h
+ * @brief   STM32硬件CRC外设封装（CRC-32/MPEG-2）
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+#ifndef __HAL_USER_CRC_H
+#define __HAL_USER_CRC_H
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "stm32f4xx_hal.h"
+#include "Crc.h"
+
+/* 类定义 --------------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   硬件CRC32计算类
+ *          STM32F4 CRC外设固定为 多项式 0x04C11DB7、初值 0xFFFFFFFF、高位在前、每次输入32位字，
+ *          按字节流大端装字后输入，结果与 Class_CRC32_MPEG2 相同；不足4字节的尾部在 Finish 中由软件查表完成
+ *          外设只有一个寄存器，同一时刻只能进行一路增量计算（Begin 会复位外设）
+ */
+class Class_CRC32_HW
+{
+public:
+    /* 函数 */
+    void Begin();
+    void Update(const uint8_t * __Buffer, uint32_t __Length);
+    uint32_t Finish();
+
+    static uint32_t Calculate(const uint8_t * __Buffer, uint32_t __Length);
+protected:
+    /* 内部变量 */
+    uint8_t Pending[4];                     /*!< 未凑满一个字的字节 */
+    uint8_t Pending_Length = 0U;            /*!< 未凑满一个字的字节数 */
+};
+
+/* 函数声明 ------------------------------------------------------------------------------------------------------------*/
+void CRC_HW_Init(void);
+
+#endif  /* HAL_User_Crc.h */
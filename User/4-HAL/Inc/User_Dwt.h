@@ -0,0 +1,41 @@
+/**
+ * @file    User_Dwt.h
+ * @brief   DWT周期计数器封装（用于代码执行周期测量）
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+#ifndef __HAL_USER_DWT_H
+#define __HAL_USER_DWT_H
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "stm32f4xx_hal.h"
+
+/* 函数声明 ------------------------------------------------------------------------------------------------------------*/
+void DWT_Init(void);
+
+/* 接口函数定义 --------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief   获取DWT周期计数值
+ *
+ * @return  uint32_t    当前CPU周期计数值（32位回绕, 168MHz下约25.5s一周）
+ */
+inline uint32_t DWT_Get_Cycle(void)
+{
+    return (DWT->CYCCNT);
+}
+
+/**
+ * @brief   计算两次周期计数值间隔（自动处理32位回绕）
+ *
+ * @param   Start       起始周期计数值
+ * @return  uint32_t    从Start到当前经过的CPU周期数
+ */
+inline uint32_t DWT_Get_Elapsed(uint32_t Start)
+{
+    return (DWT->CYCCNT - Start);
+}
+
+#endif  /* HAL_User_Dwt.h */
@@ -0,0 +1,21 @@
+/**
+ * @file    User_Time.h
+ * @brief   自由计数微秒时基（DWT周期计数器软件扩展，用于帧时间戳与时钟同步）
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+#ifndef __HAL_USER_TIME_H
+#define __HAL_USER_TIME_H
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "User_Dwt.h"
+
+/* 函数声明 ------------------------------------------------------------------------------------------------------------*/
+void Time_Init(void);
+void Time_Update(void);
+uint32_t Time_Get_us(void);
+
+#endif  /* HAL_User_Time.h */
@@ -4,7 +4,7 @@
  *
  * @author  Tang-yucheng (QQ: 3143961287)
  * @date    2024-2-14
- * @version v1.0
+ * @version v1.2
  */
 
 #ifndef __HAL_USER_UART_H
@@ -18,7 +18,7 @@
 
 /* 宏定义 -------------------------------------------------------------------------------------------------------------*/
 #define UART_TX_BUFFER_SIZE            256         // 串口TX缓冲区字节长度
-#define UART_RX_BUFFER_SIZE            256         // 串口RX缓冲区字节长度
+#define UART_RX_BUFFER_SIZE            256         // 串口RX缓冲区字节长度（环形接收时需为2的幂）
 
 /* 结构体定义 ----------------------------------------------------------------------------------------------------------*/
 /**
@@ -40,5 +40,9 @@ extern Struct_UART_Manage_Object UART3_Manage_Object;
 void UART_Init(Struct_UART_Manage_Object * UART_Mangae_Obj, uint16_t Rx_Data_Size);
 HAL_StatusTypeDef UART_Send(Struct_UART_Manage_Object * UART_Mangae_Obj, uint8_t * Data, uint16_t Length);
 HAL_StatusTypeDef UART_ReceiveToIdle_DMA(Struct_UART_Manage_Object * UART_Mangae_Obj);
+HAL_StatusTypeDef UART_ReceiveToRing_DMA(Struct_UART_Manage_Object * UART_Mangae_Obj);
+uint16_t UART_Get_Rx_Write_Index(Struct_UART_Manage_Object * UART_Mangae_Obj);
+uint32_t UART_Get_Baud_Rate_Actual(Struct_UART_Manage_Object * UART_Mangae_Obj, uint32_t Baud_Rate);
+HAL_StatusTypeDef UART_Set_Baud_Rate(Struct_UART_Manage_Object * UART_Mangae_Obj, uint32_t Baud_Rate);
 
 #endif  /* HAL_User_Uart.h */
@@ -0,0 +1,90 @@
+/**
+ * @file    User_Crc.cpp
+ * @brief   STM32硬件CRC外设封装（CRC-32/MPEG-2）
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "User_Crc.h"
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/***********************************************************************************************************************
+ * @brief   硬件CRC外设初始化（使能时钟）
+ **********************************************************************************************************************/
+void CRC_HW_Init(void)
+{
+    __HAL_RCC_CRC_CLK_ENABLE();
+}
+
+/***********************************************************************************************************************
+ * @brief   开始一次增量计算（复位外设）
+ **********************************************************************************************************************/
+void Class_CRC32_HW::Begin()
+{
+    CRC->CR = CRC_CR_RESET;
+    this->Pending_Length = 0U;
+}
+
+/***********************************************************************************************************************
+ * @brief   输入一段数据（上一段遗留的不足一字的字节与本段拼接后输入外设）
+ *
+ * @param   __Buffer    数据地址（可非对齐）
+ * @param   __Length    字节数
+ **********************************************************************************************************************/
+void Class_CRC32_HW::Update(const uint8_t * __Buffer, uint32_t __Length)
+{
+    /* 补齐上一段遗留的字 */
+    if (this->Pending_Length != 0U)
+    {
+        while (this->Pending_Length < 4U && __Length > 0U)
+        {
+            this->Pending[this->Pending_Length++] = *__Buffer++;
+            __Length--;
+        }
+        if (this->Pending_Length < 4U)
+        {
+            return;
+        }
+        CRC->DR = Math_Load_BE<uint32_t>(this->Pending);
+        this->Pending_Length = 0U;
+    }
+
+    for (; __Length >= 4U; __Length -= 4U, __Buffer += 4U)
+    {
+        CRC->DR = Math_Load_BE<uint32_t>(__Buffer);
+    }
+
+    /* 遗留尾部 */
+    memcpy(this->Pending, __Buffer, __Length);
+    this->Pending_Length = __Length;
+}
+
+/***********************************************************************************************************************
+ * @brief   获取结果（不改变外设状态，可继续 Update）
+ *
+ * @return  uint32_t    CRC校验值
+ **********************************************************************************************************************/
+uint32_t Class_CRC32_HW::Finish()
+{
+    return (Class_CRC32_MPEG2::Continue(CRC->DR, this->Pending, this->Pending_Length));
+}
+
+/***********************************************************************************************************************
+ * @brief   整帧计算
+ *
+ * @param   __Buffer    数据地址（可非对齐）
+ * @param   __Length    字节数
+ * @return  uint32_t    CRC校验值
+ **********************************************************************************************************************/
+uint32_t Class_CRC32_HW::Calculate(const uint8_t * __Buffer, uint32_t __Length)
+{
+    CRC->CR = CRC_CR_RESET;
+    for (; __Length >= 4U; __Length -= 4U, __Buffer += 4U)
+    {
+        CRC->DR = Math_Load_BE<uint32_t>(__Buffer);
+    }
+    return (Class_CRC32_MPEG2::Continue(CRC->DR, __Buffer, __Length));
+}
@@ -0,0 +1,26 @@
+/**
+ * @file    User_Dwt.cpp
+ * @brief   DWT周期计数器封装（用于代码执行周期测量）
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "User_Dwt.h"
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/***********************************************************************************************************************
+ * @brief   DWT周期计数器初始化
+ * @note    测量方法: uint32_t start = DWT_Get_Cycle(); ...被测代码...; uint32_t cycles = DWT_Get_Elapsed(start);
+ **********************************************************************************************************************/
+void DWT_Init(void)
+{
+    /* 使能DWT/ITM跟踪单元 */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+
+    /* 周期计数器清零并使能 */
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
@@ -0,0 +1,63 @@
+/**
+ * @file    User_Time.cpp
+ * @brief   自由计数微秒时基（DWT周期计数器软件扩展，用于帧时间戳与时钟同步）
+ *
+ * @author  Tang-yucheng (QQ: 3143961287)
+ * @date    2026-10-17
+ * @version v1.0
+ */
+
+/* 头文件引用 ----------------------------------------------------------------------------------------------------------*/
+#include "User_Time.h"
+
+/* 全局变量创建 --------------------------------------------------------------------------------------------------------*/
+static uint32_t Time_Base = 0U;             /* 基准时刻 (us) */
+static uint32_t Time_Base_Cycle = 0U;       /* 基准时刻对应的DWT周期计数值 */
+static uint32_t Time_Cycle_Per_us = 168U;   /* 每微秒CPU周期数 */
+
+/* 函数定义 ------------------------------------------------------------------------------------------------------------*/
+/***********************************************************************************************************************
+ * @brief   微秒时基初始化
+ * @note    需在 DWT_Init 之后调用；TIM2~5 均用作编码器，没有空闲的32位定时器，因此以DWT周期计数器为时基，
+ *          其168MHz下约25.5s回绕一次，由 Time_Update 周期性地把已经过的整微秒数并入32位微秒基准
+ **********************************************************************************************************************/
+void Time_Init(void)
+{
+    Time_Cycle_Per_us = SystemCoreClock / 1000000U;
+    Time_Base_Cycle = DWT_Get_Cycle();
+    Time_Base = 0U;
+}
+
+/***********************************************************************************************************************
+ * @brief   微秒时基更新
+ * @note    调用间隔需小于DWT回绕周期（在TIM6系统心跳中调用）；只并入整微秒对应的周期数，余数留待下次，长期无累积误差
+ **********************************************************************************************************************/
+void Time_Update(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    uint32_t elapsed = DWT_Get_Elapsed(Time_Base_Cycle) / Time_Cycle_Per_us;
+
+    Time_Base += elapsed;
+    Time_Base_Cycle += elapsed * Time_Cycle_Per_us;
+    __set_PRIMASK(primask);
+}
+
+/***********************************************************************************************************************
+ * @brief   获取当前时刻
+ * @note    可在任意中断中调用（基准与周期计数值在临界区内成对读取）
+ *
+ * @return  uint32_t    上电以来的微秒数（32位回绕，约71.6min一周，时刻之差按 (int32_t) (b - a) 计算）
+ **********************************************************************************************************************/
+uint32_t Time_Get_us(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    uint32_t time = Time_Base + DWT_Get_Elapsed(Time_Base_Cycle) / Time_Cycle_Per_us;
+
+    __set_PRIMASK(primask);
+
+    return (time);
+}
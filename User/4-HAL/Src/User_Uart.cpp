@@ -4,7 +4,7 @@
  *
  * @author  Tang-yucheng (QQ: 3143961287)
  * @date    2024-2-14
- * @version v1.0
+ * @version v1.2
  */
 
 /* 头文件引用 ---------------------------------------------------------------------------------------------------------*/
@@ -58,3 +58,95 @@ HAL_StatusTypeDef UART_ReceiveToIdle_DMA(Struct_UART_Manage_Object * UART_Mangae
 	
 	return hal_status;
 }
+
+/***********************************************************************************************************************
+ * @brief   UART开启环形DMA接收
+ * @note    RX DMA需配置为 DMA_CIRCULAR，开启后DMA持续循环写入 Rx_Buffer，无需重新开启；
+ *          半满、全满、IDLE事件均触发 HAL_UARTEx_RxEventCallback，仅在出错（DMA被中止）后需再次调用
+ *
+ * @param   UART_Manage_Obj     UART处理结构体指针
+ * @return  HAL_StatusTypeDef   执行结果
+ **********************************************************************************************************************/
+HAL_StatusTypeDef UART_ReceiveToRing_DMA(Struct_UART_Manage_Object * UART_Mangae_Obj)
+{
+    static_assert((UART_RX_BUFFER_SIZE & (UART_RX_BUFFER_SIZE - 1)) == 0, "UART_RX_BUFFER_SIZE must be a power of 2");
+
+    UART_Mangae_Obj->Rx_Data_Size = UART_RX_BUFFER_SIZE;
+
+    return (HAL_UARTEx_ReceiveToIdle_DMA(UART_Mangae_Obj->huart, UART_Mangae_Obj->Rx_Buffer, UART_RX_BUFFER_SIZE));
+}
+
+/***********************************************************************************************************************
+ * @brief   获取环形DMA接收写指针
+ *
+ * @param   UART_Manage_Obj     UART处理结构体指针
+ * @return  uint16_t            下一个待写入字节的下标
+ **********************************************************************************************************************/
+uint16_t UART_Get_Rx_Write_Index(Struct_UART_Manage_Object * UART_Mangae_Obj)
+{
+    return ((UART_RX_BUFFER_SIZE - __HAL_DMA_GET_COUNTER(UART_Mangae_Obj->huart->hdmarx)) & (UART_RX_BUFFER_SIZE - 1));
+}
+
+/***********************************************************************************************************************
+ * @brief   获取UART时钟频率
+ * @note    USART1/USART6 位于APB2，其余位于APB1
+ *
+ * @param   UART_Manage_Obj     UART处理结构体指针
+ * @return  uint32_t            时钟频率 (Hz)
+ **********************************************************************************************************************/
+static uint32_t UART_Get_Clock(Struct_UART_Manage_Object * UART_Mangae_Obj)
+{
+    USART_TypeDef * instance = UART_Mangae_Obj->huart->Instance;
+
+    return ((instance == USART1 || instance == USART6) ? HAL_RCC_GetPCLK2Freq() : HAL_RCC_GetPCLK1Freq());
+}
+
+/***********************************************************************************************************************
+ * @brief   获取波特率的实际可达值
+ * @note    16倍过采样，BRR = 时钟频率 / 波特率（四舍五入，低4位为小数），BRR不小于16，即最高 时钟频率 / 16
+ *          （APB1 42MHz 时为 2.625Mbaud）
+ *
+ * @param   UART_Manage_Obj     UART处理结构体指针
+ * @param   Baud_Rate           期望波特率 (bit/s)
+ * @return  uint32_t            实际波特率 (bit/s)，超出范围时返回0
+ **********************************************************************************************************************/
+uint32_t UART_Get_Baud_Rate_Actual(Struct_UART_Manage_Object * UART_Mangae_Obj, uint32_t Baud_Rate)
+{
+    uint32_t clock = UART_Get_Clock(UART_Mangae_Obj);
+    uint32_t brr = (Baud_Rate == 0U) ? 0U : ((clock + Baud_Rate / 2U) / Baud_Rate);
+
+    if (brr < 16U || brr > 0xFFFFU)
+    {
+        return (0U);
+    }
+
+    return (clock / brr);
+}
+
+/***********************************************************************************************************************
+ * @brief   运行时切换波特率
+ * @note    中止收发后改写BRR并重新开启环形DMA接收，发送中的数据会丢失，需在发送完成后调用；
+ *          仅改写BRR，不经过 HAL_UART_Init，DMA与中断配置保持不变
+ *
+ * @param   UART_Manage_Obj     UART处理结构体指针
+ * @param   Baud_Rate           波特率 (bit/s)
+ * @return  HAL_StatusTypeDef   执行结果（超出范围时返回 HAL_ERROR 且不切换）
+ **********************************************************************************************************************/
+HAL_StatusTypeDef UART_Set_Baud_Rate(Struct_UART_Manage_Object * UART_Mangae_Obj, uint32_t Baud_Rate)
+{
+    UART_HandleTypeDef * huart = UART_Mangae_Obj->huart;
+
+    if (UART_Get_Baud_Rate_Actual(UART_Mangae_Obj, Baud_Rate) == 0U)
+    {
+        return (HAL_ERROR);
+    }
+
+    HAL_UART_Abort(huart);
+
+    __HAL_UART_DISABLE(huart);
+    huart->Instance->BRR = (UART_Get_Clock(UART_Mangae_Obj) + Baud_Rate / 2U) / Baud_Rate;
+    huart->Init.BaudRate = Baud_Rate;
+    __HAL_UART_ENABLE(huart);
+
+    return (UART_ReceiveToRing_DMA(UART_Mangae_Obj));
+}